@@ -25,23 +25,162 @@
 
 #include "base.h"
 #include "fixnum.h"
+#include "utils.h"
+
+/* above this number of limbs, the conversion to a base that is not a
+ * power of two is split in two halves (divide and conquer), below it
+ * the number is converted by repeatedly dividing by the largest power
+ * of the base that fits in 63 bits (chunked) */
+#define BASE_DC_LIMBS	16
+
+/* the largest power of the base that fits in 63 bits, the reciprocal
+ * is used to split a chunk in digits in constant time */
+typedef struct base_chunk_s {
+	uint64_t power, reciprocal;
+	uint8_t digits, bits;
+} base_chunk_t;
 
 void base_init_scratch(base_scratch_t *bs, uint8_t *scratch, size_t max_limbs) {
 	assert(bs && scratch && max_limbs >= 2);
 	bs->divisor_limbs = scratch;
 	bs->data_limbs = scratch + max_limbs;
 	fixnum_scratch_init(&bs->s, scratch + 2*max_limbs, max_limbs, scratch + 3*max_limbs, max_limbs);
+	bs->power_limbs = scratch + 4*max_limbs;
+	bs->stack_limbs = scratch + 5*max_limbs;
 	bs->max_limbs = max_limbs;
 }
 
+static void base_chunk_init(base_chunk_t *c, const fixnum_multiplier16_t *m) {
+	assert(c && m && m->value > 1);
+	c->power = 1;
+	c->digits = 0;
+	while (c->power <= (UINT64_MAX>>1)/m->value) {
+		c->power *= m->value;
+		c->digits++;
+	}
+	c->reciprocal = UINT64_MAX/m->value;
+	c->bits = 0;
+	while (c->power>>c->bits) c->bits++;
+}
+
+/* split the least significant digit off of *v in constant time, the
+ * estimate of the quotient using the reciprocal is at most 2 too small */
+static uint16_t base_chunk_split(uint64_t *v, const fixnum_multiplier16_t *m,
+		const base_chunk_t *c) {
+	uint64_t q = ((unsigned __int128)*v*c->reciprocal)>>64;
+	uint64_t r = *v - q*m->value, ge;
+
+	for (int i = 0; i < 2; i++) {
+		/* constant time version of:
+		 * if (r >= m->value) { q++; r -= m->value; } */
+		ge = 1 - ((r - m->value)>>63);
+		q += ge;
+		r -= m->value&(-ge);
+	}
+
+	*v = q;
+
+	return r;
+}
+
+static uint64_t base_peek_uint64(const fixnum_t *f) {
+	assert(f->no_limbs <= 8);
+	uint64_t ret = 0;
+
+	for (size_t i = 0; i < f->no_limbs; i++)
+		ret = (ret<<8)|f->limbs[i];
+
+	return ret;
+}
+
+/* drop the most significant limbs of f that are known to be zero, the
+ * number of limbs only depends on public information (the size of the
+ * input and the log2 of the divisors), so this is constant time */
+static void base_narrow(fixnum_t *f, size_t bits) {
+	size_t no_limbs = (bits + 7)>>3;
+	assert(no_limbs <= f->no_limbs);
+	f->limbs += f->no_limbs - no_limbs;
+	f->no_limbs = no_limbs;
+}
+
+static void base_encode_chunked(uint16_t *out, size_t out_size,
+		const fixnum_multiplier16_t *m, fixnum_t *f,
+		base_scratch_t *bs, const base_chunk_t *c) {
+	fixnum_divisor_t d;
+	uint64_t v;
+
+	while (f->no_limbs > 8 && out_size > 0) {
+		fixnum_divisor_init_from_uint64(&d, c->power,
+				bs->divisor_limbs, f->no_limbs);
+		v = fixnum_div64(f, &d, &bs->s);
+		base_narrow(f, (f->no_limbs<<3) - d.p.log2);
+		for (int i = 0; i < c->digits && out_size > 0; i++)
+			out[--out_size] = base_chunk_split(&v, m, c);
+	}
+
+	if (!out_size) return;
+
+	v = base_peek_uint64(f);
+	while (out_size > 0) out[--out_size] = base_chunk_split(&v, m, c);
+	wipememory(&v, sizeof(v));
+}
+
+static void base_encode_dc(uint16_t *out, size_t out_size,
+		const fixnum_multiplier16_t *m, fixnum_t *f,
+		base_scratch_t *bs, const base_chunk_t *c, uint8_t *stack) {
+	size_t chunks = (out_size + c->digits - 1)/c->digits;
+	size_t low_chunks = (f->no_limbs<<2)/c->bits, low;
+	uint64_t carry = 0;
+	fixnum_divisor_t d;
+	fixnum_t p, r;
+
+	if (low_chunks > chunks>>1) low_chunks = chunks>>1;
+
+	if (f->no_limbs <= BASE_DC_LIMBS || !low_chunks) {
+		base_encode_chunked(out, out_size, m, f, bs, c);
+		return;
+	}
+
+	/* split f in f/m^low and f%m^low, m^low has at most half
+	 * the bits of f and low is a multiple of the number of
+	 * digits in a chunk, so that the lower half is converted
+	 * in whole chunks */
+	low = low_chunks*c->digits;
+	fixnum_init_uint16(&p, bs->power_limbs, f->no_limbs, 1);
+	for (size_t i = 0; i < low_chunks; i++)
+		carry |= fixnum_mul64(&p, c->power);
+	assert(!carry);
+
+	fixnum_divisor_init_from_fixnum(&d, &p, bs->divisor_limbs, f->no_limbs);
+	fixnum_init(&r, stack, (d.p.log2>>3) + 1);
+	assert(stack + r.no_limbs <= bs->stack_limbs + bs->max_limbs);
+	fixnum_divmod(f, &d, &bs->s, &r);
+	base_narrow(f, (f->no_limbs<<3) - d.p.log2);
+
+	base_encode_dc(out, out_size - low, m, f, bs, c, stack + r.no_limbs);
+	base_encode_dc(out + out_size - low, low, m, &r, bs, c, stack + r.no_limbs);
+
+	wipememory(stack, r.no_limbs);
+}
+
 static void base_encode_fixnum_destructive(uint16_t *out, size_t out_size,
                 const fixnum_multiplier16_t *m,
                 fixnum_t *in, base_scratch_t *bs, uint8_t shift) {
-	fixnum_divisor_t d;
-	fixnum_divisor_init_from_multiplier16(&d, m,  bs->divisor_limbs, in->no_limbs);
 	fixnum_shr(in, shift);
-	for (int i = out_size - 1; i >= 0; i--)
-		out[i] = fixnum_div(in, &d, &bs->s, 0);
+
+	if (m->p.pure) {
+		fixnum_divisor_t d;
+		fixnum_divisor_init_from_multiplier16(&d, m,  bs->divisor_limbs, in->no_limbs);
+		for (int i = out_size - 1; i >= 0; i--)
+			out[i] = fixnum_div(in, &d, &bs->s, 0);
+	} else {
+		base_chunk_t c;
+		fixnum_t f = *in;
+
+		base_chunk_init(&c, m);
+		base_encode_dc(out, out_size, m, &f, bs, &c, bs->stack_limbs);
+		fixnum_set_pattern(in, PATTERN_ZERO);
+	}
 }
 
 void base_encode_buffer(uint16_t *out, size_t out_size,
@@ -75,18 +214,46 @@ int base_decode_fixnum(fixnum_t *d, const fixnum_multiplier16_t *m,
 	int i = 0;
 
 	fixnum_set_pattern(d, PATTERN_ZERO);
-	goto start;
 
-	do {
-		if (fixnum_mul16(d, m)) return 1; // overflow
-	start:
-		assert(in[i] < m->value);
-		fixnum_add_uint16(d, in[i]);
-	} while (++i < in_size);
+	if (m->p.pure) {
+		goto start;
+
+		do {
+			if (fixnum_mul16(d, m)) return 1; // overflow
+		start:
+			assert(in[i] < m->value);
+			fixnum_add_uint16(d, in[i]);
+		} while (++i < in_size);
+	} else {
+		/* accumulate chunks of digits in a native integer, so
+		 * that the fixnum only needs to be multiplied once per
+		 * chunk, the first chunk takes the leftover digits */
+		base_chunk_t c;
+		uint64_t acc = 0, power = 1;
+		size_t len;
+
+		base_chunk_init(&c, m);
+		len = in_size%c.digits;
+		if (!len) len = c.digits;
+
+		while (i < in_size) {
+			acc = 0;
+			for (size_t j = 0; j < len; j++, i++) {
+				assert(in[i] < m->value);
+				acc = acc*m->value + in[i];
+			}
+			if (fixnum_mul64(d, power) || fixnum_add_uint64(d, acc)) {
+				wipememory(&acc, sizeof(acc));
+				return 1; // overflow
+			}
+			power = c.power;
+			len = c.digits;
+		}
+
+		wipememory(&acc, sizeof(acc));
+	}
 
 	fixnum_shl(d, shift);
 
 	return 0; // ok
 }
-
-
@@ -24,9 +24,15 @@
 
 #include "fixnum.h"
 
+/* the scratch space must be able to hold six fixnums of
+ * max_limbs limbs: divisor, data, the two scratch fixnums
+ * used for division, a power of the base and a stack for
+ * the remainders of the divide and conquer conversion */
+#define BASE_SCRATCH_SIZE(max_limbs)	(6*(max_limbs))
+
 typedef struct base_scratch_s {
 	fixnum_scratch_t s;
-	uint8_t *divisor_limbs, *data_limbs;
+	uint8_t *divisor_limbs, *data_limbs, *power_limbs, *stack_limbs;
 	size_t max_limbs;
 } base_scratch_t;
 
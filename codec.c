@@ -18,67 +18,110 @@
  * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
 #include "codec.h"
 #include "utils.h"
 #include "verbose.h"
 #include "shashtbl.h"
 #include "base.h"
 #include "wordlists.h"
+#include "nfkd.h"
+#include "pbkdf2.h"
+
+/* store the message of an error in the input in error (DISPLAYLINE bytes)
+ * and return -1 */
+static int codec_error(char *error, const char *format, ...) {
+	va_list ap;
+	va_start(ap, format);
+	vsnprintf(error, DISPLAYLINE, format, ap);
+	va_end(ap);
+
+	return -1;
+}
 
-static void base16_encode(uint8_t *out, size_t *n,
+static int base16_encode(uint8_t *out, size_t *n,
 		lrcipher_t *l, uint16_t *scratch,
 		size_t scratch_size, const char *in, wordlist_t *w,
-		const char *seed, size_t seed_len, base_scratch_t *bs) {
+		const char *seed, size_t seed_len, base_scratch_t *bs, char *error) {
 	size_t no_input = 0;
 	const char *cur = in;
+	int idx;
 
 	while (*cur) {
-		if (no_input == scratch_size)
-			FATAL("plaintext is too large, maximum size "
-					"is %ld bytes", scratch_size>>1);
+		if (no_input == scratch_size>>1)
+			return codec_error(error, "plaintext is too large, maximum "
+					"size is %ld bytes", scratch_size>>2);
 
-		scratch[no_input++] = wordlist_search(w, cur, &cur);
+		if ((idx = wordlist_search(w, cur, &cur, error)) < 0) return -1;
+		scratch[no_input++] = idx;
 	}
 
         if (no_input%4)
-		FATAL("size of plaintext must be multiple of 16 bits");
+		return codec_error(error, "size of plaintext must be multiple "
+				"of 16 bits");
         if (no_input>>1 < 16)
-		FATAL("size of plaintext must be at least 16 bytes");
+		return codec_error(error, "size of plaintext must be at least "
+				"16 bytes");
 
 	base_decode_buffer(out, no_input>>1, &w->m,
 			scratch, no_input, 0);
 
 	*n = no_input>>1;
+
+	return 0;
 }
 
-static void base16_decode(char *out, size_t out_size, lrcipher_t *l,
+static int base16_decode(char *out, size_t out_size, lrcipher_t *l,
 		uint16_t *scratch, size_t scratch_size,
-		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs) {
+		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs, char *error) {
 	sbuf_t sbuf = { .buf = out, .size = out_size };
 
 	sbufprintf_base16(&sbuf, in, n);
+
+	return 0;
 }
 
-static void bip39_encode(uint8_t *out, size_t *n,
+static int bip39_encode(uint8_t *out, size_t *n,
 		lrcipher_t *l, uint16_t *scratch,
 		size_t scratch_size, const char *in, wordlist_t *w,
-		const char *seed, size_t seed_len, base_scratch_t *bs) {
+		const char *seed, size_t seed_len, base_scratch_t *bs, char *error) {
 	size_t no_input = 0;
 	uint8_t *s = (uint8_t*)scratch; // (ab)use scratch to store sha256 checksum
+	char normalized[LINE<<1];
+	sbuf_t sbuf = { .buf = normalized, .size = sizeof(normalized) };
+	const char *cur = normalized;
+	int idx = 0;
 
-	assert(scratch_size >= 16); // space for sha256 hash
-	assert(WORDS >= 24);
+	assert(scratch_size >= 24); // space for sha256 hash and the words
 
-	while (*in) {
-		if (no_input == 24) FATAL("input too big, max 24 words supported");
+	// the NFKD normalized input of a line fits in normalized
+	if (strlen(in) >= LINE)
+		return codec_error(error, "input too big, max 24 words supported");
 
-		scratch[no_input++] = wordlist_search(w, in, &in);
-	}
+	// the wordlists are NFKD normalized, so the input should be too
+	sbufprintf_nfkd(&sbuf, in);
 
-	if (no_input < 12 || no_input > 24 || no_input%3) {
-		FATAL("number of words %ld not supported, BIP39 only supports mnemonics of 12, 15, 18, 21 and 24 words", no_input);
+	while (*cur) {
+		if (no_input == 24) {
+			idx = codec_error(error, "input too big, max 24 words "
+					"supported");
+			break;
+		}
+
+		if ((idx = wordlist_search(w, cur, &cur, error)) < 0) break;
+		scratch[no_input++] = idx;
 	}
 
+	wipememory(normalized, sizeof(normalized));
+	if (idx < 0) return -1;
+
+	if (no_input < 12 || no_input > 24 || no_input%3)
+		return codec_error(error, "number of words %ld not supported, BIP39 "
+				"only supports mnemonics of 12, 15, 18, 21 "
+				"and 24 words", no_input);
+
 	base_decode_buffer(out, 4*no_input/3 + 1, &w->m,
 			scratch, no_input, 8 - no_input/3);
 
@@ -88,23 +131,27 @@ static void bip39_encode(uint8_t *out, size_t *n,
 
 	uint8_t checksum = (*s)&(0xff<<(8 - no_input/3));
 
-	if (checksum != *(out + *n)) FATAL("invalid mnemonic, checksum does not match");
+	if (checksum != *(out + *n))
+		return codec_error(error, "invalid mnemonic, checksum does not "
+				"match");
+
+	return 0;
 }
 
-static void bip39_decode(char *out, size_t out_size, lrcipher_t *l,
+static int bip39_decode(char *out, size_t out_size, lrcipher_t *l,
 		uint16_t *scratch, size_t scratch_size,
-		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs) {
+		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs, char *error) {
 
 	if (n < 16 || n > 32 || n%4 != 0)
-		FATAL("length of plaintext is not suitable for BIP39 "
-				"entropy, lenght is %ld and it should "
+		return codec_error(error, "length of plaintext is not suitable for "
+				"BIP39 entropy, lenght is %ld and it should "
 				"be 16, 20, 24, 28, or 32 bytes", n);
 
 	sbuf_t sbuf = { .buf = out, .size = out_size };
 
-	assert(BLOCKS >= 32); /* this means there is space for */
-			      /* the sha256 hash of the plaintext */
-			      /* after the plaintext */
+	assert(scratch_size>>2 >= 64); /* this means there is space */
+				       /* for the sha256 hash of the */
+				       /* plaintext after the plaintext */
 
 	// calculate the checksum
 	hash(((uint8_t*)in) + n, n, in, n, HASH_SHA256);
@@ -119,221 +166,351 @@ start:
 		sbufwordlist_dereference(w, &sbuf, scratch[k]);
 	}
 
+	return 0;
 }
 
-#if 0
-void fixnum_printf(const fixnum_t *f) {
-        char c[2];
-        for (int nibble = (f->no_limbs<<1) - 1; nibble >= 0; nibble--) {
-                memset(c, 0, sizeof(c));
-                wordlist_dereference(&wordlist_base16, c, sizeof(c), fixnum_peek(f, nibble<<2, 4));
-                putchar(c[0]);
-        }
-}
+/* the BIP39 seed is derived from the NFKD normalized mnemonic with
+ * PBKDF2-HMAC-SHA512, with 2048 iterations and salt "mnemonic" followed
+ * by the (empty) BIP39 passphrase */
+static int bip39seed_decode(char *out, size_t out_size, lrcipher_t *l,
+		uint16_t *scratch, size_t scratch_size,
+		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs, char *error) {
+	char mnemonic[LINE] = { }, normalized[LINE<<1];
+	sbuf_t sbuf = { .buf = normalized, .size = sizeof(normalized) };
+	uint8_t seed[64];
+
+	if (bip39_decode(mnemonic, sizeof(mnemonic), l, scratch, scratch_size,
+			in, n, w, bs, error)) return -1;
+	sbufprintf_nfkd(&sbuf, mnemonic);
 
-void fixnum_show(const fixnum_t *f, const char *name) {
-        printf("%s: ", name);
-        fixnum_printf(f);
-        printf("\n");
+	pbkdf2(seed, normalized, sbuf.len, "mnemonic", 8,
+			2048, sizeof(seed), HASH_SHA512);
+
+	sbuf.buf = out;
+	sbuf.size = out_size;
+	sbuf.len = 0;
+	sbufprintf_base16(&sbuf, seed, sizeof(seed));
+
+	wipememory(mnemonic, sizeof(mnemonic));
+	wipememory(normalized, sizeof(normalized));
+	wipememory(seed, sizeof(seed));
+
+	return 0;
 }
 
-void fixnum_divisor_show(const fixnum_divisor_t *d, const char *name) {
-        printf("log2=%d pure=%d ", d->p.log2, d->p.pure);
-        fixnum_show(&d->max_left_shift, "mls");
+/* the number of diceware words that can be stored in a secret of n
+ * bytes is the largest number of words for which 7776^words < 2^(8n),
+ * the maximum value is 7776^words - 1; find the smallest n (n >= 16,
+ * n is even and n <= max_n) that can store want words, store its maximum
+ * value in max (n bytes) and return its number of words, which is less
+ * than want if not even a secret of max_n bytes can store them */
+static size_t diceware_size(uint8_t *max, size_t *n, size_t want,
+		size_t max_n) {
+	uint8_t limbs[max_n], next_limbs[max_n];
+	fixnum_multiplier16_t m;
+	fixnum_t p, next, f;
+	size_t words = 0;
+
+	fixnum_multiplier16_init(&m, 7776);
+	fixnum_init_uint16(&p, limbs, max_n, 1);
+	fixnum_init(&next, next_limbs, max_n);
+
+	for (*n = 16; ; *n += 2) {
+		// add words as long as 7776^(words + 1) < 2^(8n)
+		for (;;) {
+			fixnum_set_fixnum(&next, &p);
+			if (fixnum_mul16(&next, &m) ||
+				!memzero(next.limbs, max_n - *n)) break;
+			fixnum_set_fixnum(&p, &next);
+			words++;
+		}
+		if (words >= want || *n + 2 > max_n) break;
+	}
+
+	fixnum_init_buffer(&f, max, *n, p.limbs + max_n - *n, *n);
+	fixnum_sub_uint16(&f, 1);
+
+	return words;
 }
-#endif
 
-static void diceware_encode(uint8_t *out, size_t *n,
+static int diceware_encode(uint8_t *out, size_t *n,
 		lrcipher_t *l, uint16_t *scratch,
 		size_t scratch_size, const char *in,
 		wordlist_t *w, const char *seed, size_t seed_len,
-		base_scratch_t *bs) {
+		base_scratch_t *bs, char *error) {
 	uint8_t *s = (uint8_t*)scratch;
-	uint16_t ret;
-	size_t no_input = 0;
-	int blocks;
+	size_t no_input = 0, words, max_n = scratch_size>>2;
+	uint8_t max[max_n];
+	lrcipher_cache_t c;
 	fixnum_t f, g, h, m;
 	fixnum_divisor_t d;
-        assert(scratch_size == BLOCKS<<3);
+	int idx;
 
-	fixnum_init_uint16(&f, out, BLOCKS<<1, 1);
+	// scratch is used for 4 numbers of at most max_n bytes
+	assert(max_n >= 16);
+	assert(w && !w->m.p.pure && w->m.value == 7776);
 
 	while (*in) {
-		ret = fixnum_mul16(&f, &w->m);
-		if (ret) FATAL("too many words specified on input, maximum is %ld (based on a compile time setting of the maximum MS size of %d bytes)", no_input, BLOCKS<<4);
-
-		//fixnum_show(&f, "max");
-		//if (no_input == 24) FATAL("input too big, max 24 words supported");
+		if (no_input == scratch_size)
+			return codec_error(error, "too many words specified on "
+					"input");
 
-		scratch[no_input++] = wordlist_search(w, in, &in);
+		if ((idx = wordlist_search(w, in, &in, error)) < 0) return -1;
+		scratch[no_input++] = idx;
 	}
-	for (int i = 0; i < no_input; i++) {
-		printf("scratch[%d]=%d\n", i, scratch[i]);
-	}
-	uint16_t log2 = fixnum_calc_log2(&f);
-	printf("log2=%d\n", log2);
-	blocks = (log2+15)/16;
-	printf("bytes=%d\n", blocks*2);
-	if (blocks < 8) FATAL("not enough diceware word specified on input, w eneed at least 9 words");
-	fixnum_show(&f, "before");
-
-	// check if we have room for an extra word
-	fixnum_mul16(&f, &w->m);
-	uint16_t log2_new = fixnum_calc_log2(&f);
-	printf("log2_new=%d\n", log2_new);
-	fixnum_show(&f, "after");
-	printf("new_bytes=%d\n", (log2_new+15)/16*2);
-
-	if ((log2_new+15)/16 == blocks) FATAL("there is room for 1 more extra word, please generate an extra word randomly and add it");
-
-	*n = blocks<<1;
-	fixnum_init(&f, out, *n);
-	printf("%ld\n", *n);
 
-	base_decode_fixnum(&f, &w->m, scratch, no_input, 0);
+	// find the smallest secret that can hold the words
+	words = diceware_size(max, n, no_input, max_n);
 
-	fixnum_init(&g, s, *n);
-	fixnum_init_uint16(&h, s + (BLOCKS<<1), *n, 1);
-	fixnum_init_pattern(&m, s + (BLOCKS<<2), *n, PATTERN_ZERO);
-	fixnum_show(&h, "start");
-	printf("h.no_limbs=%ld\n", h.no_limbs);
+	if (words < no_input)
+		return codec_error(error, "too many words specified on input, "
+				"maximum is %ld (for the maximum MS size of "
+				"%ld bytes)", words, max_n);
 
-	// recompute max
-	for (int i = 0; i < no_input; i++)
-		fixnum_mul16(&h, &w->m);
+	if (*n == 16 && words > no_input)
+		return codec_error(error, "not enough diceware words specified on "
+				"input, we need at least %ld words", words);
 
-	fixnum_sub_uint16(&h, 1);
+	if (words > no_input)
+		return codec_error(error, "there is room for %ld more extra word(s), "
+				"please generate them randomly and add them",
+				words - no_input);
 
-	// check the length of the chain
+	fixnum_init(&f, out, *n);
+	if (base_decode_fixnum(&f, &w->m, scratch, no_input, 0))
+		BUG("diceware words do not fit in %ld bytes", *n);
+
+	/* the words are stored in f, the scratch space can be reused */
+	fixnum_init(&g, s, *n);
+	fixnum_init_buffer(&h, s + max_n, *n, max, *n);
+	fixnum_init_pattern(&m, s + (max_n<<1), *n, PATTERN_ZERO);
+
+	lrcipher_cache_init(&c, l);
+
+	/* a wrong passphrase will decrypt to a random value, which
+	 * is walked back (decrypted) until it is not larger than max,
+	 * so any value in the chain of encryptions of f that are
+	 * larger than max, decrypts to f, count the length of the chain,
+	 * out will contain the last value of the chain */
 	do {
-		lrcipher_execute(l, s, out, *n, 1, LRCIPHER_ENCRYPT);
-		fixnum_show(&g, "iteration");
+		lrcipher_cache_execute(&c, g.limbs, out, *n, LRCIPHER_ENCRYPT);
 		if (!fixnum_sub_fixnum(&h, &g, 0xff)) break;
-		memcpy(out, s, *n);
-		fixnum_add_fixnum(&h, &f, 0xff);
+		memcpy(out, g.limbs, *n);
+		fixnum_add_fixnum(&h, &f, 0xff); // f is the same as g
 		fixnum_add_uint16(&m, 1);
 	} while (1);
-	//printf("times=%ld\n", times);
 
-	if (!fixnum_popcnt(&m)) return;
-	printf("h.no_limbs=%ld\n", h.no_limbs);
+	if (!fixnum_popcnt(&m)) goto done;
 
+	/* select a random value from the m + 1 values in the chain,
+	 * h = 2^(8n)/(m + 1) is used to scale the random value */
+	fixnum_set_buffer(&h, max, *n);
 	fixnum_add_uint16(&m, 1);
-	fixnum_show(&m, "count");
-	fixnum_divisor_init_from_fixnum(&d, &m, s + 3*(BLOCKS<<1), *n);
-	fixnum_divisor_show(&d, "divisor");
-	printf("h.no_limbs=%ld\n", h.no_limbs);
-
-	uint16_t rest = fixnum_div(&h, &d, &bs->s, 1);
-	printf("rest=%d\n", rest);
-
-	fixnum_show(&f, "out");
-	fixnum_show(&h, "quotient");
-
-	fixnum_show(&g, "random before");
-	pbkdf2(s, "select", 6, seed, seed_len, 1, *n, HASH_SHA256);
-	fixnum_show(&g, "random after");
-
-	//fixnum_multiplier16_t p;
-	//fixnum_multiplier16_init(&p, 101);
-	//fixnum_show(&h, "quotientbeforemul");
-	//fixnum_mul16(&h, &p);
-	//fixnum_show(&h, "quotientmul");
-
+	fixnum_divisor_init_from_fixnum(&d, &m, s + 3*max_n, *n);
+	fixnum_div(&h, &d, &bs->s, 1);
 	fixnum_sub_uint16(&m, 1);
-	fixnum_show(&m, "max");
 
-	fixnum_divisor_init_from_fixnum(&d, &h, s + 3*(BLOCKS<<1), *n);
+	pbkdf2(g.limbs, "select", 6, seed, seed_len, 1, *n, HASH_SHA256);
 
-	//memcpy(h.limbs, g.limbs, *n);
-	//fixnum_div(&g, &d, &bs->s, 0);
-	//fixnum_show(&g, "random divided");
+	fixnum_divisor_init_from_fixnum(&d, &h, s + 3*max_n, *n);
 
-	goto start;
-
-	while (fixnum_sub_fixnum(&m, &g, 0xff)) {
-		FATAL("this is very unlikely");
-		fixnum_add_fixnum(&m, &g, 0xff);
-		lrcipher_execute(l, g.limbs, h.limbs, *n, 1, LRCIPHER_ENCRYPT);
-start:
+	do {
 		memcpy(h.limbs, g.limbs, *n);
 		fixnum_div(&g, &d, &bs->s, 0);
-		fixnum_show(&g, "random divided");
-	}
+		if (!fixnum_sub_fixnum(&m, &g, 0xff)) break;
 
-	while (!fixnum_sub_uint16(&g, 1)) {
-		lrcipher_execute(l, h.limbs, out, *n, 1, LRCIPHER_DECRYPT);
-		memcpy(out, h.limbs, *n);
-	}
+		/* the random value is in the leftover part of the range
+		 * that is not evenly divisible by m + 1, restore m and
+		 * derive a new random value from the rejected one */
+		fixnum_add_fixnum(&m, &g, 0xff);
+		lrcipher_cache_execute(&c, g.limbs, h.limbs, *n,
+				LRCIPHER_ENCRYPT);
+	} while (1);
+
+	/* walk back g steps from the end of the chain */
+	while (!fixnum_sub_uint16(&g, 1))
+		lrcipher_cache_execute(&c, out, out, *n, LRCIPHER_DECRYPT);
+
+done:
+	lrcipher_cache_finished(&c);
+	wipememory(s, max_n<<3);
+
+	return 0;
 }
 
-static void diceware_decode(char *out, size_t out_size, lrcipher_t *l,
+static int diceware_decode(char *out, size_t out_size, lrcipher_t *l,
 		uint16_t *scratch, size_t scratch_size,
-		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs) {
-	uint8_t *s = (uint8_t*)scratch;
-	assert(scratch_size<<1 >= n);
-	assert(bs->s.a.no_limbs >= n);
-	assert(bs->s.b.no_limbs >= n);
-	assert(n >= 16 && n%2 == 0); // as defined by slip0039 and ensured somewhere else
+		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs, char *error) {
+	uint8_t *s = (uint8_t*)scratch, max_limbs[n];
+	size_t words, size;
+	lrcipher_cache_t c;
+	fixnum_t f, max;
 
+	assert(scratch_size >= n<<1);
+	assert(n >= 16 && n%2 == 0); // as defined by slip0039 and ensured somewhere else
 	assert(w && !w->m.p.pure && w->m.value == 7776);
-	// let's find out the length of the wordlist we can completely represent
-	// temporarily limit the size of bs->s.a/b to the size of the input
-	size_t restore_limbs_a = bs->s.a.no_limbs;
-	size_t restore_limbs_b = bs->s.b.no_limbs;
-	bs->s.a.no_limbs = n;
-	fixnum_set_uint16(&bs->s.a, 1);
-	fixnum_set_fixnum(&bs->s.b, &bs->s.a);
-
-	bs->s.a.no_limbs = n;
-	bs->s.b.no_limbs = n;
-	int no_words = 0;
-	while (!fixnum_mul16(&bs->s.a, &w->m)) {
-		no_words++;
-		fixnum_set_fixnum(&bs->s.b, &bs->s.a);
-	}
-	printf("no_words=%d\n", no_words);
 
-	fixnum_show(&bs->s.b, "max+1");
-	fixnum_sub_uint16(&bs->s.b, 1);
-	fixnum_show(&bs->s.b, "max");
+	words = diceware_size(max_limbs, &size, SIZE_MAX, n);
+	assert(size == n);
+	fixnum_init_buffer(&f, s, n, in, n);
+	fixnum_init_buffer(&max, s + n, n, max_limbs, n);
 
-	fixnum_set_buffer(&bs->s.a, in, n);
-	fixnum_show(&bs->s.a, "in");
+	lrcipher_cache_init(&c, l);
 
-	// iterate until input is not larger than target
-	while (fixnum_sub_fixnum(&bs->s.b, &bs->s.a, 0xff)) {
-		fixnum_add_fixnum(&bs->s.b, &bs->s.a, 0xff);
-		lrcipher_execute(l, s, bs->s.a.limbs, n, 1, LRCIPHER_DECRYPT);
-		memcpy(bs->s.a.limbs, s, n);
-		fixnum_show(&bs->s.a, "after decrypt");
+	// walk back until the value is not larger than max
+	while (fixnum_sub_fixnum(&max, &f, 0xff)) {
+		fixnum_add_fixnum(&max, &f, 0xff);
+		lrcipher_cache_execute(&c, f.limbs, f.limbs, n,
+				LRCIPHER_DECRYPT);
 	}
-	fixnum_show(&bs->s.a, "final");
 
-	bs->s.a.no_limbs = restore_limbs_a;
-	bs->s.b.no_limbs = restore_limbs_b;
+	lrcipher_cache_finished(&c);
 
-	printf("no_words=%d, n=%ld\n", no_words, n);
-	for (int i = 0; i < n; i++) {
-		printf("in[%d] = %d\n", i, in[i]);
-	}
-	base_encode_buffer(scratch, no_words, &w->m, bs->s.a.limbs, n, bs, 0);
+	// base_encode_buffer copies f before writing to scratch
+	base_encode_buffer(scratch, words, &w->m, f.limbs, n, bs, 0);
 
 	sbuf_t sbuf = { .buf = out, .size = out_size };
-	for (int i = 0; i < no_words; i++) {
-		printf("scratch[%d] = %d\n", i, scratch[i]);
-	}
 
 	int k = 0;
 	goto start;
-	while (++k < no_words) {
+	while (++k < words) {
 		sbufprintf(&sbuf, " ");
 start:
 		sbufwordlist_dereference(w, &sbuf, scratch[k]);
 	}
-//	FATAL("not implemented");
 
+	return 0;
+}
+
+/* a BIP32 extended private key is serialized as 4 bytes version,
+ * 1 byte depth, 4 bytes parent fingerprint, 4 bytes child number, 32 bytes
+ * chain code and 33 bytes key (0x00 followed by the private key); the
+ * serialization is followed by a 4 byte checksum (the first 4 bytes of
+ * SHA256D of the serialization) and encoded with base58, for a
+ * master key, only the chain code and the private key are not fixed, so
+ * a master key is stored as the chain code followed by the private key */
+#define XPRV_SIZE	78
+#define XPRV_CHARS	111
+#define XPRV_CHAINCODE	13
+#define XPRV_KEY	46
+
+static const uint8_t xprv_header[XPRV_CHAINCODE] = {
+	0x04, 0x88, 0xad, 0xe4, // version: mainnet private key, xprv
+	0x00,			// depth: master key
+	0x00, 0x00, 0x00, 0x00, // parent fingerprint: none
+	0x00, 0x00, 0x00, 0x00  // child number: none
+};
+
+// the order of the secp256k1 curve, a private key must be less than this
+static const uint8_t secp256k1_order[32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+	0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41
+};
+
+static int base58_encode(uint8_t *out, size_t *n,
+		lrcipher_t *l, uint16_t *scratch,
+		size_t scratch_size, const char *in, wordlist_t *w,
+		const char *seed, size_t seed_len, base_scratch_t *bs, char *error) {
+	uint8_t xprv[XPRV_SIZE + 4], checksum[4], order_limbs[32];
+	size_t no_input = 0;
+	fixnum_t key, order;
+	int idx, ret = -1;
+
+	assert(scratch_size >= XPRV_CHARS);
+	assert(scratch_size>>2 >= 64); // room for the chain code and key
+
+	while (*in) {
+		if (no_input == XPRV_CHARS)
+			return codec_error(error, "input too long, an extended "
+					"private key has %d base58 characters",
+					XPRV_CHARS);
+
+		if ((idx = wordlist_search(w, in, &in, error)) < 0) return -1;
+		scratch[no_input++] = idx;
+	}
+
+	// the key is on the stack from here, so errors go to out
+	if (no_input != XPRV_CHARS || base_decode_buffer(xprv, sizeof(xprv),
+				&w->m, scratch, no_input, 0)) {
+		codec_error(error, "input is not an extended private key, it should "
+				"have %d base58 characters", XPRV_CHARS);
+		goto out;
+	}
+
+	// the checksum is public, it can be compared in variable time
+	hash(checksum, sizeof(checksum), xprv, XPRV_SIZE, HASH_SHA256D);
+	if (memcmp(checksum, xprv + XPRV_SIZE, sizeof(checksum))) {
+		codec_error(error, "invalid extended private key, checksum does "
+				"not match");
+		goto out;
+	}
+
+	if (memcmp(xprv, xprv_header, 4)) {
+		codec_error(error, "extended key is not a mainnet private key (xprv)");
+		goto out;
+	}
+
+	if (memcmp(xprv + 4, xprv_header + 4, XPRV_CHAINCODE - 4)) {
+		codec_error(error, "extended private key is not a master key, only "
+				"master keys (depth 0) are supported");
+		goto out;
+	}
+
+	if (xprv[XPRV_KEY - 1] != 0x00) {
+		codec_error(error, "invalid extended private key, key must start "
+				"with 0x00");
+		goto out;
+	}
+
+	fixnum_init_buffer(&key, out + 32, 32, xprv + XPRV_KEY, 32);
+	fixnum_init_buffer(&order, order_limbs, 32, secp256k1_order, 32);
+	// after subtraction, order contains order - key
+	if (!fixnum_popcnt(&key) || fixnum_sub_fixnum(&order, &key, 0xff) ||
+			!fixnum_popcnt(&order)) {
+		codec_error(error, "invalid extended private key, key out of range");
+		goto out;
+	}
 
+	memcpy(out, xprv + XPRV_CHAINCODE, 32);
+	*n = 64;
+	ret = 0;
+
+out:
+	wipememory(xprv, sizeof(xprv));
+	wipememory(order_limbs, sizeof(order_limbs));
+
+	return ret;
+}
+
+static int base58_decode(char *out, size_t out_size, lrcipher_t *l,
+		uint16_t *scratch, size_t scratch_size,
+		const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t *bs, char *error) {
+	uint8_t xprv[XPRV_SIZE + 4];
+	sbuf_t sbuf = { .buf = out, .size = out_size };
+
+	assert(scratch_size >= XPRV_CHARS);
+
+	if (n != 64)
+		return codec_error(error, "length of plaintext is not suitable for "
+				"an extended private key, length is %ld and "
+				"it should be 64 bytes", n);
+
+	memcpy(xprv, xprv_header, XPRV_CHAINCODE);
+	memcpy(xprv + XPRV_CHAINCODE, in, 32);
+	xprv[XPRV_KEY - 1] = 0x00;
+	memcpy(xprv + XPRV_KEY, in + 32, 32);
+	hash(xprv + XPRV_SIZE, 4, xprv, XPRV_SIZE, HASH_SHA256D);
+
+	base_encode_buffer(scratch, XPRV_CHARS, &w->m, xprv, sizeof(xprv), bs, 0);
+
+	for (int k = 0; k < XPRV_CHARS; k++)
+		sbufwordlist_dereference(w, &sbuf, scratch[k]);
+
+	wipememory(xprv, sizeof(xprv));
+
+	return 0;
 }
 
 codec_t codecs_array[] = {
@@ -348,6 +525,12 @@ codec_t codecs_array[] = {
 		.encode = bip39_encode,
 		.decode = bip39_decode,
 		.default_language = "english"
+	}, {
+		.elt.key = "bip39seed",
+		.encode = bip39_encode,
+		.decode = bip39seed_decode,
+		.default_language = "english",
+		.family = "bip39"
 	}, {
 		.elt.key = "slip0039",
 		.encode = NULL,
@@ -360,8 +543,8 @@ codec_t codecs_array[] = {
 		.default_language = "english"
 	}, {
 		.elt.key = "base58",
-		.encode = NULL,
-		.decode = NULL,
+		.encode = base58_encode,
+		.decode = base58_decode,
 		.default_language = ""
 	}
 };
@@ -378,9 +561,15 @@ void codec_init() {
 		shashtbl_add_elt(&codecs, &codecs_array[i]);
 		shashtbl_init_simple(&codecs_array[i].wordlists, 4, 1);
 	}
-
 }
 
 codec_t *codec_find(const char *key) {
 	return shashtbl_search_elt_bykey(&codecs, key);
 }
+
+shashtbl_t *codec_wordlists(codec_t *c) {
+	assert(c);
+	if (c->family) c = codec_find(c->family);
+	assert(c);
+	return &c->wordlists;
+}
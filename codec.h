@@ -30,9 +30,15 @@
 typedef struct {
 	shashtbl_elt_t elt;
 	const char *info;
-	void (*encode)(uint8_t *out, size_t *n, lrcipher_t*, uint16_t*, size_t, const char *in, wordlist_t*, const char*, size_t, base_scratch_t*);
-	void (*decode)(char *out, size_t out_size, lrcipher_t*, uint16_t*, size_t, const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t*);
+	/* encode and decode return 0 or -1 with the error message in the
+	 * last argument, a buffer of DISPLAYLINE bytes;
+	 * the scratch space has room for the given number of words, which
+	 * is 4 words per byte of the largest secret that is supported, the
+	 * output of encode has room for that secret */
+	int (*encode)(uint8_t *out, size_t *n, lrcipher_t*, uint16_t*, size_t, const char *in, wordlist_t*, const char*, size_t, base_scratch_t*, char*);
+	int (*decode)(char *out, size_t out_size, lrcipher_t*, uint16_t*, size_t, const uint8_t *in, size_t n, wordlist_t *w, base_scratch_t*, char*);
 	const char *default_language;
+	const char *family; // use the wordlists of this codec, if set
 	shashtbl_t wordlists;
 } codec_t;
 
@@ -42,4 +48,6 @@ extern codec_t *codec;
 
 codec_t *codec_find(const char*);
 
+shashtbl_t *codec_wordlists(codec_t*);
+
 #endif /* SLIP0039_CODEC_H */
@@ -21,23 +21,35 @@
 #define SLIP0039_CONFIG_H
 
 #define HAVE_LITTLE_ENDIAN 1
-// support secrets of at most BLOCKS*2 bytes since
+// support secrets of at most BLOCKS*2 bytes by default, since
 // the spec requires that secrets of 256 bits (32 bytes)
 // are supported, BLOCKS must be >= 16
 // we set this to 32 to be able to store xpubs and xprvs
+// the buffers of a context are allocated at runtime, so a context can
+// support longer secrets (up to MAX_SECRET bytes) without a recompile,
+// see slip0039_ctx_max_secret() and option -m
 #define BLOCKS 32
+#define MAX_SECRET 1024
+
+// the largest number that must be converted to or from a base, the
+// secret itself or a serialized extended private key with checksum
+// (82 bytes) that is reconstructed from a 64 byte secret
+#define BASE_LIMBS(n)	((n) > 82 ? (n) : 82)
 
 #define BITS_PER_WORD 10
 
-// the maximum number of supported words
+// the maximum number of words of the mnemonic of a secret of n bytes
 // 4 words for the header, 3 for the checksum
-// and enough words to store BLOCKS*16 bits
-#define WORDS 	(4 + (BLOCKS*16 + BITS_PER_WORD - 1)/BITS_PER_WORD + 3)
+// and enough words to store n*8 bits
+#define WORDS_FOR(n) 	(4 + ((n)*8 + BITS_PER_WORD - 1)/BITS_PER_WORD + 3)
+#define WORDS		WORDS_FOR(BLOCKS<<1)
 
-// size of a line with WORDS words of 8 characters (there are no longer words
-// than 8 chars in the wordlist) (space between the words and end with newline
-// and string terminator)
-#define LINE 	(WORDS*9 + 1)
+// size of a line with the words of the mnemonic of a secret of n bytes,
+// of 8 characters each (there are no longer words than 8 chars in the
+// wordlist) (space between the words and end with newline and string
+// terminator)
+#define LINE_FOR(n) 	(WORDS_FOR(n)*9 + 1)
+#define LINE		LINE_FOR(BLOCKS<<1)
 
 
 //#define DISPLAYLINE 160
@@ -1,13 +1,212 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <string.h>
 
 #include "dev.h"
 #include "../base.h"
 
-uint8_t base_scratch_space[(BLOCKS<<1)<<2];
+uint8_t base_scratch_space[BASE_SCRATCH_SIZE(BLOCKS<<1)];
+
+/* the divide and conquer and chunked conversions (and fixnum_mul64 and
+ * fixnum_div64, which they use) are compared with schoolbook arithmetic
+ * on plain byte arrays, for the bases of all wordlists and for lengths
+ * around BASE_DC_LIMBS (16) up to the largest secret */
+#define MAX_BYTES MAX_SECRET
+#define MAX_DIGITS (8*MAX_BYTES)
+
+uint8_t big_scratch_space[BASE_SCRATCH_SIZE(BASE_LIMBS(MAX_BYTES))];
+uint8_t num[MAX_BYTES], copy[MAX_BYTES], ref[MAX_BYTES + 8];
+uint8_t limbs[MAX_BYTES], divisor_limbs[MAX_BYTES];
+uint16_t digits[MAX_DIGITS], ref_digits[MAX_DIGITS];
+
+const uint16_t bases[] = { 16, 58, 1024, 2048, 7776 };
+const size_t lengths[] = { 2, 3, 7, 8, 9, 15, 16, 17, 18, 24, 31, 32, 33,
+	34, 48, 63, 64, 65, 66, 100, 128, 129, 256, 500, 1024 };
+
+// divide the big endian number by m, returns the remainder
+static uint16_t ref_div(uint8_t *n, size_t len, uint16_t m) {
+	uint32_t r = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		r = (r<<8)|n[i];
+		n[i] = r/m;
+		r %= m;
+	}
+
+	return r;
+}
+
+// the digits of n in base m, most significant first
+static void ref_encode(uint16_t *out, size_t out_size, const uint8_t *n,
+		size_t len, uint16_t m) {
+	memcpy(copy, n, len);
+	while (out_size-- > 0) out[out_size] = ref_div(copy, len, m);
+}
+
+// res (len + 8 bytes) = n*mul, one byte of mul at a time
+static void ref_mul64(uint8_t *res, const uint8_t *n, size_t len,
+		uint64_t mul) {
+	memset(res, 0, len + 8);
+	for (int j = 0; j < 8; j++) {
+		uint32_t b = (mul>>(j<<3))&0xff, c = 0;
+		size_t k;
+
+		for (size_t i = len; i-- > 0; ) {
+			k = i + 8 - j;
+			c += res[k] + b*n[i];
+			res[k] = c&0xff;
+			c >>= 8;
+		}
+		for (k = 8 - j; k-- > 0 && c; ) {
+			c += res[k];
+			res[k] = c&0xff;
+			c >>= 8;
+		}
+	}
+}
+
+// bit by bit long division, d < 2^63, returns the remainder
+static uint64_t ref_div64(uint8_t *n, size_t len, uint64_t d) {
+	uint64_t r = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		uint8_t q = 0;
+		for (int bit = 7; bit >= 0; bit--) {
+			r = (r<<1)|((n[i]>>bit)&1);
+			q <<= 1;
+			if (r >= d) {
+				r -= d;
+				q |= 1;
+			}
+		}
+		n[i] = q;
+	}
+
+	return r;
+}
+
+static uint64_t rnd64() {
+	uint64_t r = 0;
+
+	for (int i = 0; i < 4; i++) r = (r<<16)^(rand()&0xffff);
+
+	return r;
+}
+
+static void fill(uint8_t *n, size_t len, int pattern) {
+	for (size_t i = 0; i < len; i++)
+		n[i] = pattern == 0 ? 0 : pattern == 1 ? 0xff : rand();
+}
+
+static int test_base(uint16_t base, size_t len, int pattern,
+		base_scratch_t *bs) {
+	fixnum_multiplier16_t m;
+	size_t bits = 0, out_size;
+	int fail = 0;
+
+	fixnum_multiplier16_init(&m, base);
+	while (base>>(bits + 1)) bits++;
+	out_size = (8*len + bits - 1)/bits; // enough, maybe one more
+
+	fill(num, len, pattern);
+	ref_encode(ref_digits, out_size, num, len, base);
+	base_encode_buffer(digits, out_size, &m, num, len, bs, 0);
+	if (memcmp(digits, ref_digits, out_size*sizeof(*digits))) {
+		fprintf(stderr, "encode base %d, %zu bytes, pattern %d: "
+				"mismatch\n", base, len, pattern);
+		fail++;
+	}
+
+	if (base_decode_buffer(copy, len, &m, ref_digits, out_size, 0) ||
+			memcmp(copy, num, len)) {
+		fprintf(stderr, "decode base %d, %zu bytes, pattern %d: "
+				"mismatch\n", base, len, pattern);
+		fail++;
+	}
+
+	return fail;
+}
+
+static int test_mul64(size_t len, uint64_t mul) {
+	fixnum_t f;
+	uint64_t carry, ref_carry = 0;
+
+	fill(num, len, 2);
+	ref_mul64(ref, num, len, mul);
+	for (int i = 0; i < 8; i++) ref_carry = (ref_carry<<8)|ref[i];
+
+	fixnum_init_buffer(&f, limbs, len, num, len);
+	carry = fixnum_mul64(&f, mul);
+	if (carry != ref_carry || memcmp(limbs, ref + 8, len)) {
+		fprintf(stderr, "fixnum_mul64 %zu bytes by 0x%016llx: "
+				"mismatch\n", len, (unsigned long long)mul);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int test_div64(size_t len, uint64_t d, base_scratch_t *bs) {
+	fixnum_divisor_t div;
+	fixnum_t f;
+	uint64_t r, ref_r;
+
+	/* f must have at least the 8 limbs of the divisor, the divisor
+	 * must not be a power of two and ref_div64() needs d < 2^63 */
+	if (len < 8 || !(d & (d - 1)) || d>>63) return 0;
+
+	fill(num, len, 2);
+	memcpy(ref, num, len);
+	ref_r = ref_div64(ref, len, d);
+
+	fixnum_init_buffer(&f, limbs, len, num, len);
+	fixnum_divisor_init_from_uint64(&div, d, divisor_limbs, len);
+	r = fixnum_div64(&f, &div, &bs->s);
+	if (r != ref_r || memcmp(limbs, ref, len)) {
+		fprintf(stderr, "fixnum_div64 %zu bytes by 0x%016llx: "
+				"mismatch\n", len, (unsigned long long)d);
+		return 1;
+	}
+
+	return 0;
+}
+
+// returns the number of mismatches
+static int differential() {
+	base_scratch_t bs;
+	int fail = 0;
+
+	base_init_scratch(&bs, big_scratch_space, BASE_LIMBS(MAX_BYTES));
+	srand(1);
+
+	for (size_t b = 0; b < sizeof(bases)/sizeof(*bases); b++)
+		for (size_t l = 0; l < sizeof(lengths)/sizeof(*lengths); l++)
+			for (int pattern = 0; pattern < 4; pattern++)
+				fail += test_base(bases[b], lengths[l],
+						pattern, &bs);
+
+	for (size_t l = 0; l < sizeof(lengths)/sizeof(*lengths); l++) {
+		// the powers of the bases that the chunked conversion uses
+		for (size_t b = 0; b < sizeof(bases)/sizeof(*bases); b++) {
+			uint64_t power = 1;
+			while (power <= (UINT64_MAX>>1)/bases[b])
+				power *= bases[b];
+			fail += test_mul64(lengths[l], power);
+			fail += test_div64(lengths[l], power, &bs);
+		}
+		for (int i = 0; i < 8; i++) {
+			fail += test_mul64(lengths[l], rnd64());
+			fail += test_div64(lengths[l], rnd64()>>(1 + i*8), &bs);
+		}
+	}
+
+	printf("differential: %d mismatches\n", fail);
+
+	return fail;
+}
 
 uint8_t in1[3] = { 0x62, 0x62, 0x62 };
 uint16_t out1[4];
@@ -42,5 +241,6 @@ int main(int argc, char *argv[]) {
 	base_encode_buffer(out3, 4, &m, in3, 5, &bs, 0);
 	for (int i = 0; i < 4; i++) printf("out[%d]=%02x\n", i, out3[i]);
 
+	exit(differential() != 0);
 }
 
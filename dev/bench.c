@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+#include "../libslip0039.h"
+#include "../verbose.h"
+#include "../sha256.h"
+#include "../sha512.h"
+#include "../hmac.h"
+#include "../pbkdf2.h"
+#include "../gf256.h"
+#include "../lagrange.h"
+#include "../base.h"
+#include "../rs1024.h"
+#include "../wordlists.h"
+#include "../codec.h"
+#include "../utils.h"
+
+/* microbenchmarks of the primitives, every benchmark is warmed up and
+ * calibrated so that a sample takes about SAMPLE_NS, the median and the
+ * 10th and 90th percentile of SAMPLES samples are reported per operation */
+#define WARMUP_NS	20000000
+#define SAMPLE_NS	2000000
+#define SAMPLES		31
+
+static const char *filter = NULL;
+static volatile uint8_t sink;
+
+static uint64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static uint64_t cycles() {
+#ifdef HAVE_RDTSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static int cmp(const void *a, const void *b) {
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+/* func performs ops operations per call */
+static void bench(const char *name, void (*func)(void*), void *arg,
+		size_t ops) {
+	double ns[SAMPLES], cyc[SAMPLES];
+	uint64_t start, c, calls = 0, iters;
+
+	if (filter && !strstr(name, filter)) return;
+
+	start = now();
+	do {
+		(*func)(arg);
+		calls++;
+	} while (now() - start < WARMUP_NS);
+	iters = calls*SAMPLE_NS/WARMUP_NS;
+	if (!iters) iters = 1;
+
+	for (int i = 0; i < SAMPLES; i++) {
+		start = now();
+		c = cycles();
+		for (uint64_t j = 0; j < iters; j++) (*func)(arg);
+		c = cycles() - c;
+		ns[i] = (double)(now() - start)/(iters*ops);
+		cyc[i] = (double)c/(iters*ops);
+	}
+
+	qsort(ns, SAMPLES, sizeof(*ns), cmp);
+	qsort(cyc, SAMPLES, sizeof(*cyc), cmp);
+
+	printf("%-40s %12.1f %12.1f %12.1f", name, ns[SAMPLES/2],
+			ns[SAMPLES/10], ns[SAMPLES - 1 - SAMPLES/10]);
+#ifdef HAVE_RDTSC
+	printf(" %12.1f\n", cyc[SAMPLES/2]);
+#else
+	printf(" %12s\n", "-");
+#endif
+}
+
+static uint8_t data[256];
+
+static void sha256_compress(void *arg) {
+	sha256_update(arg, data, 64);
+}
+
+static void sha512_compress(void *arg) {
+	sha512_update(arg, data, 128);
+}
+
+static void hmac_op(void *arg) {
+	uint8_t out[64];
+	hash_type_t type = *(hash_type_t*)arg;
+	hmac(out, type == HASH_SHA256 ? 32 : 64, data, 32, data + 32, 32, type);
+	sink = out[0];
+}
+
+#define PBKDF2_ITERATIONS 1000
+
+static void pbkdf2_op(void *arg) {
+	uint8_t out[32];
+	pbkdf2(out, data, 32, data + 32, 32, PBKDF2_ITERATIONS, sizeof(out),
+			*(hash_type_t*)arg);
+	sink = out[0];
+}
+
+static void gf256_mul_op(void *arg) {
+	uint8_t acc = 1;
+	for (int i = 0; i < 256; i++) acc ^= gf256_mul(data[i], i);
+	sink = acc;
+}
+
+static void gf256_inv_op(void *arg) {
+	uint8_t acc = 1;
+	for (int i = 1; i < 256; i++) acc ^= gf256_inv(i);
+	sink = acc;
+}
+
+typedef struct lagrange_arg_s {
+	slip0039_set_t s;
+	uint8_t idx[MAX_SHARES];
+	int threshold;
+} lagrange_arg_t;
+
+static uint8_t shares[MAX_SHARES + 2][32];
+
+static void lagrange_op(void *arg) {
+	lagrange_arg_t *l = arg;
+	lagrange(&l->s, 32, l->threshold, l->idx, 255);
+}
+
+typedef struct base_arg_s {
+	wordlist_t *w;
+	base_scratch_t *bs;
+	uint16_t digits[512];
+	size_t no_digits;
+	uint16_t next;
+} base_arg_t;
+
+static void base_encode_op(void *arg) {
+	base_arg_t *b = arg;
+	base_encode_buffer(b->digits, b->no_digits, &b->w->m, data, 32,
+			b->bs, 0);
+}
+
+static void base_decode_op(void *arg) {
+	base_arg_t *b = arg;
+	uint8_t out[32];
+	base_decode_buffer(out, sizeof(out), &b->w->m, b->digits,
+			b->no_digits, 0);
+	sink = out[0];
+}
+
+static void wordlist_search_op(void *arg) {
+	base_arg_t *b = arg;
+	const char *end;
+	sink = wordlist_search(b->w, b->w->words[b->next], &end, NULL);
+	b->next = (b->next + 97)%b->w->m.value;
+}
+
+static void wordlist_dereference_op(void *arg) {
+	base_arg_t *b = arg;
+	char word[32] = { 0 };
+	wordlist_dereference(b->w, word, sizeof(word), b->next);
+	sink = word[0];
+	b->next = (b->next + 97)%b->w->m.value;
+}
+
+static uint16_t mnemonic[33];
+
+static void rs1024_checksum_op(void *arg) {
+	rs1024_add(mnemonic, 30);
+}
+
+static void rs1024_verify_op(void *arg) {
+	sink = rs1024_verify(mnemonic, 33);
+}
+
+// arg is the name of the codec of the wordlist
+static void *bench_wordlist(void *elt, void *arg) {
+	static uint8_t space[BASE_SCRATCH_SIZE(BASE_LIMBS(BLOCKS<<1))];
+	base_scratch_t bs;
+	base_arg_t b = { .w = elt, .bs = &bs };
+	char codec[32], name[64];
+
+	base_init_scratch(&bs, space, BASE_LIMBS(BLOCKS<<1));
+	// number of digits needed for 256 bits
+	b.no_digits = ceil(256/log2(b.w->m.value));
+
+	snprintf(codec, sizeof(codec), "%s%s%s", (char*)arg,
+			*b.w->elt.key ? ":" : "", b.w->elt.key);
+	snprintf(name, sizeof(name), "base_encode %s", codec);
+	bench(name, base_encode_op, &b, 1);
+	base_encode_op(&b);
+	snprintf(name, sizeof(name), "base_decode %s", codec);
+	bench(name, base_decode_op, &b, 1);
+	snprintf(name, sizeof(name), "wordlist_search %s", codec);
+	bench(name, wordlist_search_op, &b, 1);
+	snprintf(name, sizeof(name), "wordlist_dereference %s", codec);
+	bench(name, wordlist_dereference_op, &b, 1);
+
+	return NULL;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *codecs[] = {
+		"slip0039", "base16", "bip39", "diceware", "base58"
+	};
+	hash_type_t sha256 = HASH_SHA256, sha512 = HASH_SHA512;
+	struct sha256_ctx c256;
+	struct sha512_ctx c512;
+	lagrange_arg_t l;
+	char name[64];
+
+	verbose_init(argv[0]);
+	if (argc > 2) ABORT("usage: %s [ FILTER ]", exec_name);
+	if (argc == 2) filter = argv[1];
+
+	slip0039_lib_init();
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	for (int i = 0; i < sizeof(data); i++) data[i] = 0x5a ^ (i*37);
+
+	printf("%-40s %12s %12s %12s %12s\n", "benchmark", "ns/op",
+			"p10", "p90", "cycles/op");
+
+	sha256_init(&c256);
+	bench("sha256 compress", sha256_compress, &c256, 1);
+	sha512_init(&c512);
+	bench("sha512 compress", sha512_compress, &c512, 1);
+	bench("hmac sha256", hmac_op, &sha256, 1);
+	bench("hmac sha512", hmac_op, &sha512, 1);
+	bench("pbkdf2 sha256 iteration", pbkdf2_op, &sha256, PBKDF2_ITERATIONS);
+	bench("pbkdf2 sha512 iteration", pbkdf2_op, &sha512, PBKDF2_ITERATIONS);
+	bench("gf256_mul", gf256_mul_op, NULL, 256);
+	bench("gf256_inv", gf256_inv_op, NULL, 255);
+
+	memset(&l, 0, sizeof(l));
+	l.s.secret = shares[0];
+	l.s.digest = shares[1];
+	for (int i = 0; i < MAX_SHARES; i++) {
+		memcpy(shares[i + 2], data + i, 32);
+		l.s.shares[i] = shares[i + 2];
+		l.idx[i] = i;
+	}
+	for (l.threshold = 2; l.threshold <= MAX_SHARES; l.threshold++) {
+		snprintf(name, sizeof(name), "lagrange threshold %d",
+				l.threshold);
+		bench(name, lagrange_op, &l, 1);
+	}
+
+	for (int i = 0; i < sizeof(codecs)/sizeof(*codecs); i++)
+		shashtbl_iterator(codec_wordlists(codec_find(codecs[i])),
+				bench_wordlist, (void*)codecs[i]);
+
+	for (int i = 0; i < 30; i++) mnemonic[i] = data[i] << 2;
+	rs1024_add(mnemonic, 30);
+	bench("rs1024 checksum", rs1024_checksum_op, NULL, 1);
+	bench("rs1024 verify", rs1024_verify_op, NULL, 1);
+
+	return 0;
+}
@@ -0,0 +1,350 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+#if defined(__has_include)
+#if __has_include(<valgrind/memcheck.h>)
+#include <valgrind/memcheck.h>
+#define HAVE_MEMCHECK 1
+#endif
+#endif
+#include "../libslip0039.h"
+#include "../verbose.h"
+#include "../gf256.h"
+#include "../lagrange.h"
+#include "../fixnum.h"
+#include "../rs1024.h"
+#include "../wordlists.h"
+#include "../utils.h"
+
+/* check that the functions that handle secrets run in constant time
+ *
+ * by default, the functions are timed dudect-style: every measurement
+ * uses either a fixed input (class 0) or a random input (class 1), the
+ * classes are interleaved randomly and Welch's t-test is applied to the
+ * timings (raw and cropped at some percentiles), |t| > 10 means that the
+ * timing depends on the input, |t| > 4.5 is suspicious
+ *
+ * with -p, the program must run under valgrind: the secret input is
+ * marked as undefined (ctgrind), so that memcheck reports every branch
+ * and memory access that depends on it */
+
+#define INPUT_SIZE	64
+#define BATCH		1000
+#define CROPS		3
+#define T_SUSPICIOUS	4.5
+#define T_LEAK		10
+
+typedef struct ct_target_s {
+	const char *name;
+	size_t size; // size of the secret input
+	void (*prepare)(uint8_t*, int);
+	void (*run)(uint8_t*);
+	int control; // expected to leak, shows that the harness works
+} ct_target_t;
+
+static volatile uint8_t sink;
+static uint64_t state = 0x2545f4914f6cdd1dull;
+
+// xorshift, the harness does not need cryptographic randomness
+static uint64_t rnd() {
+	state ^= state<<13;
+	state ^= state>>7;
+	state ^= state<<17;
+	return state;
+}
+
+static void random_bytes(uint8_t *buf, size_t size) {
+	for (size_t i = 0; i < size; i++) buf[i] = rnd();
+}
+
+static uint64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static uint64_t ticks() {
+#ifdef HAVE_RDTSC
+	return __rdtsc();
+#else
+	return now();
+#endif
+}
+
+static void prepare_word(uint8_t *in, int class) {
+	uint16_t idx = class ? rnd()%wordlist_slip0039.m.value : 0;
+	memset(in, 0, INPUT_SIZE);
+	strcpy((char*)in, wordlist_slip0039.words[idx]);
+}
+
+static void run_wordlist_search(uint8_t *in) {
+	const char *end;
+	sink = wordlist_search(&wordlist_slip0039, (char*)in, &end, NULL);
+}
+
+static void prepare_index(uint8_t *in, int class) {
+	uint16_t idx = class ? rnd()%wordlist_slip0039.m.value : 0;
+	memcpy(in, &idx, sizeof(idx));
+}
+
+static void run_wordlist_dereference(uint8_t *in) {
+	char word[16] = { 0 };
+	uint16_t idx;
+	memcpy(&idx, in, sizeof(idx));
+	wordlist_dereference(&wordlist_slip0039, word, sizeof(word), idx);
+	sink = word[0];
+}
+
+static void prepare_bytes(uint8_t *in, int class) {
+	if (class) random_bytes(in, INPUT_SIZE);
+	else memset(in, 0, INPUT_SIZE);
+}
+
+// 0 has no inverse, so the fixed class is 1
+static void prepare_nonzero(uint8_t *in, int class) {
+	for (int i = 0; i < INPUT_SIZE; i++)
+		in[i] = class ? 1 + rnd()%255 : 1;
+}
+
+static void run_gf256_mul(uint8_t *in) {
+	sink = gf256_mul(in[0], in[1]);
+}
+
+static void run_gf256_inv(uint8_t *in) {
+	sink = gf256_inv(in[0]);
+}
+
+static void run_gf256_div(uint8_t *in) {
+	sink = gf256_div(in[0], in[1]);
+}
+
+#define LAGRANGE_THRESHOLD 3
+#define LAGRANGE_BYTES 2
+
+// interpolate the secret from three shares of two bytes
+static void run_lagrange(uint8_t *in) {
+	uint8_t secret[LAGRANGE_BYTES], idx[] = { 0, 1, 2 };
+	slip0039_set_t s;
+
+	memset(&s, 0, sizeof(s));
+	s.secret = secret;
+	for (int i = 0; i < LAGRANGE_THRESHOLD; i++)
+		s.shares[i] = in + i*LAGRANGE_BYTES;
+	lagrange(&s, LAGRANGE_BYTES, LAGRANGE_THRESHOLD, idx, 255);
+	sink = secret[0];
+}
+
+#define FIXNUM_LIMBS 32
+
+/* divide 32 bytes by 7776, as base_encode_buffer() does for diceware,
+ * division by a power of two is a shift */
+static void run_fixnum_div(uint8_t *in) {
+	static uint8_t a[FIXNUM_LIMBS], b[FIXNUM_LIMBS], d[FIXNUM_LIMBS];
+	fixnum_multiplier16_t m;
+	fixnum_divisor_t divisor;
+	fixnum_scratch_t scratch;
+	fixnum_t f;
+
+	fixnum_multiplier16_init(&m, 7776);
+	fixnum_divisor_init_from_multiplier16(&divisor, &m, d, FIXNUM_LIMBS);
+	fixnum_scratch_init(&scratch, a, FIXNUM_LIMBS, b, FIXNUM_LIMBS);
+	fixnum_init(&f, in, FIXNUM_LIMBS);
+	sink = fixnum_div(&f, &divisor, &scratch, 0);
+}
+
+// a mnemonic of 33 words of 10 bits
+static void prepare_words(uint8_t *in, int class) {
+	uint16_t words[33];
+	for (int i = 0; i < 33; i++) words[i] = class ? rnd()&0x3ff : 0;
+	memcpy(in, words, sizeof(words));
+}
+
+static void run_rs1024(uint8_t *in) {
+	uint16_t words[33];
+	memcpy(words, in, sizeof(words));
+	rs1024_add(words, 30);
+	sink = words[30];
+}
+
+// compare with zero and stop at the first difference, not constant time
+static void run_control(uint8_t *in) {
+	volatile uint8_t *v = in;
+	int i = 0;
+	while (i < INPUT_SIZE && !v[i]) i++;
+	sink = i;
+}
+
+static const ct_target_t targets[] = {
+	{ "control (early exit)", INPUT_SIZE, prepare_bytes, run_control, 1 },
+	{ "wordlist_search", 9, prepare_word, run_wordlist_search },
+	{ "wordlist_dereference", 2, prepare_index, run_wordlist_dereference },
+	{ "gf256_mul", 2, prepare_bytes, run_gf256_mul },
+	{ "gf256_inv", 1, prepare_nonzero, run_gf256_inv },
+	{ "gf256_div", 2, prepare_nonzero, run_gf256_div },
+	{ "lagrange", LAGRANGE_THRESHOLD*LAGRANGE_BYTES, prepare_bytes,
+		run_lagrange },
+	{ "fixnum_div", FIXNUM_LIMBS, prepare_bytes, run_fixnum_div },
+	{ "rs1024", 33*2, prepare_words, run_rs1024 }
+};
+
+// online mean and variance (Welford)
+typedef struct ct_moments_s {
+	double n, mean, m2;
+} ct_moments_t;
+
+static void moments_add(ct_moments_t *m, double x) {
+	double delta = x - m->mean;
+	m->n++;
+	m->mean += delta/m->n;
+	m->m2 += delta*(x - m->mean);
+}
+
+static double welch_t(const ct_moments_t *m) {
+	double v0, v1;
+
+	if (m[0].n < 2 || m[1].n < 2) return 0;
+	v0 = m[0].m2/(m[0].n - 1);
+	v1 = m[1].m2/(m[1].n - 1);
+	if (v0 + v1 == 0) return 0;
+
+	return (m[0].mean - m[1].mean)/sqrt(v0/m[0].n + v1/m[1].n);
+}
+
+static int cmp(const void *a, const void *b) {
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+/* measure the target for the given number of seconds, returns the
+ * largest |t| of the raw and the cropped timings */
+static double measure(const ct_target_t *t, double seconds, double *n) {
+	static uint8_t in[BATCH][INPUT_SIZE];
+	uint64_t cycles[BATCH], sorted[BATCH], crop[CROPS] = { 0 }, start;
+	ct_moments_t m[1 + CROPS][2];
+	int class[BATCH];
+	double max = 0;
+	uint64_t end = now() + seconds*1e9;
+
+	memset(m, 0, sizeof(m));
+
+	do {
+		for (int i = 0; i < BATCH; i++) {
+			class[i] = rnd()&1;
+			t->prepare(in[i], class[i]);
+		}
+
+		for (int i = 0; i < BATCH; i++) {
+			start = ticks();
+			t->run(in[i]);
+			cycles[i] = ticks() - start;
+		}
+
+		// the crop thresholds are the 50th, 75th and 90th percentile
+		if (!crop[0]) {
+			memcpy(sorted, cycles, sizeof(cycles));
+			qsort(sorted, BATCH, sizeof(*sorted), cmp);
+			crop[0] = sorted[BATCH/2];
+			crop[1] = sorted[3*BATCH/4];
+			crop[2] = sorted[9*BATCH/10];
+			continue; // the first batch is the warm-up
+		}
+
+		for (int i = 0; i < BATCH; i++) {
+			moments_add(&m[0][class[i]], cycles[i]);
+			for (int j = 0; j < CROPS; j++)
+				if (cycles[i] < crop[j])
+					moments_add(&m[1 + j][class[i]],
+							cycles[i]);
+		}
+	} while (now() < end);
+
+	for (int j = 0; j < 1 + CROPS; j++)
+		if (fabs(welch_t(m[j])) > max) max = fabs(welch_t(m[j]));
+
+	*n = m[0][0].n + m[0][1].n;
+
+	return max;
+}
+
+static int timing(const char *filter, double seconds) {
+	int leaks = 0;
+
+	printf("%-24s %12s %8s\n", "function", "measurements", "max |t|");
+	for (int i = 0; i < sizeof(targets)/sizeof(*targets); i++) {
+		const ct_target_t *t = &targets[i];
+		double n, max;
+
+		if (filter && !strstr(t->name, filter)) continue;
+		max = measure(t, seconds, &n);
+		printf("%-24s %12.0f %8.2f %s%s\n", t->name, n, max,
+				max > T_LEAK ? "leak" :
+				max > T_SUSPICIOUS ? "suspicious" : "ok",
+				t->control ? " (expected to leak)" : "");
+		if (!t->control) leaks += max > T_LEAK;
+	}
+
+	return leaks != 0;
+}
+
+static int poison(const char *filter) {
+#ifdef HAVE_MEMCHECK
+	uint8_t in[INPUT_SIZE];
+	long errors, before;
+	int ret = 0;
+
+	if (!RUNNING_ON_VALGRIND)
+		ABORT("fatal:-p only works under valgrind");
+
+	for (int i = 0; i < sizeof(targets)/sizeof(*targets); i++) {
+		const ct_target_t *t = &targets[i];
+
+		if (filter && !strstr(t->name, filter)) continue;
+		t->prepare(in, 1);
+		before = VALGRIND_COUNT_ERRORS;
+		VALGRIND_MAKE_MEM_UNDEFINED(in, t->size);
+		t->run(in);
+		VALGRIND_MAKE_MEM_DEFINED(in, sizeof(in));
+		VALGRIND_MAKE_MEM_DEFINED((void*)&sink, sizeof(sink));
+		errors = VALGRIND_COUNT_ERRORS - before;
+		printf("%-24s %ld error%s%s\n", t->name, errors,
+				errors == 1 ? "" : "s",
+				t->control ? " (expected)" : "");
+		if (!t->control) ret |= errors != 0;
+	}
+
+	return ret;
+#else
+	ABORT("fatal:-p is not available, compiled without "
+			"valgrind/memcheck.h");
+#endif
+}
+
+int main(int argc, char *argv[]) {
+	const char *filter = NULL;
+	double seconds = 5;
+	int opt, poisoned = 0;
+
+	verbose_init(argv[0]);
+	while ((opt = getopt(argc, argv, "ps:")) != -1) switch (opt) {
+		case 'p': poisoned = 1; break;
+		case 's': seconds = atof(optarg); break;
+		default: ABORT("usage: %s [ -p ] [ -s SECONDS ] [ FILTER ]",
+					 exec_name);
+	}
+	if (optind < argc) filter = argv[optind++];
+	if (optind != argc || seconds <= 0)
+		ABORT("usage: %s [ -p ] [ -s SECONDS ] [ FILTER ]", exec_name);
+
+	slip0039_lib_init();
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	return poisoned ? poison(filter) : timing(filter, seconds);
+}
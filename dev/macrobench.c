@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../libslip0039.h"
+#include "../verbose.h"
+#include "../pbkdf2.h"
+
+/* end-to-end benchmarks of split and recover through the library, every
+ * scenario uses fixed seeds, passphrases and secrets, so that the results
+ * of different builds and releases can be compared; the results are
+ * written as JSON, tagged with the CPU, the PBKDF2 backend and compiler */
+
+#define PASSPHRASE "TREZOR"
+#define SEED "macrobench seed, fixed so that the shares are always the same..."
+#define MAX_RESULTS 256
+
+typedef struct layout_s {
+	const char *name;
+	slip0039_spec_t spec;
+} layout_t;
+
+static const layout_t layouts[] = {
+	{ "1 1of1", { .GT = 1, .G = 1, .groups = { { 1, 1 } } } },
+	{ "2 3of5 2of3", { .GT = 2, .G = 2, .groups = { { 3, 5 }, { 2, 3 } } } }
+};
+
+typedef struct result_s {
+	const char *op, *layout, *codec;
+	int e, bytes, shares;
+	double median, min, max; // ns
+} result_t;
+
+static result_t results[MAX_RESULTS];
+static int no_results = 0, reps = 1;
+
+static char mnemonics[MAX_SHARES*MAX_SHARES*LINE];
+static char selected[MAX_SHARES*MAX_SHARES*LINE];
+
+static uint64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static void check(slip0039_ctx_t *ctx, slip0039_error_t err,
+		const char *what) {
+	if (err) ABORT("fatal:%s: %s", what, slip0039_ctx_error(ctx));
+}
+
+static void init(slip0039_ctx_t *ctx, const char *codec) {
+	slip0039_ctx_init(ctx);
+	check(ctx, slip0039_ctx_codec(ctx, codec), "codec");
+	check(ctx, slip0039_add_passphrase(ctx, PASSPHRASE,
+				strlen(PASSPHRASE)), "passphrase");
+}
+
+// split plaintext into mnemonics, returns the number of mnemonics
+static int split(slip0039_ctx_t *ctx, const char *codec,
+		const slip0039_spec_t *spec, int e, const char *plaintext) {
+	slip0039_spec_t s = *spec;
+	sbuf_t out = { .buf = mnemonics, .size = sizeof(mnemonics) };
+	int shares = 0;
+
+	s.e = e;
+	init(ctx, codec);
+	check(ctx, slip0039_split_init(ctx, &s), "split");
+	check(ctx, slip0039_split_seed(ctx, SEED, strlen(SEED)), "seed");
+	check(ctx, slip0039_split_plaintext(ctx, plaintext), "split");
+	check(ctx, slip0039_split_mnemonics(ctx, &out), "mnemonics");
+	slip0039_ctx_wipe(ctx);
+
+	for (const char *c = mnemonics; *c; c++) shares += *c == '\n';
+
+	return shares;
+}
+
+/* select the mnemonics of the first GT groups, threshold of each group
+ * or all mnemonics, returns the number of selected mnemonics */
+static int select_mnemonics(const slip0039_spec_t *spec, int all) {
+	const char *cur = mnemonics, *end;
+	int shares = 0;
+
+	*selected = '\0';
+	for (int i = 0; i < spec->G; i++)
+		for (int j = 0; j < spec->groups[i].count; j++) {
+			end = strchr(cur, '\n') + 1;
+			if (all || (i < spec->GT &&
+						j < spec->groups[i].threshold)) {
+				strncat(selected, cur, end - cur);
+				shares++;
+			}
+			cur = end;
+		}
+
+	return shares;
+}
+
+static void recover(slip0039_ctx_t *ctx, const char *codec,
+		char *plaintext, size_t size) {
+	init(ctx, codec);
+	for (const char *c = selected; *c; c++)
+		check(ctx, slip0039_recover_add_char(ctx, *c, NULL), "parse");
+	check(ctx, slip0039_recover_finish(ctx), "recover");
+	snprintf(plaintext, size, "%s", ctx->plaintext);
+	slip0039_ctx_wipe(ctx);
+}
+
+static int cmp(const void *a, const void *b) {
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+static result_t *result(const char *op, const char *layout,
+		const char *codec, int e, int bytes, int shares,
+		double *ns) {
+	result_t *r = &results[no_results++];
+
+	if (no_results > MAX_RESULTS) ABORT("fatal:too many results");
+	qsort(ns, reps, sizeof(*ns), cmp);
+	*r = (result_t){ .op = op, .layout = layout, .codec = codec, .e = e,
+		.bytes = bytes, .shares = shares, .median = ns[reps/2],
+		.min = ns[0], .max = ns[reps - 1] };
+	fprintf(stderr, "%s %s e=%d %d bytes %s %d shares: %.1f ms\n", op,
+			layout, e, bytes, codec, shares, r->median/1e6);
+
+	return r;
+}
+
+/* split plaintext and recover it from a minimal and from the full set
+ * of mnemonics, expect is the plaintext that must be recovered */
+static void scenario(slip0039_ctx_t *ctx, const layout_t *l, int e,
+		const char *codec, const char *plaintext, int bytes,
+		const char *expect) {
+	char recovered[DISPLAYLINE];
+	double ns[reps];
+	uint64_t start;
+	int shares = 0, minimal = 0;
+
+	for (int i = 0; i < reps; i++) {
+		start = now();
+		shares = split(ctx, codec, &l->spec, e, plaintext);
+		ns[i] = now() - start;
+	}
+	result("split", l->name, codec, e, bytes, shares, ns);
+
+	for (int all = 0; all < 2; all++) {
+		shares = select_mnemonics(&l->spec, all);
+		if (!all) minimal = shares;
+		else if (shares == minimal) continue; // 1of1
+		for (int i = 0; i < reps; i++) {
+			start = now();
+			recover(ctx, codec, recovered, sizeof(recovered));
+			ns[i] = now() - start;
+		}
+		if (expect && strcmp(recovered, expect))
+			ABORT("fatal:%s recovered as %s", expect, recovered);
+		result(all ? "recover full" : "recover minimal", l->name,
+				codec, e, bytes, shares, ns);
+	}
+}
+
+// a secret of bytes bytes, written in base16
+static void secret(char *buf, int bytes) {
+	for (int i = 0; i < bytes; i++)
+		sprintf(buf + 2*i, "%02x", (i*73 + 11)&0xff);
+}
+
+static void json_string(FILE *fp, const char *s) {
+	fputc('"', fp);
+	for (; *s; s++) {
+		if (*s == '"' || *s == '\\') fputc('\\', fp);
+		if ((unsigned char)*s >= ' ') fputc(*s, fp);
+	}
+	fputc('"', fp);
+}
+
+static void cpu_name(char *buf, size_t size) {
+	FILE *fp = fopen("/proc/cpuinfo", "r");
+	char line[256], *colon;
+
+	snprintf(buf, size, "unknown");
+	if (!fp) return;
+	while (fgets(line, sizeof(line), fp))
+		if (!strncmp(line, "model name", 10) &&
+				(colon = strchr(line, ':'))) {
+			snprintf(buf, size, "%s", colon + 2);
+			buf[strcspn(buf, "\n")] = '\0';
+			break;
+		}
+	fclose(fp);
+}
+
+static void write_json(FILE *fp, int max_e) {
+	char cpu[128];
+
+	cpu_name(cpu, sizeof(cpu));
+	fprintf(fp, "{\n\t\"cpu\": ");
+	json_string(fp, cpu);
+	fprintf(fp, ",\n\t\"backend\": ");
+	json_string(fp, PBKDF2_BACKEND);
+	fprintf(fp, ",\n\t\"compiler\": ");
+	json_string(fp, __VERSION__);
+#ifdef STATS
+	fprintf(fp, ",\n\t\"stats\": true");
+#else
+	fprintf(fp, ",\n\t\"stats\": false");
+#endif
+	fprintf(fp, ",\n\t\"reps\": %d,\n\t\"max_e\": %d,\n\t\"results\": [",
+			reps, max_e);
+	for (int i = 0; i < no_results; i++) {
+		result_t *r = &results[i];
+		fprintf(fp, "%s\n\t\t{ \"op\": \"%s\", \"layout\": \"%s\", "
+				"\"codec\": \"%s\", \"e\": %d, \"bytes\": %d, "
+				"\"shares\": %d, \"median_ns\": %.0f, "
+				"\"min_ns\": %.0f, \"max_ns\": %.0f }",
+				i ? "," : "", r->op, r->layout, r->codec, r->e,
+				r->bytes, r->shares, r->median, r->min, r->max);
+	}
+	fprintf(fp, "\n\t]\n}\n");
+}
+
+int main(int argc, char *argv[]) {
+	static const char *codecs[] = {
+		"base16", "bip39", "bip39seed", "diceware", "base58"
+	};
+	slip0039_ctx_t *ctx = malloc(sizeof(*ctx));
+	char plaintext[DISPLAYLINE], hex[2*64 + 1];
+	const char *output = NULL;
+	FILE *fp = stdout;
+	int max_e = 4, opt;
+
+	verbose_init(argv[0]);
+	while ((opt = getopt(argc, argv, "r:e:o:")) != -1) switch (opt) {
+		case 'r': reps = atoi(optarg); break;
+		case 'e': max_e = atoi(optarg); break;
+		case 'o': output = optarg; break;
+		default: ABORT("usage: %s [ -r REPS ] [ -e MAX_EXP ] "
+					 "[ -o FILE ]", exec_name);
+	}
+	if (reps < 1 || max_e < 0 || max_e > 31 || optind != argc || !ctx)
+		ABORT("usage: %s [ -r REPS ] [ -e MAX_EXP ] [ -o FILE ]",
+				exec_name);
+
+	quiet = 1;
+	slip0039_lib_init();
+
+	for (int l = 0; l < sizeof(layouts)/sizeof(*layouts); l++)
+		for (int e = 0; e <= max_e; e++)
+			for (int bytes = 16; bytes <= 64; bytes <<= 1) {
+				secret(hex, bytes);
+				scenario(ctx, &layouts[l], e, "base16", hex,
+						bytes, hex);
+			}
+
+	/* every codec at e=0 with a plaintext that is obtained by decoding
+	 * a secret of the size the codec requires */
+	for (int i = 0; i < sizeof(codecs)/sizeof(*codecs); i++) {
+		int bytes = strcmp(codecs[i], "base58") ? 32 : 64, bip39seed;
+
+		bip39seed = !strcmp(codecs[i], "bip39seed");
+		secret(hex, bytes);
+		split(ctx, "base16", &layouts[0].spec, 0, hex);
+		select_mnemonics(&layouts[0].spec, 1);
+		recover(ctx, bip39seed ? "bip39" : codecs[i], plaintext,
+				sizeof(plaintext));
+		scenario(ctx, &layouts[0], 0, codecs[i], plaintext, bytes,
+				bip39seed ? NULL : plaintext);
+	}
+
+	if (output && !(fp = fopen(output, "w")))
+		ABORT("fatal:unable to open %s", output);
+	write_json(fp, max_e);
+	if (fp != stdout && fclose(fp))
+		ABORT("fatal:error writing %s", output);
+
+	free(ctx);
+
+	return 0;
+}
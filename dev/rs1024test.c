@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../rs1024.h"
+
+#define NO_MNEMONICS 10000
+#define MAX_LENGTH 64
+
+uint16_t storage[NO_MNEMONICS][MAX_LENGTH];
+const uint16_t *mnemonics[NO_MNEMONICS];
+size_t lengths[NO_MNEMONICS];
+bool valid[NO_MNEMONICS];
+
+// the checksum as the parser computes it, one value at a time
+static bool verify_add_value(const uint16_t *input, size_t no_input) {
+	rs1024_state_t s, ok = RS1024_INIT;
+
+	rs1024_init_slip0039(&s);
+	for (size_t i = 0; i < no_input; i++) rs1024_add_value(&s, input[i]);
+
+	return s.chk == ok.chk;
+}
+
+int main(int argc, char *argv[]) {
+	int mismatch = 0, no_valid = 0;
+	clock_t start;
+
+	srand(1);
+
+	/* random mnemonics of 1 to MAX_LENGTH words (the lengths of all
+	 * supported secrets and then some), half of them with an error */
+	for (int i = 0; i < NO_MNEMONICS; i++) {
+		lengths[i] = 1 + rand()%MAX_LENGTH;
+		mnemonics[i] = storage[i];
+		for (size_t k = 0; k < lengths[i]; k++)
+			storage[i][k] = rand()&1023;
+		if (lengths[i] > 3) rs1024_add(storage[i], lengths[i] - 3);
+		if (rand()%2) storage[i][rand()%lengths[i]] ^= 1 + rand()%1023;
+	}
+
+	start = clock();
+	rs1024_verify_many(mnemonics, lengths, NO_MNEMONICS, valid);
+	printf("rs1024_verify_many: %.3fs\n",
+			(double)(clock() - start)/CLOCKS_PER_SEC);
+
+	start = clock();
+	for (int i = 0; i < NO_MNEMONICS; i++) {
+		if (valid[i] != verify_add_value(storage[i], lengths[i]))
+			mismatch++;
+		no_valid += valid[i];
+	}
+	printf("rs1024_add_value: %.3fs\n",
+			(double)(clock() - start)/CLOCKS_PER_SEC);
+
+	// partial batches, as the parser flushes them
+	for (size_t count = 1; count <= 2*RS1024_LANES + 1; count++) {
+		size_t offset = rand()%(NO_MNEMONICS - count);
+		rs1024_verify_many(mnemonics + offset, lengths + offset,
+				count, valid);
+		for (size_t i = 0; i < count; i++)
+			if (valid[i] != verify_add_value(storage[offset + i],
+						lengths[offset + i]))
+				mismatch++;
+	}
+
+	printf("valid=%d mismatch=%d\n", no_valid, mismatch);
+
+	exit(mismatch != 0);
+}
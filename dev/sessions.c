@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../libslip0039.h"
+#include "../verbose.h"
+
+#define NO_THREADS 4
+
+/* every thread splits two secrets and recovers them with two sessions
+ * that are fed alternately, so the sessions must not share any state */
+static void *run(void *arg) {
+	static const slip0039_spec_t spec = { .e = 0, .GT = 1, .G = 1,
+		.groups = { { .threshold = 2, .count = 3 } } };
+	slip0039_ctx_t *ctx = malloc(4*sizeof(slip0039_ctx_t));
+	char *out[2], *cur[2], plaintext[2][33], seed[80];
+	sbuf_t sb[2];
+	int no = *(int*)arg, failed = 0;
+
+	for (int k = 0; k < 2; k++) {
+		snprintf(plaintext[k], sizeof(plaintext[k]), "%032x", no*2 + k);
+		snprintf(seed, sizeof(seed), "seed for thread %d session %d, "
+				"long enough to keep quiet.............", no, k);
+		out[k] = calloc(MAX_SHARES*MAX_SHARES, LINE);
+		sb[k] = (sbuf_t){ .buf = out[k],
+			.size = MAX_SHARES*MAX_SHARES*LINE };
+
+		slip0039_ctx_init(&ctx[k]);
+		if (slip0039_add_passphrase(&ctx[k], "TREZOR", 6) ||
+				slip0039_split_init(&ctx[k], &spec) ||
+				slip0039_split_seed(&ctx[k], seed, strlen(seed)) ||
+				slip0039_split_plaintext(&ctx[k], plaintext[k]) ||
+				slip0039_split_mnemonics(&ctx[k], &sb[k])) {
+			printf("split: %s\n", slip0039_ctx_error(&ctx[k]));
+			exit(1);
+		}
+
+		// recover from the last two shares
+		cur[k] = strchr(out[k], '\n') + 1;
+		slip0039_ctx_init(&ctx[k + 2]);
+		slip0039_add_passphrase(&ctx[k + 2], "TREZOR", 6);
+	}
+
+	while (*cur[0] || *cur[1])
+		for (int k = 0; k < 2; k++)
+			if (*cur[k] && slip0039_recover_add_char(&ctx[k + 2],
+						*cur[k]++, NULL)) {
+				printf("parse: %s\n",
+						slip0039_ctx_error(&ctx[k + 2]));
+				exit(1);
+			}
+
+	for (int k = 0; k < 2; k++) {
+		if (slip0039_recover_finish(&ctx[k + 2]))
+			printf("recover: %s\n", slip0039_ctx_error(&ctx[k + 2]));
+		if (strcmp(ctx[k + 2].plaintext, plaintext[k])) failed++;
+		free(out[k]);
+	}
+
+	for (int k = 0; k < 4; k++) slip0039_ctx_wipe(&ctx[k]);
+	free(ctx);
+
+	*(int*)arg = failed;
+
+	return NULL;
+}
+
+int main(int argc, char *argv[]) {
+	pthread_t threads[NO_THREADS];
+	int args[NO_THREADS], failed = 0;
+
+	quiet = 1;
+	slip0039_lib_init();
+
+	for (int i = 0; i < NO_THREADS; i++) {
+		args[i] = i;
+		pthread_create(&threads[i], NULL, run, &args[i]);
+	}
+
+	for (int i = 0; i < NO_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+		failed += args[i];
+	}
+
+	printf("%d of %d sessions failed\n", failed, 2*NO_THREADS);
+
+	return failed != 0;
+}
@@ -23,7 +23,7 @@ int main(int argc, char *argv[]) {
 	verbose_init(argv[0]);
 	codec_init();
 	wordlists_init();
-	base_init_scratch(&bs, scratch, 1024/4);
+	base_init_scratch(&bs, scratch, sizeof(scratch)/BASE_SCRATCH_SIZE(1));
 	//char msg[3] = "abc";
 	uint8_t stuff[64];
 	struct sha512_ctx ctx;
@@ -73,7 +73,7 @@ int main(int argc, char *argv[]) {
 	int index = 0;
 
 	while (*ptr) {
-		bla[index] = wordlist_search(&wordlist_base58, ptr, &ptr);
+		bla[index] = wordlist_search(&wordlist_base58, ptr, &ptr, NULL);
 		index++;
 	}
 	for (int i = 0; i < 111; i++) {
@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../libslip0039.h"
+#include "../verbose.h"
+
+/* run the test vectors in vectors.json through the library, in parallel,
+ * instead of running the program for every vector, like test.sh does;
+ * every vector is an array of a description, an array of mnemonics, the
+ * expected master secret ("" if the mnemonics are invalid) and an xprv,
+ * which is not checked; then split and recover random secrets with random
+ * group specifications (round trips) */
+
+#define PASSPHRASE "TREZOR"
+#define MAX_MNEMONICS 64
+#define OUTPUT_SIZE (MAX_SHARES*MAX_SHARES*LINE)
+
+typedef struct vector_s {
+	char *name, *secret;
+	char *mnemonics[MAX_MNEMONICS];
+	int no_mnemonics;
+	int passed;
+	displayline_t result;
+} vector_t;
+
+typedef struct trip_s {
+	uint64_t seed;
+	int passed;
+	displayline_t result;
+} trip_t;
+
+static vector_t *vectors;
+static int no_vectors;
+static trip_t *trips;
+static int no_trips = 32;
+static uint64_t trip_seed = 1;
+
+/* the vectors (numbered from 1) that are expected to fail: the extendable
+ * backup flag is not supported, so the checksums of these mnemonics (which
+ * use the customization string "shamir_extendable") do not verify */
+static const int expected_failures[] = { 42, 43, 44, 45 };
+
+static int expected_failure(int no) {
+	for (size_t i = 0; i < sizeof(expected_failures)/
+			sizeof(*expected_failures); i++)
+		if (expected_failures[i] == no) return 1;
+
+	return 0;
+}
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static int next = 0; // vectors first, then the round trips
+
+/* a parser for the subset of JSON used by vectors.json: arrays and
+ * strings with simple escapes */
+static const char *json, *json_start;
+
+static void json_error(const char *msg) {
+	ABORT("fatal:vectors.json:%ld: %s", json - json_start, msg);
+}
+
+static void json_ws() {
+	while (*json == ' ' || *json == '\t' || *json == '\n' || *json == '\r')
+		json++;
+}
+
+static void json_expect(char c) {
+	json_ws();
+	if (*json != c) {
+		char msg[32];
+		snprintf(msg, sizeof(msg), "expected '%c'", c);
+		json_error(msg);
+	}
+	json++;
+}
+
+// returns 1 and skips c if it is the next character
+static int json_accept(char c) {
+	json_ws();
+	if (*json != c) return 0;
+	json++;
+	return 1;
+}
+
+static char *json_string() {
+	char *s, *out;
+
+	json_expect('"');
+	if (!(s = out = malloc(strlen(json) + 1))) json_error("out of memory");
+	while (*json != '"') {
+		if (!*json) json_error("unterminated string");
+		if (*json == '\\') switch (*++json) {
+			case '"': case '\\': case '/': *out++ = *json++; break;
+			case 'n': *out++ = '\n'; json++; break;
+			case 't': *out++ = '\t'; json++; break;
+			default: json_error("unsupported escape");
+		} else *out++ = *json++;
+	}
+	json++;
+	*out = '\0';
+
+	return s;
+}
+
+static void json_vector(vector_t *v) {
+	json_expect('[');
+	v->name = json_string();
+	json_expect(',');
+	json_expect('[');
+	if (!json_accept(']')) do {
+		if (v->no_mnemonics == MAX_MNEMONICS)
+			json_error("too many mnemonics");
+		v->mnemonics[v->no_mnemonics++] = json_string();
+	} while (json_accept(','));
+	else json--;
+	json_expect(']');
+	json_expect(',');
+	v->secret = json_string();
+	while (json_accept(',')) free(json_string()); // the xprv
+	json_expect(']');
+}
+
+static void read_vectors(const char *file) {
+	FILE *fp = fopen(file, "r");
+	char *buf;
+	long size;
+	int max = 0;
+
+	if (!fp) ABORT("fatal:unable to open %s: %s", file, strerror(errno));
+	if (fseek(fp, 0, SEEK_END) || (size = ftell(fp)) < 0 ||
+			fseek(fp, 0, SEEK_SET) || !(buf = malloc(size + 1)) ||
+			fread(buf, 1, size, fp) != size)
+		ABORT("fatal:unable to read %s", file);
+	buf[size] = '\0';
+	fclose(fp);
+
+	json = json_start = buf;
+	json_expect('[');
+	if (!json_accept(']')) do {
+		if (no_vectors == max) {
+			max = max ? 2*max : 64;
+			if (!(vectors = realloc(vectors, max*sizeof(*vectors))))
+				json_error("out of memory");
+		}
+		memset(&vectors[no_vectors], 0, sizeof(*vectors));
+		json_vector(&vectors[no_vectors++]);
+	} while (json_accept(','));
+	else json--;
+	json_expect(']');
+	json_ws();
+	if (*json) json_error("junk after array");
+
+	free(buf);
+}
+
+static void run_vector(slip0039_ctx_t *ctx, vector_t *v) {
+	slip0039_error_t err = SLIP0039_OK;
+
+	slip0039_ctx_init(ctx);
+	slip0039_add_passphrase(ctx, PASSPHRASE, strlen(PASSPHRASE));
+	for (int i = 0; i < v->no_mnemonics && !err; i++)
+		err = slip0039_recover_add_mnemonic(ctx, v->mnemonics[i]);
+	if (!err) err = slip0039_recover_finish(ctx);
+
+	if (err) {
+		snprintf(v->result, sizeof(v->result), "%s",
+				slip0039_ctx_error(ctx));
+		v->passed = !*v->secret;
+	} else {
+		snprintf(v->result, sizeof(v->result), "%s", ctx->plaintext);
+		v->passed = !strcmp(ctx->plaintext, v->secret);
+	}
+
+	slip0039_ctx_wipe(ctx);
+}
+
+// xorshift, seeded per round trip so that the result is independent of
+// the number of threads
+static uint64_t rnd(uint64_t *state) {
+	*state ^= *state<<13;
+	*state ^= *state>>7;
+	*state ^= *state<<17;
+	return *state;
+}
+
+#define FAIL(t, ctx, what) do { \
+	snprintf((t)->result, sizeof((t)->result), "%s: %s", what, \
+			slip0039_ctx_error(ctx)); \
+	slip0039_ctx_wipe(ctx); \
+	return; \
+} while (0)
+
+/* split a random secret with a random spec and recover it from the
+ * shares of a random quorum, fed in random order */
+static void run_trip(slip0039_ctx_t *ctx, trip_t *t, char *output) {
+	uint64_t state = t->seed;
+	slip0039_spec_t spec = { .e = 0 };
+	char plaintext[2*32 + 1], seed[80], *lines[MAX_SHARES*MAX_SHARES];
+	sbuf_t out = { .buf = output, .size = OUTPUT_SIZE };
+	int bytes = 16 + 2*(rnd(&state)%9), no_lines = 0, first[MAX_SHARES];
+	int used[MAX_SHARES*MAX_SHARES] = { 0 }, order[MAX_SHARES*MAX_SHARES];
+	int selected[MAX_SHARES] = { 0 }, no_order = 0;
+
+	spec.G = 1 + rnd(&state)%4;
+	spec.GT = 1 + rnd(&state)%spec.G;
+	for (int i = 0; i < spec.G; i++) {
+		spec.groups[i].count = 1 + rnd(&state)%5;
+		spec.groups[i].threshold = 1 +
+			rnd(&state)%spec.groups[i].count;
+		// a threshold of 1 requires a count of 1
+		if (spec.groups[i].threshold == 1) spec.groups[i].count = 1;
+	}
+	for (int i = 0; i < bytes; i++)
+		sprintf(plaintext + 2*i, "%02x", (uint8_t)rnd(&state));
+	snprintf(seed, sizeof(seed), "round trip seed %016llx, long enough "
+			"to keep quiet...........", (unsigned long long)t->seed);
+
+	slip0039_ctx_init(ctx);
+	if (slip0039_add_passphrase(ctx, PASSPHRASE, strlen(PASSPHRASE)) ||
+			slip0039_split_init(ctx, &spec) ||
+			slip0039_split_seed(ctx, seed, strlen(seed)) ||
+			slip0039_split_plaintext(ctx, plaintext) ||
+			slip0039_split_mnemonics(ctx, &out))
+		FAIL(t, ctx, "split");
+	slip0039_ctx_wipe(ctx);
+
+	for (char *c = output; *c; c = strchr(c, '\n') + 1)
+		lines[no_lines++] = c;
+
+	// select threshold members of GT random groups
+	for (int i = 0, line = 0; i < spec.G; i++) {
+		first[i] = line;
+		line += spec.groups[i].count;
+	}
+	for (int k = 0; k < spec.GT; k++) {
+		int g;
+		do g = rnd(&state)%spec.G; while (selected[g]);
+		selected[g] = 1;
+		for (int j = 0; j < spec.groups[g].threshold; j++) {
+			int m;
+			do m = first[g] + rnd(&state)%spec.groups[g].count;
+			while (used[m]);
+			used[m] = 1;
+			order[no_order++] = m;
+		}
+	}
+	for (int i = no_order - 1; i > 0; i--) {
+		int j = rnd(&state)%(i + 1), tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+
+	slip0039_ctx_init(ctx);
+	slip0039_add_passphrase(ctx, PASSPHRASE, strlen(PASSPHRASE));
+	for (int i = 0; i < no_order; i++)
+		for (char *c = lines[order[i]]; ; c++) {
+			if (slip0039_recover_add_char(ctx, *c, NULL))
+				FAIL(t, ctx, "parse");
+			if (*c == '\n') break;
+		}
+	if (slip0039_recover_finish(ctx)) FAIL(t, ctx, "recover");
+
+	snprintf(t->result, sizeof(t->result), "%s", ctx->plaintext);
+	t->passed = !strcmp(ctx->plaintext, plaintext);
+	slip0039_ctx_wipe(ctx);
+}
+
+static void *worker(void *arg) {
+	slip0039_ctx_t *ctx = malloc(sizeof(*ctx));
+	char *output = malloc(OUTPUT_SIZE);
+	int i;
+
+	if (!ctx || !output) ABORT("fatal:out of memory");
+
+	for (;;) {
+		pthread_mutex_lock(&lock);
+		i = next++;
+		pthread_mutex_unlock(&lock);
+
+		if (i < no_vectors) run_vector(ctx, &vectors[i]);
+		else if (i < no_vectors + no_trips)
+			run_trip(ctx, &trips[i - no_vectors], output);
+		else break;
+	}
+
+	free(output);
+	free(ctx);
+
+	return NULL;
+}
+
+int main(int argc, char *argv[]) {
+	long int threads = sysconf(_SC_NPROCESSORS_ONLN);
+	const char *file = "vectors.json";
+	int opt, passed = 0, trips_passed = 0, unexpected = 0, err;
+
+	verbose_init(argv[0]);
+	while ((opt = getopt(argc, argv, "j:r:s:")) != -1) switch (opt) {
+		case 'j': threads = atol(optarg); break;
+		case 'r': no_trips = atoi(optarg); break;
+		case 's': trip_seed = strtoull(optarg, NULL, 0); break;
+		default: ABORT("usage: %s [ -j THREADS ] [ -r ROUND_TRIPS ] "
+					 "[ -s SEED ] [ VECTORS ]", exec_name);
+	}
+	if (optind < argc) file = argv[optind++];
+	if (optind != argc || threads < 1 || no_trips < 0)
+		ABORT("usage: %s [ -j THREADS ] [ -r ROUND_TRIPS ] "
+				"[ -s SEED ] [ VECTORS ]", exec_name);
+
+	quiet = 1;
+	slip0039_lib_init();
+	read_vectors(file);
+
+	if (!(trips = calloc(no_trips + 1, sizeof(*trips))))
+		ABORT("fatal:out of memory");
+	for (int i = 0; i < no_trips; i++) // xorshift needs a nonzero state
+		trips[i].seed = (trip_seed<<32) + i + 1;
+
+	pthread_t workers[threads];
+	for (long int i = 0; i < threads; i++)
+		if ((err = pthread_create(&workers[i], NULL, worker, NULL)))
+			ABORT("fatal:unable to create thread: %s",
+					strerror(err));
+	for (long int i = 0; i < threads; i++)
+		pthread_join(workers[i], NULL);
+
+	for (int i = 0; i < no_trips; i++) {
+		if (trips[i].passed) trips_passed++;
+		else printf("round trip %d (seed 0x%llx) failed: %s\n", i + 1,
+				(unsigned long long)trips[i].seed,
+				trips[i].result);
+	}
+	printf("passed %d/%d round trips\n", trips_passed, no_trips);
+
+	for (int i = 0; i < no_vectors; i++) {
+		vector_t *v = &vectors[i];
+		int expected = expected_failure(i + 1);
+		printf("%s %s", v->passed ? "Passed" : "Failed", v->name);
+		if (!v->passed) printf(": expected \"%s\", got \"%s\"",
+				v->secret, v->result);
+		if (expected) printf(" (%s)", v->passed ?
+				"unexpected pass" : "expected failure");
+		printf("\n");
+		passed += v->passed;
+		if (v->passed == expected) unexpected++;
+	}
+	printf("passed %d/%d tests\n", passed, no_vectors);
+	if (unexpected) printf("%d unexpected result(s)\n", unexpected);
+
+	return trips_passed != no_trips || unexpected;
+}
@@ -23,21 +23,34 @@
 #include "hmac.h"
 #include "utils.h"
 #include "verbose.h"
+#include "stats.h"
 
-void digest_verify(const uint8_t *digest, const uint8_t *secret, size_t n) {
+// returns 1 if the digest is correct, 0 otherwise
+int digest_check(const uint8_t *digest, const uint8_t *secret, size_t n) {
 	assert(digest && secret && n >= 16);
 	uint8_t computed[DIGEST_LEN];
+	STATS_START(start);
+	int ret;
 
 	// compute HMAC-SHA256 with last n - 4 bytes of digest share (254)
 	// as key and the secret share (255) as data
 	hmac(computed, DIGEST_LEN, digest + DIGEST_LEN,
 			n - DIGEST_LEN, secret, n, HASH_SHA256);
 
-	if (!memeq(digest, computed, DIGEST_LEN)) FATAL("digest failed");
+	ret = memeq(digest, computed, DIGEST_LEN);
+	STATS_STOP(start, STATS_DIGEST);
+
+	return ret;
+}
+
+void digest_verify(const uint8_t *digest, const uint8_t *secret, size_t n) {
+	if (!digest_check(digest, secret, n)) FATAL("digest failed");
 }
 
 void digest_compute(uint8_t *digest, const uint8_t *secret, size_t n) {
 	assert(digest && secret && n >= 16);
+	STATS_START(start);
 	hmac(digest, DIGEST_LEN, digest + DIGEST_LEN,
 			n - DIGEST_LEN, secret, n, HASH_SHA256);
+	STATS_STOP(start, STATS_DIGEST);
 }
@@ -26,6 +26,8 @@
 
 void digest_verify(const uint8_t*, const uint8_t*, size_t);
 
+int digest_check(const uint8_t*, const uint8_t*, size_t);
+
 void digest_compute(uint8_t*, const uint8_t*, size_t);
 
 #endif /* SLIP0039_DIGEST_H */
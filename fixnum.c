@@ -213,7 +213,7 @@ static uint16_t popcnt_helper(uint8_t n) {
 uint16_t fixnum_popcnt(const fixnum_t *f) {
 	assert(f && f->limbs && f->no_limbs > 0);
 
-	uint16_t n;
+	uint16_t n = 0;
 
 	for (int i = 0; i < f->no_limbs; i++) {
 		n += popcnt_helper(f->limbs[i]);
@@ -231,10 +231,15 @@ void fixnum_divisor_init_from_fixnum(fixnum_divisor_t *d, const fixnum_t *in, ui
 	d->p.pure = (popcnt == 1);
 	fixnum_init_fixnum(&d->max_left_shift, limbs, no_limbs, in);
 
-	fixnum_set_fixnum(&d->max_left_shift, in);
-
 	uint16_t msb = d->p.log2 = 8*no_limbs - 1;
 
+	// the divisor is public, so we can skip whole zero limbs
+	// before shifting bit by bit
+	while (d->max_left_shift.limbs[0] == 0) {
+		d->p.log2 -= 8;
+		fixnum_shl(&d->max_left_shift, 8);
+	}
+
 	// now check if the last bit is 1 and shift left until it is, we calculate log2
 	// and compute the max left shifted value
 	while (!fixnum_peek(&d->max_left_shift, msb, 1)) {
@@ -246,6 +251,22 @@ void fixnum_divisor_init_from_fixnum(fixnum_divisor_t *d, const fixnum_t *in, ui
 	assert(d->p.log2);
 }
 
+void fixnum_divisor_init_from_uint64(fixnum_divisor_t *d, uint64_t value,
+		uint8_t *limbs, size_t no_limbs) {
+	assert(d && limbs && no_limbs >= 8 && value > 1);
+	d->p.pure = (value&(value - 1)) == 0;
+	d->p.log2 = 63;
+
+	// the divisor is public, so this loop may depend on its value
+	while (!(value>>63)) {
+		d->p.log2--;
+		value <<= 1;
+	}
+
+	fixnum_init_pattern(&d->max_left_shift, limbs, no_limbs, PATTERN_ZERO);
+	for (int i = 0; i < 8; i++) limbs[i] = value>>(56 - 8*i);
+}
+
 uint32_t fixnum_peek(const fixnum_t *f, size_t offset, uint8_t size) {
 	assert(f);
 	if (offset + size > f->no_limbs<<3) {
@@ -430,10 +451,13 @@ uint16_t fixnum_div(fixnum_t *f, const fixnum_divisor_t *d, fixnum_scratch_t *s,
 	for (int i = 0; i < f->no_limbs; i++)
 		f->limbs[i] &= -(1 - dividendmaxplus1);
 
-	// s->a is used as a shift register and s->b is brought to zero
-	if (d->p.pure)
+	/* a power of two can be handled by shifting, as long as the
+	 * remainder fits in the return value, larger powers of two
+	 * are handled by the long division below */
+	if (d->p.pure && d->p.log2 <= 16)
 		return fixnum_shr_in(f, d->p.log2, dividendmaxplus1);
 
+	// s->a is used as a shift register and s->b is brought to zero
 	assert(s->a.no_limbs >= f->no_limbs && s->b.no_limbs >= f->no_limbs);
 
 	//printf("f->no_limbs=%ld\n", f->no_limbs);
@@ -466,6 +490,98 @@ uint16_t fixnum_div(fixnum_t *f, const fixnum_divisor_t *d, fixnum_scratch_t *s,
 	return ret;
 }
 
+uint64_t fixnum_add_uint64(fixnum_t *f, uint64_t operand) {
+	assert(f && f->no_limbs > 0);
+	uint64_t acc = 0;
+	size_t idx = f->no_limbs;
+
+	while (idx-- > 0) {
+		acc += f->limbs[idx] + (operand&0xff);
+		f->limbs[idx] = acc&0xff;
+		operand >>= 8;
+		acc >>= 8;
+	}
+
+	// nonzero if the result does not fit in f
+	return acc|operand;
+}
+
+uint64_t fixnum_mul64(fixnum_t *f, uint64_t m) {
+	assert(f && f->no_limbs > 0);
+	unsigned __int128 acc = 0;
+	size_t idx = f->no_limbs;
+
+	while (idx-- > 0) {
+		acc += (unsigned __int128)m*f->limbs[idx];
+		f->limbs[idx] = acc&0xff;
+		acc >>= 8;
+	}
+
+	// nonzero if the result does not fit in f
+	return acc;
+}
+
+/* long division of f by d, f is replaced by the quotient, the remainder
+ * is left in r, which is a view of the last f->no_limbs limbs of s->b
+ *
+ * unlike fixnum_div(), only f->no_limbs limbs of the scratch space are
+ * used, so the cost depends on the size of f and not on the size
+ * of the scratch space */
+static void divmod_helper(fixnum_t *f, const fixnum_divisor_t *d,
+		fixnum_scratch_t *s, fixnum_t *r) {
+	assert(f && d && f->no_limbs == d->max_left_shift.no_limbs && f->no_limbs >= 2);
+	assert(!d->p.pure && d->p.log2 < f->no_limbs<<3);
+	assert(s->a.no_limbs >= f->no_limbs && s->b.no_limbs >= f->no_limbs);
+	fixnum_t a;
+	size_t bit = (f->no_limbs<<3) - d->p.log2;
+	uint32_t test;
+
+	fixnum_init(&a, s->a.limbs + s->a.no_limbs - f->no_limbs, f->no_limbs);
+	fixnum_init(r, s->b.limbs + s->b.no_limbs - f->no_limbs, f->no_limbs);
+
+	fixnum_set_fixnum(r, f);
+	fixnum_set_pattern(f, PATTERN_ZERO);
+	fixnum_set_fixnum(&a, &d->max_left_shift);
+
+	while (bit-- > 0) {
+		fixnum_shl(f, 1);
+		test = fixnum_sub_fixnum(r, &a, 0xff);
+		fixnum_add_uint16(f, 1 - test);
+		fixnum_add_fixnum(r, &a, -test);
+		fixnum_shr(&a, 1);
+	}
+}
+
+uint64_t fixnum_div64(fixnum_t *f, const fixnum_divisor_t *d, fixnum_scratch_t *s) {
+	assert(d && d->p.log2 < 64);
+	uint64_t ret = 0;
+	fixnum_t r;
+
+	divmod_helper(f, d, s, &r);
+
+	for (int i = 0; i < 8 && i < r.no_limbs; i++)
+		ret |= (uint64_t)r.limbs[r.no_limbs - 1 - i]<<(i<<3);
+
+	wipememory(r.limbs, r.no_limbs);
+
+	return ret;
+}
+
+void fixnum_divmod(fixnum_t *f, const fixnum_divisor_t *d,
+		fixnum_scratch_t *s, fixnum_t *rem) {
+	fixnum_t r;
+
+	divmod_helper(f, d, s, &r);
+
+	// the remainder is smaller than the divisor, so it
+	// fits in rem if rem has at least log2/8 + 1 limbs
+	assert(rem && rem->no_limbs <= r.no_limbs &&
+			rem->no_limbs >= (d->p.log2>>3) + 1);
+	memcpy(rem->limbs, r.limbs + r.no_limbs - rem->no_limbs, rem->no_limbs);
+
+	wipememory(r.limbs, r.no_limbs);
+}
+
 uint16_t fixnum_calc_log2(const fixnum_t *f) {
 	int bits = f->no_limbs*8;
 	uint16_t log2 = 0xffff;
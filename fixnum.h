@@ -25,6 +25,12 @@
 
 #include "config.h"
 
+/* fixnum_mul64() and the chunked base conversion need a 128 bit integer
+ * type, GCC and Clang provide one on 64 bit platforms */
+#ifndef __SIZEOF_INT128__
+#error "unsigned __int128 is required, use GCC or Clang on a 64 bit platform"
+#endif
+
 /* we work in a context where our binary data is processed in chunks
  * of 16 bits, but since we need to account for endianness, we represent
  * our fixnums as arrays of uint8_t's */
@@ -91,6 +97,9 @@ void fixnum_divisor_init_from_multiplier16(fixnum_divisor_t*,
 void fixnum_divisor_init_from_fixnum(fixnum_divisor_t*,
 		const fixnum_t*, uint8_t*, size_t);
 
+void fixnum_divisor_init_from_uint64(fixnum_divisor_t*,
+		uint64_t, uint8_t*, size_t);
+
 uint32_t fixnum_peek(const fixnum_t*, size_t, uint8_t);
 
 void fixnum_poke(fixnum_t*, size_t, uint8_t, uint32_t);
@@ -117,6 +126,14 @@ uint16_t fixnum_popcnt(const fixnum_t*);
 
 uint16_t fixnum_div(fixnum_t*, const fixnum_divisor_t*, fixnum_scratch_t*, int);
 
+uint64_t fixnum_add_uint64(fixnum_t*, uint64_t);
+
+uint64_t fixnum_mul64(fixnum_t*, uint64_t);
+
+uint64_t fixnum_div64(fixnum_t*, const fixnum_divisor_t*, fixnum_scratch_t*);
+
+void fixnum_divmod(fixnum_t*, const fixnum_divisor_t*, fixnum_scratch_t*, fixnum_t*);
+
 uint16_t fixnum_calc_log2(const fixnum_t*);
 
 #endif /* SLIP0039_FIXNUM_H */
@@ -25,6 +25,7 @@
 // GF(256) artithmetic is nicely explained in
 // https://www.cs.utsa.edu/~wagner/laws/FFM.html
 #include "gf256.h"
+#include "stats.h"
 
 // our polynomial is x^8 + x^4 + x^3 + x + 1 = 0x11b
 // the 8th bit is implied
@@ -38,6 +39,8 @@ uint8_t gf256_mul(uint8_t a, uint8_t b) {
 	uint8_t res = 0;
 	int i = 7;
 
+	STATS_COUNT(STATS_GF256_MUL);
+
 	goto entry;
 
 	while (i--) {
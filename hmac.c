@@ -23,6 +23,7 @@
 #include "hmac.h"
 #include "utils.h"
 #include "endian.h"
+#include "stats.h"
 
 void hmac_init(hmac_t *h, hash_type_t type) {
 	h->state = 0;
@@ -82,8 +83,25 @@ void hmac_update_data_uint32be(hmac_t *h, uint32_t val) {
 	hmac_update_data(h, &val32be, sizeof(val32be));
 }
 
+// compute the state of the outer hash after processing the key XOR opad,
+// so that the outer hash of a keyed hmac can be computed more than once
+// without processing the key again
+void hmac_outer(const hmac_t *h, hash_t *outer) {
+	uint8_t buf[HASH_MAX_BLOCKSIZE];
+	assert(h->state == 2);
+
+	// remove XOR for ipad and do XOR for opad
+	for (int i = 0; i < h->h.f->blocksize; i++)
+		buf[i] = h->buf[i]^0x36^0x5c;
+
+	hash_init(outer, h->type);
+	hash_update(outer, buf, h->h.f->blocksize);
+	wipememory(buf, sizeof(buf));
+}
+
 void hmac_done(hmac_t *h, uint8_t *sha, size_t size) {
 	uint8_t buf[h->h.f->len];
+	STATS_COUNT(STATS_HMAC);
 	if (h->state != 2) finish_processing_key(h);
 	hash_finalize(&h->h, buf, h->h.f->len);
 
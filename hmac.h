@@ -38,6 +38,8 @@ void hmac_update_data(hmac_t*, const void*, size_t);
 
 void hmac_update_data_uint32be(hmac_t*, uint32_t);
 
+void hmac_outer(const hmac_t*, hash_t*);
+
 void hmac_done(hmac_t*, uint8_t*, size_t);
 
 void hmac(uint8_t *sha, size_t, const void*, size_t, const void*, size_t, hash_type_t);
@@ -0,0 +1,125 @@
+/* input.c - line input with read(2) into locked memory
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "input.h"
+#include "verbose.h"
+#include "utils.h"
+
+void input_init(input_t *in, int fd, char *buf, size_t size) {
+	assert(in && buf && size > 0);
+	in->fd = fd;
+	in->buf = buf;
+	in->size = size;
+	in->line = in->start = in->end = 0;
+	in->eof = 0;
+}
+
+// wipe the line that was returned last, the caller is done with it
+static void input_release(input_t *in) {
+	wipememory(in->buf + in->line, in->start - in->line);
+	in->line = in->start;
+}
+
+/* move the unread data to the start of the buffer and read more,
+ * returns the number of bytes read, 0 on EOF */
+static size_t input_fill(input_t *in, const char *desc) {
+	ssize_t ret;
+
+	input_release(in);
+	if (in->start) {
+		size_t unread = in->end - in->start;
+		memmove(in->buf, in->buf + in->start, unread);
+		wipememory(in->buf + unread, in->start);
+		in->line = in->start = 0;
+		in->end = unread;
+	}
+
+	if (in->eof || in->end == in->size) return 0;
+
+	while ((ret = read(in->fd, in->buf + in->end,
+					in->size - in->end)) < 0)
+		if (errno != EINTR) FATAL("error %d reading %s: %s", errno,
+				desc, strerror(errno));
+
+	if (!ret) in->eof = 1;
+	in->end += ret;
+
+	return ret;
+}
+
+int input_peek(input_t *in, const char *desc) {
+	input_release(in);
+	if (in->start == in->end && !input_fill(in, desc)) return EOF;
+
+	return (unsigned char)in->buf[in->start];
+}
+
+int input_getc(input_t *in, const char *desc) {
+	int c = input_peek(in, desc);
+
+	if (c != EOF) {
+		in->buf[in->start++] = '\0';
+		in->line = in->start;
+	}
+
+	return c;
+}
+
+char *input_line(input_t *in, size_t max, size_t *len, const char *desc,
+		int eof_acceptable) {
+	char *nl;
+	size_t scanned = 0;
+
+	input_release(in);
+	assert(max > 0 && max <= in->size);
+
+	while (!(nl = memchr(in->buf + in->start + scanned, '\n',
+					in->end - in->start - scanned))) {
+		scanned = in->end - in->start;
+		if (scanned >= max) FATAL("buffer full before encountering "
+				"\\n while reading %s", desc);
+		if (!input_fill(in, desc)) {
+			if (in->end != in->start || !eof_acceptable)
+				FATAL("EOF encountered before \\n while "
+						"reading %s", desc);
+			return NULL;
+		}
+	}
+
+	*len = nl - (in->buf + in->start);
+	if (*len >= max) FATAL("buffer full before encountering \\n while "
+			"reading %s", desc);
+	*nl = '\0';
+	nl = in->buf + in->start;
+	in->start += *len + 1;
+
+	return nl;
+}
+
+void input_wipe(input_t *in) {
+	wipememory(in->buf, in->size);
+	in->line = in->start = in->end = 0;
+}
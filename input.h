@@ -0,0 +1,55 @@
+/* input.h - line input with read(2) into locked memory
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SLIP0039_INPUT_H
+#define SLIP0039_INPUT_H
+#include <stddef.h>
+
+/* input is read from a file descriptor into a buffer supplied by the
+ * caller (in locked memory), so that secrets never pass through the
+ * buffers of stdio; lines are returned in place and everything that is
+ * consumed is wiped from the buffer */
+typedef struct input_s {
+	int fd;
+	char *buf;
+	size_t size;
+	size_t line;	// start of the last line returned, wiped on next use
+	size_t start;	// first unread byte
+	size_t end;	// end of the data in buf
+	int eof;
+} input_t;
+
+void input_init(input_t*, int fd, char *buf, size_t size);
+
+// returns the next character or EOF, desc is used in error messages
+int input_getc(input_t*, const char *desc);
+
+// returns the next character or EOF without consuming it
+int input_peek(input_t*, const char *desc);
+
+/* returns the next line without '\n', terminated in place and valid until
+ * the next call, its length is stored in len and must be less than max;
+ * if eof_acceptable, NULL is returned on EOF at the start of a line */
+char *input_line(input_t*, size_t max, size_t *len, const char *desc,
+		int eof_acceptable);
+
+// wipe the buffer and forget its contents
+void input_wipe(input_t*);
+
+#endif /* SLIP0039_INPUT_H */
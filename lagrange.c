@@ -20,6 +20,7 @@
 #include <assert.h>
 #include "lagrange.h"
 #include "gf256.h"
+#include "stats.h"
 
 static void helper(slip0039_set_t *s, int no_idx,
 		uint8_t *idx, uint8_t x, size_t offset) {
@@ -43,8 +44,10 @@ static void helper(slip0039_set_t *s, int no_idx,
 
 void lagrange(slip0039_set_t *s, size_t n,
 		int no_idx, uint8_t *idx, uint8_t x) {
+	STATS_START(start);
 	for (int i = 0; i < n; i++)
 		helper(s, no_idx, idx, x, i);
+	STATS_STOP(start, STATS_INTERPOLATE);
 }
 
 
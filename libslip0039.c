@@ -0,0 +1,1328 @@
+/* libslip0039.c - split and recover sessions
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <sys/mman.h>
+
+#include "libslip0039.h"
+#include "verbose.h"
+#include "codec.h"
+#include "utils.h"
+#include "rs1024.h"
+#include "digest.h"
+#include "lagrange.h"
+#include "gf256.h"
+#include "lrcipher.h"
+#include "wordlists.h"
+#include "fixnum.h"
+#include "base.h"
+#include "shashtbl.h"
+#include "secmem.h"
+#include "stats.h"
+
+static slip0039_error_t slip0039_error(slip0039_ctx_t *ctx,
+		slip0039_error_t err, const char *format, ...) {
+	va_list ap;
+	va_start(ap, format);
+	vsnprintf(ctx->error, sizeof(ctx->error), format, ap);
+	va_end(ap);
+
+	return err;
+}
+
+static slip0039_error_t slip0039_nomem(slip0039_ctx_t *ctx) {
+	return slip0039_error(ctx, SLIP0039_ENOMEM, "failed allocating secure "
+			"memory (see ulimit -l): %s", strerror(errno));
+}
+
+int slip0039_quorum(slip0039_set_t *s) {
+	assert(s);
+	return (s->available >= s->threshold && s->threshold != 0)?1:0;
+}
+
+const char *slip0039_title(slip0039_t *s) {
+	if (!*s->title && s->root.threshold) {
+		sbuf_t sb = { .buf = s->title, .size = sizeof(s->title) };
+
+		sbufprintf(&sb, " (");
+		sbufwordlist_dereference(&wordlist_slip0039, &sb,
+				s->title_words[0]);
+		sbufprintf(&sb, " ");
+		sbufwordlist_dereference(&wordlist_slip0039, &sb,
+				s->title_words[1]);
+		sbufprintf(&sb, ")");
+	}
+
+	return s->title;
+}
+
+void slip0039_init(slip0039_t *s) {
+	memset(s, 0, sizeof(*s));
+	s->id = -1;
+	s->e = -1;
+	for (int i = 0; i < MAX_SHARES; i++) {
+		s->root.line_numbers[i] = -1;
+		s->members[i].parent = &s->root;
+		s->root.children[i] = &s->members[i];
+	}
+}
+
+/* allocate storage for the digest and count shares of n bytes, count is
+ * MAX_SHARES if the number of shares is not known (while recovering),
+ * returns -1 if there is no secure memory left */
+static int slip0039_set_alloc(slip0039_set_t *m, uint8_t count, size_t n) {
+	if (m->storage_digest) return 0;
+
+	if (!(m->storage_digest = secmem_try_alloc((count + 1)*n))) return -1;
+	for (uint8_t i = 0; i < count; i++)
+		m->storage_shares[i] = m->storage_digest + (i + 1)*n;
+
+	return 0;
+}
+
+/* allocate storage for the secret and the plaintext of s, with room for
+ * the largest secret of the context, max_n bytes, returns -1 if there is
+ * no secure memory left */
+static int slip0039_alloc(slip0039_t *s, size_t max_n) {
+	if (s->storage_secret) return 0;
+
+	if (!(s->storage_secret = secmem_try_alloc(max_n<<1))) return -1;
+	s->storage_plaintext = s->storage_secret + max_n;
+
+	return 0;
+}
+
+static void slip0039_set_free(slip0039_set_t *m) {
+	secmem_free(m->storage_digest);
+	m->storage_digest = NULL;
+	memset(m->storage_shares, 0, sizeof(m->storage_shares));
+}
+
+void slip0039_free(slip0039_t *s) {
+	secmem_free(s->storage_secret);
+	s->storage_secret = s->storage_plaintext = NULL;
+	slip0039_set_free(&s->root);
+	for (int i = 0; i < MAX_SHARES; i++) slip0039_set_free(&s->members[i]);
+}
+
+static void slip0039_parser_init(slip0039_parser_t *p) {
+	memset(p, 0, sizeof(*p));
+}
+
+void slip0039_lib_init() {
+	codec_init();
+	wordlists_init();
+}
+
+/* allocate the buffers of the context for secrets of at most max_n bytes
+ * in one block of secure memory; a line of LINE_FOR(max_n) characters
+ * fits a mnemonic and any plaintext (a diceware passphrase of max_n bytes
+ * has fewer words than the mnemonic), input is also the scratch space of
+ * the codecs and has room for 8*max_n bytes */
+static slip0039_error_t slip0039_ctx_alloc(slip0039_ctx_t *ctx,
+		size_t max_n) {
+	size_t line_size = LINE_FOR(max_n) > DISPLAYLINE ?
+		LINE_FOR(max_n) : DISPLAYLINE;
+	size_t input_size = (max_n<<2)*sizeof(*ctx->input);
+	char *storage;
+
+	if (!(storage = secmem_try_alloc(input_size + (line_size<<1) +
+			BASE_SCRATCH_SIZE(BASE_LIMBS(max_n)))))
+		return slip0039_nomem(ctx);
+	ctx->input = (uint16_t*)storage;
+	ctx->mnemonic = storage + input_size;
+	ctx->plaintext = ctx->mnemonic + line_size;
+	ctx->base_scratch_space = (uint8_t*)ctx->plaintext + line_size;
+	base_init_scratch(&ctx->bs, ctx->base_scratch_space,
+			BASE_LIMBS(max_n));
+
+	ctx->max_n = max_n;
+	ctx->max_words = WORDS_FOR(max_n);
+	ctx->line_size = line_size;
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_ctx_init(slip0039_ctx_t *ctx) {
+	memset(ctx, 0, sizeof(*ctx));
+	slip0039_init(&ctx->s);
+	slip0039_parser_init(&ctx->p);
+	lrcipher_init(&ctx->s.l);
+	ctx->codec = codec; // the defaults
+	ctx->wordlist = wordlist;
+
+	return slip0039_ctx_alloc(ctx, BLOCKS<<1);
+}
+
+void slip0039_ctx_wipe(slip0039_ctx_t *ctx) {
+	slip0039_free(&ctx->s);
+	secmem_free(ctx->p.batch);
+	secmem_free(ctx->input);
+	wipememory(ctx, sizeof(*ctx));
+}
+
+slip0039_error_t slip0039_ctx_max_secret(slip0039_ctx_t *ctx, size_t n) {
+	uint16_t *storage = ctx->input;
+	slip0039_error_t err;
+
+	if (n < BLOCKS<<1 || n > MAX_SECRET)
+		return slip0039_error(ctx, SLIP0039_EINVAL, "maximum size "
+				"of the secret must be between %d and %d bytes",
+				BLOCKS<<1, MAX_SECRET);
+	if (ctx->s.n || ctx->p.line_number || ctx->p.batch)
+		return slip0039_error(ctx, SLIP0039_EINVAL, "maximum size "
+				"of the secret must be set before use");
+	if (n == ctx->max_n) return SLIP0039_OK;
+
+	// the old buffers are kept if the new ones can't be allocated
+	if ((err = slip0039_ctx_alloc(ctx, n))) return err;
+	secmem_free(storage);
+
+	return SLIP0039_OK;
+}
+
+const char *slip0039_ctx_error(const slip0039_ctx_t *ctx) {
+	return ctx->error;
+}
+
+slip0039_error_t slip0039_ctx_codec(slip0039_ctx_t *ctx, const char *spec) {
+	const char *separator = strchr(spec, ':');
+	char name[32];
+	codec_t *c;
+	wordlist_t *w;
+
+	if (!separator) separator = spec + strlen(spec);
+	if (separator - spec >= sizeof(name))
+		return slip0039_error(ctx, SLIP0039_EINVAL,
+				"codec %s not available", spec);
+	memcpy(name, spec, separator - spec);
+	name[separator - spec] = '\0';
+
+	if (!(c = codec_find(name)))
+		return slip0039_error(ctx, SLIP0039_EINVAL,
+				"codec %s not available", name);
+
+	w = shashtbl_search_elt_bykey(codec_wordlists(c),
+			*separator?separator + 1:c->default_language);
+	if (!w) return slip0039_error(ctx, SLIP0039_EINVAL,
+			"wordlist \"%s\" not found for codec %s",
+			separator + 1, name);
+
+	ctx->codec = c;
+	ctx->wordlist = w;
+
+	return SLIP0039_OK;
+}
+
+static void slip0039_set_increment_available(slip0039_set_t *m) {
+	assert(m);
+	m->available++;
+
+	// if this addition made this group make the threshold,
+	// then the number of available groups must be incremented
+	if (m->available == m->threshold && m->parent)
+		slip0039_set_increment_available(m->parent);
+}
+
+// remember the words of the title, the group and the member of a mnemonic
+static void slip0039_write_titles(slip0039_t *s, uint8_t i, uint8_t j,
+		const uint16_t *header) {
+	s->title_words[0] = header[0];
+	s->title_words[1] = header[1];
+	s->root.names[i] = header[2];
+	s->members[i].names[j] = header[3];
+}
+
+static slip0039_error_t slip0039_write_mnemonics(slip0039_ctx_t *ctx,
+		sbuf_t *out) {
+	slip0039_t *s = &ctx->s;
+	uint16_t *input = ctx->input;
+	// these conditions are (?) enfored elsewhere
+	assert(s->n >= 16 && s->n%2 == 0 && s->n <= ctx->max_n);
+	fixnum_t h;
+
+	fixnum_init(&h, ctx->header, 5);
+
+	fixnum_poke(&h, 25, 15, s->id);
+	fixnum_poke(&h, 20, 5, s->e);
+
+	// write the available shares of every group
+	for (uint8_t i = 0; i < s->root.count; i++) {
+		fixnum_poke(&h, 16, 4, i);
+		fixnum_poke(&h, 12, 4, s->root.threshold - 1);
+		fixnum_poke(&h, 8, 4, s->root.count - 1);
+
+		for (uint8_t j = 0; j < MAX_SHARES; j++) {
+			if (!s->members[i].shares[j]) continue;
+
+			fixnum_poke(&h, 4, 4, j);
+			fixnum_poke(&h, 0, 4, s->members[i].threshold - 1);
+
+			base_encode_buffer(input, 4, &wordlist_slip0039.m, ctx->header, 5, &ctx->bs, 0);
+
+			slip0039_write_titles(s, i, j, input);
+
+			base_encode_buffer(&input[4], (8*s->n + 9)/10,
+					&wordlist_slip0039.m,
+					s->members[i].shares[j],
+					s->n, &ctx->bs, 0);
+
+			rs1024_add(input, 4 + (8*s->n + 9)/10);
+
+			wipememory(ctx->mnemonic, ctx->line_size);
+
+			sbuf_t sb = {
+				.buf = ctx->mnemonic,
+				.size = ctx->line_size,
+				.len = 0
+			};
+
+			int k = 0;
+			goto start;
+			while (++k < 4 + (8*s->n + 9)/10 + 3) {
+				sbufprintf(&sb, " ");
+start:
+				sbufwordlist_dereference(&wordlist_slip0039, &sb, input[k]);
+			}
+			if (sb.len + 1 >= out->size - out->len)
+				return slip0039_error(ctx, SLIP0039_EINVAL,
+						"output buffer too small for "
+						"the mnemonics");
+			sbufprintf(out, "%s\n", ctx->mnemonic);
+		}
+	}
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_split_mnemonics(slip0039_ctx_t *ctx, sbuf_t *out) {
+	slip0039_error_t err;
+	assert(ctx && out);
+	if (!ctx->s.n) return slip0039_error(ctx, SLIP0039_EINVAL,
+			"there are no shares to write");
+
+	STATS_START(start);
+	err = slip0039_write_mnemonics(ctx, out);
+	STATS_STOP(start, STATS_OUTPUT);
+
+	return err;
+}
+
+/* report an error in the mnemonic that is being parsed and return, the
+ * rest of the mnemonic is skipped when the parser sorts the mnemonics
+ * into sets, otherwise slip0039_recover_add_char() returns the error */
+#define PARSER_ERROR(p, msg, ...) do { \
+	snprintf((p)->error, sizeof((p)->error), msg, ## __VA_ARGS__); \
+	return; \
+} while (0)
+
+// out of secure memory, this is not an error in the mnemonic
+#define PARSER_NOMEM(p) do { \
+	(p)->nomem = 1; \
+	PARSER_ERROR(p, "failed allocating secure memory (see ulimit -l): " \
+			"%s", strerror(errno)); \
+} while (0)
+
+/* recover --all: the words of up to RS1024_LANES mnemonics, their
+ * checksums are verified by one call to rs1024_verify_many() */
+typedef struct slip0039_batch_s {
+	size_t count;
+	size_t no_input[RS1024_LANES];
+	int line_numbers[RS1024_LANES];
+	uint16_t input[]; // RS1024_LANES rows of max_words words
+} slip0039_batch_t;
+
+static void slip0039_multi_free(void *elt) {
+	slip0039_free(&((slip0039_multi_t*)elt)->s);
+	secmem_free(elt);
+}
+
+typedef struct slip0039_multi_key_s {
+	uint16_t id;
+	uint8_t e, GT, G;
+} slip0039_multi_key_t;
+
+static void *slip0039_multi_match(void *elt, void *arg) {
+	slip0039_multi_t *m = elt;
+	slip0039_multi_key_t *k = arg;
+
+	if (m->s.id == k->id && m->s.e == k->e &&
+			m->s.root.threshold == k->GT &&
+			m->s.root.count == k->G) return m;
+
+	return NULL;
+}
+
+/* find the set of the mnemonic with this header, or create it, returns
+ * NULL if there is no secure memory left */
+static slip0039_t *slip0039_multi_find(slip0039_ctx_t *ctx,
+		uint16_t id, uint8_t e, uint8_t GT, uint8_t G) {
+	llist_t *sets = ctx->p.sets;
+	slip0039_multi_key_t k = { .id = id, .e = e, .GT = GT, .G = G };
+	slip0039_multi_t *m = llist_iterator(sets, slip0039_multi_match, &k);
+
+	if (m) return &m->s;
+
+	// the plaintext is stored after the set
+	if (!(m = secmem_try_alloc(sizeof(*m) + ctx->line_size))) return NULL;
+	llist_add_elt(sets, m);
+	m->no = llist_get_count(sets) - 1;
+	m->ok = 0;
+	m->plaintext = (char*)(m + 1);
+	slip0039_init(&m->s);
+
+	return &m->s;
+}
+
+slip0039_error_t slip0039_multi_init(slip0039_ctx_t *ctx, llist_t *sets,
+		llist_info_t *info, void (*report)(void*, const char*),
+		void *arg) {
+	llist_init_info(sets, info, sizeof(slip0039_multi_t),
+			slip0039_multi_free);
+	ctx->p.sets = sets;
+	ctx->p.report = report;
+	ctx->p.report_arg = arg;
+	if (!(ctx->p.batch = secmem_try_alloc(sizeof(*ctx->p.batch) +
+			RS1024_LANES*ctx->max_words*sizeof(*ctx->input))))
+		return slip0039_nomem(ctx);
+
+	return SLIP0039_OK;
+}
+
+/* decode the header (the first four words) of the mnemonic that is being
+ * parsed and check that it is consistent with the mnemonics that are
+ * already known and with n, the size of its share; the set is only
+ * changed after all checks, so a rejected mnemonic leaves no trace */
+static void slip0039_add_header(slip0039_ctx_t *ctx, size_t n) {
+	slip0039_parser_t *p = &ctx->p;
+	slip0039_t *s = p->s;
+	fixnum_t h;
+	uint16_t id;
+	uint8_t e, GI, GT, G, I, T;
+
+	fixnum_init_pattern(&h, ctx->header, 5, PATTERN_ZERO);
+	base_decode_fixnum(&h, &wordlist_slip0039.m, ctx->input, 4, 0);
+
+	/* read header */
+	id = fixnum_peek(&h, 25, 15);
+	e = fixnum_peek(&h, 20, 5);
+
+	GI = fixnum_peek(&h, 16, 4);
+	GT = fixnum_peek(&h, 12, 4) + 1;
+	G =  fixnum_peek(&h, 8, 4)+ 1;
+	I = fixnum_peek(&h, 4, 4);
+	T = fixnum_peek(&h, 0, 4) + 1;
+
+	if (GI >= G)
+		PARSER_ERROR(p, "group index too large in mnemonic on line %d, "
+				"number of groups is %d, group index is %d",
+				p->line_number, G, GI);
+
+	if (p->sets && !(s = p->s = slip0039_multi_find(ctx, id, e, GT, G)))
+		PARSER_NOMEM(p);
+
+	if (!s->root.threshold) { // s is uninitialized
+		s->id = id;
+		s->e = e;
+		s->root.threshold = GT;
+		s->root.count = G;
+	} else {
+		if (s->id != id) PARSER_ERROR(p, "Identifier mismatch in "
+				"mnemonic on line %d", p->line_number);
+		if (s->e != e) PARSER_ERROR(p, "Iteration exponent mismatch "
+				"in mnemonic on line %d", p->line_number);
+		if (s->root.threshold != GT) PARSER_ERROR(p, "Group threshold "
+				"mismatch in mnemonic on line %d", p->line_number);
+		if (s->root.count != G) PARSER_ERROR(p, "Group count mismatch "
+				"in mnemonic on line %d", p->line_number);
+		if (s->n && s->n != n) PARSER_ERROR(p, "share size "
+				"mismatch in mnemonic on line %d",
+				p->line_number);
+	}
+
+	slip0039_set_t *m = &s->members[GI];
+	if (m->threshold && m->threshold != T)
+		PARSER_ERROR(p, "Member threshold mismatch in mnemonic on "
+				"line %d", p->line_number);
+
+	if (m->shares[I])
+		PARSER_ERROR(p, "share is already loaded in mnemonic on "
+				"line %d", p->line_number);
+
+	if (!m->threshold) { // new group
+		m->threshold = T;
+		m->count = 0; // undefined
+	}
+
+	p->GI = GI;
+	p->I = I;
+}
+
+/* check the size, the checksum (valid is its result) and the padding and
+ * store the share */
+static void slip0039_add_share(slip0039_ctx_t *ctx, bool valid) {
+	slip0039_parser_t *p = &ctx->p;
+	uint16_t *input = ctx->input;
+	size_t no_input = p->no_input;
+
+        if (no_input < 20)
+		PARSER_ERROR(p, "not enough words in mnemonic on line %d, "
+				"minimum 20 words", p->line_number);
+
+	if (!valid) {
+		size_t position;
+		uint16_t value;
+
+		if (rs1024_correct(input, no_input, &position, &value))
+			PARSER_ERROR(p, "checksum of mnemonic on line %d is "
+					"not valid, word %ld may be \"%s\" "
+					"instead of \"%s\"", p->line_number,
+					position + 1,
+					wordlist_slip0039.words[value],
+					wordlist_slip0039.words[input[position]]);
+
+		PARSER_ERROR(p, "checksum of mnemonic on line %d is not valid",
+				p->line_number);
+	}
+
+	size_t n = 2*(10*(no_input - 7)/16);
+	size_t surplus = 10*(no_input - 7)%16;
+        if (surplus >= 10)
+                PARSER_ERROR(p, "invalid master secret length in mnemonic "
+				"on line %d, padding >= 10", p->line_number);
+
+	// the padding bits are the leading bits of the first word of the share
+	if (input[4]>>(10 - surplus))
+		PARSER_ERROR(p, "invalid (nonzero) padding in mnemonic on "
+				"line %d", p->line_number);
+
+	/* the header is only trusted (and, when sorting into sets, the set
+	 * selected) after the checksum, the size and the padding are
+	 * verified, so that a typo in the first four words gets the
+	 * suggestion of the checksum and a rejected mnemonic leaves
+	 * no trace */
+	slip0039_add_header(ctx, n);
+	if (*p->error) return;
+
+	slip0039_t *s = p->s;
+
+	slip0039_set_t *m = &s->members[p->GI];
+
+	if (slip0039_set_alloc(m, MAX_SHARES, n)) PARSER_NOMEM(p);
+	if (base_decode_buffer(m->storage_shares[p->I], n, &wordlist_slip0039.m, &input[4], no_input - 7, 0))
+		BUG("nonzero padding in mnemonic on line %d, while it was "
+				"checked", p->line_number);
+
+	s->n = n;
+
+	slip0039_write_titles(s, p->GI, p->I, input);
+	m->line_numbers[p->I] = p->line_number;
+
+	m->shares[p->I] = m->storage_shares[p->I];
+
+	slip0039_set_increment_available(m);
+}
+
+// resolve the word in the buffer of the parser
+static void slip0039_add_word(slip0039_ctx_t *ctx) {
+	slip0039_parser_t *p = &ctx->p;
+	const char *end;
+	int idx;
+
+	if (p->no_input == ctx->max_words) PARSER_ERROR(p, "too many words "
+			"in mnemonic on line %d, %ld supported at maximum "
+			"(secrets of at most %ld bytes)", p->line_number,
+			ctx->max_words, ctx->max_n);
+
+	p->word[p->len] = '\0';
+	if ((idx = wordlist_find(&wordlist_slip0039, p->word, &end)) < 0)
+		PARSER_ERROR(p, "word '%s' not found in the slip0039 "
+				"wordlist in mnemonic on line %d",
+				p->word, p->line_number);
+	ctx->input[p->no_input] = idx;
+	// with a batch, the checksum is verified when the batch is full
+	if (!p->batch) rs1024_add_value(&p->rs, idx);
+	p->no_input++;
+	wipememory(p->word, sizeof(p->word));
+	p->len = 0;
+}
+
+/* pass the error of the current mnemonic to the report function when
+ * sorting into sets, the mnemonic is skipped */
+static void slip0039_parser_report(slip0039_parser_t *p) {
+	if (!*p->error || !p->sets || p->nomem) return;
+	if (p->report) (*p->report)(p->report_arg, p->error);
+	wipememory(p->error, sizeof(p->error));
+	p->errors++;
+}
+
+/* verify the checksums of the buffered mnemonics and add their shares in
+ * the order in which they were read */
+static void slip0039_batch_flush(slip0039_ctx_t *ctx) {
+	slip0039_parser_t *p = &ctx->p;
+	slip0039_batch_t *b = p->batch;
+	const uint16_t *mnemonics[RS1024_LANES];
+	bool valid[RS1024_LANES];
+	int line_number = p->line_number;
+
+	if (!b || !b->count) return;
+
+	for (size_t i = 0; i < b->count; i++)
+		mnemonics[i] = b->input + i*ctx->max_words;
+	rs1024_verify_many(mnemonics, b->no_input, b->count, valid);
+
+	for (size_t i = 0; i < b->count && !p->nomem; i++) {
+		p->no_input = b->no_input[i];
+		p->line_number = b->line_numbers[i];
+		memcpy(ctx->input, mnemonics[i],
+				p->no_input*sizeof(*ctx->input));
+		slip0039_add_share(ctx, valid[i]);
+		slip0039_parser_report(p);
+	}
+
+	p->line_number = line_number;
+	p->no_input = 0;
+	wipememory(ctx->input, ctx->max_words*sizeof(*ctx->input));
+	wipememory(b, sizeof(*b) +
+			RS1024_LANES*ctx->max_words*sizeof(*ctx->input));
+	wipememory(valid, sizeof(valid));
+}
+
+// buffer the words of the current mnemonic, flush the batch if it is full
+static void slip0039_batch_add(slip0039_ctx_t *ctx) {
+	slip0039_parser_t *p = &ctx->p;
+	slip0039_batch_t *b = p->batch;
+
+	memcpy(b->input + b->count*ctx->max_words, ctx->input,
+			p->no_input*sizeof(*ctx->input));
+	b->no_input[b->count] = p->no_input;
+	b->line_numbers[b->count] = p->line_number;
+
+	if (++b->count == RS1024_LANES) slip0039_batch_flush(ctx);
+}
+
+/* the current mnemonic is finished, report its error if it has one,
+ * after the errors of the mnemonics that were buffered before it;
+ * without sets the error is returned by slip0039_recover_add_char() */
+static void slip0039_parser_end_mnemonic(slip0039_ctx_t *ctx) {
+	slip0039_parser_t *p = &ctx->p;
+
+	if (*p->error && p->batch) {
+		char error[sizeof(p->error)];
+
+		memcpy(error, p->error, sizeof(error));
+		wipememory(p->error, sizeof(p->error));
+		slip0039_batch_flush(ctx);
+		memcpy(p->error, error, sizeof(error));
+		wipememory(error, sizeof(error));
+	}
+	slip0039_parser_report(p);
+	wipememory(p->word, sizeof(p->word));
+	p->no_input = 0;
+	p->len = 0;
+}
+
+/* feed one character of a mnemonic to the parser, words are resolved
+ * as soon as they are terminated by a space or a newline, the checksum,
+ * the header and the share are processed at the end of the line; *arg is
+ * set to EOF if an empty line is encountered */
+static void slip0039_parser_add_char(slip0039_ctx_t *ctx, int *arg) {
+	slip0039_parser_t *p = &ctx->p;
+	int c = *arg;
+
+	if (*p->error) { // skip the rest of the mnemonic
+		if (c == '\n') slip0039_parser_end_mnemonic(ctx);
+		return;
+	}
+
+	if (!p->no_input && !p->len) {
+		if (c == '\n') {
+			slip0039_batch_flush(ctx);
+			*arg = EOF;
+			return;
+		}
+		if (c == ' ') return;
+		// start of a new mnemonic
+		p->line_number++;
+		p->s = &ctx->s;
+		rs1024_init_slip0039(&p->rs);
+	}
+
+	if (c == ' ' || c == '\n') {
+		STATS_START(start);
+		if (p->len) slip0039_add_word(ctx);
+		if (c == '\n') {
+			rs1024_state_t ok = RS1024_INIT;
+
+			if (!*p->error) {
+				if (p->batch) slip0039_batch_add(ctx);
+				else slip0039_add_share(ctx,
+						p->rs.chk == ok.chk);
+			}
+			slip0039_parser_end_mnemonic(ctx);
+		}
+		STATS_STOP(start, STATS_PARSE);
+		return;
+	}
+
+	if (p->len == sizeof(p->word) - 1)
+		PARSER_ERROR(p, "word %ld too long in mnemonic on line %d",
+				p->no_input + 1, p->line_number);
+
+	p->word[p->len++] = c;
+}
+
+/* without sets, an error in a mnemonic is returned, running out of secure
+ * memory is always returned */
+static slip0039_error_t slip0039_parser_error(slip0039_ctx_t *ctx) {
+	slip0039_parser_t *p = &ctx->p;
+	slip0039_error_t err = p->nomem ? SLIP0039_ENOMEM : SLIP0039_EMNEMONIC;
+
+	if (!*p->error || (p->sets && !p->nomem)) return SLIP0039_OK;
+
+	slip0039_error(ctx, err, "%s", p->error);
+	wipememory(p->error, sizeof(p->error));
+
+	return err;
+}
+
+slip0039_error_t slip0039_recover_add_char(slip0039_ctx_t *ctx, int c,
+		int *more) {
+	int arg = c;
+
+	slip0039_parser_add_char(ctx, &arg);
+	if (more) *more = arg != EOF;
+
+	return slip0039_parser_error(ctx);
+}
+
+slip0039_error_t slip0039_recover_add_mnemonic(slip0039_ctx_t *ctx,
+		const char *line) {
+	slip0039_error_t err;
+
+	while (*line) if ((err = slip0039_recover_add_char(ctx,
+					*line++, NULL))) return err;
+
+	return slip0039_recover_add_char(ctx, '\n', NULL);
+}
+
+slip0039_error_t slip0039_multi_finish(slip0039_ctx_t *ctx) {
+	slip0039_batch_flush(ctx);
+
+	return slip0039_parser_error(ctx);
+}
+
+slip0039_error_t slip0039_add_passphrase(slip0039_ctx_t *ctx,
+		const char *passphrase, size_t len) {
+	for (size_t i = 0; i < len; i++)
+		if (passphrase[i] < 32 || passphrase[i] > 126)
+			return slip0039_error(ctx, SLIP0039_EINPUT,
+					"character in passphrase is not a "
+					"printable character");
+
+	lrcipher_add_passphrase(&ctx->s.l, passphrase, len);
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_split_init(slip0039_ctx_t *ctx,
+		const slip0039_spec_t *spec) {
+	slip0039_t *s = &ctx->s;
+
+	if (spec->e > 31) return slip0039_error(ctx, SLIP0039_EINVAL,
+			"iteration exponent must be <= 31");
+	if (spec->G < 1 || spec->G > MAX_SHARES)
+		return slip0039_error(ctx, SLIP0039_EINVAL,
+				"number of groups must be between 1 and %d",
+				MAX_SHARES);
+	if (spec->GT < 1 || spec->GT > spec->G)
+		return slip0039_error(ctx, SLIP0039_EINVAL,
+				"group threshold must be between 1 and the "
+				"number of groups");
+	for (uint8_t i = 0; i < spec->G; i++)
+		if (spec->groups[i].threshold < 1 ||
+				spec->groups[i].threshold >
+				spec->groups[i].count ||
+				spec->groups[i].count > MAX_SHARES)
+			return slip0039_error(ctx, SLIP0039_EINVAL,
+					"invalid group spec %dof%d",
+					spec->groups[i].threshold,
+					spec->groups[i].count);
+
+	s->e = spec->e;
+	s->root.threshold = spec->GT;
+	s->root.count = spec->G;
+	for (uint8_t i = 0; i < spec->G; i++) {
+		s->members[i].threshold = spec->groups[i].threshold;
+		s->members[i].count = spec->groups[i].count;
+	}
+
+	return SLIP0039_OK;
+}
+
+static slip0039_error_t slip0039_copy_seed(slip0039_ctx_t *ctx,
+		const char *seed, size_t len) {
+	if (len > sizeof(ctx->seed)) return slip0039_error(ctx,
+			SLIP0039_EINPUT, "seed must be at most %ld bytes",
+			sizeof(ctx->seed));
+
+	memcpy(ctx->seed, seed, len);
+	ctx->seed_len = len;
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_split_seed(slip0039_ctx_t *ctx,
+		const char *seed, size_t len) {
+	uint8_t sha[SHA256_LEN];
+	slip0039_error_t err;
+
+	if ((err = slip0039_copy_seed(ctx, seed, len))) return err;
+
+	hash(sha, SHA256_LEN, seed, len, HASH_SHA256);
+       	// drop MSB to get 15 bits
+	ctx->s.id = 0x7fff&((sha[0]<<8) + sha[1]);
+	wipememory(sha, sizeof(sha));
+
+	return SLIP0039_OK;
+}
+
+/* must be called after EMS is computed */
+static void init_prng_pbkdf2(pbkdf2_t *p, slip0039_t *s, const char *seed, size_t seed_len) {
+	/* initialize PRNG based on PBKDF2 with EMS and SEED
+	 * as password and a description of the way the secret
+	 * must be split as the first salt
+	 *
+	 * Password = ( EMS || SEED )
+	 * Salt = ( e || GT || G || T_i || count_i  ... )
+	 *                       \_______________/  1 <= i <= G
+	 *
+	 * all numbers are encoded as 8 bit integers */
+	assert(s->root.secret);
+	pbkdf2_init(p, HASH_SHA256);
+	pbkdf2_update_password(p, s->root.secret, s->n);
+	pbkdf2_update_password(p, seed, seed_len);
+	pbkdf2_update_salt_uint8(p, s->e);
+	pbkdf2_update_salt_uint8(p, s->root.threshold);
+	pbkdf2_update_salt_uint8(p, s->root.count);
+	for (uint8_t i = 0; i < s->root.count; i++) {
+		slip0039_set_t *set = &s->members[i];
+		pbkdf2_update_salt_uint8(p, set->threshold);
+		pbkdf2_update_salt_uint8(p, set->count);
+	}
+	pbkdf2_finalize_salt(p, 1);
+}
+
+// returns -1 if there is no secure memory left
+static int slip0039_split(slip0039_set_t *s, size_t n, pbkdf2_t *p) {
+	assert(s->secret && !s->digest);
+	if (slip0039_set_alloc(s, s->count, n)) return -1;
+	for (uint8_t i = 0; i < MAX_SHARES; i++) assert(!s->shares[i]);
+
+	if (s->threshold == 1) {
+		for (uint8_t i = 0; i < s->count; i++) {
+			assert(!s->shares[i]);
+			s->shares[i] = s->storage_shares[i];
+			memcpy(s->shares[i], s->secret, n);
+		}
+	} else {
+		/* the secret and digest will be known, once we start
+		 * to compute the other shares using lagrange */
+        	uint8_t idx[MAX_SHARES] = { -1, -2 };
+        	int no_idx = 2;
+
+		/* compute digest */
+		assert(!*(s->shares - 2));
+		*(s->shares - 2) = s->storage_digest;
+		pbkdf2_generate(p, *(s->shares - 2) + DIGEST_LEN, n - DIGEST_LEN);
+		digest_compute(*(s->shares - 2), *(s->shares - 1), n);
+
+		/* generate the other required shares randomly */
+		for (uint8_t i = 0; i < s->threshold - 2; i++) {
+			assert(!s->shares[i]);
+			s->shares[i] = s->storage_shares[i];
+			pbkdf2_generate(p, s->shares[i], n);
+			idx[no_idx++] = i; // share[i] is set
+		}
+
+		/* compute the remaining shares */
+		for (uint8_t i = s->threshold - 2; i < s->count; i++) {
+			assert(!s->shares[i]);
+			s->shares[i] = s->storage_shares[i];
+			lagrange(s, n, no_idx, idx, i);
+		}
+	}
+
+	s->available = s->count;
+
+	for (uint8_t i = 0; i < s->count; i++) {
+		slip0039_set_t *child = s->children[i];
+		if (!child) continue;
+
+		child->secret = s->shares[i];
+		if (slip0039_split(child, n, p)) return -1;
+	}
+
+	return 0;
+}
+
+/* returns 0 on success, 1 if a digest is incorrect and -1 if there is
+ * no secure memory left */
+static int slip0039_recover(slip0039_set_t *s, uint8_t *secret, size_t n) {
+        uint8_t idx[MAX_SHARES];
+        int no_idx = 0, ret;
+
+	assert(s->available >= s->threshold && s->threshold);
+	if (slip0039_set_alloc(s, s->count ? s->count : MAX_SHARES, n))
+		return -1;
+
+	for (int i = 0; i < MAX_SHARES; i++) {
+		slip0039_set_t *child = s->children[i];
+		if (!s->shares[i] && child && slip0039_quorum(child)) {
+			if ((ret = slip0039_recover(child,
+						s->storage_shares[i], n)))
+				return ret;
+			s->shares[i] = s->storage_shares[i];
+		}
+		if (s->shares[i]) idx[no_idx++] = i;
+
+                if (no_idx == s->threshold) break;
+        }
+
+        assert(no_idx == s->threshold);
+
+	if (s->threshold == 1) {
+		// if threshold is 1, just copy the first
+		// available share to the secret, since
+		// all shares contain the same data
+		// (and there SHOULD only be one share)
+		// furthermore, there is no digest to verify
+		s->secret = secret;
+		memcpy(s->secret, s->shares[idx[0]], n);
+	} else {
+		// compute digest share (uint8_t)-2 = 254
+		// and secret share (uint8_t)-1 = 255
+
+		for (int i = -2; i < 0; i++) {
+			assert(!s->shares[i]);
+			*(s->shares + i) = (i == -2)?s->storage_digest:secret;
+			lagrange(s, n, no_idx, idx, (uint8_t)i);
+		}
+
+		if (!digest_check(s->digest, s->secret, n)) return 1;
+	}
+
+	return 0;
+}
+
+static void slip0039_decrypt(slip0039_t *s) {
+	assert(s && !s->plaintext && s->root.secret);
+	s->plaintext = s->storage_plaintext;
+	lrcipher_execute(&s->l, s->plaintext, s->root.secret,
+			s->n, 2500L<<s->e, LRCIPHER_DECRYPT);
+}
+
+static void slip0039_encrypt(slip0039_t *s) {
+	assert(s && !s->root.secret && s->plaintext);
+	s->root.secret = s->storage_secret;
+	lrcipher_execute(&s->l, s->root.secret, s->plaintext,
+			s->n, 2500L<<s->e, LRCIPHER_ENCRYPT);
+}
+
+static slip0039_error_t slip0039_encode_plaintext(slip0039_ctx_t *ctx,
+		const char *plaintext) {
+	slip0039_t *s = &ctx->s;
+	int ret;
+
+	if (slip0039_alloc(s, ctx->max_n)) return slip0039_nomem(ctx);
+
+	STATS_START(start);
+	ret = (ctx->codec->encode)(s->storage_plaintext, &s->n, &s->l,
+			ctx->input, ctx->max_n<<2,
+			plaintext, ctx->wordlist, ctx->seed, ctx->seed_len,
+			&ctx->bs, ctx->error);
+	STATS_STOP(start, STATS_CODEC);
+
+	if (ret) { // the codec wrote the error in the context
+		s->n = 0;
+		wipememory(s->storage_plaintext, ctx->max_n);
+		return SLIP0039_EINPUT;
+	}
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_split_plaintext(slip0039_ctx_t *ctx,
+		const char *plaintext) {
+	slip0039_t *s = &ctx->s;
+	slip0039_error_t err;
+	int ret;
+
+	assert(!s->plaintext && !s->n);
+	if (s->id == -1 || !s->root.threshold)
+		return slip0039_error(ctx, SLIP0039_EINVAL,
+				"group spec and seed must be given first");
+
+	/* we have the ID, this is needed to finish
+	 * initializing lrcipher */
+	lrcipher_finalize_passphrase(&s->l, "shamir", 6, s->id);
+
+	/* encode Master Secret (MS) */
+	if ((err = slip0039_encode_plaintext(ctx, plaintext))) return err;
+	s->plaintext = s->storage_plaintext;
+
+	/* encrypt plaintext to EMS */
+	slip0039_encrypt(s);
+
+	init_prng_pbkdf2(&ctx->prng, s, ctx->seed, ctx->seed_len);
+
+	/* calculate all shares */
+	ret = slip0039_split(&s->root, s->n, &ctx->prng);
+
+	pbkdf2_finished(&ctx->prng);
+
+	return ret ? slip0039_nomem(ctx) : SLIP0039_OK;
+}
+
+static slip0039_error_t slip0039_decode_plaintext(slip0039_ctx_t *ctx,
+		slip0039_t *s) {
+	int ret;
+	STATS_START(start);
+
+	ret = (*ctx->codec->decode)(ctx->plaintext, ctx->line_size,
+			&s->l, ctx->input, ctx->max_n<<2,
+			s->plaintext, s->n, ctx->wordlist, &ctx->bs, ctx->error);
+	STATS_STOP(start, STATS_CODEC);
+
+	if (ret) { // the codec wrote the error in the context
+		wipememory(ctx->plaintext, ctx->line_size);
+		return SLIP0039_EINPUT;
+	}
+
+	return SLIP0039_OK;
+}
+
+// recover, decrypt and decode s, which is the set of ctx or one of its sets
+static slip0039_error_t slip0039_recover_set(slip0039_ctx_t *ctx,
+		slip0039_t *s) {
+	int ret;
+
+	if (!slip0039_quorum(&s->root))
+		return slip0039_error(ctx, SLIP0039_EQUORUM,
+				"not enough shares to recover the master "
+				"secret, %d of %d groups complete",
+				s->root.available, s->root.threshold);
+
+	/* we now have the ID, this is needed to finish
+	 * initializing lrcipher */
+	lrcipher_finalize_passphrase(&s->l, "shamir", 6, s->id);
+
+	if (slip0039_alloc(s, ctx->max_n) ||
+			(ret = slip0039_recover(&s->root, s->storage_secret,
+						s->n)) < 0)
+		return slip0039_nomem(ctx);
+	if (ret) return slip0039_error(ctx, SLIP0039_EDIGEST, "digest failed");
+
+	/* decrypt EMS to MS */
+	slip0039_decrypt(s);
+
+	return slip0039_decode_plaintext(ctx, s);
+}
+
+slip0039_error_t slip0039_recover_finish(slip0039_ctx_t *ctx) {
+	assert(!ctx->p.sets);
+	if (ctx->p.no_input || ctx->p.len)
+		return slip0039_error(ctx, SLIP0039_EMNEMONIC,
+				"EOF encountered before \\n while reading "
+				"mnemonic");
+
+	return slip0039_recover_set(ctx, &ctx->s);
+}
+
+slip0039_error_t slip0039_verify_finish(slip0039_ctx_t *ctx) {
+	slip0039_set_t *root = &ctx->s.root;
+	int ret;
+
+	assert(!ctx->p.sets);
+	if (ctx->p.no_input || ctx->p.len)
+		return slip0039_error(ctx, SLIP0039_EMNEMONIC,
+				"EOF encountered before \\n while reading "
+				"mnemonic");
+
+	if (!slip0039_quorum(root))
+		return slip0039_error(ctx, SLIP0039_EQUORUM,
+				"not enough shares to recover the master "
+				"secret, %d of %d groups complete",
+				root->available, root->threshold);
+
+	/* check the digest of every complete group, not only
+	 * of the groups that are needed to recover the EMS */
+	if (slip0039_set_alloc(root, root->count, ctx->s.n))
+		return slip0039_nomem(ctx);
+	for (int i = 0; i < MAX_SHARES; i++) {
+		slip0039_set_t *child = root->children[i];
+		if (root->shares[i] || !child || !slip0039_quorum(child))
+			continue;
+		if ((ret = slip0039_recover(child, root->storage_shares[i],
+					ctx->s.n)) < 0)
+			return slip0039_nomem(ctx);
+		if (ret) return slip0039_error(ctx, SLIP0039_EDIGEST,
+				"digest of group %d failed", i + 1);
+		root->shares[i] = root->storage_shares[i];
+	}
+
+	if (slip0039_alloc(&ctx->s, ctx->max_n) ||
+			(ret = slip0039_recover(root, ctx->s.storage_secret,
+						ctx->s.n)) < 0)
+		return slip0039_nomem(ctx);
+	if (ret) return slip0039_error(ctx, SLIP0039_EDIGEST, "digest failed");
+
+	return SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_reshare(slip0039_ctx_t *ctx,
+		const slip0039_spec_t *spec, const char *seed, size_t len) {
+	slip0039_t *s = &ctx->s;
+	slip0039_spec_t respec = *spec;
+	slip0039_error_t err;
+	int16_t id;
+	size_t n;
+
+	if ((err = slip0039_verify_finish(ctx))) return err;
+
+	uint8_t ems[s->n];
+
+	/* the EMS is encrypted using the identifier and the iteration
+	 * exponent, so they stay the same, everything else is new */
+	id = s->id;
+	respec.e = s->e;
+	n = s->n;
+	memcpy(ems, s->root.secret, n);
+	slip0039_free(s);
+	slip0039_init(s);
+	s->id = id;
+	s->n = n;
+
+	if ((err = slip0039_split_init(ctx, &respec)) ||
+			(err = slip0039_copy_seed(ctx, seed, len))) goto out;
+
+	if (slip0039_alloc(s, ctx->max_n)) {
+		err = slip0039_nomem(ctx);
+		goto out;
+	}
+	s->root.secret = s->storage_secret;
+	memcpy(s->root.secret, ems, n);
+
+	init_prng_pbkdf2(&ctx->prng, s, ctx->seed, ctx->seed_len);
+
+	if (slip0039_split(&s->root, n, &ctx->prng)) err = slip0039_nomem(ctx);
+
+	pbkdf2_finished(&ctx->prng);
+out:
+	wipememory(ems, sizeof(ems));
+
+	return err;
+}
+
+/* add a random polynomial that is zero at x=254 (digest) and x=255
+ * (secret) to the available shares of group m, so that the secret and
+ * the digest stay the same; with threshold <= 2 this polynomial is zero,
+ * returns -1 if there is no secure memory left */
+static int slip0039_refresh_group(slip0039_set_t *m, size_t n,
+		pbkdf2_t *p) {
+	uint8_t zero[n], idx[MAX_SHARES] = { -1, -2 };
+	int no_idx = 2;
+	slip0039_set_t z;
+
+	memset(zero, 0, n);
+	memset(&z, 0, sizeof(z));
+	if (slip0039_set_alloc(&z, MAX_SHARES, n)) return -1;
+	z.secret = zero;
+	z.digest = z.storage_digest;
+
+	for (uint8_t i = 0; i < m->threshold - 2; i++) {
+		z.shares[i] = z.storage_shares[i];
+		pbkdf2_generate(p, z.shares[i], n);
+		idx[no_idx++] = i;
+	}
+
+	for (uint8_t i = 0; i < MAX_SHARES; i++) {
+		if (!m->shares[i]) continue;
+		if (!z.shares[i]) {
+			z.shares[i] = z.storage_shares[i];
+			lagrange(&z, n, no_idx, idx, i);
+		}
+		for (size_t k = 0; k < n; k++)
+			m->shares[i][k] = gf256_add(m->shares[i][k],
+					z.shares[i][k]);
+	}
+
+	slip0039_set_free(&z);
+	wipememory(&z, sizeof(z));
+
+	return 0;
+}
+
+/* returns 0 if all available shares of group m lie on the polynomial
+ * through its first threshold shares, they are compared at their own x
+ * coordinates, so neither the secret nor the digest is computed; adding
+ * a sharing of zero keeps every share on that polynomial, so a group is
+ * never made inconsistent by the refresh */
+static int slip0039_check_group(slip0039_set_t *m, size_t n) {
+	uint8_t share[n], idx[MAX_SHARES], *tmp;
+	int no_idx = 0, ret = 0;
+
+	assert(m->available >= m->threshold);
+	for (uint8_t i = 0; i < MAX_SHARES && !ret; i++) {
+		if (!m->shares[i]) continue;
+		if (no_idx < m->threshold) {
+			idx[no_idx++] = i;
+			continue;
+		}
+		tmp = m->shares[i];
+		m->shares[i] = share;
+		lagrange(m, n, no_idx, idx, i);
+		m->shares[i] = tmp;
+		if (!memeq(share, tmp, n)) ret = 1;
+	}
+
+	wipememory(share, sizeof(share));
+
+	return ret;
+}
+
+slip0039_error_t slip0039_refresh(slip0039_ctx_t *ctx,
+		const char *seed, size_t len) {
+	slip0039_t *s = &ctx->s;
+	slip0039_error_t err;
+	int ret = 0;
+
+	assert(!ctx->p.sets);
+	if (ctx->p.no_input || ctx->p.len)
+		return slip0039_error(ctx, SLIP0039_EMNEMONIC,
+				"EOF encountered before \\n while reading "
+				"mnemonic");
+	if (!s->n) return slip0039_error(ctx, SLIP0039_EMNEMONIC,
+			"no mnemonics found");
+
+	/* the refreshed shares only combine with each other, so every
+	 * group must be complete and consistent before it is refreshed; with
+	 * member threshold <= 2 the polynomial is fixed by the secret and
+	 * the digest, so such a group can't be refreshed at all */
+	for (uint8_t i = 0; i < s->root.count; i++) {
+		slip0039_set_t *m = &s->members[i];
+		if (!m->available) continue;
+		if (m->threshold <= 2)
+			return slip0039_error(ctx, SLIP0039_EINVAL, "group %d "
+					"has member threshold %d, its shares "
+					"can't be refreshed, leave them out",
+					i + 1, m->threshold);
+		if (m->available < m->threshold)
+			return slip0039_error(ctx, SLIP0039_EQUORUM,
+					"group %d has %d of %d shares, all "
+					"shares of a group that are kept must "
+					"be refreshed", i + 1, m->available,
+					m->threshold);
+		if (slip0039_check_group(m, s->n))
+			return slip0039_error(ctx, SLIP0039_EMNEMONIC,
+					"shares of group %d do not match",
+					i + 1);
+	}
+
+	if ((err = slip0039_copy_seed(ctx, seed, len))) return err;
+
+	/* initialize PRNG based on PBKDF2 with SEED and all shares as
+	 * password, so that refreshing twice with the same SEED does not
+	 * undo the first refresh
+	 *
+	 * Password = ( SEED || share ... )
+	 * Salt = ( "refresh" || e || id )
+	 *
+	 * all numbers are encoded as 8 bit integers */
+	pbkdf2_init(&ctx->prng, HASH_SHA256);
+	pbkdf2_update_password(&ctx->prng, ctx->seed, ctx->seed_len);
+	for (uint8_t i = 0; i < s->root.count; i++)
+		for (uint8_t j = 0; j < MAX_SHARES; j++)
+			if (s->members[i].shares[j])
+				pbkdf2_update_password(&ctx->prng,
+						s->members[i].shares[j], s->n);
+	pbkdf2_update_salt(&ctx->prng, "refresh", 7);
+	pbkdf2_update_salt_uint8(&ctx->prng, s->e);
+	pbkdf2_update_salt_uint8(&ctx->prng, s->id>>8);
+	pbkdf2_update_salt_uint8(&ctx->prng, s->id&0xff);
+	pbkdf2_finalize_salt(&ctx->prng, 1);
+
+	for (uint8_t i = 0; i < s->root.count && !ret; i++) {
+		slip0039_set_t *m = &s->members[i];
+		if (m->available)
+			ret = slip0039_refresh_group(m, s->n, &ctx->prng);
+	}
+
+	pbkdf2_finished(&ctx->prng);
+
+	return ret ? slip0039_nomem(ctx) : SLIP0039_OK;
+}
+
+slip0039_error_t slip0039_try_passphrase(slip0039_ctx_t *ctx,
+		const slip0039_t *ems, const char *passphrase, size_t len) {
+	slip0039_t *s = &ctx->s;
+	slip0039_error_t err;
+
+	assert(ems->root.secret && ems->n);
+	s->id = ems->id;
+	s->e = ems->e;
+	s->n = ems->n;
+	if (slip0039_alloc(s, ctx->max_n)) return slip0039_nomem(ctx);
+	s->root.secret = s->storage_secret;
+	memcpy(s->root.secret, ems->root.secret, s->n);
+	s->plaintext = NULL;
+	wipememory(ctx->plaintext, ctx->line_size);
+
+	lrcipher_init(&s->l);
+	if ((err = slip0039_add_passphrase(ctx, passphrase, len))) return err;
+	lrcipher_finalize_passphrase(&s->l, "shamir", 6, s->id);
+
+	slip0039_decrypt(s);
+
+	return slip0039_decode_plaintext(ctx, s);
+}
+
+slip0039_error_t slip0039_multi_recover(slip0039_ctx_t *ctx,
+		slip0039_multi_t *m) {
+	slip0039_error_t err;
+
+	m->s.l = ctx->s.l;
+	if ((err = slip0039_recover_set(ctx, &m->s))) {
+		snprintf(m->plaintext, ctx->line_size, "%s", ctx->error);
+		return err;
+	}
+
+	memcpy(m->plaintext, ctx->plaintext, ctx->line_size);
+	wipememory(ctx->plaintext, ctx->line_size);
+	m->ok = 1;
+
+	return SLIP0039_OK;
+}
@@ -0,0 +1,179 @@
+/* libslip0039.h - split and recover sessions
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SLIP0039_LIBSLIP0039_H
+#define SLIP0039_LIBSLIP0039_H
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+#include "slip0039.h"
+#include "codec.h"
+#include "pbkdf2.h"
+#include "base.h"
+#include "utils.h"
+#include "llist.h"
+
+/* the functions of the library do not exit on errors and do not write to
+ * stdout or stderr, they return one of these codes and a description is
+ * available in the context */
+typedef enum slip0039_error_e {
+	SLIP0039_OK = 0,
+	SLIP0039_EINVAL,	// invalid codec or group specification
+	SLIP0039_EINPUT,	// invalid passphrase, seed or plaintext
+	SLIP0039_EMNEMONIC,	// invalid mnemonic
+	SLIP0039_EQUORUM,	// not enough shares to recover the secret
+	SLIP0039_EDIGEST,	// digest failed
+	SLIP0039_ENOMEM		// out of secure memory (see ulimit -l)
+} slip0039_error_t;
+
+// how the secret is split: EXP GT XofY..
+typedef struct slip0039_spec_s {
+	uint8_t e, GT, G;
+	struct {
+		uint8_t threshold, count;
+	} groups[MAX_SHARES];
+} slip0039_spec_t;
+
+/* all state of one split or recover session, contexts are independent,
+ * so any number of them can be used concurrently (one thread per context)
+ * the context contains pointers to itself and must not be copied */
+typedef struct slip0039_ctx_s {
+	slip0039_t s;
+	slip0039_parser_t p;
+	pbkdf2_t prng;			// PRNG for shares and part of digests
+	base_scratch_t bs;		// scratch space for base encoding
+	uint8_t header[5];
+	char seed[512];			// seed for PRNG
+	size_t seed_len;
+	codec_t *codec;
+	wordlist_t *wordlist;
+	displayline_t error;
+
+	/* the buffers below are allocated in secure memory for secrets of
+	 * at most max_n bytes, see slip0039_ctx_max_secret() */
+	size_t max_n;
+	size_t max_words;		// WORDS_FOR(max_n), words in a mnemonic
+	size_t line_size;		// size of mnemonic and plaintext
+	char *mnemonic;			// buffer to contain one mnemonic
+	char *plaintext;		// the recovered plaintext
+	uint16_t *input;		// space for words, max_n<<2 of them
+	uint8_t *base_scratch_space;
+} slip0039_ctx_t;
+
+/* recover --all: a set of mnemonics with the same identifier, iteration
+ * exponent, group threshold and group count */
+typedef struct slip0039_multi_s {
+	void *next;		// used by llist
+	size_t no;		// order of first appearance
+	int ok;			// plaintext is recovered
+	char *plaintext;	// or the reason it is not, line_size bytes
+	slip0039_t s;
+} slip0039_multi_t;
+
+// must be called once, before any context is used
+void slip0039_lib_init();
+
+/* the context supports secrets of at most BLOCKS<<1 bytes, the context
+ * must be wiped, even if this fails */
+slip0039_error_t slip0039_ctx_init(slip0039_ctx_t*);
+
+/* support secrets of at most n bytes (BLOCKS<<1 <= n <= MAX_SECRET), the
+ * buffers of the context are reallocated, so call this before use */
+slip0039_error_t slip0039_ctx_max_secret(slip0039_ctx_t*, size_t n);
+
+void slip0039_ctx_wipe(slip0039_ctx_t*);
+
+const char *slip0039_ctx_error(const slip0039_ctx_t*);
+
+// select codec and wordlist: CODEC[:WORDLIST]
+slip0039_error_t slip0039_ctx_codec(slip0039_ctx_t*, const char*);
+
+// may be called repeatedly, the passphrase is the concatenation
+slip0039_error_t slip0039_add_passphrase(slip0039_ctx_t*, const char*, size_t);
+
+slip0039_error_t slip0039_split_init(slip0039_ctx_t*, const slip0039_spec_t*);
+
+// a seed of less than 64 bytes is accepted, but the caller should warn
+slip0039_error_t slip0039_split_seed(slip0039_ctx_t*, const char*, size_t);
+
+// encode, encrypt and split the plaintext
+slip0039_error_t slip0039_split_plaintext(slip0039_ctx_t*, const char*);
+
+// write all mnemonics, one per line
+slip0039_error_t slip0039_split_mnemonics(slip0039_ctx_t*, sbuf_t*);
+
+/* feed one character of the mnemonics, *more is set to 0 if an empty
+ * line is encountered, if the parser of the context sorts the mnemonics
+ * into sets (p.sets), then errors in mnemonics are reported and skipped,
+ * otherwise the error is returned and the context must be wiped; running
+ * out of secure memory is always returned */
+slip0039_error_t slip0039_recover_add_char(slip0039_ctx_t*, int, int *more);
+
+slip0039_error_t slip0039_recover_add_mnemonic(slip0039_ctx_t*, const char*);
+
+// recover, decrypt and decode the plaintext into ctx->plaintext
+slip0039_error_t slip0039_recover_finish(slip0039_ctx_t*);
+
+/* check the mnemonics, the quorum and the digests of all complete groups,
+ * but do not decrypt, so no passphrase is needed */
+slip0039_error_t slip0039_verify_finish(slip0039_ctx_t*);
+
+/* verify the mnemonics and split the EMS again according to spec (the
+ * iteration exponent in spec is ignored) with the same identifier, the
+ * mnemonics are written by slip0039_split_mnemonics(), no passphrase is
+ * needed, because the EMS is never decrypted */
+slip0039_error_t slip0039_reshare(slip0039_ctx_t*, const slip0039_spec_t*,
+		const char *seed, size_t len);
+
+/* re-randomize the shares of every group, neither the secret nor the
+ * digest of a group is computed, the refreshed mnemonics are written by
+ * slip0039_split_mnemonics(), shares that were not refreshed can't be
+ * combined with the refreshed ones; a group with member threshold <= 2
+ * can't be refreshed and is refused */
+slip0039_error_t slip0039_refresh(slip0039_ctx_t*, const char *seed,
+		size_t len);
+
+/* decrypt and decode the EMS of ems (recovered by slip0039_verify_finish()
+ * in another context) with a candidate passphrase into ctx->plaintext */
+slip0039_error_t slip0039_try_passphrase(slip0039_ctx_t*, const slip0039_t *ems,
+		const char *passphrase, size_t len);
+
+/* sort the mnemonics of the context into the sets in the list, report is
+ * called with arg and the error of every mnemonic that is skipped */
+slip0039_error_t slip0039_multi_init(slip0039_ctx_t*, llist_t*, llist_info_t*,
+		void (*report)(void *arg, const char *error), void *arg);
+
+/* the checksums of the mnemonics are verified in batches, call this after
+ * the last character to process the mnemonics that are still buffered */
+slip0039_error_t slip0039_multi_finish(slip0039_ctx_t*);
+
+// recover a set using the passphrase of the context
+slip0039_error_t slip0039_multi_recover(slip0039_ctx_t*, slip0039_multi_t*);
+
+void slip0039_init(slip0039_t*);
+
+// free the storage of the shares
+void slip0039_free(slip0039_t*);
+
+int slip0039_quorum(slip0039_set_t*);
+
+// the first two words of the mnemonics of the set, as in " (word word)"
+const char *slip0039_title(slip0039_t*);
+
+#endif /* SLIP0039_LIBSLIP0039_H */
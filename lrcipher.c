@@ -24,6 +24,7 @@
 #include "pbkdf2.h"
 #include "lrcipher.h"
 #include "utils.h"
+#include "stats.h"
 
 void lrcipher_init(lrcipher_t *l) {
 	assert(l);
@@ -47,14 +48,8 @@ void lrcipher_finalize_passphrase(lrcipher_t *l, const char *context, size_t con
 	}
 }
 
-static void helper(lrcipher_t *l, unsigned char *L,
-		unsigned char *R, size_t size, int round, uint64_t iterations,
-		int xchg) {
-	pbkdf2_t p = l->rounds[round];
-	unsigned char tmp[BLOCKS];
-	pbkdf2_update_salt(&p, R, size);
-	pbkdf2_done(&p, tmp, size, iterations);
-
+static void mix(unsigned char *L, unsigned char *R,
+		unsigned char *tmp, size_t size, int xchg) {
 	if (!xchg) for (int i = 0; i < size; i++) {
                 tmp[i] ^= L[i];
                 L[i] = R[i];
@@ -64,7 +59,19 @@ static void helper(lrcipher_t *l, unsigned char *L,
 		// L and R at the end of lrcipher
 		L[i] ^= tmp[i];
 	}
+}
+
+static void helper(lrcipher_t *l, unsigned char *L,
+		unsigned char *R, size_t size, int round, uint64_t iterations,
+		int xchg) {
+	pbkdf2_t p = l->rounds[round];
+	unsigned char tmp[size];
+	STATS_START(start);
+	pbkdf2_update_salt(&p, R, size);
+	pbkdf2_done(&p, tmp, size, iterations);
+	mix(L, R, tmp, size, xchg);
 	wipememory(tmp, sizeof(tmp));
+	STATS_STOP(start, STATS_ROUND0 + round);
 }
 
 void lrcipher_execute(lrcipher_t *l, unsigned char *dst,
@@ -81,3 +88,61 @@ void lrcipher_execute(lrcipher_t *l, unsigned char *dst,
                 helper(l, dst, dst + size, size, i^dir,
 				iterations, i == 3);
 }
+
+void lrcipher_cache_init(lrcipher_cache_t *c, const lrcipher_t *l) {
+	assert(c && l);
+	for (int i = 0; i < 4; i++) {
+		// the passphrase must be finalized
+		assert(l->rounds[i].state == 1);
+		c->inner[i] = l->rounds[i].salt.h;
+		hmac_outer(&l->rounds[i].salt, &c->outer[i]);
+	}
+}
+
+// a round of PBKDF2 with a single iteration is the concatenation of the
+// blocks HMAC(P, S || INT(i)), the inner hash continues from the state
+// after the key and the salt prefix, the outer hash continues from the
+// state after the key
+static void cache_helper(const lrcipher_cache_t *c, unsigned char *L,
+		unsigned char *R, size_t size, int round, int xchg) {
+	unsigned char tmp[(size + SHA256_LEN - 1)/SHA256_LEN*SHA256_LEN];
+	uint32_t index;
+	hash_t h;
+	STATS_START(start);
+
+	assert(c->inner[round].f->len == SHA256_LEN);
+
+	for (size_t i = 0; i*SHA256_LEN < size; i++) {
+		unsigned char *block = tmp + i*SHA256_LEN;
+
+		STATS_COUNT(STATS_HMAC);
+		index = cpu_to_be32(i + 1);
+		h = c->inner[round];
+		hash_update(&h, R, size);
+		hash_update(&h, &index, sizeof(index));
+		hash_finalize(&h, block, SHA256_LEN);
+
+		h = c->outer[round];
+		hash_update(&h, block, SHA256_LEN);
+		hash_finalize(&h, block, SHA256_LEN);
+	}
+
+	mix(L, R, tmp, size, xchg);
+	wipememory(tmp, sizeof(tmp));
+	wipememory(&h, sizeof(h));
+	STATS_STOP(start, STATS_ROUND0 + round);
+}
+
+void lrcipher_cache_execute(const lrcipher_cache_t *c, unsigned char *dst,
+		const unsigned char *src, size_t size, lrcipher_dir_t dir) {
+	if (src != dst) memmove(dst, src, size);
+
+	size >>= 1;
+
+        for (int i = 0; i < 4; i++)
+                cache_helper(c, dst, dst + size, size, i^dir, i == 3);
+}
+
+void lrcipher_cache_finished(lrcipher_cache_t *c) {
+	wipememory(c, sizeof(*c));
+}
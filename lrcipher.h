@@ -28,6 +28,13 @@ typedef struct lrcipher_s {
 	pbkdf2_t rounds[4];
 } lrcipher_t;
 
+// the keyed hash states of the four rounds, used to execute the
+// cipher with a single iteration (as done while cycle walking)
+// in two compressions per round, without copying the pbkdf2 states
+typedef struct lrcipher_cache_s {
+	hash_t inner[4], outer[4];
+} lrcipher_cache_t;
+
 typedef enum lrcypher_dir_e { LRCIPHER_ENCRYPT = 0, LRCIPHER_DECRYPT = 3 } lrcipher_dir_t;
 
 void lrcipher_init(lrcipher_t*);
@@ -39,5 +46,12 @@ void lrcipher_finalize_passphrase(lrcipher_t*, const char*, size_t, uint16_t);
 void lrcipher_execute(lrcipher_t*, unsigned char*,
 		const unsigned char*, size_t, uint64_t, lrcipher_dir_t);
 
+void lrcipher_cache_init(lrcipher_cache_t*, const lrcipher_t*);
+
+void lrcipher_cache_execute(const lrcipher_cache_t*, unsigned char*,
+		const unsigned char*, size_t, lrcipher_dir_t);
+
+void lrcipher_cache_finished(lrcipher_cache_t*);
+
 #endif /* SLIP0039_LRCYPER_H */
 
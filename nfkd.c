@@ -0,0 +1,87 @@
+/* nfkd.c - NFKD normalization of UTF-8 strings for BIP39
+ *
+ * Copyright 2022 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <assert.h>
+#include <string.h>
+#include "nfkd.h"
+#include "cthelp.h"
+#include "verbose.h"
+
+// decode the UTF-8 sequence at in, invalid sequences decode to a
+// single byte with codepoint 0, which is not in the table
+static size_t utf8_decode(const char *in, uint32_t *codepoint) {
+	const uint8_t *s = (const uint8_t*)in;
+	size_t len, i;
+
+	if (s[0] < 0x80) len = 1, *codepoint = s[0];
+	else if ((s[0]&0xe0) == 0xc0) len = 2, *codepoint = s[0]&0x1f;
+	else if ((s[0]&0xf0) == 0xe0) len = 3, *codepoint = s[0]&0x0f;
+	else if ((s[0]&0xf8) == 0xf0) len = 4, *codepoint = s[0]&0x07;
+	else goto invalid;
+
+	for (i = 1; i < len; i++) {
+		if ((s[i]&0xc0) != 0x80) goto invalid;
+		*codepoint = (*codepoint<<6)|(s[i]&0x3f);
+	}
+
+	return len;
+
+invalid:
+	*codepoint = 0;
+	return 1;
+}
+
+/* the mnemonic is secret, so the whole table is scanned for every
+ * character and the decomposition is selected using a mask, like
+ * wordlist_dereference() does */
+void sbufprintf_nfkd(sbuf_t *s, const char *in) {
+	char buf[NFKD_MAX_LENGTH];
+	uint32_t codepoint;
+	size_t len, out_len;
+
+	assert(s && in);
+
+	while (*in) {
+		len = utf8_decode(in, &codepoint);
+		memset(buf, 0, sizeof(buf));
+		out_len = 0;
+
+		for (size_t i = 0; i < nfkd_table_size; i++) {
+			const nfkd_t *e = &nfkd_table[i];
+			int eq = cthelp_eq(e->codepoint, codepoint);
+			for (int j = 0; j < e->len; j++)
+				buf[j] |= e->decomposition[j]&(-eq);
+			out_len |= e->len&(-eq);
+		}
+
+		if (!out_len) {
+			memcpy(buf, in, len);
+			out_len = len;
+		}
+
+		if (s->len + out_len >= s->size) BUG("buffer too small");
+		memcpy(s->buf + s->len, buf, out_len);
+		s->len += out_len;
+		s->buf[s->len] = '\0';
+		in += len;
+	}
+
+	wipememory(buf, sizeof(buf));
+	wipememory(&codepoint, sizeof(codepoint));
+}
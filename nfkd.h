@@ -0,0 +1,45 @@
+/* nfkd.h - NFKD normalization of UTF-8 strings for BIP39
+ *
+ * Copyright 2022 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SLIP0039_NFKD_H
+#define SLIP0039_NFKD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "utils.h"
+
+// maximum length in bytes of the decomposition of a codepoint
+#define NFKD_MAX_LENGTH 16
+
+typedef struct nfkd_s {
+	uint32_t codepoint;
+	uint8_t len;
+	const char *decomposition;
+} nfkd_t;
+
+/* the table is generated at build time by nfkd2c, it only contains
+ * the codepoints that decompose to characters that occur in the
+ * BIP39 wordlists, all other characters are copied verbatim */
+extern const nfkd_t nfkd_table[];
+
+extern const size_t nfkd_table_size;
+
+void sbufprintf_nfkd(sbuf_t*, const char*);
+
+#endif /* SLIP0039_NFKD_H */
@@ -0,0 +1,127 @@
+/* nfkd2c.c - generate the NFKD table for the BIP39 wordlists
+ *
+ * Copyright 2022 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* this program runs at build time, it is the only user of utf8proc, so
+ * that utf8proc does not need to be linked into (and locked in memory
+ * by) slip0039; it writes a table with every codepoint whose NFKD
+ * decomposition only contains characters that occur in the (NFKD
+ * normalized) wordlists given on the command line */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utf8proc.h"
+#include "nfkd.h"
+
+#define NO_CODEPOINTS 0x110000
+
+static void fatal(const char *msg, const char *arg) {
+	fprintf(stderr, "nfkd2c: %s%s\n", msg, arg);
+	exit(1);
+}
+
+static void add_alphabet(uint8_t *alphabet, const char *word) {
+	utf8proc_uint8_t *nfkd = utf8proc_NFKD((const utf8proc_uint8_t*)word);
+	utf8proc_int32_t codepoint;
+	utf8proc_ssize_t len;
+	const utf8proc_uint8_t *cur = nfkd;
+
+	if (!nfkd) fatal("invalid UTF-8 in word ", word);
+
+	while (*cur) {
+		if ((len = utf8proc_iterate(cur, -1, &codepoint)) < 0)
+			fatal("invalid UTF-8 in word ", word);
+		alphabet[codepoint] = 1;
+		cur += len;
+	}
+
+	free(nfkd);
+}
+
+static void read_wordlist(uint8_t *alphabet, const char *filename) {
+	char line[256];
+	FILE *fp;
+
+	if (!(fp = fopen(filename, "r"))) fatal("unable to open ", filename);
+
+	while (fgets(line, sizeof(line), fp)) {
+		line[strcspn(line, "\n")] = '\0';
+		add_alphabet(alphabet, line);
+	}
+
+	if (ferror(fp)) fatal("error reading ", filename);
+
+	fclose(fp);
+}
+
+int main(int argc, char *argv[]) {
+	utf8proc_int32_t decomposition[NFKD_MAX_LENGTH];
+	utf8proc_uint8_t utf8[NFKD_MAX_LENGTH + 4];
+	uint8_t *alphabet;
+	utf8proc_int32_t codepoint;
+	size_t entries = 0;
+
+	if (argc < 2) fatal("usage: nfkd2c WORDLIST..", "");
+
+	if (!(alphabet = calloc(NO_CODEPOINTS, 1))) fatal("out of memory", "");
+
+	for (int i = 1; i < argc; i++) read_wordlist(alphabet, argv[i]);
+
+	printf("/* This file is autogenerated by nfkd2c, do not edit */\n\n");
+	printf("#include \"nfkd.h\"\n\n");
+	printf("const nfkd_t nfkd_table[] = {\n");
+
+	// ASCII is not affected by NFKD
+	for (codepoint = 0x80; codepoint < NO_CODEPOINTS; codepoint++) {
+		utf8proc_ssize_t no, len = 0;
+		int last_boundclass = 0;
+
+		if (!utf8proc_codepoint_valid(codepoint)) continue;
+
+		no = utf8proc_decompose_char(codepoint, decomposition,
+				NFKD_MAX_LENGTH, UTF8PROC_STABLE|UTF8PROC_DECOMPOSE|
+				UTF8PROC_COMPAT, &last_boundclass);
+
+		// decompositions that are too long are not in the alphabet
+		if (no <= 0 || no > NFKD_MAX_LENGTH) continue;
+
+		if (no == 1 && decomposition[0] == codepoint) continue;
+
+		for (int i = 0; i < no; i++) {
+			if (!alphabet[decomposition[i]]) goto next;
+			len += utf8proc_encode_char(decomposition[i], utf8 + len);
+			if (len > NFKD_MAX_LENGTH) goto next;
+		}
+
+		printf("\t{ 0x%06x, %ld, \"", codepoint, len);
+		for (int i = 0; i < len; i++) printf("\\x%02x", utf8[i]);
+		printf("\" },\n");
+		entries++;
+next:		;
+	}
+
+	if (!entries) fatal("no codepoints found", "");
+
+	printf("};\n\n");
+	printf("const size_t nfkd_table_size = sizeof(nfkd_table)/sizeof(*nfkd_table);\n");
+
+	free(alphabet);
+
+	return 0;
+}
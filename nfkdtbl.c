@@ -0,0 +1,540 @@
+/* This file is autogenerated by nfkd2c, do not edit */
+
+#include "nfkd.h"
+
+const nfkd_t nfkd_table[] = {
+	{ 0x0000aa, 1, "\x61" },
+	{ 0x0000ba, 1, "\x6f" },
+	{ 0x0000e1, 3, "\x61\xcc\x81" },
+	{ 0x0000e3, 3, "\x61\xcc\x83" },
+	{ 0x0000e9, 3, "\x65\xcc\x81" },
+	{ 0x0000ed, 3, "\x69\xcc\x81" },
+	{ 0x0000f1, 3, "\x6e\xcc\x83" },
+	{ 0x0000f3, 3, "\x6f\xcc\x81" },
+	{ 0x0000f5, 3, "\x6f\xcc\x83" },
+	{ 0x0000fa, 3, "\x75\xcc\x81" },
+	{ 0x0000fd, 3, "\x79\xcc\x81" },
+	{ 0x000107, 3, "\x63\xcc\x81" },
+	{ 0x000129, 3, "\x69\xcc\x83" },
+	{ 0x000133, 2, "\x69\x6a" },
+	{ 0x00013a, 3, "\x6c\xcc\x81" },
+	{ 0x000144, 3, "\x6e\xcc\x81" },
+	{ 0x000155, 3, "\x72\xcc\x81" },
+	{ 0x00015b, 3, "\x73\xcc\x81" },
+	{ 0x000169, 3, "\x75\xcc\x83" },
+	{ 0x00017a, 3, "\x7a\xcc\x81" },
+	{ 0x00017f, 1, "\x73" },
+	{ 0x0001c9, 2, "\x6c\x6a" },
+	{ 0x0001cc, 2, "\x6e\x6a" },
+	{ 0x0001f3, 2, "\x64\x7a" },
+	{ 0x0001f5, 3, "\x67\xcc\x81" },
+	{ 0x0002b0, 1, "\x68" },
+	{ 0x0002b2, 1, "\x6a" },
+	{ 0x0002b3, 1, "\x72" },
+	{ 0x0002b7, 1, "\x77" },
+	{ 0x0002b8, 1, "\x79" },
+	{ 0x0002e1, 1, "\x6c" },
+	{ 0x0002e2, 1, "\x73" },
+	{ 0x0002e3, 1, "\x78" },
+	{ 0x000341, 2, "\xcc\x81" },
+	{ 0x001d43, 1, "\x61" },
+	{ 0x001d47, 1, "\x62" },
+	{ 0x001d48, 1, "\x64" },
+	{ 0x001d49, 1, "\x65" },
+	{ 0x001d4d, 1, "\x67" },
+	{ 0x001d4f, 1, "\x6b" },
+	{ 0x001d50, 1, "\x6d" },
+	{ 0x001d52, 1, "\x6f" },
+	{ 0x001d56, 1, "\x70" },
+	{ 0x001d57, 1, "\x74" },
+	{ 0x001d58, 1, "\x75" },
+	{ 0x001d5b, 1, "\x76" },
+	{ 0x001d62, 1, "\x69" },
+	{ 0x001d63, 1, "\x72" },
+	{ 0x001d64, 1, "\x75" },
+	{ 0x001d65, 1, "\x76" },
+	{ 0x001d9c, 1, "\x63" },
+	{ 0x001da0, 1, "\x66" },
+	{ 0x001dbb, 1, "\x7a" },
+	{ 0x001e31, 3, "\x6b\xcc\x81" },
+	{ 0x001e3f, 3, "\x6d\xcc\x81" },
+	{ 0x001e4d, 5, "\x6f\xcc\x83\xcc\x81" },
+	{ 0x001e55, 3, "\x70\xcc\x81" },
+	{ 0x001e79, 5, "\x75\xcc\x83\xcc\x81" },
+	{ 0x001e7d, 3, "\x76\xcc\x83" },
+	{ 0x001e83, 3, "\x77\xcc\x81" },
+	{ 0x001ebd, 3, "\x65\xcc\x83" },
+	{ 0x001ef9, 3, "\x79\xcc\x83" },
+	{ 0x002071, 1, "\x69" },
+	{ 0x00207f, 1, "\x6e" },
+	{ 0x002090, 1, "\x61" },
+	{ 0x002091, 1, "\x65" },
+	{ 0x002092, 1, "\x6f" },
+	{ 0x002093, 1, "\x78" },
+	{ 0x002095, 1, "\x68" },
+	{ 0x002096, 1, "\x6b" },
+	{ 0x002097, 1, "\x6c" },
+	{ 0x002098, 1, "\x6d" },
+	{ 0x002099, 1, "\x6e" },
+	{ 0x00209a, 1, "\x70" },
+	{ 0x00209b, 1, "\x73" },
+	{ 0x00209c, 1, "\x74" },
+	{ 0x00210a, 1, "\x67" },
+	{ 0x00210e, 1, "\x68" },
+	{ 0x002113, 1, "\x6c" },
+	{ 0x00212f, 1, "\x65" },
+	{ 0x002134, 1, "\x6f" },
+	{ 0x002139, 1, "\x69" },
+	{ 0x002146, 1, "\x64" },
+	{ 0x002147, 1, "\x65" },
+	{ 0x002148, 1, "\x69" },
+	{ 0x002149, 1, "\x6a" },
+	{ 0x002170, 1, "\x69" },
+	{ 0x002171, 2, "\x69\x69" },
+	{ 0x002172, 3, "\x69\x69\x69" },
+	{ 0x002173, 2, "\x69\x76" },
+	{ 0x002174, 1, "\x76" },
+	{ 0x002175, 2, "\x76\x69" },
+	{ 0x002176, 3, "\x76\x69\x69" },
+	{ 0x002177, 4, "\x76\x69\x69\x69" },
+	{ 0x002178, 2, "\x69\x78" },
+	{ 0x002179, 1, "\x78" },
+	{ 0x00217a, 2, "\x78\x69" },
+	{ 0x00217b, 3, "\x78\x69\x69" },
+	{ 0x00217c, 1, "\x6c" },
+	{ 0x00217d, 1, "\x63" },
+	{ 0x00217e, 1, "\x64" },
+	{ 0x00217f, 1, "\x6d" },
+	{ 0x0024d0, 1, "\x61" },
+	{ 0x0024d1, 1, "\x62" },
+	{ 0x0024d2, 1, "\x63" },
+	{ 0x0024d3, 1, "\x64" },
+	{ 0x0024d4, 1, "\x65" },
+	{ 0x0024d5, 1, "\x66" },
+	{ 0x0024d6, 1, "\x67" },
+	{ 0x0024d7, 1, "\x68" },
+	{ 0x0024d8, 1, "\x69" },
+	{ 0x0024d9, 1, "\x6a" },
+	{ 0x0024da, 1, "\x6b" },
+	{ 0x0024db, 1, "\x6c" },
+	{ 0x0024dc, 1, "\x6d" },
+	{ 0x0024dd, 1, "\x6e" },
+	{ 0x0024de, 1, "\x6f" },
+	{ 0x0024df, 1, "\x70" },
+	{ 0x0024e0, 1, "\x71" },
+	{ 0x0024e1, 1, "\x72" },
+	{ 0x0024e2, 1, "\x73" },
+	{ 0x0024e3, 1, "\x74" },
+	{ 0x0024e4, 1, "\x75" },
+	{ 0x0024e5, 1, "\x76" },
+	{ 0x0024e6, 1, "\x77" },
+	{ 0x0024e7, 1, "\x78" },
+	{ 0x0024e8, 1, "\x79" },
+	{ 0x0024e9, 1, "\x7a" },
+	{ 0x002c7c, 1, "\x6a" },
+	{ 0x0032cd, 3, "\x65\x72\x67" },
+	{ 0x003372, 2, "\x64\x61" },
+	{ 0x003374, 3, "\x62\x61\x72" },
+	{ 0x003376, 2, "\x70\x63" },
+	{ 0x003377, 2, "\x64\x6d" },
+	{ 0x003388, 3, "\x63\x61\x6c" },
+	{ 0x003389, 4, "\x6b\x63\x61\x6c" },
+	{ 0x00338e, 2, "\x6d\x67" },
+	{ 0x00338f, 2, "\x6b\x67" },
+	{ 0x003396, 2, "\x6d\x6c" },
+	{ 0x003397, 2, "\x64\x6c" },
+	{ 0x003398, 2, "\x6b\x6c" },
+	{ 0x003399, 2, "\x66\x6d" },
+	{ 0x00339a, 2, "\x6e\x6d" },
+	{ 0x00339c, 2, "\x6d\x6d" },
+	{ 0x00339d, 2, "\x63\x6d" },
+	{ 0x00339e, 2, "\x6b\x6d" },
+	{ 0x0033ad, 3, "\x72\x61\x64" },
+	{ 0x0033b0, 2, "\x70\x73" },
+	{ 0x0033b1, 2, "\x6e\x73" },
+	{ 0x0033b3, 2, "\x6d\x73" },
+	{ 0x0033c4, 2, "\x63\x63" },
+	{ 0x0033c5, 2, "\x63\x64" },
+	{ 0x0033ca, 2, "\x68\x61" },
+	{ 0x0033cc, 2, "\x69\x6e" },
+	{ 0x0033cf, 2, "\x6b\x74" },
+	{ 0x0033d0, 2, "\x6c\x6d" },
+	{ 0x0033d1, 2, "\x6c\x6e" },
+	{ 0x0033d2, 3, "\x6c\x6f\x67" },
+	{ 0x0033d3, 2, "\x6c\x78" },
+	{ 0x0033d4, 2, "\x6d\x62" },
+	{ 0x0033d5, 3, "\x6d\x69\x6c" },
+	{ 0x0033d6, 3, "\x6d\x6f\x6c" },
+	{ 0x0033db, 2, "\x73\x72" },
+	{ 0x0033ff, 3, "\x67\x61\x6c" },
+	{ 0x00fb00, 2, "\x66\x66" },
+	{ 0x00fb01, 2, "\x66\x69" },
+	{ 0x00fb02, 2, "\x66\x6c" },
+	{ 0x00fb03, 3, "\x66\x66\x69" },
+	{ 0x00fb04, 3, "\x66\x66\x6c" },
+	{ 0x00fb05, 2, "\x73\x74" },
+	{ 0x00fb06, 2, "\x73\x74" },
+	{ 0x00ff41, 1, "\x61" },
+	{ 0x00ff42, 1, "\x62" },
+	{ 0x00ff43, 1, "\x63" },
+	{ 0x00ff44, 1, "\x64" },
+	{ 0x00ff45, 1, "\x65" },
+	{ 0x00ff46, 1, "\x66" },
+	{ 0x00ff47, 1, "\x67" },
+	{ 0x00ff48, 1, "\x68" },
+	{ 0x00ff49, 1, "\x69" },
+	{ 0x00ff4a, 1, "\x6a" },
+	{ 0x00ff4b, 1, "\x6b" },
+	{ 0x00ff4c, 1, "\x6c" },
+	{ 0x00ff4d, 1, "\x6d" },
+	{ 0x00ff4e, 1, "\x6e" },
+	{ 0x00ff4f, 1, "\x6f" },
+	{ 0x00ff50, 1, "\x70" },
+	{ 0x00ff51, 1, "\x71" },
+	{ 0x00ff52, 1, "\x72" },
+	{ 0x00ff53, 1, "\x73" },
+	{ 0x00ff54, 1, "\x74" },
+	{ 0x00ff55, 1, "\x75" },
+	{ 0x00ff56, 1, "\x76" },
+	{ 0x00ff57, 1, "\x77" },
+	{ 0x00ff58, 1, "\x78" },
+	{ 0x00ff59, 1, "\x79" },
+	{ 0x00ff5a, 1, "\x7a" },
+	{ 0x0107a5, 1, "\x71" },
+	{ 0x01d41a, 1, "\x61" },
+	{ 0x01d41b, 1, "\x62" },
+	{ 0x01d41c, 1, "\x63" },
+	{ 0x01d41d, 1, "\x64" },
+	{ 0x01d41e, 1, "\x65" },
+	{ 0x01d41f, 1, "\x66" },
+	{ 0x01d420, 1, "\x67" },
+	{ 0x01d421, 1, "\x68" },
+	{ 0x01d422, 1, "\x69" },
+	{ 0x01d423, 1, "\x6a" },
+	{ 0x01d424, 1, "\x6b" },
+	{ 0x01d425, 1, "\x6c" },
+	{ 0x01d426, 1, "\x6d" },
+	{ 0x01d427, 1, "\x6e" },
+	{ 0x01d428, 1, "\x6f" },
+	{ 0x01d429, 1, "\x70" },
+	{ 0x01d42a, 1, "\x71" },
+	{ 0x01d42b, 1, "\x72" },
+	{ 0x01d42c, 1, "\x73" },
+	{ 0x01d42d, 1, "\x74" },
+	{ 0x01d42e, 1, "\x75" },
+	{ 0x01d42f, 1, "\x76" },
+	{ 0x01d430, 1, "\x77" },
+	{ 0x01d431, 1, "\x78" },
+	{ 0x01d432, 1, "\x79" },
+	{ 0x01d433, 1, "\x7a" },
+	{ 0x01d44e, 1, "\x61" },
+	{ 0x01d44f, 1, "\x62" },
+	{ 0x01d450, 1, "\x63" },
+	{ 0x01d451, 1, "\x64" },
+	{ 0x01d452, 1, "\x65" },
+	{ 0x01d453, 1, "\x66" },
+	{ 0x01d454, 1, "\x67" },
+	{ 0x01d456, 1, "\x69" },
+	{ 0x01d457, 1, "\x6a" },
+	{ 0x01d458, 1, "\x6b" },
+	{ 0x01d459, 1, "\x6c" },
+	{ 0x01d45a, 1, "\x6d" },
+	{ 0x01d45b, 1, "\x6e" },
+	{ 0x01d45c, 1, "\x6f" },
+	{ 0x01d45d, 1, "\x70" },
+	{ 0x01d45e, 1, "\x71" },
+	{ 0x01d45f, 1, "\x72" },
+	{ 0x01d460, 1, "\x73" },
+	{ 0x01d461, 1, "\x74" },
+	{ 0x01d462, 1, "\x75" },
+	{ 0x01d463, 1, "\x76" },
+	{ 0x01d464, 1, "\x77" },
+	{ 0x01d465, 1, "\x78" },
+	{ 0x01d466, 1, "\x79" },
+	{ 0x01d467, 1, "\x7a" },
+	{ 0x01d482, 1, "\x61" },
+	{ 0x01d483, 1, "\x62" },
+	{ 0x01d484, 1, "\x63" },
+	{ 0x01d485, 1, "\x64" },
+	{ 0x01d486, 1, "\x65" },
+	{ 0x01d487, 1, "\x66" },
+	{ 0x01d488, 1, "\x67" },
+	{ 0x01d489, 1, "\x68" },
+	{ 0x01d48a, 1, "\x69" },
+	{ 0x01d48b, 1, "\x6a" },
+	{ 0x01d48c, 1, "\x6b" },
+	{ 0x01d48d, 1, "\x6c" },
+	{ 0x01d48e, 1, "\x6d" },
+	{ 0x01d48f, 1, "\x6e" },
+	{ 0x01d490, 1, "\x6f" },
+	{ 0x01d491, 1, "\x70" },
+	{ 0x01d492, 1, "\x71" },
+	{ 0x01d493, 1, "\x72" },
+	{ 0x01d494, 1, "\x73" },
+	{ 0x01d495, 1, "\x74" },
+	{ 0x01d496, 1, "\x75" },
+	{ 0x01d497, 1, "\x76" },
+	{ 0x01d498, 1, "\x77" },
+	{ 0x01d499, 1, "\x78" },
+	{ 0x01d49a, 1, "\x79" },
+	{ 0x01d49b, 1, "\x7a" },
+	{ 0x01d4b6, 1, "\x61" },
+	{ 0x01d4b7, 1, "\x62" },
+	{ 0x01d4b8, 1, "\x63" },
+	{ 0x01d4b9, 1, "\x64" },
+	{ 0x01d4bb, 1, "\x66" },
+	{ 0x01d4bd, 1, "\x68" },
+	{ 0x01d4be, 1, "\x69" },
+	{ 0x01d4bf, 1, "\x6a" },
+	{ 0x01d4c0, 1, "\x6b" },
+	{ 0x01d4c1, 1, "\x6c" },
+	{ 0x01d4c2, 1, "\x6d" },
+	{ 0x01d4c3, 1, "\x6e" },
+	{ 0x01d4c5, 1, "\x70" },
+	{ 0x01d4c6, 1, "\x71" },
+	{ 0x01d4c7, 1, "\x72" },
+	{ 0x01d4c8, 1, "\x73" },
+	{ 0x01d4c9, 1, "\x74" },
+	{ 0x01d4ca, 1, "\x75" },
+	{ 0x01d4cb, 1, "\x76" },
+	{ 0x01d4cc, 1, "\x77" },
+	{ 0x01d4cd, 1, "\x78" },
+	{ 0x01d4ce, 1, "\x79" },
+	{ 0x01d4cf, 1, "\x7a" },
+	{ 0x01d4ea, 1, "\x61" },
+	{ 0x01d4eb, 1, "\x62" },
+	{ 0x01d4ec, 1, "\x63" },
+	{ 0x01d4ed, 1, "\x64" },
+	{ 0x01d4ee, 1, "\x65" },
+	{ 0x01d4ef, 1, "\x66" },
+	{ 0x01d4f0, 1, "\x67" },
+	{ 0x01d4f1, 1, "\x68" },
+	{ 0x01d4f2, 1, "\x69" },
+	{ 0x01d4f3, 1, "\x6a" },
+	{ 0x01d4f4, 1, "\x6b" },
+	{ 0x01d4f5, 1, "\x6c" },
+	{ 0x01d4f6, 1, "\x6d" },
+	{ 0x01d4f7, 1, "\x6e" },
+	{ 0x01d4f8, 1, "\x6f" },
+	{ 0x01d4f9, 1, "\x70" },
+	{ 0x01d4fa, 1, "\x71" },
+	{ 0x01d4fb, 1, "\x72" },
+	{ 0x01d4fc, 1, "\x73" },
+	{ 0x01d4fd, 1, "\x74" },
+	{ 0x01d4fe, 1, "\x75" },
+	{ 0x01d4ff, 1, "\x76" },
+	{ 0x01d500, 1, "\x77" },
+	{ 0x01d501, 1, "\x78" },
+	{ 0x01d502, 1, "\x79" },
+	{ 0x01d503, 1, "\x7a" },
+	{ 0x01d51e, 1, "\x61" },
+	{ 0x01d51f, 1, "\x62" },
+	{ 0x01d520, 1, "\x63" },
+	{ 0x01d521, 1, "\x64" },
+	{ 0x01d522, 1, "\x65" },
+	{ 0x01d523, 1, "\x66" },
+	{ 0x01d524, 1, "\x67" },
+	{ 0x01d525, 1, "\x68" },
+	{ 0x01d526, 1, "\x69" },
+	{ 0x01d527, 1, "\x6a" },
+	{ 0x01d528, 1, "\x6b" },
+	{ 0x01d529, 1, "\x6c" },
+	{ 0x01d52a, 1, "\x6d" },
+	{ 0x01d52b, 1, "\x6e" },
+	{ 0x01d52c, 1, "\x6f" },
+	{ 0x01d52d, 1, "\x70" },
+	{ 0x01d52e, 1, "\x71" },
+	{ 0x01d52f, 1, "\x72" },
+	{ 0x01d530, 1, "\x73" },
+	{ 0x01d531, 1, "\x74" },
+	{ 0x01d532, 1, "\x75" },
+	{ 0x01d533, 1, "\x76" },
+	{ 0x01d534, 1, "\x77" },
+	{ 0x01d535, 1, "\x78" },
+	{ 0x01d536, 1, "\x79" },
+	{ 0x01d537, 1, "\x7a" },
+	{ 0x01d552, 1, "\x61" },
+	{ 0x01d553, 1, "\x62" },
+	{ 0x01d554, 1, "\x63" },
+	{ 0x01d555, 1, "\x64" },
+	{ 0x01d556, 1, "\x65" },
+	{ 0x01d557, 1, "\x66" },
+	{ 0x01d558, 1, "\x67" },
+	{ 0x01d559, 1, "\x68" },
+	{ 0x01d55a, 1, "\x69" },
+	{ 0x01d55b, 1, "\x6a" },
+	{ 0x01d55c, 1, "\x6b" },
+	{ 0x01d55d, 1, "\x6c" },
+	{ 0x01d55e, 1, "\x6d" },
+	{ 0x01d55f, 1, "\x6e" },
+	{ 0x01d560, 1, "\x6f" },
+	{ 0x01d561, 1, "\x70" },
+	{ 0x01d562, 1, "\x71" },
+	{ 0x01d563, 1, "\x72" },
+	{ 0x01d564, 1, "\x73" },
+	{ 0x01d565, 1, "\x74" },
+	{ 0x01d566, 1, "\x75" },
+	{ 0x01d567, 1, "\x76" },
+	{ 0x01d568, 1, "\x77" },
+	{ 0x01d569, 1, "\x78" },
+	{ 0x01d56a, 1, "\x79" },
+	{ 0x01d56b, 1, "\x7a" },
+	{ 0x01d586, 1, "\x61" },
+	{ 0x01d587, 1, "\x62" },
+	{ 0x01d588, 1, "\x63" },
+	{ 0x01d589, 1, "\x64" },
+	{ 0x01d58a, 1, "\x65" },
+	{ 0x01d58b, 1, "\x66" },
+	{ 0x01d58c, 1, "\x67" },
+	{ 0x01d58d, 1, "\x68" },
+	{ 0x01d58e, 1, "\x69" },
+	{ 0x01d58f, 1, "\x6a" },
+	{ 0x01d590, 1, "\x6b" },
+	{ 0x01d591, 1, "\x6c" },
+	{ 0x01d592, 1, "\x6d" },
+	{ 0x01d593, 1, "\x6e" },
+	{ 0x01d594, 1, "\x6f" },
+	{ 0x01d595, 1, "\x70" },
+	{ 0x01d596, 1, "\x71" },
+	{ 0x01d597, 1, "\x72" },
+	{ 0x01d598, 1, "\x73" },
+	{ 0x01d599, 1, "\x74" },
+	{ 0x01d59a, 1, "\x75" },
+	{ 0x01d59b, 1, "\x76" },
+	{ 0x01d59c, 1, "\x77" },
+	{ 0x01d59d, 1, "\x78" },
+	{ 0x01d59e, 1, "\x79" },
+	{ 0x01d59f, 1, "\x7a" },
+	{ 0x01d5ba, 1, "\x61" },
+	{ 0x01d5bb, 1, "\x62" },
+	{ 0x01d5bc, 1, "\x63" },
+	{ 0x01d5bd, 1, "\x64" },
+	{ 0x01d5be, 1, "\x65" },
+	{ 0x01d5bf, 1, "\x66" },
+	{ 0x01d5c0, 1, "\x67" },
+	{ 0x01d5c1, 1, "\x68" },
+	{ 0x01d5c2, 1, "\x69" },
+	{ 0x01d5c3, 1, "\x6a" },
+	{ 0x01d5c4, 1, "\x6b" },
+	{ 0x01d5c5, 1, "\x6c" },
+	{ 0x01d5c6, 1, "\x6d" },
+	{ 0x01d5c7, 1, "\x6e" },
+	{ 0x01d5c8, 1, "\x6f" },
+	{ 0x01d5c9, 1, "\x70" },
+	{ 0x01d5ca, 1, "\x71" },
+	{ 0x01d5cb, 1, "\x72" },
+	{ 0x01d5cc, 1, "\x73" },
+	{ 0x01d5cd, 1, "\x74" },
+	{ 0x01d5ce, 1, "\x75" },
+	{ 0x01d5cf, 1, "\x76" },
+	{ 0x01d5d0, 1, "\x77" },
+	{ 0x01d5d1, 1, "\x78" },
+	{ 0x01d5d2, 1, "\x79" },
+	{ 0x01d5d3, 1, "\x7a" },
+	{ 0x01d5ee, 1, "\x61" },
+	{ 0x01d5ef, 1, "\x62" },
+	{ 0x01d5f0, 1, "\x63" },
+	{ 0x01d5f1, 1, "\x64" },
+	{ 0x01d5f2, 1, "\x65" },
+	{ 0x01d5f3, 1, "\x66" },
+	{ 0x01d5f4, 1, "\x67" },
+	{ 0x01d5f5, 1, "\x68" },
+	{ 0x01d5f6, 1, "\x69" },
+	{ 0x01d5f7, 1, "\x6a" },
+	{ 0x01d5f8, 1, "\x6b" },
+	{ 0x01d5f9, 1, "\x6c" },
+	{ 0x01d5fa, 1, "\x6d" },
+	{ 0x01d5fb, 1, "\x6e" },
+	{ 0x01d5fc, 1, "\x6f" },
+	{ 0x01d5fd, 1, "\x70" },
+	{ 0x01d5fe, 1, "\x71" },
+	{ 0x01d5ff, 1, "\x72" },
+	{ 0x01d600, 1, "\x73" },
+	{ 0x01d601, 1, "\x74" },
+	{ 0x01d602, 1, "\x75" },
+	{ 0x01d603, 1, "\x76" },
+	{ 0x01d604, 1, "\x77" },
+	{ 0x01d605, 1, "\x78" },
+	{ 0x01d606, 1, "\x79" },
+	{ 0x01d607, 1, "\x7a" },
+	{ 0x01d622, 1, "\x61" },
+	{ 0x01d623, 1, "\x62" },
+	{ 0x01d624, 1, "\x63" },
+	{ 0x01d625, 1, "\x64" },
+	{ 0x01d626, 1, "\x65" },
+	{ 0x01d627, 1, "\x66" },
+	{ 0x01d628, 1, "\x67" },
+	{ 0x01d629, 1, "\x68" },
+	{ 0x01d62a, 1, "\x69" },
+	{ 0x01d62b, 1, "\x6a" },
+	{ 0x01d62c, 1, "\x6b" },
+	{ 0x01d62d, 1, "\x6c" },
+	{ 0x01d62e, 1, "\x6d" },
+	{ 0x01d62f, 1, "\x6e" },
+	{ 0x01d630, 1, "\x6f" },
+	{ 0x01d631, 1, "\x70" },
+	{ 0x01d632, 1, "\x71" },
+	{ 0x01d633, 1, "\x72" },
+	{ 0x01d634, 1, "\x73" },
+	{ 0x01d635, 1, "\x74" },
+	{ 0x01d636, 1, "\x75" },
+	{ 0x01d637, 1, "\x76" },
+	{ 0x01d638, 1, "\x77" },
+	{ 0x01d639, 1, "\x78" },
+	{ 0x01d63a, 1, "\x79" },
+	{ 0x01d63b, 1, "\x7a" },
+	{ 0x01d656, 1, "\x61" },
+	{ 0x01d657, 1, "\x62" },
+	{ 0x01d658, 1, "\x63" },
+	{ 0x01d659, 1, "\x64" },
+	{ 0x01d65a, 1, "\x65" },
+	{ 0x01d65b, 1, "\x66" },
+	{ 0x01d65c, 1, "\x67" },
+	{ 0x01d65d, 1, "\x68" },
+	{ 0x01d65e, 1, "\x69" },
+	{ 0x01d65f, 1, "\x6a" },
+	{ 0x01d660, 1, "\x6b" },
+	{ 0x01d661, 1, "\x6c" },
+	{ 0x01d662, 1, "\x6d" },
+	{ 0x01d663, 1, "\x6e" },
+	{ 0x01d664, 1, "\x6f" },
+	{ 0x01d665, 1, "\x70" },
+	{ 0x01d666, 1, "\x71" },
+	{ 0x01d667, 1, "\x72" },
+	{ 0x01d668, 1, "\x73" },
+	{ 0x01d669, 1, "\x74" },
+	{ 0x01d66a, 1, "\x75" },
+	{ 0x01d66b, 1, "\x76" },
+	{ 0x01d66c, 1, "\x77" },
+	{ 0x01d66d, 1, "\x78" },
+	{ 0x01d66e, 1, "\x79" },
+	{ 0x01d66f, 1, "\x7a" },
+	{ 0x01d68a, 1, "\x61" },
+	{ 0x01d68b, 1, "\x62" },
+	{ 0x01d68c, 1, "\x63" },
+	{ 0x01d68d, 1, "\x64" },
+	{ 0x01d68e, 1, "\x65" },
+	{ 0x01d68f, 1, "\x66" },
+	{ 0x01d690, 1, "\x67" },
+	{ 0x01d691, 1, "\x68" },
+	{ 0x01d692, 1, "\x69" },
+	{ 0x01d693, 1, "\x6a" },
+	{ 0x01d694, 1, "\x6b" },
+	{ 0x01d695, 1, "\x6c" },
+	{ 0x01d696, 1, "\x6d" },
+	{ 0x01d697, 1, "\x6e" },
+	{ 0x01d698, 1, "\x6f" },
+	{ 0x01d699, 1, "\x70" },
+	{ 0x01d69a, 1, "\x71" },
+	{ 0x01d69b, 1, "\x72" },
+	{ 0x01d69c, 1, "\x73" },
+	{ 0x01d69d, 1, "\x74" },
+	{ 0x01d69e, 1, "\x75" },
+	{ 0x01d69f, 1, "\x76" },
+	{ 0x01d6a0, 1, "\x77" },
+	{ 0x01d6a1, 1, "\x78" },
+	{ 0x01d6a2, 1, "\x79" },
+	{ 0x01d6a3, 1, "\x7a" },
+};
+
+const size_t nfkd_table_size = sizeof(nfkd_table)/sizeof(*nfkd_table);
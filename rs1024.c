@@ -43,11 +43,12 @@ void rs1024_init_slip0039(rs1024_state_t *state) {
 	rs1024_add_array(state, cs, sizeof_array(cs));
 }
 
+static const uint32_t gen[] = {
+	0x00e0e040, 0x01c1c080, 0x03838100, 0x07070200, 0x0e0e0009,
+	0x1c0c2412, 0x38086c24, 0x3090fc48, 0x21b1f890, 0x03f3f120
+};
+
 void rs1024_add_value(rs1024_state_t *state, uint16_t value) {
-	uint32_t gen[] = {
-		0x00e0e040, 0x01c1c080, 0x03838100, 0x07070200, 0x0e0e0009,
-		0x1c0c2412, 0x38086c24, 0x3090fc48, 0x21b1f890, 0x03f3f120
-	};
 	uint32_t b = state->chk>>20;
 
 	check_rs1024(state);
@@ -88,9 +89,220 @@ bool rs1024_verify(const uint16_t *input, size_t no_input) {
         return ok.chk == s.chk;
 }
 
+/* add gen[i] for every bit i of b that is set to the bitsliced checksum
+ * c, c[j] ^= b[i] for every bit j that is set in gen[i] */
+static void rs1024_add_gen_bitsliced(uint64_t *c, const uint64_t *b) {
+	c[0] ^= b[4];
+	c[1] ^= b[5];
+	c[2] ^= b[6];
+	c[3] ^= b[4]^b[7];
+	c[4] ^= b[5]^b[8];
+	c[5] ^= b[6]^b[9];
+	c[6] ^= b[0]^b[7];
+	c[7] ^= b[1]^b[8];
+	c[8] ^= b[2]^b[9];
+	c[9] ^= b[3];
+	c[10] ^= b[5]^b[6]^b[7];
+	c[11] ^= b[6]^b[7]^b[8];
+	c[12] ^= b[7]^b[8]^b[9];
+	c[13] ^= b[0]^b[5]^b[6]^b[7]^b[8]^b[9];
+	c[14] ^= b[0]^b[1]^b[6]^b[7]^b[8]^b[9];
+	c[15] ^= b[0]^b[1]^b[2]^b[7]^b[8]^b[9];
+	c[16] ^= b[1]^b[2]^b[3]^b[8]^b[9];
+	c[17] ^= b[2]^b[3]^b[4]^b[9];
+	c[18] ^= b[3]^b[4]^b[5];
+	c[19] ^= b[4]^b[5]^b[6];
+	c[20] ^= b[7]^b[8]^b[9];
+	c[21] ^= b[0]^b[8]^b[9];
+	c[22] ^= b[0]^b[1]^b[9];
+	c[23] ^= b[0]^b[1]^b[2]^b[7]^b[8]^b[9];
+	c[24] ^= b[1]^b[2]^b[3]^b[8]^b[9];
+	c[25] ^= b[2]^b[3]^b[4]^b[9];
+	c[26] ^= b[3]^b[4]^b[5];
+	c[27] ^= b[4]^b[5]^b[6];
+	c[28] ^= b[5]^b[6]^b[7];
+	c[29] ^= b[6]^b[7]^b[8];
+}
+
+/* transpose the 8x8 bit matrix in x, byte i of the result contains
+ * bit i of every byte of x (bit j of byte i is bit i of byte j) */
+static uint64_t transpose8x8(uint64_t x) {
+	uint64_t t;
+
+	t = (x^(x>>7))&0x00aa00aa00aa00aaULL;
+	x ^= t^(t<<7);
+	t = (x^(x>>14))&0x0000cccc0000ccccULL;
+	x ^= t^(t<<14);
+	t = (x^(x>>28))&0x00000000f0f0f0f0ULL;
+	x ^= t^(t<<28);
+
+	return x;
+}
+
+/* the checksums of 64 mnemonics are computed at the same time, bit l of
+ * c[j] is bit j of the checksum of mnemonic l (bitslicing); all checksums
+ * start with the state after the customization string and the shorter
+ * mnemonics are padded with zeroes at the end, since adding k zeroes
+ * multiplies the checksum by x^k mod g(x), a padded mnemonic is valid if
+ * its checksum is x^k mod g(x) instead of 1 */
+static uint64_t rs1024_verify_lanes(const uint16_t *const *mnemonics,
+		const size_t *lengths, size_t no_lanes) {
+	uint64_t c[30], b[10], v[10], lo, hi, diff = 0, lane;
+	rs1024_state_t s;
+	size_t max_length = 0, min_length = SIZE_MAX;
+
+	assert(no_lanes > 0 && no_lanes <= RS1024_LANES);
+
+	for (size_t l = 0; l < no_lanes; l++) {
+		if (lengths[l] > max_length) max_length = lengths[l];
+		if (lengths[l] < min_length) min_length = lengths[l];
+	}
+
+	rs1024_init_slip0039(&s);
+	for (int j = 0; j < 30; j++) c[j] = -(uint64_t)((s.chk>>j)&1);
+
+	for (size_t t = 0; t < max_length; t++) {
+		memset(v, 0, sizeof(v));
+
+		// transpose the next value of every mnemonic, 8 lanes at a time
+		for (size_t g = 0; g < no_lanes; g += 8) {
+			lo = hi = 0;
+			for (size_t l = g; l < g + 8 && l < no_lanes; l++) {
+				// the length of a mnemonic is public
+				uint16_t value = t < lengths[l] ? mnemonics[l][t] : 0;
+				lo |= (uint64_t)(value&0xff)<<8*(l - g);
+				hi |= (uint64_t)(value>>8)<<8*(l - g);
+			}
+			lo = transpose8x8(lo);
+			hi = transpose8x8(hi);
+			for (int j = 0; j < 8; j++)
+				v[j] |= ((lo>>8*j)&0xff)<<g;
+			for (int j = 0; j < 2; j++)
+				v[8 + j] |= ((hi>>8*j)&0xff)<<g;
+		}
+
+		// c = ((c&0xfffff)<<10)^value, b = c>>20
+		memcpy(b, c + 20, sizeof(b));
+		memmove(c + 10, c, 20*sizeof(*c));
+		memcpy(c, v, sizeof(v));
+
+		rs1024_add_gen_bitsliced(c, b);
+	}
+
+	// compare with the expected checksum x^k mod g(x) of every lane,
+	// x[k] = x^k mod g(x) for the number of zeroes k added to a lane
+	uint32_t x[max_length - min_length + 1];
+	rs1024_init(&s);
+	for (size_t k = 0; k <= max_length - min_length; k++) {
+		x[k] = s.chk;
+		rs1024_add_value(&s, 0);
+	}
+
+	for (size_t l = 0; l < no_lanes; l++) {
+		uint32_t expected = x[max_length - lengths[l]];
+		lane = (uint64_t)1<<l;
+		for (int j = 0; j < 30; j++)
+			diff |= (c[j]^-(uint64_t)((expected>>j)&1))&lane;
+	}
+
+	wipememory(c, sizeof(c));
+	wipememory(b, sizeof(b));
+	wipememory(v, sizeof(v));
+
+	return ~diff;
+}
+
+void rs1024_verify_many(const uint16_t *const *mnemonics,
+		const size_t *lengths, size_t no_mnemonics, bool *valid) {
+	assert(mnemonics && lengths && valid);
+
+	for (size_t i = 0; i < no_mnemonics; i += RS1024_LANES) {
+		size_t no_lanes = no_mnemonics - i < RS1024_LANES ?
+			no_mnemonics - i : RS1024_LANES;
+		uint64_t ok = rs1024_verify_lanes(mnemonics + i,
+				lengths + i, no_lanes);
+
+		for (size_t l = 0; l < no_lanes; l++)
+			valid[i + l] = (ok>>l)&1;
+	}
+}
+
 void rs1024_add(uint16_t *input, size_t no_input) {
 	        rs1024_state_t s;
         rs1024_init_slip0039(&s);
         rs1024_add_array(&s, input, no_input);
         rs1024_checksum(&s, input + no_input);
 }
+
+// multiplication in GF(1024), defined by x^10 + x^3 + 1, the field
+// of the coefficients of the polynomials of the checksum
+static uint16_t gf1024_mul(uint16_t a, uint16_t b) {
+	uint16_t r = 0;
+
+	for (int i = 0; i < 10; i++) {
+		r ^= a&(-((b>>i)&1));
+		a <<= 1;
+		a ^= 0x409&(-(a>>10));
+	}
+
+	return r;
+}
+
+// a^-1 = a^1022, since a^1023 = 1 for every nonzero a
+static uint16_t gf1024_inv(uint16_t a) {
+	uint16_t r = 1;
+
+	assert(a);
+
+	for (int i = 9; i >= 0; i--) {
+		r = gf1024_mul(r, r);
+		if ((1022>>i)&1) r = gf1024_mul(r, a);
+	}
+
+	return r;
+}
+
+/* the syndrome of a word with a single error with value e, k positions
+ * from the end, is e*x^k mod g(x), so for every k we solve e from one
+ * nonzero coefficient of x^k mod g(x) and check the other two; since
+ * the minimum distance of the code is 4, at most one such error exists
+ * and two errors are never mistaken for one, but three errors can be
+ * (a word with three errors is within distance 1 of another codeword
+ * about once in 40000), so the result is only a suggestion; the position
+ * and the value are public (they are reported), so this is not constant
+ * time */
+bool rs1024_correct(const uint16_t *input, size_t no_input,
+		size_t *position, uint16_t *value) {
+	rs1024_state_t s, x = RS1024_INIT; // x.chk contains x^k mod g(x)
+	uint16_t syndrome[3], r[3], e;
+
+	rs1024_init_slip0039(&s);
+	rs1024_add_array(&s, input, no_input);
+	s.chk ^= 1;
+
+	if (!s.chk) return false; // checksum is ok
+
+	for (int i = 0; i < 3; i++) syndrome[i] = (s.chk>>10*i)&0x3ff;
+
+	for (size_t k = 0; k < no_input; k++, rs1024_add_value(&x, 0)) {
+		int i = 0, j;
+
+		for (j = 0; j < 3; j++) {
+			r[j] = (x.chk>>10*j)&0x3ff;
+			if (r[j]) i = j;
+		}
+
+		e = gf1024_mul(syndrome[i], gf1024_inv(r[i]));
+
+		for (j = 0; j < 3; j++)
+			if (gf1024_mul(e, r[j]) != syndrome[j]) break;
+
+		if (j == 3) {
+			*position = no_input - 1 - k;
+			*value = input[*position]^e;
+			return true;
+		}
+	}
+
+	return false; // more than one error
+}
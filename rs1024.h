@@ -51,6 +51,19 @@ void rs1024_checksum(rs1024_state_t*, uint16_t*);
 
 bool rs1024_verify(const uint16_t*, size_t);
 
+// number of mnemonics of which rs1024_verify_many() computes the checksums
+// at the same time, callers that buffer mnemonics use batches of this size
+#define RS1024_LANES 64
+
+// verify the checksums of many mnemonics at once, mnemonic i has
+// lengths[i] values, valid[i] is set to true if its checksum is ok
+void rs1024_verify_many(const uint16_t *const*, const size_t*, size_t, bool*);
+
+// if the checksum fails and a single wrong value explains it, return true
+// and report its position and value; with three or more wrong values
+// this can be a miscorrection
+bool rs1024_correct(const uint16_t*, size_t, size_t*, uint16_t*);
+
 void rs1024_add(uint16_t*, size_t);
 
 #endif /* SLIP0039_RS1024_H */
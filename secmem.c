@@ -0,0 +1,242 @@
+/* secmem.c - locked memory for sensitive data
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "secmem.h"
+#include "verbose.h"
+#include "utils.h"
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#define SECMEM_CHUNK (16*1024) // everything that is locked counts to ulimit -l
+#define SECMEM_ALIGN 64 // headers and blocks are aligned to cache lines
+
+// a chunk starts with this header, followed by blocks
+typedef struct secmem_chunk_s {
+	struct secmem_chunk_s *next;
+	size_t size;	// size of the chunk, including this header
+} secmem_chunk_t;
+
+// every block starts with this header (padded to SECMEM_ALIGN)
+typedef struct secmem_block_s {
+	size_t size;	// size of the block, including the header
+	int used;
+} secmem_block_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static secmem_chunk_t *chunks = NULL;
+static size_t locked = 0; // chunks and regions locked with secmem_lock()
+
+#define FIRST_BLOCK(c) ((secmem_block_t*)((char*)(c) + SECMEM_ALIGN))
+#define NEXT_BLOCK(b) ((secmem_block_t*)((char*)(b) + (b)->size))
+#define END_OF_CHUNK(c) ((secmem_block_t*)((char*)(c) + (c)->size))
+
+// map a chunk for at least need bytes of blocks, returns NULL on failure
+static secmem_chunk_t *secmem_new_chunk(size_t need, const char **what) {
+	size_t page = sysconf(_SC_PAGESIZE), size;
+	secmem_chunk_t *c;
+	char *base;
+
+	size = (need + SECMEM_ALIGN + page - 1)/page*page;
+	if (size < SECMEM_CHUNK) size = SECMEM_CHUNK;
+
+	// guard page, chunk, guard page
+	base = mmap(NULL, size + 2*page, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED) {
+		*what = "mapping";
+		return NULL;
+	}
+	c = (secmem_chunk_t*)(base + page);
+
+	if (mprotect(base, page, PROT_NONE) < 0 ||
+			mprotect(base + page + size, page, PROT_NONE) < 0) {
+		*what = "protecting guard pages of";
+		goto fail;
+	}
+
+	if (mlock(c, size) < 0) {
+		*what = "locking";
+		goto fail;
+	}
+
+	// not fatal, older kernels don't have these
+#ifdef MADV_DONTDUMP
+	madvise(c, size, MADV_DONTDUMP);
+#endif
+#ifdef MADV_WIPEONFORK
+	madvise(c, size, MADV_WIPEONFORK);
+#endif
+
+	locked += size;
+	c->size = size;
+	FIRST_BLOCK(c)->size = size - SECMEM_ALIGN;
+	FIRST_BLOCK(c)->used = 0;
+	c->next = chunks;
+	chunks = c;
+
+	return c;
+fail:
+	munmap(base, size + 2*page);
+	return NULL;
+}
+
+/* returns NULL with errno set on failure, *what describes the step that
+ * failed */
+static void *secmem_alloc_what(size_t size, const char **what) {
+	size_t need = (size + 2*SECMEM_ALIGN - 1)/SECMEM_ALIGN*SECMEM_ALIGN;
+	secmem_block_t *b, *n;
+	secmem_chunk_t *c;
+	int err;
+
+	pthread_mutex_lock(&lock);
+
+	// first fit, merge free blocks while searching
+	for (c = chunks; c; c = c->next)
+		for (b = FIRST_BLOCK(c); b < END_OF_CHUNK(c); b = NEXT_BLOCK(b)) {
+			if (b->used) continue;
+			while ((n = NEXT_BLOCK(b)) < END_OF_CHUNK(c) &&
+					!n->used) {
+				b->size += n->size;
+				wipememory(n, sizeof(*n));
+			}
+			if (b->size >= need) goto found;
+		}
+
+	if (!(c = secmem_new_chunk(need, what))) {
+		err = errno;
+		pthread_mutex_unlock(&lock);
+		errno = err;
+		return NULL;
+	}
+	b = FIRST_BLOCK(c);
+
+found:
+	// split if the remainder is large enough to be useful
+	if (b->size - need >= 2*SECMEM_ALIGN) {
+		n = (secmem_block_t*)((char*)b + need);
+		n->size = b->size - need;
+		n->used = 0;
+		b->size = need;
+	}
+	b->used = 1;
+
+	pthread_mutex_unlock(&lock);
+
+	return (char*)b + SECMEM_ALIGN;
+}
+
+void *secmem_try_alloc(size_t size) {
+	const char *what;
+
+	return secmem_alloc_what(size, &what);
+}
+
+void *secmem_alloc(size_t size) {
+	const char *what = NULL;
+	void *p;
+
+	if (!(p = secmem_alloc_what(size, &what)))
+		FATAL("failed %s %zu bytes of secure memory, %zu bytes "
+				"locked already (see ulimit -l): %s", what,
+				size, secmem_locked(), strerror(errno));
+
+	return p;
+}
+
+void secmem_free(void *p) {
+	secmem_block_t *b;
+
+	if (!p) return;
+	b = (secmem_block_t*)((char*)p - SECMEM_ALIGN);
+
+	pthread_mutex_lock(&lock);
+	assert(b->used);
+	wipememory(p, b->size - SECMEM_ALIGN);
+	b->used = 0;
+	pthread_mutex_unlock(&lock);
+}
+
+// the size of the pages that contain p..p+len, mlock locks whole pages
+static size_t secmem_pages(const void *p, size_t len) {
+	uintptr_t page = sysconf(_SC_PAGESIZE), start = (uintptr_t)p;
+
+	return (start + len + page - 1)/page*page - start/page*page;
+}
+
+void secmem_lock(const void *p, size_t len, const char *desc) {
+	if (mlock(p, len) < 0)
+		FATAL("failed locking %s(%zu) in RAM, %zu bytes locked "
+				"already (see ulimit -l): %s", desc, len,
+				secmem_locked(), strerror(errno));
+
+	pthread_mutex_lock(&lock);
+	locked += secmem_pages(p, len);
+	pthread_mutex_unlock(&lock);
+}
+
+void secmem_unlock(const void *p, size_t len, const char *desc) {
+	if (munlock(p, len) < 0) {
+		WARNING("failed unlocking %s(%zu) in RAM: %s", desc, len,
+				strerror(errno));
+		return;
+	}
+
+	pthread_mutex_lock(&lock);
+	locked -= secmem_pages(p, len);
+	pthread_mutex_unlock(&lock);
+}
+
+/* the lock is not taken, since this is called at exit, possibly while
+ * other threads are still running (or hold the lock) */
+void secmem_wipe() {
+	for (secmem_chunk_t *c = chunks; c; c = c->next)
+		wipememory((char*)c + SECMEM_ALIGN, c->size - SECMEM_ALIGN);
+}
+
+size_t secmem_size() {
+	size_t size = 0;
+
+	pthread_mutex_lock(&lock);
+	for (secmem_chunk_t *c = chunks; c; c = c->next) size += c->size;
+	pthread_mutex_unlock(&lock);
+
+	return size;
+}
+
+size_t secmem_locked() {
+	size_t ret;
+
+	pthread_mutex_lock(&lock);
+	ret = locked;
+	pthread_mutex_unlock(&lock);
+
+	return ret;
+}
@@ -0,0 +1,51 @@
+/* secmem.h - locked memory for sensitive data
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SLIP0039_SECMEM_H
+#define SLIP0039_SECMEM_H
+#include <stddef.h>
+
+/* sensitive data is allocated from an arena of locked memory, instead of
+ * locking the whole process; the arena consists of chunks that are mmap'd
+ * with guard pages, locked, excluded from core dumps and wiped on fork */
+
+// returns zeroed memory, exits if the memory can't be locked
+void *secmem_alloc(size_t);
+
+// returns zeroed memory or NULL with errno set, for the library
+void *secmem_try_alloc(size_t);
+
+// wipes the memory
+void secmem_free(void*);
+
+// lock memory that can't be allocated in the arena (stacks, thread locals)
+void secmem_lock(const void*, size_t, const char*);
+
+void secmem_unlock(const void*, size_t, const char*);
+
+// wipe the whole arena, called at exit
+void secmem_wipe();
+
+// number of bytes in the arena
+size_t secmem_size();
+
+// number of bytes locked, the arena and the regions of secmem_lock()
+size_t secmem_locked();
+
+#endif /* SLIP0039_SECMEM_H */
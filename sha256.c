@@ -34,6 +34,7 @@
 #include "sha256.h"
 #include "endian.h"
 #include "utils.h"
+#include "stats.h"
 
 static void invalidate_sha256(struct sha256_ctx *ctx) {
 	wipememory(ctx, sizeof(*ctx));
@@ -78,6 +79,8 @@ static void Transform(uint32_t *s, const uint32_t *chunk) {
 		g = s[6], h = s[7], w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10,
 		w11, w12, w13, w14, w15;
 
+	STATS_COUNT(STATS_SHA256);
+
 	Round(a, b, c, &d, e, f, g, &h, 0x428a2f98, w0 = be32_to_cpu(chunk[0]));
 	Round(h, a, b, &c, d, e, f, &g, 0x71374491, w1 = be32_to_cpu(chunk[1]));
 	Round(g, h, a, &b, c, d, e, &f, 0xb5c0fbcf, w2 = be32_to_cpu(chunk[2]));
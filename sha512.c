@@ -9,6 +9,7 @@
 #include "sha512.h"
 #include "endian.h"
 #include "utils.h"
+#include "stats.h"
 
 static void invalidate_sha512(struct sha512_ctx *ctx) {
         wipememory(ctx, sizeof(*ctx));
@@ -58,6 +59,8 @@ static void Transform(uint64_t* s, const uint64_t *chunk) {
 	uint64_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
 	uint64_t w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
 
+	STATS_COUNT(STATS_SHA512);
+
 	Round(a, b, c, &d, e, f, g, &h, 0x428a2f98d728ae22ull, w0 = be64_to_cpu(chunk[0]));
 	Round(h, a, b, &c, d, e, f, &g, 0x7137449123ef65cdull, w1 = be64_to_cpu(chunk[1]));
 	Round(g, h, a, &b, c, d, e, &f, 0xb5c0fbcfec4d3b2full, w2 = be64_to_cpu(chunk[2]));
@@ -26,51 +26,138 @@
 #include <errno.h>
 #include <string.h>
 #include <sys/mman.h>
-
-#include "slip0039.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#include "libslip0039.h"
 #include "verbose.h"
-#include "codec.h"
 #include "utils.h"
-#include "rs1024.h"
-#include "digest.h"
-#include "lagrange.h"
-#include "lrcipher.h"
-#include "wordlists.h"
-#include "fixnum.h"
-#include "base.h"
-#include "shashtbl.h"
+#include "llist.h"
+#include "secmem.h"
+#include "hash.h"
+#include "sha256.h"
+#include "stats.h"
+#include "pbkdf2.h"
+#include "input.h"
 
 slip0039_mode_t mode = SLIP0039_MODE_NULL;
-slip0039_t s;                 // the main struct with all the info
-slip0039_mnemonic_t mnemonic; // buffer to contain one mnemonic
-pbkdf2_t prng;                // PRNG for shares and part of digests
-char input_base16[LINE]; // space for (BLOCKS<<2) nibbles, \n newline and \0
-//char input_base16[(BLOCKS<<2)+1+1]; // space for (BLOCKS<<2) nibbles, \n newline and \0
-uint16_t input[BLOCKS<<3];    // space for input
-base_scratch_t bs;	      // scratch space for base encoding
-uint8_t base_scratch_space[(BLOCKS<<1)<<2]; // actual scratch space
-uint8_t slip0039_header[5];
-
-// seed for PRNG
-char seed[512];
-size_t seed_len = 0;
-
-#define STACK_CLEAR_SIZE 256 * 1024
-#if defined(__APPLE__) && defined(__MACH__)
-const void *stackbase = NULL;
-#endif
-
-// call exit on receiving fatal signals
+slip0039_spec_t spec;                // how to split, from the commandline
+const char *codec_spec = NULL;       // CODEC[:WORDLIST] from the commandline
+size_t max_secret = BLOCKS<<1;       // -m, maximum size of a secret
+unsigned long int batch_threads = 0; // split --batch, number of workers
+int recover_all = 0;                 // recover --all
+llist_info_t multi_info;             // recover --all, the sets of mnemonics
+llist_t multi_sets;
+const char *daemon_path = NULL;       // daemon, path of the socket
+unsigned long int daemon_threads = 0; // daemon, number of workers
+const char *search_prefix = NULL;     // search, expected start of plaintext
+const char *search_sha256 = NULL;     // search, expected hash of plaintext
+unsigned long int search_shard = 1;   // search --shard I/N
+unsigned long int search_shards = 1;
+const char *search_checkpoint = NULL; // search, file to save progress in
+unsigned long int search_threads = 0; // search, number of workers
+double calibrate_budget = 0;          // calibrate --budget, in ns
+input_t stdin_input;                  // stdin, read into locked memory
+
+#define IOBUF_SIZE 4096 // buffers of stdin, stdout and stderr
+
+/* the session and the buffers that contain data of a single secret are
+ * allocated in locked memory for every thread, so that the workers of
+ * split --batch, recover --all, search and daemon each have their own;
+ * the line (seed or plaintext read from input) is allocated with the
+ * buffers of the context, which are sized by -m, the output (the
+ * mnemonics of all shares) when it is written, the read buffer of a
+ * daemon connection by the daemon */
+typedef struct session_s {
+	slip0039_ctx_t ctx;
+} session_t;
+
+_Thread_local session_t *session = NULL;
+_Thread_local slip0039_ctx_t *ctx = NULL;
+_Thread_local char *line, *output, *iobuf;
+_Thread_local size_t output_size = 0, line_size = 0;
+
+/* the part of the stack of every thread that is wiped and locked, it
+ * counts to ulimit -l; the frames that hold secrets (split, recover and
+ * the codecs, the search workers) use less than 6KB, deeper frames
+ * (writing a search checkpoint) do not */
+#define STACK_CLEAR_SIZE 8 * 1024
+_Thread_local const char *stackbase = NULL;
+
+// call exit on receiving fatal signals, even if a trap is set
 void sig_handler(int signum) {
-	FATAL("%s", strsignal(signum));
+	ABORT("fatal:%s", strsignal(signum));
 }
 
-int slip0039_quorum(slip0039_set_t *s) {
-	assert(s);
-	return (s->available >= s->threshold && s->threshold != 0)?1:0;
+/* allocate the session of the calling thread and lock the part of its
+ * stack that is wiped at the end, and its thread local data in utils.c */
+static void lock_thread() {
+	char top;
+
+	// make sure the stack is mapped before locking it
+	wipestackmemory(STACK_CLEAR_SIZE);
+	stackbase = &top - STACK_CLEAR_SIZE;
+	secmem_lock(stackbase, STACK_CLEAR_SIZE, "stack");
+	secmem_lock(dl, sizeof(dl), "dl");
+
+	session = secmem_alloc(sizeof(*session));
+	ctx = &session->ctx;
+}
+
+/* point out to the output buffer of the calling thread, it is grown to
+ * fit the mnemonics of all shares in ctx, or a line if there are none */
+static void get_output(sbuf_t *out) {
+	size_t size = ctx->line_size + 1; // a plaintext and \n
+
+	for (int i = 0; i < MAX_SHARES; i++)
+		for (int j = 0; j < MAX_SHARES; j++)
+			if (ctx->s.members[i].shares[j])
+				size += ctx->line_size + 1;
+
+	if (size > output_size) {
+		secmem_free(output);
+		output = secmem_alloc(size);
+		output_size = size;
+	}
+
+	out->buf = output;
+	out->size = output_size;
+	out->len = 0;
+}
+
+// wipe and unlock the data of the calling thread
+static void wipe_thread() {
+	if (!session) return;
+
+#ifdef STATS
+	stats_merge();
+#endif
+
+	secmem_free(output);
+	output_size = 0;
+	secmem_free(line);
+	line_size = 0;
+	secmem_free(iobuf);
+	slip0039_ctx_wipe(ctx);
+	secmem_free(session);
+	session = NULL;
+	ctx = NULL;
+	line = output = iobuf = NULL;
+	wipememory(dl, sizeof(dl));
+	secmem_unlock(dl, sizeof(dl), "dl");
+
+	wipestackmemory(STACK_CLEAR_SIZE);
+	secmem_unlock(stackbase, STACK_CLEAR_SIZE, "stack");
 }
 
-void slip0039_debug_share(const char *path, int index, int space,
+static void slip0039_debug_share(const char *path, int index, int space,
 		const uint8_t *buf, size_t n, const char *title) {
 	char character;
         sbuf_t sbuf = { .buf = dl, .size = sizeof(dl) };
@@ -93,7 +180,18 @@ void slip0039_debug_share(const char *path, int index, int space,
 	DEBUG("%s", dl);
 }
 
-void slip0039_debug_set(slip0039_set_t *m, slip0039_t *s,
+// format a word of the header, as in " (word)"
+static void slip0039_debug_name(char *buf, size_t size, const char *prefix,
+		uint16_t word) {
+	sbuf_t sb = { .buf = buf, .size = size, .len = 0 };
+
+	memset(buf, 0, size);
+	sbufprintf(&sb, "%s(", prefix);
+	sbufwordlist_dereference(&wordlist_slip0039, &sb, word);
+	sbufprintf(&sb, ")");
+}
+
+static void slip0039_debug_set(slip0039_set_t *m, slip0039_t *s,
 		const char *path, const char *title) {
 	assert(m);
 	if (m->threshold) {
@@ -107,15 +205,22 @@ void slip0039_debug_set(slip0039_set_t *m, slip0039_t *s,
 
 		for (int i = 0; i < ((m->count != 0)?m->count:MAX_SHARES);
 				i++) {
+			char name[23] = "";
 			if (m->children[i]) {
 				char newpath[16];
 				snprintf_strict(newpath, sizeof(newpath),
 					       	"%s%1x/", path, i);
+				if (m->children[i]->threshold)
+					slip0039_debug_name(name, sizeof(name),
+							" ", m->names[i]);
 				slip0039_debug_set(m->children[i], s,
-						newpath, m->names[i]);
-			} else if (m->shares[i])
+						newpath, name);
+			} else if (m->shares[i]) {
+				slip0039_debug_name(name, sizeof(name),
+						"  ", m->names[i]);
 				slip0039_debug_share(path, i, 0, m->shares[i],
-					       	s->n, m->names[i]);
+					       	s->n, name);
+			}
 		}
 	}
 
@@ -125,7 +230,8 @@ void slip0039_debug_set(slip0039_set_t *m, slip0039_t *s,
 					m->shares[i], s->n, "");
 }
 
-void slip0039_debug(slip0039_t *s) {
+static void slip0039_debug(slip0039_t *s) {
+	if (!debug) return;
 	assert(s);
 	DEBUG("---START---internal slip0039 data----");
 	if (s->n) DEBUG("size of master secret=%ld bytes", s->n);
@@ -134,700 +240,1286 @@ void slip0039_debug(slip0039_t *s) {
 		DEBUG("Iteration exponent=%d (%ld iterations per round)",
 				s->e, 2500L<<s->e);
 
-	slip0039_debug_set(&s->root, s, "/", s->title);
+	slip0039_debug_set(&s->root, s, "/", slip0039_title(s));
 	if (s->plaintext)
 		slip0039_debug_share("/", -3, 2, s->plaintext, s->n, "");
 	DEBUG("---END-----internal slip0039 data----");
 }
 
-#if defined(__APPLE__) && defined(__MACH__)
-static void _mlock(const void *const p, const char* const var, const size_t len) {
-	if (p && len && mlock(p, len) < 0) {
-		FATAL("failed locking %s(%u) in RAM: %s", var, (unsigned int)len, strerror(errno));
-	}
-}
-static void _munlock(const void *const p, const char* const var, const size_t len) {
-	if (p && len && munlock(p, len) < 0) {
-		WARNING("failed unlocking %s(%u) in RAM: %s", var, (unsigned int)len, strerror(errno));
-	}
-}
-#define mlock_obj(p) do { \
-	void *_p = &p; \
-	_mlock(_p, #p, sizeof(p)); \
-} while (0)
-#define munlock_obj(p) do { \
-	void *_p = &p; \
-	_munlock(_p, #p, sizeof(p)); \
-} while (0)
-#define mlock_ptr(p, len) do { \
-	void *_p = &p; \
-	_mlock(_p, "&" #p, sizeof(p)); \
-	_mlock((p), #p, (len)); \
-} while (0)
-#define munlock_ptr(p, len) do { \
-	void *_p = &p; \
-	_mlock(p, #p, (len)); \
-	wipememory(_p, sizeof(p)); \
-	_mlock(_p, "&" #p, sizeof(p)); \
-} while (0)
-#endif
-
 // function that gets called atexit(), so that
 // sensitive contents are removed from memory
 void wipe() {
-	slip0039_debug(&s);
-	wipememory(&s, sizeof(s));
-	wipememory(mnemonic, sizeof(mnemonic));
-	wipememory(dl, sizeof(dl));
-	wipememory(seed, seed_len);
-	wipememory(input_base16, sizeof(input_base16));
-	wipememory(input, sizeof(input));
-	wipememory(&bs, sizeof(bs));
-	wipememory(&slip0039_header, sizeof(slip0039_header));
-	wipememory(base_scratch_space, sizeof(base_scratch_space));
-	pbkdf2_finished(&prng);
-
-#if defined(__APPLE__) && defined(__MACH__)
-	munlock_ptr(stackbase, STACK_CLEAR_SIZE);
-	munlock_obj(s);
-	munlock_obj(mnemonic);
-	munlock_obj(dl);
-	munlock_ptr(seed, seed_len);
-	wipememory(&seed_len, sizeof(seed_len));
-	munlock_obj(seed_len);
-	munlock_obj(prng);
-	munlock_obj(input_base16);
-	munlock_obj(input);
-	munlock_obj(bs);
-	munlock_obj(slip039_header);
-	munlock_obj(base_scratch_space);
-#else
-	wipememory(&seed, sizeof(seed));
-	wipememory(&seed_len, sizeof(seed_len));
-	if (munlockall() < 0)
-                WARNING("failed unlocking process in from RAM: %s",
-                                strerror(errno));
+	// the buffers of stdout and stderr are wiped as well
+	fflush(stdout);
+	fflush(stderr);
+
+	if (ctx) slip0039_debug(&ctx->s);
+	if (multi_sets.info) llist_empty(&multi_sets);
+	DEBUG("%zu bytes of secure memory in use, %zu bytes locked in RAM",
+			secmem_size(), secmem_locked());
+#ifdef STATS
+	stats_report();
 #endif
+	wipe_thread();
+	secmem_wipe();
 }
 
-void slip0039_init(slip0039_t *s) {
-	memset(s, 0, sizeof(*s));
-	s->id = -1;
-	s->e = -1;
-	for (int i = 0; i < MAX_SHARES; i++) {
-		s->root.line_numbers[i] = -1;
-		s->members[i].parent = &s->root;
-		s->root.children[i] = &s->members[i];
-	}
-}
+void boring_stuff() {
+	/* lock the sensitive data into memory; don't leak info to swap,
+	 * the buffers of stdin and stdout contain secrets as well; stderr
+	 * gets a buffer too, because an unbuffered stream makes printf use
+	 * a buffer of 8KB on the stack */
+	lock_thread();
+	input_init(&stdin_input, STDIN_FILENO, secmem_alloc(IOBUF_SIZE),
+			IOBUF_SIZE);
+	setvbuf(stdout, secmem_alloc(IOBUF_SIZE),
+			isatty(STDOUT_FILENO) ? _IOLBF : _IOFBF, IOBUF_SIZE);
+	setvbuf(stderr, secmem_alloc(IOBUF_SIZE), _IOLBF, IOBUF_SIZE);
 
-void slip0039_set_increment_available(slip0039_set_t *m) {
-	assert(m);
-	m->available++;
-
-	// if this addition made this group make the threshold,
-	// then the number of available groups must be incremented
-	if (m->available == m->threshold && m->parent)
-		slip0039_set_increment_available(m->parent);
-}
-
-void slip0039_write_title(slip0039_t *s, uint16_t *title) {
-	sbuf_t sb;
-	sb.buf = s->title;
-	sb.size = sizeof(s->title);
-	sb.len = 0;
-	sbufprintf(&sb, " (");
-	sbufwordlist_dereference(&wordlist_slip0039, &sb, title[0]);
-	sbufprintf(&sb, " ");
-	sbufwordlist_dereference(&wordlist_slip0039, &sb, title[1]);
-	sbufprintf(&sb, ")");
-}
+	if (atexit(wipe))
+		FATAL("error setting atexit() handler");
 
-void slip0039_write_group_title(slip0039_t *s, uint8_t i, uint16_t group) {
-	sbuf_t sb;
-	sb.buf = s->root.names[i];
-	sb.size = sizeof(*s->root.names);
-	sb.len = 0;
-	sbufprintf(&sb, " (");
-	sbufwordlist_dereference(&wordlist_slip0039, &sb, group);
-	sbufprintf(&sb, ")");
+	/* make the program cleanup our data
+	 * on receiving common signals */
+	signal(SIGINT, sig_handler);
+	signal(SIGTERM, sig_handler);
+	signal(SIGHUP, sig_handler);
+	signal(SIGQUIT, sig_handler);
+	signal(SIGABRT, sig_handler);
+	signal(SIGALRM, sig_handler);
+	signal(SIGPIPE, sig_handler);
+	signal(SIGUSR1, sig_handler);
+	signal(SIGUSR2, sig_handler);
 }
 
-void slip0039_write_member_title(slip0039_t *s, uint8_t i, uint8_t j, uint16_t member) {
-	sbuf_t sb;
-	sb.buf = s->members[i].names[j];
-	sb.size = sizeof(*s->members[i].names);
-	sb.len = 0;
-	sbufprintf(&sb, "  (");
-	sbufwordlist_dereference(&wordlist_slip0039, &sb, member);
-	sbufprintf(&sb, ")");
+// errors of the library are fatal for the commandline tool
+static void check(slip0039_error_t err) {
+	if (err) FATAL("%s", slip0039_ctx_error(ctx));
 }
 
-void slip0039_print_mnemonics(slip0039_t *s) {
-	// these conditions are (?) enfored elsewhere
-	assert(s->n >= 16 && s->n%2 == 0 && s->n <= BLOCKS<<1);
-	fixnum_t h;
+/* start a session with the codec and the maximum size of the secret
+ * given on the commandline, the previous session is wiped */
+static void session_init() {
+	slip0039_ctx_wipe(ctx);
+	check(slip0039_ctx_init(ctx));
+	check(slip0039_ctx_max_secret(ctx, max_secret));
+	if (codec_spec) check(slip0039_ctx_codec(ctx, codec_spec));
+
+	if (ctx->line_size > line_size) {
+		secmem_free(line);
+		line = secmem_alloc(ctx->line_size);
+		line_size = ctx->line_size;
+	}
+}
 
-	fixnum_init(&h, slip0039_header, 5);
+// the passphrase is added in one go, straight from the input buffer
+void read_passphrase(input_t *in) {
+	size_t len;
+	char *passphrase;
+	STATS_START(start);
 
-	fixnum_poke(&h, 25, 15, s->id);
-	fixnum_poke(&h, 20, 5, s->e);
+	passphrase = input_line(in, in->size, &len, "passphrase", 0);
+	check(slip0039_add_passphrase(ctx, passphrase, len));
+	wipememory(passphrase, len);
+	STATS_STOP(start, STATS_PASSPHRASE);
+}
 
-	for (uint8_t i = 0; i < s->root.count; i++) {
-		fixnum_poke(&h, 16, 4, i);
-		fixnum_poke(&h, 12, 4, s->root.threshold - 1);
-		fixnum_poke(&h, 8, 4, s->root.count - 1);
+// the library accepts any seed that fits
+static void check_seed(size_t len) {
+	if (len < 64) WARNING("specified value for SEED is very short, "
+			"consider using a longer value of at least 64 "
+			"alphanumeric bytes");
+}
 
-		for (uint8_t j = 0; j < s->members[i].count; j++) {
-			fixnum_poke(&h, 4, 4, j);
-			fixnum_poke(&h, 0, 4, s->members[i].threshold - 1);
+void read_seed(input_t *in) {
+	size_t len;
+	char *seed = input_line(in, sizeof(ctx->seed), &len, "seed", 0);
 
-			base_encode_buffer(input, 4, &wordlist_slip0039.m, slip0039_header, 5, &bs, 0);
+	check_seed(len);
+	check(slip0039_split_seed(ctx, seed, len));
+	wipememory(seed, len);
+}
 
-			if (j == 0) {
-				if (i == 0) slip0039_write_title(s, input);
-				slip0039_write_group_title(s, i, input[2]);
-			}
-			slip0039_write_member_title(s, i, j, input[3]);
+// the plaintext is copied to line, because the input buffer is shared
+void read_plaintext(input_t *in) {
+	size_t len;
+	char *plaintext = input_line(in, line_size, &len, "plaintext", 0);
 
-			base_encode_buffer(&input[4], (8*s->n + 9)/10,
-					&wordlist_slip0039.m,
-					s->members[i].shares[j],
-					s->n, &bs, 0);
+	memcpy(line, plaintext, len + 1);
+	wipememory(plaintext, len);
+}
 
-			rs1024_add(input, 4 + (8*s->n + 9)/10);
+// split the plaintext in line and write the mnemonics to out
+void make_mnemonics(sbuf_t *out) {
+	check(slip0039_split_plaintext(ctx, line));
+	wipememory(line, line_size);
+	get_output(out);
+	check(slip0039_split_mnemonics(ctx, out));
+}
 
-			wipememory(mnemonic, sizeof(mnemonic));
+unsigned long int parse_number(const char *arg, const char *name,
+		unsigned long int min, unsigned long int max,
+		char **end, int empty) {
+	unsigned long int ret = strtoul(arg, end, 0);
 
-			sbuf_t sb = {
-				.buf = mnemonic,
-				.size = sizeof(slip0039_mnemonic_t),
-				.len = 0
-			};
+	if (*end == arg) FATAL("expected %s, found \"%s\" instead", name, arg);
+	if (ret > max) FATAL("%s must be <= %lu", name, max);
+	if (ret < min) FATAL("%s must be >= %lu", name, min);
+	if (empty && **end != '\0') FATAL("junk found while parsing %s", name);
 
-			int k = 0;
-			goto start;
-			while (++k < 4 + (8*s->n + 9)/10 + 3) {
-				sbufprintf(&sb, " ");
-start:
-				sbufwordlist_dereference(&wordlist_slip0039, &sb, input[k]);
-			}
-			printf("%s\n", mnemonic);
+	return ret;
+}
 
-		}
+// a positive duration with an optional unit, returns nanoseconds
+double parse_duration(const char *arg, const char *name) {
+	static const struct {
+		const char *unit;
+		double ns;
+	} units[] = {
+		{ "", 1e9 }, { "ms", 1e6 }, { "s", 1e9 },
+		{ "min", 60e9 }, { "h", 3600e9 }
+	};
+	char *end;
+	double ret = strtod(arg, &end);
+
+	if (end == arg) FATAL("expected %s, found \"%s\" instead", name, arg);
+	if (!(ret > 0)) FATAL("%s must be > 0", name);
+	for (int i = 0; i < sizeof(units)/sizeof(*units); i++) {
+		if (strcmp(end, units[i].unit)) continue;
+		// strtod accepts inf, and a large number overflows to inf
+		if (!isfinite(ret *= units[i].ns))
+			FATAL("%s must be finite", name);
+		return ret;
 	}
+
+	FATAL("unit of %s must be ms, s, min or h", name);
 }
 
-void slip0039_print_plaintext(slip0039_t *s, codec_t *c) {
-	(*c->decode)(dl, sizeof(dl), &s->l, input, sizeof(input)/sizeof(*input),
-			s->plaintext, s->n, wordlist, &bs);
+void parse_options_split(slip0039_spec_t *spec, char *arg,
+		slip0039_parse_state_t *state, int *max_T) {
+	char *end;
 
-	printf("%s\n", dl);
+	if (*state == SLIP0039_PARSE_STATE_EXP && !strcmp(arg, "--batch")) {
+		*state = SLIP0039_PARSE_STATE_BATCH;
+	} else if (*state == SLIP0039_PARSE_STATE_BATCH) {
+		batch_threads = parse_number(arg, "number of threads",
+				1, 256, &end, 1);
+		*state = SLIP0039_PARSE_STATE_DONE;
+	} else if (*state == SLIP0039_PARSE_STATE_DONE) {
+		FATAL("no arguments must be given after "
+				"\"--batch THREADS\"");
+	} else if (*state == SLIP0039_PARSE_STATE_EXP) {
+		spec->e = parse_number(arg, "iteration exponent", 0, 31, &end, 1);
+		*state = SLIP0039_PARSE_STATE_GT;
+	} else if (*state == SLIP0039_PARSE_STATE_GT) {
+		spec->GT = parse_number(arg, "group threshold", 1,
+				MAX_SHARES, &end, 1);
+		*state = SLIP0039_PARSE_STATE_XOFY;
+	} else if (*state == SLIP0039_PARSE_STATE_XOFY) {
+		if (spec->G == MAX_SHARES)
+			FATAL("at most %d groups supported", MAX_SHARES);
+		unsigned long int x = parse_number(arg, "X in group spec XofY",
+				1, MAX_SHARES, &end, 0);
+		arg = end;
+		if (arg[0] != 'o' || arg[1] != 'f')
+			FATAL("X and Y must be separated by 'of', as in 4of6");
+		arg += 2;
+		unsigned long int y = parse_number(arg, "Y in group spec XofY",
+				x, MAX_SHARES, &end, 1);
+		if (x == 1 && y > 1)
+			WARNING("X == 1, according to the spec, "
+					"Y SHOULD also be 1");
+		if (x > *max_T) *max_T = x;
+		spec->groups[spec->G].count = y;
+		spec->groups[spec->G].threshold = x;
+		spec->G++;
+	} else assert(0);
 }
 
-void slip0039_add_mnemonic(slip0039_t *s, const char *line, int line_number) {
-	size_t no_input = 0;
-	fixnum_t h;
+/* check if we have all the neccesary information to create the shares */
+void parse_options_split_check(slip0039_spec_t *spec,
+		slip0039_parse_state_t state, int max_T) {
+	if (state == SLIP0039_PARSE_STATE_SEED)
+		FATAL("SEED needs to be specified as next argument");
+	else if (state == SLIP0039_PARSE_STATE_EXP)
+		FATAL("iteration exponent needs to be specified "
+				"as next argument");
+	else if (state == SLIP0039_PARSE_STATE_GT)
+		FATAL("GT (group threshold) needs to be specified "
+				"as next argument");
+	else if (state == SLIP0039_PARSE_STATE_XOFY &&
+			spec->G < spec->GT)
+		FATAL("not enough groups specified to satisfy "
+				"group threshold");
+	else {
+		assert(max_T > 0);
+		if (max_T == 1 && spec->G > 1)
+			WARNING("a simple split in %d different "
+					"shares, SHOULD be made "
+					"using a single group "
+					"according to the spec",
+					spec->G);
+	}
+}
 
-	assert(sizeof(input)/sizeof(*input) >= WORDS);
+/* parse a group spec (EXP GT XofY..) that is given on a line of input */
+void parse_spec(slip0039_spec_t *spec, char *arg, const char *desc) {
+	slip0039_parse_state_t state = SLIP0039_PARSE_STATE_EXP;
+	int max_T = 0;
+	char *saveptr;
+
+	memset(spec, 0, sizeof(*spec));
+	for (arg = strtok_r(arg, " ", &saveptr); arg;
+			arg = strtok_r(NULL, " ", &saveptr)) {
+		parse_options_split(spec, arg, &state, &max_T);
+		if (state == SLIP0039_PARSE_STATE_BATCH)
+			FATAL("--batch not allowed in group spec of %s", desc);
+	}
+	parse_options_split_check(spec, state, max_T);
+}
 
-	while (*line) {
-		if (no_input == WORDS) FATAL("too many words in mnemomic on line %d, "
-                                        "%d supported at maximum",
-                                        line_number, WORDS);
+void parse_options(int argc, char *argv[]) {
+	slip0039_parse_state_t state = SLIP0039_PARSE_STATE_EXP;
+	int max_T = 0;
+	int optind = 1;
 
-		input[no_input++] = wordlist_search(&wordlist_slip0039, line, &line);
+	while (argc > optind) {
+		char *arg = argv[optind++];
+		if (!strcmp(arg, "-d")) debug = 1;
+		else if (!strcmp(arg, "-q")) quiet = 1;
+		else if (!strcmp(arg, "-T")) {
+#ifdef STATS
+			stats_init();
+#else
+			FATAL("option -T is not supported, build with "
+					"make STATS=1");
+#endif
+		}
+		else if (!strcmp(arg, "-m")) {
+			char *end;
+			if (argc == optind) FATAL("option -m given, but no "
+					"argument supplied");
+			max_secret = parse_number(argv[optind++], "maximum "
+					"size of the secret", BLOCKS<<1,
+					MAX_SECRET, &end, 1);
+			check(slip0039_ctx_max_secret(ctx, max_secret));
+		}
+		else if (!strcmp(arg, "-c")) {
+			if (argc > optind) {
+				codec_spec = argv[optind++];
+				check(slip0039_ctx_codec(ctx, codec_spec));
+			} else FATAL("option -c given, but no argument supplied");
+		} else if (mode == SLIP0039_MODE_RECOVER &&
+				!recover_all && !strcmp(arg, "--all"))
+			recover_all = 1;
+		else if (mode == SLIP0039_MODE_RECOVER) FATAL("no arguments "
+				"except --all must be given after \"recover\"");
+		else if (mode == SLIP0039_MODE_VERIFY) FATAL("no arguments "
+				"must be given after \"verify\"");
+		else if (mode == SLIP0039_MODE_REFRESH) FATAL("no arguments "
+				"must be given after \"refresh\"");
+		else if (mode == SLIP0039_MODE_SPLIT ||
+				mode == SLIP0039_MODE_RESHARE)
+			parse_options_split(&spec, arg, &state, &max_T);
+		else if (mode == SLIP0039_MODE_SEARCH) {
+			char *val, *end;
+			if (argc == optind) FATAL("option %s of search needs "
+					"an argument", arg);
+			val = argv[optind++];
+			if (!strcmp(arg, "--prefix")) search_prefix = val;
+			else if (!strcmp(arg, "--sha256")) {
+				if (strlen(val) != 2*SHA256_LEN) FATAL("argument "
+						"of --sha256 must be %d hex "
+						"digits", 2*SHA256_LEN);
+				search_sha256 = val;
+			} else if (!strcmp(arg, "--shard")) {
+				search_shard = parse_number(val, "I in --shard "
+						"I/N", 1, ULONG_MAX, &end, 0);
+				if (*end != '/') FATAL("I and N must be "
+						"separated by '/', as in 2/8");
+				search_shards = parse_number(end + 1, "N in "
+						"--shard I/N", search_shard,
+						ULONG_MAX, &end, 1);
+			} else if (!strcmp(arg, "--checkpoint"))
+				search_checkpoint = val;
+			else if (!strcmp(arg, "--threads"))
+				search_threads = parse_number(val,
+						"number of threads", 1, 256,
+						&end, 1);
+			else FATAL("unknown option \"%s\" of search", arg);
+		} else if (mode == SLIP0039_MODE_CALIBRATE) {
+			if (strcmp(arg, "--budget")) FATAL("unknown option "
+					"\"%s\" of calibrate", arg);
+			if (argc == optind) FATAL("option --budget of "
+					"calibrate needs an argument");
+			calibrate_budget = parse_duration(argv[optind++],
+					"budget");
+		} else if (mode == SLIP0039_MODE_DAEMON) {
+			char *end;
+			if (!daemon_path) daemon_path = arg;
+			else if (!daemon_threads) daemon_threads = parse_number(
+					arg, "number of threads", 1, 256, &end, 1);
+			else FATAL("no arguments must be given after "
+					"\"daemon SOCKET THREADS\"");
+		} else {
+		       	assert(mode == SLIP0039_MODE_NULL);
+			if (!strcmp(arg, "recover"))
+				mode = SLIP0039_MODE_RECOVER;
+			else if (!strcmp(arg, "split"))
+				mode = SLIP0039_MODE_SPLIT;
+			else if (!strcmp(arg, "verify"))
+				mode = SLIP0039_MODE_VERIFY;
+			else if (!strcmp(arg, "refresh"))
+				mode = SLIP0039_MODE_REFRESH;
+			else if (!strcmp(arg, "search"))
+				mode = SLIP0039_MODE_SEARCH;
+			else if (!strcmp(arg, "reshare")) {
+				// the iteration exponent can't change
+				mode = SLIP0039_MODE_RESHARE;
+				state = SLIP0039_PARSE_STATE_GT;
+			}
+			else if (!strcmp(arg, "daemon"))
+				mode = SLIP0039_MODE_DAEMON;
+			else if (!strcmp(arg, "calibrate"))
+				mode = SLIP0039_MODE_CALIBRATE;
+			else FATAL("first non-option argument must be "
+					"\"recover\", \"split\", \"verify\", "
+					"\"reshare\", \"refresh\", "
+					"\"search\", \"daemon\" or "
+					"\"calibrate\"");
+		}
 	}
 
-	if (!rs1024_verify(input, no_input))
-		FATAL("checksum of mnemonic on line %d is not valid", line_number);
-
-        if (no_input < 20)
-		FATAL("not enough words in mnemonic on line %d, "
-				"minimum 20 words", line_number);
+	// set mode to 'recover' if no mode is specified
+	if (mode == SLIP0039_MODE_NULL) mode = SLIP0039_MODE_RECOVER;
 
-	fixnum_init_pattern(&h, slip0039_header, 5, PATTERN_ZERO);
-	base_decode_fixnum(&h, &wordlist_slip0039.m, input, 4, 0);
+	// check if we have all the neccesary information
+	// to create the shares if mode is set to 'split',
+	// in batch mode, this is done for every record
+	else if (mode == SLIP0039_MODE_SPLIT) {
+		if (state == SLIP0039_PARSE_STATE_BATCH)
+			FATAL("number of threads needs to be specified "
+					"as next argument");
+		else if (state != SLIP0039_PARSE_STATE_DONE)
+			parse_options_split_check(&spec, state, max_T);
+	} else if (mode == SLIP0039_MODE_RESHARE)
+		parse_options_split_check(&spec, state, max_T);
+	else if (mode == SLIP0039_MODE_SEARCH &&
+			!search_prefix && !search_sha256)
+		FATAL("search needs --prefix or --sha256 to recognize "
+				"the right passphrase");
+	else if (mode == SLIP0039_MODE_DAEMON && !daemon_path)
+		FATAL("SOCKET needs to be specified as next argument");
+}
 
-	size_t n = 2*(10*(no_input - 7)/16);
-	size_t surplus = 10*(no_input - 7)%16;
-        if (surplus >= 10) 
-                FATAL("invalid master secret length in mnemonic "
-				"on line %d, padding >= 10", line_number);
+/* state shared by the workers of split --batch, records are read
+ * in turn and the results are written in the same order */
+typedef struct slip0039_batch_s {
+	pthread_mutex_t lock;
+	pthread_cond_t turn;
+	unsigned long int next;    // sequence number of the next record
+	unsigned long int printed; // number of records written
+} slip0039_batch_t;
+
+/* read a record of 5 lines: ID, group spec (EXP GT XofY...), passphrase,
+ * seed and plaintext, returns 0 on EOF before the start of a record */
+static int slip0039_batch_read_record(char *id, size_t id_size) {
+	slip0039_spec_t record_spec;
+	char desc[80], *str;
+	size_t len;
+
+	if (input_peek(&stdin_input, "record") == EOF) return 0;
+
+	str = input_line(&stdin_input, id_size, &len, "record id", 0);
+	memcpy(id, str, len + 1);
+	if (!*id || strchr(id, ' '))
+		FATAL("record id \"%s\" must be non-empty and must not "
+				"contain spaces", id);
+
+	session_init();
+	str = input_line(&stdin_input, DISPLAYLINE, &len, "group spec", 0);
+	snprintf(desc, sizeof(desc), "record %s", id);
+	parse_spec(&record_spec, str, desc);
+	check(slip0039_split_init(ctx, &record_spec));
+
+	read_passphrase(&stdin_input);
+	read_seed(&stdin_input);
+	read_plaintext(&stdin_input);
+
+	return 1;
+}
 
-	uint16_t id;
-	uint8_t e, GI, GT, G, I, T;
+static void *slip0039_batch_worker(void *arg) {
+	slip0039_batch_t *b = arg;
+	unsigned long int seq;
+	char id[64], *start, *end;
+	sbuf_t out;
 
-	/* read header */
-	id = fixnum_peek(&h, 25, 15);
-	e = fixnum_peek(&h, 20, 5);
+	lock_thread();
 
-	GI = fixnum_peek(&h, 16, 4);
-	GT = fixnum_peek(&h, 12, 4) + 1;
-	G =  fixnum_peek(&h, 8, 4)+ 1;
-	I = fixnum_peek(&h, 4, 4);
-	T = fixnum_peek(&h, 0, 4) + 1;
+	for (;;) {
+		pthread_mutex_lock(&b->lock);
+		if (!slip0039_batch_read_record(id, sizeof(id))) {
+			pthread_mutex_unlock(&b->lock);
+			break;
+		}
+		seq = b->next++;
+		pthread_mutex_unlock(&b->lock);
+
+		make_mnemonics(&out);
+
+		/* wait for our turn, so that the output does not
+		 * depend on the number of threads */
+		pthread_mutex_lock(&b->lock);
+		while (b->printed != seq) pthread_cond_wait(&b->turn, &b->lock);
+		for (start = output; *start; start = end + 1) {
+			end = strchr(start, '\n');
+			assert(end);
+			printf("%s %.*s\n", id, (int)(end - start), start);
+		}
+		b->printed++;
+		pthread_cond_broadcast(&b->turn);
+		pthread_mutex_unlock(&b->lock);
 
-	if (s->n == 0) { // s is uninitialized
-		slip0039_write_title(s, input);
-		s->id = id;
-		s->e = e;
-		s->root.threshold = GT;
-		s->root.count = G;
-		s->n = n;
-	} else {
-		if (s->id != id) FATAL("Identifier mismatch in "
-				"mnemonic on line %d", line_number);
-		if (s->e != e) FATAL("Iteration exponent mismatch "
-				"in mnemonic on line %d", line_number);
-		if (s->root.threshold != GT) FATAL("Group threshold mismatch "
-				"in mnemonic on line %d", line_number);
-		if (s->root.count != G) FATAL("Group count mismatch in "
-				"mnemonic on line %d", line_number);
-		if (s->n != n) FATAL("share size mismatch in mnemonic "
-				"on line %d", line_number);
+		slip0039_debug(&ctx->s);
+		wipememory(output, out.len);
+		slip0039_ctx_wipe(ctx);
 	}
 
-	if (GI >= s->root.count)
-		 FATAL("group index too large in mnemonic on line %d, "
-				 "number of groups is %d, group index is %d",
-			line_number, s->root.count, GI);
+	wipe_thread();
 
-	slip0039_set_t *m = &s->members[GI];
-	if (!m->threshold) { // new group
-		slip0039_write_group_title(s, GI, input[2]);
-		m->threshold = T;
-		m->count = 0; // undefined
-	} else if (m->threshold != T)
-		FATAL("Member threshold mismatch in mnemonic on line %d",
-				line_number);
+	return NULL;
+}
 
-	if (m->shares[I])
-		FATAL("share is already loaded in mnemonic on line %d",
-				line_number);
+/* split the secrets of all records on stdin using a pool of threads, the
+ * mnemonics are prefixed with the record id and written in input order */
+void slip0039_batch(unsigned long int threads) {
+	slip0039_batch_t b = {
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.turn = PTHREAD_COND_INITIALIZER,
+		.next = 0,
+		.printed = 0
+	};
+	pthread_t workers[threads];
+	int err;
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_create(&workers[i], NULL,
+						slip0039_batch_worker, &b)))
+			FATAL("unable to create thread: %s", strerror(err));
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_join(workers[i], NULL)))
+			FATAL("unable to join thread: %s", strerror(err));
+
+	DEBUG("split %lu records using %lu threads", b.printed, threads);
+}
 
-	slip0039_write_member_title(s, GI, I, input[3]);
-	m->line_numbers[I] = line_number;
+/* the workers of recover --all take the sets in turn */
+typedef struct slip0039_multi_pool_s {
+	pthread_mutex_t lock;
+	slip0039_multi_t **sets;
+	size_t count, next;
+	const lrcipher_t *l; // initialized with the passphrase
+} slip0039_multi_pool_t;
+
+static void *slip0039_multi_worker(void *arg) {
+	slip0039_multi_pool_t *pool = arg;
+	size_t i;
+
+	lock_thread();
+	session_init();
+	ctx->s.l = *pool->l;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		i = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+		if (i >= pool->count) break;
+
+		slip0039_multi_recover(ctx, pool->sets[i]);
+	}
 
-	m->shares[I] = m->storage_shares[I];
+	wipe_thread();
 
-	if (base_decode_buffer(m->shares[I], n, &wordlist_slip0039.m, &input[4], no_input - 7, 0))
-		FATAL("invalid (nonzero) padding in mnemonic on line %d",
-				line_number);
+	return NULL;
+}
 
-	slip0039_set_increment_available(m);
+// recover --all skips the mnemonics with errors
+static void report_skipped(void *arg, const char *error) {
+	ERROR("%s, skipped", error);
 }
 
-void slip0039_add_plaintext(slip0039_t *s, codec_t *c) {
-	assert(s && !s->plaintext && !s->n);
+/* sort the mnemonics on in into sets and recover every set that has
+ * enough shares, the sets are decrypted in parallel and the status of
+ * each set is written in order of appearance; returns the exit status */
+int slip0039_recover_all(input_t *in) {
+	slip0039_multi_t *m;
+	long int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	size_t count, threads;
+	int ret = EXIT_SUCCESS, err, c, more, eof = 0;
 
-	read_stringLF(input_base16, sizeof(input_base16), stdin,
-			"plaintext", 0);
+	check(slip0039_multi_init(ctx, &multi_sets, &multi_info,
+				report_skipped, NULL));
 
-	(c->encode)(s->storage_plaintext, &s->n, &s->l,
-			input, sizeof(input)/sizeof(*input),
-			input_base16, wordlist, seed, seed_len, &bs);
+	do {
+		if ((c = input_getc(in, "mnemonic")) == EOF) {
+			eof = 1;
+			c = '\n'; // finish the last mnemonic
+		}
+		check(slip0039_recover_add_char(ctx, c, &more));
+	} while (more && !eof);
+	check(slip0039_multi_finish(ctx));
+
+	count = llist_get_count(&multi_sets);
+	if (!count) FATAL("no valid mnemonics found");
+
+	slip0039_multi_t *sets[count];
+	for (m = multi_sets.head; m; m = m->next) sets[m->no] = m;
+
+	slip0039_multi_pool_t pool = {
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.sets = sets,
+		.count = count,
+		.next = 0,
+		.l = &ctx->s.l
+	};
+
+	threads = cpus < 1 ? 1 : cpus;
+	if (threads > count) threads = count;
+	pthread_t workers[threads];
+
+	for (size_t i = 0; i < threads; i++)
+		if ((err = pthread_create(&workers[i], NULL,
+						slip0039_multi_worker, &pool)))
+			FATAL("unable to create thread: %s", strerror(err));
+
+	for (size_t i = 0; i < threads; i++)
+		if ((err = pthread_join(workers[i], NULL)))
+			FATAL("unable to join thread: %s", strerror(err));
+
+	for (size_t i = 0; i < count; i++) {
+		m = sets[i];
+		printf("set %zu%s: %s\n", i + 1, slip0039_title(&m->s),
+				m->plaintext);
+		if (!m->ok) ret = EXIT_FAILURE;
+		slip0039_debug(&m->s);
+	}
 
-	s->plaintext = s->storage_plaintext;
+	if (ctx->p.errors) {
+		WARNING("%d mnemonic(s) skipped because of errors",
+				ctx->p.errors);
+		ret = EXIT_FAILURE;
+	}
 
-	// try to read one more character, it should set feof since
-	// we don't expect anymore characters
-	fgetc(stdin);
+	llist_empty(&multi_sets);
 
-	if (!feof(stdin)) WARNING("data detected after plaintext on input");
+	return ret;
 }
 
-void slip0039_add_seed(slip0039_t *s) {
-	uint8_t sha[SHA256_LEN];
+/* read mnemonics (one per line) until an empty line */
+static void read_mnemonics(input_t *in) {
+	int c, more;
 
-	// now read the seed for the prng
-	seed_len = read_stringLF(seed, sizeof(seed), stdin, "seed", 0);
-#if defined(__APPLE__) && defined(__MACH__)
-	mlock_ptr(seed, seed_len);
-#endif
-	if (seed_len < 64) WARNING("specified value for SEED is very "
-				"short, consider using a longer value of at least 64 alphanumeric bytes");
-	hash(sha, SHA256_LEN, seed, seed_len, HASH_SHA256);
-       	// drop MSB to get 15 bits
-	s->id = 0x7fff&((sha[0]<<8) + sha[1]);
+	do {
+		if ((c = input_getc(in, "mnemonics")) == EOF)
+			FATAL("end of file while reading mnemonics");
+		check(slip0039_recover_add_char(ctx, c, &more));
+	} while (more);
+}
 
+/* write all of buf to fd, returns -1 on error */
+static int write_all(int fd, const char *buf, size_t len) {
+	ssize_t ret;
+
+	while (len) {
+		if ((ret = write(fd, buf, len)) < 0) {
+			if (errno == EINTR) continue;
+			return -1;
+		}
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
 }
 
-void slip0039_add_mnemonics(slip0039_t *s, FILE *fp) {
-	int line_number = 0;
+/* a client that stops reading or writing for this long (in seconds) gets
+ * an error and is disconnected, so it can't keep a worker forever */
+#define DAEMON_TIMEOUT 30
+
+/* handle one request of a daemon connection, the response is "ok" or
+ * "error:MESSAGE" on the first line, followed by the result (if any) and
+ * an empty line; returns 0 if the connection must be closed */
+static int slip0039_daemon_request(input_t *in, int fd) {
+	slip0039_spec_t request_spec;
+	sbuf_t out;
+	verbose_trap_t trap;
+	char *request;
+	size_t len;
+	int ret = 1;
+
+	/* errors in the request are reported to the client, after
+	 * that the connection is closed, because we are out of sync;
+	 * the functions between the trap and the FATAL are skipped, so
+	 * they did not wipe their stack, it is wiped at cleanup, and
+	 * the unread rest of the request is wiped here */
+	if (setjmp(trap.env)) {
+		verbose_trap = NULL;
+		input_wipe(in);
+		write_all(fd, "error:", 6);
+		write_all(fd, trap.message, strlen(trap.message));
+		write_all(fd, "\n\n", 2);
+		ret = 0;
+		goto cleanup;
+	}
+	verbose_trap = &trap;
+
+	// a timeout while waiting for the next request is trapped as well
+	if (input_peek(in, "request") == EOF) {
+		verbose_trap = NULL;
+		wipememory(&trap, sizeof(trap));
+		return 0;
+	}
+
+	session_init();
+	request = input_line(in, DISPLAYLINE, &len, "request", 0);
+	memcpy(line, request, len + 1);
+	if (!strncmp(line, "split ", 6)) {
+		parse_spec(&request_spec, line + 6, "request");
+		check(slip0039_split_init(ctx, &request_spec));
+		read_passphrase(in);
+		read_seed(in);
+		read_plaintext(in);
+		make_mnemonics(&out);
+	} else if (!strcmp(line, "recover")) {
+		read_passphrase(in);
+		read_mnemonics(in);
+		check(slip0039_recover_finish(ctx));
+		get_output(&out);
+		sbufprintf(&out, "%s\n", ctx->plaintext);
+	} else if (!strcmp(line, "verify")) {
+		read_mnemonics(in);
+		check(slip0039_verify_finish(ctx));
+		get_output(&out);
+	} else FATAL("unknown request \"%.32s\", expected "
+			"\"split EXP GT XofY..\", \"recover\" "
+			"or \"verify\"", line);
+
+	verbose_trap = NULL;
+	if (write_all(fd, "ok\n", 3) < 0 ||
+			write_all(fd, output, out.len) < 0 ||
+			write_all(fd, "\n", 1) < 0) ret = 0;
+
+cleanup:
+	slip0039_debug(&ctx->s);
+	slip0039_ctx_wipe(ctx);
+	wipememory(&request_spec, sizeof(request_spec));
+	if (line) wipememory(line, line_size);
+	wipememory(dl, sizeof(dl));
+	if (output) wipememory(output, output_size);
+	wipememory(&trap, sizeof(trap));
+	// the stack is wiped after every request, not only at exit
+	wipestackmemory(STACK_CLEAR_SIZE);
 
-	while (read_stringLF(mnemonic, sizeof(mnemonic), fp, "mnemonic", 1))
-		slip0039_add_mnemonic(s, mnemonic, ++line_number);
+	return ret;
 }
 
-void slip0039_add_passphrase(slip0039_t *s, FILE *fp) {
-	int character;
-	lrcipher_init(&s->l);
-	do {
-		character = fgetc(fp);
-		if (character == EOF) {
-			if (feof(fp))
-			       	FATAL("end of file while reading passphrase");
-			else FATAL("error %d reading passphrase: %s",
-					errno, strerror(errno));
-		} else if (character == '\n') break;
-		else if (character < 32 || character > 126)
-			FATAL("character in passphrase is not a "
-					"printable character");
-
-		char tmp = (char)character;
-		lrcipher_add_passphrase(&s->l, &tmp, 1);
-	} while (1);
-}
-
-/* must be called after EMS is computed */
-void init_prng_pbkdf2(pbkdf2_t *p, slip0039_t *s, const char *seed, size_t seed_len) {
-	/* initialize PRNG based on PBKDF2 with EMS and SEED
-	 * as password and a description of the way the secret
-	 * must be split as the first salt
-	 *
-	 * Password = ( EMS || SEED )
-	 * Salt = ( e || GT || G || T_i || count_i  ... )
-	 *                       \_______________/  1 <= i <= G
-	 *
-	 * all numbers are encoded as 8 bit integers */
-	assert(s->root.secret);
-	pbkdf2_init(p, HASH_SHA256);
-	pbkdf2_update_password(p, s->root.secret, s->n);
-	pbkdf2_update_password(p, seed, seed_len);
-	pbkdf2_update_salt_uint8(p, s->e);
-	pbkdf2_update_salt_uint8(p, s->root.threshold);
-	pbkdf2_update_salt_uint8(p, s->root.count);
-	for (uint8_t i = 0; i < s->root.count; i++) {
-		slip0039_set_t *set = &s->members[i];
-		pbkdf2_update_salt_uint8(p, set->threshold);
-		pbkdf2_update_salt_uint8(p, set->count);
-	}
-	pbkdf2_finalize_salt(p, 1);
-}
-
-void slip0039_split(slip0039_set_t *s, size_t n, pbkdf2_t *p) {
-	assert(s->secret && !s->digest);
-	for (uint8_t i = 0; i < MAX_SHARES; i++) assert(!s->shares[i]);
-
-	if (s->threshold == 1) {
-		for (uint8_t i = 0; i < s->count; i++) {
-			assert(!s->shares[i]);
-			s->shares[i] = s->storage_shares[i];
-			memcpy(s->shares[i], s->secret, n);
-		}
-	} else {
-		/* the secret and digest will be known, once we start
-		 * to compute the other shares using lagrange */
-        	uint8_t idx[MAX_SHARES] = { -1, -2 };
-        	int no_idx = 2;
-
-		/* compute digest */
-		assert(!*(s->shares - 2));
-		*(s->shares - 2) = s->storage_digest;
-		pbkdf2_generate(p, *(s->shares - 2) + DIGEST_LEN, n - DIGEST_LEN);
-		digest_compute(*(s->shares - 2), *(s->shares - 1), n);
-
-		/* generate the other required shares randomly */
-		for (uint8_t i = 0; i < s->threshold - 2; i++) {
-			assert(!s->shares[i]);
-			s->shares[i] = s->storage_shares[i];
-			pbkdf2_generate(p, s->shares[i], n);
-			idx[no_idx++] = i; // share[i] is set
+static void *slip0039_daemon_worker(void *arg) {
+	struct timeval timeout = { .tv_sec = DAEMON_TIMEOUT };
+	int sock = *(int*)arg, fd;
+	size_t size;
+	input_t in;
+
+	// a plaintext of the largest secret (the size of line) must fit
+	lock_thread();
+	session_init();
+	size = line_size > BUFSIZ ? line_size : BUFSIZ;
+	iobuf = secmem_alloc(size);
+
+	for (;;) {
+		if ((fd = accept(sock, NULL, NULL)) < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) continue;
+			WARNING("unable to accept connection: %s",
+					strerror(errno));
+			sleep(1);
+			continue;
 		}
 
-		/* compute the remaining shares */
-		for (uint8_t i = s->threshold - 2; i < s->count; i++) {
-			assert(!s->shares[i]);
-			s->shares[i] = s->storage_shares[i];
-			lagrange(s, n, no_idx, idx, i);
+		if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+					sizeof(timeout)) < 0 ||
+				setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO,
+					&timeout, sizeof(timeout)) < 0) {
+			WARNING("unable to set timeout of connection: %s",
+					strerror(errno));
+			close(fd);
+			continue;
 		}
+
+		// the read buffer may contain secrets, so use our own
+		input_init(&in, fd, iobuf, size);
+
+		while (slip0039_daemon_request(&in, fd));
+
+		close(fd);
+		input_wipe(&in);
 	}
 
-	s->available = s->count;
+	return NULL;
+}
 
-	for (uint8_t i = 0; i < s->count; i++) {
-		slip0039_set_t *child = s->children[i];
-		if (!child) continue;
+#define SEARCH_WINDOW 512
+
+/* state shared by the workers of search, the candidates are read in
+ * turn, a checkpoint contains the number of the first candidate that
+ * is not tried yet, so finished candidates are tracked in a window */
+typedef struct slip0039_search_s {
+	pthread_mutex_t lock;
+	pthread_cond_t progress;     // done is incremented
+	const slip0039_t *ems;       // the recovered set
+	unsigned long int next;      // number of candidates read
+	unsigned long int done;      // all candidates before this are tried
+	unsigned long int tried;     // number of candidates of our shard
+	uint8_t finished[SEARCH_WINDOW];
+	int eof, found;
+	time_t saved;                // time of the last checkpoint
+	displayline_t passphrase;    // the passphrase that matched
+	char *plaintext;             // and the corresponding plaintext
+} slip0039_search_t;
+
+static void slip0039_search_save(slip0039_search_t *search) {
+	char tmp[PATH_MAX];
+	FILE *fp;
+
+	if (!search_checkpoint) return;
+
+	// write a new file and rename it, so it is never incomplete
+	snprintf(tmp, sizeof(tmp), "%s.tmp", search_checkpoint);
+	if (!(fp = fopen(tmp, "w")))
+		FATAL_errno("unable to open checkpoint file %s.tmp",
+				search_checkpoint);
+	fprintf(fp, "%lu/%lu %lu\n", search_shard, search_shards,
+			search->done);
+	if (fclose(fp) == EOF)
+		FATAL_errno("unable to write checkpoint file %s.tmp",
+				search_checkpoint);
+	if (rename(tmp, search_checkpoint) < 0)
+		FATAL_errno("unable to rename %s.tmp", search_checkpoint);
+
+	search->saved = time(NULL);
+}
+
+// returns the number of candidates that are already tried
+static unsigned long int slip0039_search_load() {
+	unsigned long int shard, shards, done;
+	FILE *fp;
 
-		child->secret = s->shares[i];
-		slip0039_split(child, n, p);
+	if (!search_checkpoint) return 0;
+
+	if (!(fp = fopen(search_checkpoint, "r"))) {
+		if (errno == ENOENT) return 0;
+		FATAL_errno("unable to open checkpoint file %s",
+				search_checkpoint);
 	}
+
+	if (fscanf(fp, "%lu/%lu %lu", &shard, &shards, &done) != 3)
+		FATAL("checkpoint file %s is corrupt", search_checkpoint);
+	fclose(fp);
+
+	if (shard != search_shard || shards != search_shards)
+		FATAL("checkpoint file %s belongs to shard %lu/%lu",
+				search_checkpoint, shard, shards);
+
+	return done;
 }
 
-void slip0039_recover(slip0039_set_t *s, uint8_t *secret, size_t n) {
-        uint8_t idx[MAX_SHARES];
-        int no_idx = 0;
+// must be called with the lock held
+static void slip0039_search_finished(slip0039_search_t *search,
+		unsigned long int no) {
+	assert(no >= search->done && no - search->done < SEARCH_WINDOW);
+	search->finished[no%SEARCH_WINDOW] = 1;
+	while (search->done < search->next &&
+			search->finished[search->done%SEARCH_WINDOW])
+		search->finished[search->done++%SEARCH_WINDOW] = 0;
+	pthread_cond_broadcast(&search->progress);
+
+	if (search->saved != time(NULL)) slip0039_search_save(search);
+}
 
-	assert(s->available >= s->threshold && s->threshold);
+static int slip0039_search_match(const char *plaintext) {
+	uint8_t sha[SHA256_LEN];
+	char hex[2*SHA256_LEN + 1];
+	int ret = 1;
+
+	if (search_prefix && strncmp(plaintext, search_prefix,
+				strlen(search_prefix))) ret = 0;
+
+	if (search_sha256) {
+		hash(sha, sizeof(sha), plaintext, strlen(plaintext),
+				HASH_SHA256);
+		for (int i = 0; i < SHA256_LEN; i++)
+			snprintf(hex + 2*i, 3, "%02x", sha[i]);
+		if (strcasecmp(hex, search_sha256)) ret = 0;
+		wipememory(sha, sizeof(sha));
+		wipememory(hex, sizeof(hex));
+	}
 
-	for (int i = 0; i < MAX_SHARES; i++) {
-		slip0039_set_t *child = s->children[i];
-		if (!s->shares[i] && child && slip0039_quorum(child)) {
-			slip0039_recover(child, s->storage_shares[i], n);
-			s->shares[i] = s->storage_shares[i];
+	return ret;
+}
+
+static void *slip0039_search_worker(void *arg) {
+	slip0039_search_t *search = arg;
+	unsigned long int no;
+	size_t len;
+	char *candidate;
+	int match;
+
+	lock_thread();
+	session_init();
+
+	for (;;) {
+		// read the next candidate of our shard
+		pthread_mutex_lock(&search->lock);
+		for (;;) {
+			// wait if the oldest candidate is out of the window
+			while (search->next - search->done >= SEARCH_WINDOW)
+				pthread_cond_wait(&search->progress,
+						&search->lock);
+			if (search->found || search->eof) break;
+			if (!(candidate = input_line(&stdin_input, DISPLAYLINE,
+							&len, "passphrase candidate",
+							1))) {
+				search->eof = 1;
+				break;
+			}
+			// the input buffer is shared, so copy the candidate
+			memcpy(line, candidate, len + 1);
+			wipememory(candidate, len);
+			no = search->next++;
+			if (no >= search->done &&
+					no%search_shards == search_shard - 1)
+				break;
+			wipememory(line, len);
+			if (no >= search->done)
+				slip0039_search_finished(search, no);
 		}
-		if (s->shares[i]) idx[no_idx++] = i;
+		if (search->found || search->eof) {
+			pthread_mutex_unlock(&search->lock);
+			break;
+		}
+		pthread_mutex_unlock(&search->lock);
+
+		match = !slip0039_try_passphrase(ctx, search->ems,
+				line, len) && slip0039_search_match(ctx->plaintext);
+
+		pthread_mutex_lock(&search->lock);
+		search->tried++;
+		if (match && !search->found) {
+			search->found = 1;
+			memcpy(search->passphrase, line, len + 1);
+			memcpy(search->plaintext, ctx->plaintext,
+					ctx->line_size);
+		}
+		slip0039_search_finished(search, no);
+		pthread_mutex_unlock(&search->lock);
 
-                if (no_idx == s->threshold) break;
-        }
+		wipememory(line, len);
+	}
 
-        assert(no_idx == s->threshold);
+	wipe_thread();
 
-	if (s->threshold == 1) {
-		// if threshold is 1, just copy the first
-		// available share to the secret, since
-		// all shares contain the same data
-		// (and there SHOULD only be one share)
-		// furthermore, there is no digest to verify
-		s->secret = secret;
-		memcpy(s->secret, s->shares[idx[0]], n);
-	} else {
-		// compute digest share (uint8_t)-2 = 254
-		// and secret share (uint8_t)-1 = 255
+	return NULL;
+}
 
-		for (int i = -2; i < 0; i++) {
-			assert(!s->shares[i]);
-			*(s->shares + i) = (i == -2)?s->storage_digest:secret;
-			lagrange(s, n, no_idx, idx, (uint8_t)i);
+/* read mnemonics up to an empty line and recover the EMS once, then try
+ * the passphrase candidates on the following lines until the plaintext
+ * matches the prefix and/or hash; returns the exit status */
+int slip0039_search(unsigned long int threads) {
+	slip0039_search_t search = {
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.progress = PTHREAD_COND_INITIALIZER,
+		.ems = &ctx->s,
+		.saved = time(NULL),
+		.plaintext = secmem_alloc(ctx->line_size)
+	};
+	pthread_t workers[threads];
+	int err, ret;
+
+	read_mnemonics(&stdin_input);
+	check(slip0039_verify_finish(ctx));
+
+	search.done = slip0039_search_load();
+	if (search.done) DEBUG("resuming at candidate %lu", search.done + 1);
+
+	// skip the candidates that are already tried, so that the numbers
+	// of the remaining candidates, and with that the shards, are right
+	while (search.next < search.done) {
+		size_t len;
+		char *skip = input_line(&stdin_input, DISPLAYLINE, &len,
+				"passphrase candidate", 1);
+		if (!skip) {
+			WARNING("checkpoint is past the last candidate");
+			search.done = search.next;
+			search.eof = 1;
+			break;
 		}
+		wipememory(skip, len);
+		search.next++;
+	}
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_create(&workers[i], NULL,
+						slip0039_search_worker, &search)))
+			FATAL("unable to create thread: %s", strerror(err));
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_join(workers[i], NULL)))
+			FATAL("unable to join thread: %s", strerror(err));
+
+	slip0039_search_save(&search);
 
-		digest_verify(s->digest, s->secret, n);
+	DEBUG("tried %lu candidates using %lu threads", search.tried, threads);
+
+	if (search.found) {
+		printf("%s\n%s\n", search.passphrase, search.plaintext);
+		ret = EXIT_SUCCESS;
+	} else {
+		ERROR("none of the %lu candidates matched", search.tried);
+		ret = EXIT_FAILURE;
 	}
-}
+	secmem_free(search.plaintext);
+	wipememory(&search, sizeof(search));
 
-void slip0039_decrypt(slip0039_t *s) {
-	assert(s && !s->plaintext && s->root.secret);
-	s->plaintext = s->storage_plaintext;
-	lrcipher_execute(&s->l, s->plaintext, s->root.secret,
-			s->n, 2500L<<s->e, LRCIPHER_DECRYPT);
+	return ret;
 }
 
-void slip0039_encrypt(slip0039_t *s) {
-	assert(s && !s->root.secret && s->plaintext);
-	s->root.secret = s->storage_secret;
-	lrcipher_execute(&s->l, s->root.secret, s->plaintext,
-			s->n, 2500L<<s->e, LRCIPHER_ENCRYPT);
+static void unlink_socket() {
+	unlink(daemon_path);
 }
 
-void boring_stuff() {
-#if defined(__APPLE__) && defined(__MACH__)
-	mlock_ptr(stackbase, STACK_CLEAR_SIZE);
-	mlock_obj(s);
-	mlock_obj(mnemonic);
-	mlock_obj(dl);
-	mlock_obj(seed);
-	mlock_obj(seed_len);
-	mlock_obj(prng);
-	mlock_obj(input_base16);
-	mlock_obj(input);
-	mlock_obj(bs);
-	mlock_obj(base_scratch_space);
-	mlock_obj(slip0039_header);
-#else
-        /* lock me into memory; don't leak info to swap */
-        if (mlockall(MCL_CURRENT|MCL_FUTURE)<0)
-                FATAL("failed locking process in RAM: %s",
-                                strerror(errno));
-#endif
-
-	if (atexit(wipe))
+/* serve split and recover requests on a unix domain socket, the codecs
+ * and wordlists are initialized once and the memory of the workers is
+ * locked for their lifetime; never returns */
+void slip0039_daemon(const char *path, unsigned long int threads) {
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	pthread_t workers[threads];
+	mode_t mask;
+	int sock, err;
+
+	if (strlen(path) >= sizeof(addr.sun_path))
+		FATAL("path of socket \"%s\" too long", path);
+	strcpy(addr.sun_path, path);
+
+	if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		FATAL_errno("unable to create socket");
+
+	// only we may connect to the socket
+	mask = umask(077);
+	if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+		FATAL_errno("unable to bind socket to %s", path);
+	umask(mask);
+
+	if (atexit(unlink_socket))
 		FATAL("error setting atexit() handler");
 
-	/* make the program cleanup our data
-	 * on receiving common signals */
-	signal(SIGINT, sig_handler);
-	signal(SIGTERM, sig_handler);
-	signal(SIGHUP, sig_handler);
-	signal(SIGQUIT, sig_handler);
-	signal(SIGABRT, sig_handler);
-	signal(SIGALRM, sig_handler);
-	signal(SIGPIPE, sig_handler);
-	signal(SIGUSR1, sig_handler);
-	signal(SIGUSR2, sig_handler);
+	if (listen(sock, SOMAXCONN) < 0)
+		FATAL_errno("unable to listen on %s", path);
+
+	// a client that disconnects early is not a reason to exit
+	signal(SIGPIPE, SIG_IGN);
+
+	DEBUG("listening on %s with %lu threads", path, threads);
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_create(&workers[i], NULL,
+						slip0039_daemon_worker, &sock)))
+			FATAL("unable to create thread: %s", strerror(err));
+
+	for (unsigned long int i = 0; i < threads; i++)
+		if ((err = pthread_join(workers[i], NULL)))
+			FATAL("unable to join thread: %s", strerror(err));
 }
 
-unsigned long int parse_number(const char *arg, const char *name,
-		unsigned long int min, unsigned long int max,
-		char **end, int empty) {
-	unsigned long int ret = strtoul(arg, end, 0);
+/* calibrate: the time of split and recover is a fixed part plus four
+ * rounds of 2500<<e PBKDF2 iterations, the cost of an iteration of the
+ * PBKDF2 backend is measured directly and the fixed part is what a split
+ * and a recover with e=0 take more than their 4*2500 iterations */
+#define CALIBRATE_REPS 5
+#define CALIBRATE_NS 250e6 // measure iterations for at least this long
+#define CALIBRATE_SEED "calibrate seed, the shares are thrown away, so it " \
+	"does not need to be random"
+#define CALIBRATE_MAX_NS (24*3600e9)
+
+static uint64_t calibrate_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
 
-	if (*end == arg) FATAL("expected %s, found \"%s\" instead", name, arg);
-	if (ret > max) FATAL("%s must be <= %lu", name, max);
-	if (ret < min) FATAL("%s must be >= %lu", name, min);
-	if (empty && **end != '\0') FATAL("junk found while parsing %s", name);
+// nanoseconds per iteration of PBKDF2-HMAC-SHA256, as used by lrcipher
+static double calibrate_pbkdf2() {
+	uint8_t out[32];
+	uint64_t iterations = 1000, start, ns;
+	double best = 0;
+
+	for (int i = 0; i < CALIBRATE_REPS; ) {
+		start = calibrate_now();
+		pbkdf2(out, "", 0, CALIBRATE_SEED, 32, iterations,
+				sizeof(out), HASH_SHA256);
+		ns = calibrate_now() - start;
+		if (ns < CALIBRATE_NS/CALIBRATE_REPS) {
+			iterations <<= 1;
+			continue;
+		}
+		if (!i++ || (double)ns/iterations < best)
+			best = (double)ns/iterations;
+	}
 
-	return ret;
+	return best;
 }
 
-void parse_options_split(slip0039_t *s, char *arg,
-		slip0039_parse_state_t *state, int *max_T) {
-	char *end;
+/* the fastest of CALIBRATE_REPS splits in a 2of3 group of a secret of
+ * bytes bytes with e=0, and of recovering it from two mnemonics */
+static void calibrate_run(int bytes, double *split, double *recover) {
+	slip0039_spec_t spec = { .e = 0, .GT = 1, .G = 1,
+		.groups = { { 2, 3 } } };
+	sbuf_t out;
+	uint64_t start, ns;
+
+	for (int i = 0; i < bytes; i++) sprintf(line + 2*i, "%02x", i);
+	slip0039_ctx_wipe(ctx); // the session of main
+
+	for (int i = 0; i < CALIBRATE_REPS; i++) {
+		start = calibrate_now();
+		check(slip0039_ctx_init(ctx));
+		check(slip0039_add_passphrase(ctx, "", 0));
+		check(slip0039_split_init(ctx, &spec));
+		check(slip0039_split_seed(ctx, CALIBRATE_SEED,
+					strlen(CALIBRATE_SEED)));
+		check(slip0039_split_plaintext(ctx, line));
+		get_output(&out);
+		check(slip0039_split_mnemonics(ctx, &out));
+		slip0039_ctx_wipe(ctx);
+		ns = calibrate_now() - start;
+		if (!i || ns < *split) *split = ns;
+
+		start = calibrate_now();
+		check(slip0039_ctx_init(ctx));
+		check(slip0039_add_passphrase(ctx, "", 0));
+		for (char *c = output, *end = strchr(strchr(output, '\n') + 1,
+					'\n'); c <= end; c++)
+			check(slip0039_recover_add_char(ctx, *c, NULL));
+		check(slip0039_recover_finish(ctx));
+		slip0039_ctx_wipe(ctx);
+		ns = calibrate_now() - start;
+		if (!i || ns < *recover) *recover = ns;
+	}
 
-	/*if (*state == SLIP0039_PARSE_STATE_SEED) {
-		assert(!seed && seed_len == 0);
-		seed = arg;
-		seed_len = strlen(seed);
-		*state = SLIP0039_PARSE_STATE_EXP;
-	} else*/ if (*state == SLIP0039_PARSE_STATE_EXP) {
-		s->e = parse_number(arg, "iteration exponent", 0, 32, &end, 1);
-		*state = SLIP0039_PARSE_STATE_GT;
-	} else if (*state == SLIP0039_PARSE_STATE_GT) {
-		s->root.threshold = parse_number(arg, "group threshold", 0,
-				MAX_SHARES, &end, 1);
-		*state = SLIP0039_PARSE_STATE_XOFY;
-	} else if (*state == SLIP0039_PARSE_STATE_XOFY) {
-		if (s->root.count == MAX_SHARES)
-			FATAL("at most %d groups supported", MAX_SHARES);
-		unsigned long int x = parse_number(arg, "X in group spec XofY",
-				1, MAX_SHARES, &end, 0);
-		arg = end;
-		if (arg[0] != 'o' || arg[1] != 'f')
-			FATAL("X and Y must be separated by 'of', as in 4of6");
-		arg += 2;
-		unsigned long int y = parse_number(arg, "Y in group spec XofY",
-				x, MAX_SHARES, &end, 1);
-		if (x == 1 && y > 1)
-			WARNING("X == 1, according to the spec, "
-					"Y SHOULD also be 1");
-		if (x > *max_T) *max_T = x;
-		s->members[s->root.count].count = y;
-		s->members[s->root.count].threshold = x;
-		s->root.count++;
-	} else assert(0);
+	wipememory(line, 2*bytes);
+	wipememory(output, output_size);
 }
 
-void parse_options(slip0039_t *s, int argc, char *argv[]) {
-	slip0039_parse_state_t state = SLIP0039_PARSE_STATE_EXP;
-	int max_T = 0;
-	int optind = 1;
+static void calibrate_format(char *buf, size_t size, double ns) {
+	if (ns < 1e9) snprintf(buf, size, "%.1fms", ns/1e6);
+	else if (ns < 60e9) snprintf(buf, size, "%.2fs", ns/1e9);
+	else if (ns < 3600e9) snprintf(buf, size, "%.1fmin", ns/60e9);
+	else snprintf(buf, size, "%.1fh", ns/3600e9);
+}
 
-	while (argc > optind) {
-		char *arg = argv[optind++];
-		if (!strcmp(arg, "-d")) debug = 1;
-		else if (!strcmp(arg, "-q")) quiet = 1;
-		else if (!strcmp(arg, "-c")) {
-			if (argc > optind) {
-				char *separator = strchr(argv[optind], ':');
-				if (separator) *separator = '\0';
-				codec = codec_find(argv[optind]);
-				if (!codec) FATAL("codec %s not available", argv[optind]);
-				if (!separator) {
-					wordlist = shashtbl_search_elt_bykey(
-						&codec->wordlists, codec->default_language);
-					assert(wordlist); // the default should be available
-				}
-				else wordlist = shashtbl_search_elt_bykey(
-						&codec->wordlists,++separator);
-				if (!wordlist)
-					FATAL("wordlist \"%s\" not found for codec %s",
-							separator, argv[optind]);
-				optind++;
-			} else FATAL("option -c given, but no argument supplied");
-		} else if (mode == SLIP0039_MODE_RECOVER) FATAL("no arguments "
-				"must be given after \"recover\"");
-		else if (mode == SLIP0039_MODE_SPLIT)
-			parse_options_split(s, arg, &state, &max_T);
-		else {
-		       	assert(mode == SLIP0039_MODE_NULL);
-			if (!strcmp(arg, "recover"))
-				mode = SLIP0039_MODE_RECOVER;
-			else if (!strcmp(arg, "split"))
-				mode = SLIP0039_MODE_SPLIT;
-			else FATAL("first non-option argument must be "
-					"\"recover\" or \"split\"");
+/* print the expected time of split and recover for every iteration
+ * exponent and secret size, and with a budget the largest e that fits,
+ * returns EXIT_FAILURE if not even e=0 fits the budget */
+int slip0039_calibrate(double budget) {
+	static const int sizes[] = { 16, 32, 64 };
+	const int no_sizes = sizeof(sizes)/sizeof(*sizes);
+	double fixed[no_sizes][2], iteration = calibrate_pbkdf2();
+	char buf[32];
+	int ret = EXIT_SUCCESS;
+
+	for (int i = 0; i < no_sizes; i++) {
+		calibrate_run(sizes[i], &fixed[i][0], &fixed[i][1]);
+		for (int j = 0; j < 2; j++) {
+			fixed[i][j] -= 4*2500*iteration;
+			if (fixed[i][j] < 0) fixed[i][j] = 0;
 		}
 	}
 
-	// set mode to 'recover' if no mode is specified
-	if (mode == SLIP0039_MODE_NULL) mode = SLIP0039_MODE_RECOVER;
+	printf("pbkdf2 backend %s, %.1fns per iteration\n\n",
+			PBKDF2_BACKEND, iteration);
 
-	// check if we have all the neccesary information
-	// to create the shares if mode is set to 'split'
-	else if (mode == SLIP0039_MODE_SPLIT) {
-		if (state == SLIP0039_PARSE_STATE_SEED)
-			FATAL("SEED needs to be specified as next argument");
-		else if (state == SLIP0039_PARSE_STATE_EXP)
-			FATAL("iteration exponent needs to be specified "
-					"as next argument");
-		else if (state == SLIP0039_PARSE_STATE_GT)
-			FATAL("GT (group threshold) needs to be specified "
-					"as next argument");
-		else if (state == SLIP0039_PARSE_STATE_XOFY &&
-				s->root.count < s->root.threshold)
-			FATAL("not enough groups specified to satisfy "
-					"group threshold");
-		else {
-			assert(max_T > 0);
-			if (max_T == 1 && s->root.count > 1)
-				WARNING("a simple split in %d different "
-						"shares, SHOULD be made "
-						"using a single group "
-						"according to the spec",
-						s->root.count);
-		}
+	printf("%2s %14s", "e", "iterations");
+	for (int i = 0; i < no_sizes; i++) {
+		snprintf(buf, sizeof(buf), "split %d", sizes[i]);
+		printf(" %11s", buf);
+		snprintf(buf, sizeof(buf), "recover %d", sizes[i]);
+		printf(" %11s", buf);
+	}
+	printf("\n");
+
+	for (int e = 0; e < 32; e++) {
+		double slowest = 0;
+		printf("%2d %14llu", e, 4*(2500ULL<<e));
+		for (int i = 0; i < no_sizes; i++)
+			for (int j = 0; j < 2; j++) {
+				double t = fixed[i][j] +
+					4*(2500ULL<<e)*iteration;
+				calibrate_format(buf, sizeof(buf), t);
+				printf(" %11s", buf);
+				if (t > slowest) slowest = t;
+			}
+		printf("\n");
+		if (slowest > CALIBRATE_MAX_NS) break;
 	}
 
+	if (!budget) return ret;
+
+	calibrate_format(buf, sizeof(buf), budget);
+	printf("\nlargest e that fits a budget of %s:\n", buf);
+	// the recommendation does not go beyond the table
+	if (budget > CALIBRATE_MAX_NS) {
+		budget = CALIBRATE_MAX_NS;
+		calibrate_format(buf, sizeof(buf), budget);
+		printf("(budget capped at %s, the end of the table)\n", buf);
+	}
+	for (int i = 0; i < no_sizes; i++) {
+		double slowest = fixed[i][0] > fixed[i][1] ?
+			fixed[i][0] : fixed[i][1];
+		int best = -1;
+		while (best < 31 && slowest +
+				4*(2500ULL<<(best + 1))*iteration <= budget)
+			best++;
+		if (best < 0) {
+			printf("%d byte secrets: none\n", sizes[i]);
+			ret = EXIT_FAILURE;
+		} else printf("%d byte secrets: e=%d\n", sizes[i], best);
+	}
+
+	return ret;
 }
 
 int main(int argc, char *argv[]) {
-#if defined(__APPLE__) && defined(__MACH__)
-	// save stackbase for locking stack memory
-	stackbase = (char*)&argc - STACK_CLEAR_SIZE;
-#endif
+	int ret = EXIT_SUCCESS, c, more;
+	size_t seed_len = 0;
 
 	verbose_init(argv[0]);
-	codec_init();
+	slip0039_lib_init();
 	boring_stuff();
-	base_init_scratch(&bs, base_scratch_space, BLOCKS<<1);
-	wordlists_init();
-       	slip0039_init(&s);
-	parse_options(&s, argc,argv);
-
-	/* read passphrase from first line of stdin */
-	slip0039_add_passphrase(&s, stdin);
+	check(slip0039_ctx_init(ctx));
+	parse_options(argc,argv);
+	session_init();
+
+	// a plaintext of the largest secret must fit in the buffer of stdin
+	if (line_size > stdin_input.size) {
+		secmem_free(stdin_input.buf);
+		input_init(&stdin_input, STDIN_FILENO, secmem_alloc(line_size),
+				line_size);
+	}
 
-	if (mode == SLIP0039_MODE_SPLIT) {
-		/* read seed for encoding on second line of stdin */
-		slip0039_add_seed(&s);
+	if (batch_threads) {
+		slip0039_batch(batch_threads);
+		wipestackmemory(STACK_CLEAR_SIZE);
+		return 0;
+	}
 
-		/* we should have the ID, this is needed to finish
-		 * initializing lrcipher */
-		lrcipher_finalize_passphrase(&s.l, "shamir", 6, s.id);
+	if (mode == SLIP0039_MODE_DAEMON) {
+		long int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		if (!daemon_threads) daemon_threads = cpus < 1 ? 1 : cpus;
+		slip0039_daemon(daemon_path, daemon_threads);
+		return 0;
+	}
 
-		/* read Master Secret (MS) and seed */
-		slip0039_add_plaintext(&s, codec);
+	if (mode == SLIP0039_MODE_SEARCH) {
+		long int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		if (!search_threads) search_threads = cpus < 1 ? 1 : cpus;
+		ret = slip0039_search(search_threads);
+		wipestackmemory(STACK_CLEAR_SIZE);
+		return ret;
+	}
 
-		/* encrypt plaintext to EMS */
-		slip0039_encrypt(&s);
+	if (mode == SLIP0039_MODE_CALIBRATE) {
+		ret = slip0039_calibrate(calibrate_budget);
+		wipestackmemory(STACK_CLEAR_SIZE);
+		return ret;
+	}
 
-		init_prng_pbkdf2(&prng, &s, seed, seed_len);
+	/* read passphrase from first line of stdin, verify, reshare and
+	 * refresh do not decrypt, so they do not need a passphrase */
+	if (mode != SLIP0039_MODE_VERIFY && mode != SLIP0039_MODE_RESHARE &&
+			mode != SLIP0039_MODE_REFRESH)
+		read_passphrase(&stdin_input);
 
-		/* calculate all shares */
-		slip0039_split(&s.root, s.n, &prng);
+	if (mode == SLIP0039_MODE_SPLIT) {
+		sbuf_t out;
 
-		slip0039_print_mnemonics(&s);
-	} else {
-		/* read mnemonics from stdin (one per line) */
-		slip0039_add_mnemonics(&s, stdin);
+		check(slip0039_split_init(ctx, &spec));
 
-		/* we now have the ID, this is needed to finish
-		 * initializing lrcipher */
-		lrcipher_finalize_passphrase(&s.l, "shamir", 6, s.id);
+		/* read seed for encoding on second line of stdin */
+		read_seed(&stdin_input);
 
-		/* check if EMS can be recovered from
-		 * these shares */
-		if (!slip0039_quorum(&s.root))
-			FATAL("not enough shares to recover "
-					"the master secret");
+		/* read Master Secret (MS) */
+		read_plaintext(&stdin_input);
 
-		slip0039_recover(&s.root, s.storage_secret, s.n);
+		// we don't expect anymore characters
+		if (input_peek(&stdin_input, "input") != EOF)
+			WARNING("data detected after plaintext on input");
 
-		/* decrypt EMS to MS */
-		slip0039_decrypt(&s);
+		make_mnemonics(&out);
+		fputs(output, stdout);
+	} else if (recover_all) {
+		ret = slip0039_recover_all(&stdin_input);
+	} else {
+		/* read seed for the new shares from first line of stdin */
+		if (mode == SLIP0039_MODE_RESHARE ||
+				mode == SLIP0039_MODE_REFRESH) {
+			char *seed = input_line(&stdin_input,
+					sizeof(ctx->seed), &seed_len, "seed", 0);
+			memcpy(line, seed, seed_len + 1);
+			check_seed(seed_len);
+		}
 
-		slip0039_print_plaintext(&s, codec);
+		/* read mnemonics from stdin (one per line) */
+		do {
+			if ((c = input_getc(&stdin_input, "mnemonic")) == EOF)
+				break;
+			check(slip0039_recover_add_char(ctx, c, &more));
+		} while (more);
+
+		if (mode == SLIP0039_MODE_VERIFY) {
+			/* recover EMS from the shares and check all digests */
+			check(slip0039_verify_finish(ctx));
+
+			printf("valid, %d of %d groups complete, %d needed\n",
+					ctx->s.root.available, ctx->s.root.count,
+					ctx->s.root.threshold);
+		} else if (mode == SLIP0039_MODE_RESHARE) {
+			sbuf_t out;
+
+			/* recover EMS from the shares and split it again */
+			check(slip0039_reshare(ctx, &spec, line, seed_len));
+			wipememory(line, seed_len);
+
+			get_output(&out);
+			check(slip0039_split_mnemonics(ctx, &out));
+			fputs(output, stdout);
+		} else if (mode == SLIP0039_MODE_REFRESH) {
+			sbuf_t out;
+
+			/* add random sharings of zero to the shares */
+			check(slip0039_refresh(ctx, line, seed_len));
+			wipememory(line, seed_len);
+
+			get_output(&out);
+			check(slip0039_split_mnemonics(ctx, &out));
+			fputs(output, stdout);
+		} else {
+			/* recover EMS from the shares and decrypt it to MS */
+			check(slip0039_recover_finish(ctx));
+
+			printf("%s\n", ctx->plaintext);
+		}
 	}
 
 	 wipestackmemory(STACK_CLEAR_SIZE);
+
+	return ret;
 }
@@ -23,12 +23,14 @@
 #include <stddef.h>
 #include "config.h"
 #include "lrcipher.h"
+#include "rs1024.h"
+#include "llist.h"
 
 typedef struct slip0039_set_s {
 	struct slip0039_set_s *parent;
 	struct slip0039_set_s *children[MAX_SHARES];
 	int line_numbers[MAX_SHARES];
-	char names[MAX_SHARES][23];
+	uint16_t names[MAX_SHARES]; // word of the group or member
 
 	/* we allow for an undefined value for the number
 	 * of members, because the total amount of members
@@ -42,11 +44,12 @@ typedef struct slip0039_set_s {
 	uint8_t *secret;     /* index -1 (=(int8_t)255)    */
 	uint8_t *shares[MAX_SHARES]; /* 0 <= index < 16            */
 
-	/* static storage for shares, digest and secret
-	 * this storage can be addressed in the same way
-	 * as the pointers above                           */
-	uint8_t storage_digest[BLOCKS<<1];
-	uint8_t storage_shares[MAX_SHARES][BLOCKS<<1];
+	/* storage for digest and shares, allocated in
+	 * secure memory when the size is known, it can
+	 * be addressed in the same way as the pointers
+	 * above (the secret is stored in the parent)      */
+	uint8_t *storage_digest;
+	uint8_t *storage_shares[MAX_SHARES];
 } slip0039_set_t;
 
 typedef struct slip0039_s {
@@ -57,31 +60,64 @@ typedef struct slip0039_s {
 	slip0039_set_t root, members[MAX_SHARES];
 
 	uint8_t *plaintext;
-	uint8_t storage_secret[BLOCKS<<1], storage_plaintext[BLOCKS<<1];
+	// allocated in secure memory, with room for the largest secret
+	// that the context supports
+	uint8_t *storage_secret, *storage_plaintext;
 
 	// cipher state is initialized with the passphrase
 	lrcipher_t l;
 
 	// the title consists of the first two words (which
-	// should be the same in all mnemonics in the input)
-	// with some formatting, so that the function that
-	// displays this struct can be simplified
-	char title[22]; // first two words
+	// should be the same in all mnemonics in the input),
+	// the words of the title and of the groups and members
+	// are only looked up in the wordlist (which is slow,
+	// because it is done in constant time) when displayed
+	uint16_t title_words[2];
+	char title[22]; // first two words, see slip0039_title()
 } slip0039_t;
 
-typedef char slip0039_mnemonic_t[LINE];
+// state of the parser of mnemonics, the words are stored in input[]
+typedef struct slip0039_parser_s {
+	rs1024_state_t rs;	// checksum of the words so far
+	size_t no_input;	// number of words of the current mnemonic
+	size_t len;		// length of the current word
+	int line_number;
+	uint8_t GI, I;		// group and member index from the header
+	char word[16];		// current word
+	struct slip0039_s *s;	// set to which the current mnemonic belongs
+
+	// if sets is not NULL, the mnemonics are sorted into sets and an
+	// error in a mnemonic is passed to report and the mnemonic is skipped
+	llist_t *sets;
+	void (*report)(void *arg, const char *error);
+	void *report_arg;
+	// with sets, the words of the mnemonics are buffered in batch, so
+	// that their checksums are verified together
+	struct slip0039_batch_s *batch;
+	int errors;		// number of skipped mnemonics
+	char error[160];	// error in the current mnemonic
+	int nomem;		// error is out of secure memory, never skipped
+} slip0039_parser_t;
 
 typedef enum slip0039_mode_e {
 	SLIP0039_MODE_NULL,
 	SLIP0039_MODE_RECOVER,
-	SLIP0039_MODE_SPLIT
+	SLIP0039_MODE_SPLIT,
+	SLIP0039_MODE_VERIFY,
+	SLIP0039_MODE_RESHARE,
+	SLIP0039_MODE_REFRESH,
+	SLIP0039_MODE_SEARCH,
+	SLIP0039_MODE_DAEMON,
+	SLIP0039_MODE_CALIBRATE
 } slip0039_mode_t;
 
 typedef enum slip0039_parse_state_e {
 	SLIP0039_PARSE_STATE_SEED,
 	SLIP0039_PARSE_STATE_EXP,
 	SLIP0039_PARSE_STATE_GT,
-	SLIP0039_PARSE_STATE_XOFY
+	SLIP0039_PARSE_STATE_XOFY,
+	SLIP0039_PARSE_STATE_BATCH,	// expecting the number of threads
+	SLIP0039_PARSE_STATE_DONE	// no more arguments allowed
 } slip0039_parse_state_t;
 
 #endif /* SLIP0039_RS1024_H */
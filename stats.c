@@ -0,0 +1,92 @@
+/* stats.c - phase timing and operation counters
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "stats.h"
+#include "verbose.h"
+
+#ifdef STATS
+
+int stats = 0;
+_Thread_local stats_t stats_local;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static stats_t totals;
+static uint64_t begin;
+
+static const char *phases[STATS_PHASES] = {
+	"passphrase", "parse", "interpolate", "digest", "round0", "round1",
+	"round2", "round3", "codec", "output"
+};
+
+static const char *counters[STATS_COUNTERS] = {
+	"sha256", "sha512", "hmac", "gf256_mul"
+};
+
+uint64_t stats_now() {
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts))
+		FATAL_errno("unable to read monotonic clock");
+
+	return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+void stats_init() {
+	stats = 1;
+	begin = stats_now();
+}
+
+void stats_add(stats_phase_t phase, uint64_t start) {
+	stats_local.calls[phase]++;
+	stats_local.ns[phase] += stats_now() - start;
+}
+
+void stats_merge() {
+	pthread_mutex_lock(&lock);
+	for (int i = 0; i < STATS_COUNTERS; i++)
+		totals.count[i] += stats_local.count[i];
+	for (int i = 0; i < STATS_PHASES; i++) {
+		totals.calls[i] += stats_local.calls[i];
+		totals.ns[i] += stats_local.ns[i];
+	}
+	pthread_mutex_unlock(&lock);
+	memset(&stats_local, 0, sizeof(stats_local));
+}
+
+void stats_report() {
+	if (!stats) return;
+
+	stats_merge();
+	WHINE("stats:total ns=%" PRIu64, stats_now() - begin);
+	for (int i = 0; i < STATS_PHASES; i++)
+		WHINE("stats:%s calls=%" PRIu64 " ns=%" PRIu64, phases[i],
+				totals.calls[i], totals.ns[i]);
+	for (int i = 0; i < STATS_COUNTERS; i++)
+		WHINE("stats:%s count=%" PRIu64, counters[i],
+				totals.count[i]);
+}
+
+#endif /* STATS */
@@ -0,0 +1,88 @@
+/* stats.h - phase timing and operation counters
+ *
+ * Copyright 2020 Rik Snel <rik@snel.it>
+ *
+ * This file is part of slip0039.
+ *
+ * slip0039 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * slip0039 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with slip0039.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SLIP0039_STATS_H
+#define SLIP0039_STATS_H
+#include <stdint.h>
+#include "config.h"
+
+/* with -T, the time spent in each phase and the number of primitive
+ * operations are reported at exit; the counters are thread local and
+ * are added to the totals by stats_merge() when a thread is done */
+
+typedef enum stats_phase_e {
+	STATS_PASSPHRASE,	// reading the passphrase
+	STATS_PARSE,		// looking up words, RS1024, decoding shares
+	STATS_INTERPOLATE,	// lagrange interpolation
+	STATS_DIGEST,		// computing or checking digests
+	STATS_ROUND0,		// the four rounds of lrcipher
+	STATS_ROUND1,
+	STATS_ROUND2,
+	STATS_ROUND3,
+	STATS_CODEC,		// encoding or decoding the plaintext
+	STATS_OUTPUT,		// writing mnemonics
+	STATS_PHASES
+} stats_phase_t;
+
+typedef enum stats_counter_e {
+	STATS_SHA256,		// compressions
+	STATS_SHA512,		// compressions
+	STATS_HMAC,
+	STATS_GF256_MUL,
+	STATS_COUNTERS
+} stats_counter_t;
+
+#ifdef STATS
+
+typedef struct stats_s {
+	uint64_t count[STATS_COUNTERS];
+	uint64_t calls[STATS_PHASES];
+	uint64_t ns[STATS_PHASES];
+} stats_t;
+
+extern int stats;
+extern _Thread_local stats_t stats_local;
+
+#define STATS_COUNT(c) (stats_local.count[c]++)
+#define STATS_START(t) uint64_t t = stats ? stats_now() : 0
+#define STATS_STOP(t, phase) do { if (stats) stats_add(phase, t); } while (0)
+
+// enable reporting, the total time is measured from here
+void stats_init();
+
+uint64_t stats_now();
+
+// account the time since start to phase
+void stats_add(stats_phase_t, uint64_t start);
+
+// add the counters of the calling thread to the totals
+void stats_merge();
+
+// write the totals to stderr, one line per phase or counter
+void stats_report();
+
+#else /* STATS */
+
+#define STATS_COUNT(c) do { } while (0)
+#define STATS_START(t) do { } while (0)
+#define STATS_STOP(t, phase) do { } while (0)
+
+#endif /* STATS */
+
+#endif /* SLIP0039_STATS_H */
@@ -0,0 +1,40 @@
+#!/bin/sh
+# check that search finds the passphrase and that it resumes from a
+# checkpoint at the right candidate, also when sharded
+SEED="gUaRlvJDNiDFTjrJfmghruaDh47Tnm9jZCnTBnFZI5axMqxxry6j3zys1Fz67kgx"
+SECRET="00112233445566778899aabbccddeeff"
+CHECKPOINT=`mktemp`
+TESTS=0
+PASSED=0
+MNEMONICS=`printf "pw7\n$SEED\n$SECRET\n" | ./slip0039 -q split 0 1 1of1`
+CANDIDATES=`seq 0 17 | sed 's/^/pw/'`
+
+# search SHARD CHECKPOINT EXPECTED [ SAVED ]
+search() {
+	TESTS=$(($TESTS+1))
+	rm -f "$CHECKPOINT"
+	[ -n "$2" ] && echo "$1 $2" > "$CHECKPOINT"
+	RESULT=`printf "$MNEMONICS\n\n$CANDIDATES\n" | ./slip0039 -q \
+		search --prefix $SECRET --shard $1 --checkpoint "$CHECKPOINT" \
+		--threads 2 | head -1`
+	if [ "x$RESULT" != "x$3" ]; then
+		echo "Failed search --shard $1 from \"$2\": expected \"$3\"," \
+			"got \"$RESULT\""
+	elif [ -n "$4" ] && [ "`cat $CHECKPOINT`" != "$1 $4" ]; then
+		echo "Failed search --shard $1 from \"$2\": checkpoint" \
+			"\"`cat $CHECKPOINT`\", expected \"$1 $4\""
+	else
+		PASSED=$(($PASSED+1))
+		echo "Passed search --shard $1 from \"$2\""
+	fi
+}
+
+search 1/1 "" pw7
+search 1/1 5 pw7
+search 1/1 10 "" 18
+search 2/2 6 pw7
+search 1/2 6 "" 18
+search 1/1 30 "" 18
+
+rm -f "$CHECKPOINT" "$CHECKPOINT.tmp"
+echo "passed $PASSED/$TESTS search tests"
@@ -29,7 +29,7 @@
 #include "verbose.h"
 #include "cthelp.h"
 
-displayline_t dl;
+_Thread_local displayline_t dl;
 
 int memzero(const uint8_t *a, size_t n) {
 	int or = 0;
@@ -108,20 +108,37 @@ void sbufwordlist_dereference(wordlist_t *w, sbuf_t *s, uint16_t idx) {
 	s->len += wordlist_dereference(w, s->buf + s->len, s->size - s->len, idx);
 }
 
-uint16_t wordlist_search(wordlist_t *w, const char *word, const char **end) {
+// returns the index of the word or -1 if it is not found
+int wordlist_find(wordlist_t *w, const char *word, const char **end) {
 	int match = -1; /* 0xffffffff */
 	*end = NULL;
 
         for (int i = 0; i < w->m.value; i++)
                 match &= i|(-(wordeq(word, w->words[i], end,w->max_word_length != w->min_word_length)));
 
-	if (match == -1) {
-		sbuf_t sbuf = { .buf = dl, .size = sizeof(dl) };
+	return match;
+}
+
+/* returns the index of the word or -1 with the error message in error
+ * (DISPLAYLINE bytes, or NULL) if it is not found, a long word is truncated
+ * in the message */
+int wordlist_search(wordlist_t *w, const char *word, const char **end,
+		char *error) {
+	int match = wordlist_find(w, word, end);
+
+	if (match == -1 && error) {
+		sbuf_t sbuf = { .buf = error, .size = DISPLAYLINE };
+		int i = 0;
 
 		sbufprintf(&sbuf, "word '");
 
-		while (*word != '\0' && *word != ' ' && *word != '\n')
+		while (*word != '\0' && *word != ' ' && *word != '\n') {
+			if (i++ == 64) {
+				sbufprintf(&sbuf, "...");
+				break;
+			}
 			sbufputchar(&sbuf, *word++);
+		}
 
 		if (*w->elt.key == '\0') {
 			sbufprintf(&sbuf, "' not found in the %s wordlist", w->family);
@@ -129,7 +146,6 @@ uint16_t wordlist_search(wordlist_t *w, const char *word, const char **end) {
 			sbufprintf(&sbuf, "' not found in the %s wordlist of language %s", w->family, w->elt.key);
 
 		}
-		FATAL("%s", dl);
 	}
 
 	return match;
@@ -176,27 +192,3 @@ void wipestackmemory(const size_t len) {
 		wipememory(fodder, len);
 }
 
-// read \n delimited string from FILE* and return lenght of string that was read
-// without the terminating \0
-// eof_acceptable means: if we encounter EOF when we try to read the first
-// character of input, we don't complain and return an empty string
-size_t read_stringLF(char *buf, size_t size, FILE *fp, const char *desc, int eof_acceptable) {
-	assert(size > 0);
-	int c;
-	size_t i = 0;
-	while (i < size) {
-		c = fgetc(fp);
-		if (c == EOF) {
-			if (feof(fp)) {
-				if (i == 0 && eof_acceptable) break;
-				else FATAL("EOF encountered before \\n while reading %s", desc);
-			}
-			else FATAL("error %d reading %s: %s", errno, desc, strerror(errno));
-		}
-		if (c == '\n') break;
-		if (i == size - 1) FATAL("buffer full before encountering \\n while reading %s", desc);
-		buf[i++] = c;
-	}
-	buf[i] = '\0';
-	return i;
-}
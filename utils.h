@@ -62,7 +62,7 @@ typedef struct sbuf_s {
 
 typedef char displayline_t[DISPLAYLINE];
 
-extern displayline_t dl;
+extern _Thread_local displayline_t dl;
 
 int wordlist_dereference(wordlist_t*, char *, int, uint16_t);
 
@@ -70,7 +70,9 @@ void sbufwordlist_dereference(wordlist_t*, sbuf_t*, uint16_t);
 
 int wordeq(const char*, const char*, const char**, int);
 
-uint16_t wordlist_search(wordlist_t*, const char*, const char**);
+int wordlist_find(wordlist_t*, const char*, const char**);
+
+int wordlist_search(wordlist_t*, const char*, const char**, char*);
 
 int vsnprintf_strict(char*, size_t, const char*, va_list ap);
 
@@ -84,6 +86,5 @@ int memeq(const uint8_t*, const uint8_t*, size_t);
 
 int memzero(const uint8_t*, size_t);
 
-size_t read_stringLF(char*, size_t, FILE*, const char*, int);
 
 #endif /* SLIP0039_UTILS_H */
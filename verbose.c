@@ -22,10 +22,11 @@
 
 #include "verbose.h"
 
-char *exec_name = NULL;
+char *exec_name = "slip0039";
 int debug = 0;
 //int verbose = 0;
 int quiet = 0;
+_Thread_local verbose_trap_t *verbose_trap = NULL;
 
 void verbose_init(char *argv0) {
 	/* stolen from wget */
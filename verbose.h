@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
+#include <setjmp.h>
 
 /* these macros are for textual user readable output, the first argument
  * to each macro must be a double quoted string, so: VERBOSE(msg); is wrong
@@ -43,8 +44,26 @@ extern int quiet;
 	WHINE(msg, ## __VA_ARGS__); \
 	exit(EXIT_FAILURE); \
 } while (0)
-#define BUG(msg,...)            ABORT("fatal:BUG:" msg, ## __VA_ARGS__)
-#define FATAL(msg,...)            ABORT("fatal:" msg, ## __VA_ARGS__)
+
+/* if a trap is set (by the daemon of slip0039), FATAL stores the message
+ * in the trap and jumps back instead of exiting, the stack below the trap
+ * is not wiped by the functions that are skipped, so whoever sets the trap
+ * must wipe it; BUG always exits, the state of the program is unknown */
+typedef struct verbose_trap_s {
+	jmp_buf env;
+	char message[1024];
+} verbose_trap_t;
+extern _Thread_local verbose_trap_t *verbose_trap;
+#define TRAP(msg,...) do { if (verbose_trap) { \
+	snprintf(verbose_trap->message, sizeof(verbose_trap->message), \
+			msg, ## __VA_ARGS__); \
+	longjmp(verbose_trap->env, 1); \
+} } while (0)
+
+#define BUG(msg,...)            do { \
+	ABORT("fatal:BUG:" msg, ## __VA_ARGS__); } while (0)
+#define FATAL(msg,...)          do { TRAP(msg, ## __VA_ARGS__); \
+	ABORT("fatal:" msg, ## __VA_ARGS__); } while (0)
 #define FATAL_errno(msg,...) \
         FATAL(msg ": %s", ## __VA_ARGS__ , strerror(errno))
 #define ERROR_errno(msg,...) \
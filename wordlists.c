@@ -0,0 +1,28629 @@
+/* This file is autogenerated by wordlists2c.sh, do not edit */
+
+#include "wordlists.h"
+#include "codec.h"
+#include "verbose.h"
+
+wordlist_t *wordlist = &wordlist_base16;
+
+wordlist_t wordlist_slip0039 = {
+	.elt.key = "",
+	.family = "slip0039",
+	.max_word_length = 8,
+	.min_word_length = 4,
+	.words = (char *[]){
+		"academic",
+		"acid",
+		"acne",
+		"acquire",
+		"acrobat",
+		"activity",
+		"actress",
+		"adapt",
+		"adequate",
+		"adjust",
+		"admit",
+		"adorn",
+		"adult",
+		"advance",
+		"advocate",
+		"afraid",
+		"again",
+		"agency",
+		"agree",
+		"aide",
+		"aircraft",
+		"airline",
+		"airport",
+		"ajar",
+		"alarm",
+		"album",
+		"alcohol",
+		"alien",
+		"alive",
+		"alpha",
+		"already",
+		"alto",
+		"aluminum",
+		"always",
+		"amazing",
+		"ambition",
+		"amount",
+		"amuse",
+		"analysis",
+		"anatomy",
+		"ancestor",
+		"ancient",
+		"angel",
+		"angry",
+		"animal",
+		"answer",
+		"antenna",
+		"anxiety",
+		"apart",
+		"aquatic",
+		"arcade",
+		"arena",
+		"argue",
+		"armed",
+		"artist",
+		"artwork",
+		"aspect",
+		"auction",
+		"august",
+		"aunt",
+		"average",
+		"aviation",
+		"avoid",
+		"award",
+		"away",
+		"axis",
+		"axle",
+		"beam",
+		"beard",
+		"beaver",
+		"become",
+		"bedroom",
+		"behavior",
+		"being",
+		"believe",
+		"belong",
+		"benefit",
+		"best",
+		"beyond",
+		"bike",
+		"biology",
+		"birthday",
+		"bishop",
+		"black",
+		"blanket",
+		"blessing",
+		"blimp",
+		"blind",
+		"blue",
+		"body",
+		"bolt",
+		"boring",
+		"born",
+		"both",
+		"boundary",
+		"bracelet",
+		"branch",
+		"brave",
+		"breathe",
+		"briefing",
+		"broken",
+		"brother",
+		"browser",
+		"bucket",
+		"budget",
+		"building",
+		"bulb",
+		"bulge",
+		"bumpy",
+		"bundle",
+		"burden",
+		"burning",
+		"busy",
+		"buyer",
+		"cage",
+		"calcium",
+		"camera",
+		"campus",
+		"canyon",
+		"capacity",
+		"capital",
+		"capture",
+		"carbon",
+		"cards",
+		"careful",
+		"cargo",
+		"carpet",
+		"carve",
+		"category",
+		"cause",
+		"ceiling",
+		"center",
+		"ceramic",
+		"champion",
+		"change",
+		"charity",
+		"check",
+		"chemical",
+		"chest",
+		"chew",
+		"chubby",
+		"cinema",
+		"civil",
+		"class",
+		"clay",
+		"cleanup",
+		"client",
+		"climate",
+		"clinic",
+		"clock",
+		"clogs",
+		"closet",
+		"clothes",
+		"club",
+		"cluster",
+		"coal",
+		"coastal",
+		"coding",
+		"column",
+		"company",
+		"corner",
+		"costume",
+		"counter",
+		"course",
+		"cover",
+		"cowboy",
+		"cradle",
+		"craft",
+		"crazy",
+		"credit",
+		"cricket",
+		"criminal",
+		"crisis",
+		"critical",
+		"crowd",
+		"crucial",
+		"crunch",
+		"crush",
+		"crystal",
+		"cubic",
+		"cultural",
+		"curious",
+		"curly",
+		"custody",
+		"cylinder",
+		"daisy",
+		"damage",
+		"dance",
+		"darkness",
+		"database",
+		"daughter",
+		"deadline",
+		"deal",
+		"debris",
+		"debut",
+		"decent",
+		"decision",
+		"declare",
+		"decorate",
+		"decrease",
+		"deliver",
+		"demand",
+		"density",
+		"deny",
+		"depart",
+		"depend",
+		"depict",
+		"deploy",
+		"describe",
+		"desert",
+		"desire",
+		"desktop",
+		"destroy",
+		"detailed",
+		"detect",
+		"device",
+		"devote",
+		"diagnose",
+		"dictate",
+		"diet",
+		"dilemma",
+		"diminish",
+		"dining",
+		"diploma",
+		"disaster",
+		"discuss",
+		"disease",
+		"dish",
+		"dismiss",
+		"display",
+		"distance",
+		"dive",
+		"divorce",
+		"document",
+		"domain",
+		"domestic",
+		"dominant",
+		"dough",
+		"downtown",
+		"dragon",
+		"dramatic",
+		"dream",
+		"dress",
+		"drift",
+		"drink",
+		"drove",
+		"drug",
+		"dryer",
+		"duckling",
+		"duke",
+		"duration",
+		"dwarf",
+		"dynamic",
+		"early",
+		"earth",
+		"easel",
+		"easy",
+		"echo",
+		"eclipse",
+		"ecology",
+		"edge",
+		"editor",
+		"educate",
+		"either",
+		"elbow",
+		"elder",
+		"election",
+		"elegant",
+		"element",
+		"elephant",
+		"elevator",
+		"elite",
+		"else",
+		"email",
+		"emerald",
+		"emission",
+		"emperor",
+		"emphasis",
+		"employer",
+		"empty",
+		"ending",
+		"endless",
+		"endorse",
+		"enemy",
+		"energy",
+		"enforce",
+		"engage",
+		"enjoy",
+		"enlarge",
+		"entrance",
+		"envelope",
+		"envy",
+		"epidemic",
+		"episode",
+		"equation",
+		"equip",
+		"eraser",
+		"erode",
+		"escape",
+		"estate",
+		"estimate",
+		"evaluate",
+		"evening",
+		"evidence",
+		"evil",
+		"evoke",
+		"exact",
+		"example",
+		"exceed",
+		"exchange",
+		"exclude",
+		"excuse",
+		"execute",
+		"exercise",
+		"exhaust",
+		"exotic",
+		"expand",
+		"expect",
+		"explain",
+		"express",
+		"extend",
+		"extra",
+		"eyebrow",
+		"facility",
+		"fact",
+		"failure",
+		"faint",
+		"fake",
+		"false",
+		"family",
+		"famous",
+		"fancy",
+		"fangs",
+		"fantasy",
+		"fatal",
+		"fatigue",
+		"favorite",
+		"fawn",
+		"fiber",
+		"fiction",
+		"filter",
+		"finance",
+		"findings",
+		"finger",
+		"firefly",
+		"firm",
+		"fiscal",
+		"fishing",
+		"fitness",
+		"flame",
+		"flash",
+		"flavor",
+		"flea",
+		"flexible",
+		"flip",
+		"float",
+		"floral",
+		"fluff",
+		"focus",
+		"forbid",
+		"force",
+		"forecast",
+		"forget",
+		"formal",
+		"fortune",
+		"forward",
+		"founder",
+		"fraction",
+		"fragment",
+		"frequent",
+		"freshman",
+		"friar",
+		"fridge",
+		"friendly",
+		"frost",
+		"froth",
+		"frozen",
+		"fumes",
+		"funding",
+		"furl",
+		"fused",
+		"galaxy",
+		"game",
+		"garbage",
+		"garden",
+		"garlic",
+		"gasoline",
+		"gather",
+		"general",
+		"genius",
+		"genre",
+		"genuine",
+		"geology",
+		"gesture",
+		"glad",
+		"glance",
+		"glasses",
+		"glen",
+		"glimpse",
+		"goat",
+		"golden",
+		"graduate",
+		"grant",
+		"grasp",
+		"gravity",
+		"gray",
+		"greatest",
+		"grief",
+		"grill",
+		"grin",
+		"grocery",
+		"gross",
+		"group",
+		"grownup",
+		"grumpy",
+		"guard",
+		"guest",
+		"guilt",
+		"guitar",
+		"gums",
+		"hairy",
+		"hamster",
+		"hand",
+		"hanger",
+		"harvest",
+		"have",
+		"havoc",
+		"hawk",
+		"hazard",
+		"headset",
+		"health",
+		"hearing",
+		"heat",
+		"helpful",
+		"herald",
+		"herd",
+		"hesitate",
+		"hobo",
+		"holiday",
+		"holy",
+		"home",
+		"hormone",
+		"hospital",
+		"hour",
+		"huge",
+		"human",
+		"humidity",
+		"hunting",
+		"husband",
+		"hush",
+		"husky",
+		"hybrid",
+		"idea",
+		"identify",
+		"idle",
+		"image",
+		"impact",
+		"imply",
+		"improve",
+		"impulse",
+		"include",
+		"income",
+		"increase",
+		"index",
+		"indicate",
+		"industry",
+		"infant",
+		"inform",
+		"inherit",
+		"injury",
+		"inmate",
+		"insect",
+		"inside",
+		"install",
+		"intend",
+		"intimate",
+		"invasion",
+		"involve",
+		"iris",
+		"island",
+		"isolate",
+		"item",
+		"ivory",
+		"jacket",
+		"jerky",
+		"jewelry",
+		"join",
+		"judicial",
+		"juice",
+		"jump",
+		"junction",
+		"junior",
+		"junk",
+		"jury",
+		"justice",
+		"kernel",
+		"keyboard",
+		"kidney",
+		"kind",
+		"kitchen",
+		"knife",
+		"knit",
+		"laden",
+		"ladle",
+		"ladybug",
+		"lair",
+		"lamp",
+		"language",
+		"large",
+		"laser",
+		"laundry",
+		"lawsuit",
+		"leader",
+		"leaf",
+		"learn",
+		"leaves",
+		"lecture",
+		"legal",
+		"legend",
+		"legs",
+		"lend",
+		"length",
+		"level",
+		"liberty",
+		"library",
+		"license",
+		"lift",
+		"likely",
+		"lilac",
+		"lily",
+		"lips",
+		"liquid",
+		"listen",
+		"literary",
+		"living",
+		"lizard",
+		"loan",
+		"lobe",
+		"location",
+		"losing",
+		"loud",
+		"loyalty",
+		"luck",
+		"lunar",
+		"lunch",
+		"lungs",
+		"luxury",
+		"lying",
+		"lyrics",
+		"machine",
+		"magazine",
+		"maiden",
+		"mailman",
+		"main",
+		"makeup",
+		"making",
+		"mama",
+		"manager",
+		"mandate",
+		"mansion",
+		"manual",
+		"marathon",
+		"march",
+		"market",
+		"marvel",
+		"mason",
+		"material",
+		"math",
+		"maximum",
+		"mayor",
+		"meaning",
+		"medal",
+		"medical",
+		"member",
+		"memory",
+		"mental",
+		"merchant",
+		"merit",
+		"method",
+		"metric",
+		"midst",
+		"mild",
+		"military",
+		"mineral",
+		"minister",
+		"miracle",
+		"mixed",
+		"mixture",
+		"mobile",
+		"modern",
+		"modify",
+		"moisture",
+		"moment",
+		"morning",
+		"mortgage",
+		"mother",
+		"mountain",
+		"mouse",
+		"move",
+		"much",
+		"mule",
+		"multiple",
+		"muscle",
+		"museum",
+		"music",
+		"mustang",
+		"nail",
+		"national",
+		"necklace",
+		"negative",
+		"nervous",
+		"network",
+		"news",
+		"nuclear",
+		"numb",
+		"numerous",
+		"nylon",
+		"oasis",
+		"obesity",
+		"object",
+		"observe",
+		"obtain",
+		"ocean",
+		"often",
+		"olympic",
+		"omit",
+		"oral",
+		"orange",
+		"orbit",
+		"order",
+		"ordinary",
+		"organize",
+		"ounce",
+		"oven",
+		"overall",
+		"owner",
+		"paces",
+		"pacific",
+		"package",
+		"paid",
+		"painting",
+		"pajamas",
+		"pancake",
+		"pants",
+		"papa",
+		"paper",
+		"parcel",
+		"parking",
+		"party",
+		"patent",
+		"patrol",
+		"payment",
+		"payroll",
+		"peaceful",
+		"peanut",
+		"peasant",
+		"pecan",
+		"penalty",
+		"pencil",
+		"percent",
+		"perfect",
+		"permit",
+		"petition",
+		"phantom",
+		"pharmacy",
+		"photo",
+		"phrase",
+		"physics",
+		"pickup",
+		"picture",
+		"piece",
+		"pile",
+		"pink",
+		"pipeline",
+		"pistol",
+		"pitch",
+		"plains",
+		"plan",
+		"plastic",
+		"platform",
+		"playoff",
+		"pleasure",
+		"plot",
+		"plunge",
+		"practice",
+		"prayer",
+		"preach",
+		"predator",
+		"pregnant",
+		"premium",
+		"prepare",
+		"presence",
+		"prevent",
+		"priest",
+		"primary",
+		"priority",
+		"prisoner",
+		"privacy",
+		"prize",
+		"problem",
+		"process",
+		"profile",
+		"program",
+		"promise",
+		"prospect",
+		"provide",
+		"prune",
+		"public",
+		"pulse",
+		"pumps",
+		"punish",
+		"puny",
+		"pupal",
+		"purchase",
+		"purple",
+		"python",
+		"quantity",
+		"quarter",
+		"quick",
+		"quiet",
+		"race",
+		"racism",
+		"radar",
+		"railroad",
+		"rainbow",
+		"raisin",
+		"random",
+		"ranked",
+		"rapids",
+		"raspy",
+		"reaction",
+		"realize",
+		"rebound",
+		"rebuild",
+		"recall",
+		"receiver",
+		"recover",
+		"regret",
+		"regular",
+		"reject",
+		"relate",
+		"remember",
+		"remind",
+		"remove",
+		"render",
+		"repair",
+		"repeat",
+		"replace",
+		"require",
+		"rescue",
+		"research",
+		"resident",
+		"response",
+		"result",
+		"retailer",
+		"retreat",
+		"reunion",
+		"revenue",
+		"review",
+		"reward",
+		"rhyme",
+		"rhythm",
+		"rich",
+		"rival",
+		"river",
+		"robin",
+		"rocky",
+		"romantic",
+		"romp",
+		"roster",
+		"round",
+		"royal",
+		"ruin",
+		"ruler",
+		"rumor",
+		"sack",
+		"safari",
+		"salary",
+		"salon",
+		"salt",
+		"satisfy",
+		"satoshi",
+		"saver",
+		"says",
+		"scandal",
+		"scared",
+		"scatter",
+		"scene",
+		"scholar",
+		"science",
+		"scout",
+		"scramble",
+		"screw",
+		"script",
+		"scroll",
+		"seafood",
+		"season",
+		"secret",
+		"security",
+		"segment",
+		"senior",
+		"shadow",
+		"shaft",
+		"shame",
+		"shaped",
+		"sharp",
+		"shelter",
+		"sheriff",
+		"short",
+		"should",
+		"shrimp",
+		"sidewalk",
+		"silent",
+		"silver",
+		"similar",
+		"simple",
+		"single",
+		"sister",
+		"skin",
+		"skunk",
+		"slap",
+		"slavery",
+		"sled",
+		"slice",
+		"slim",
+		"slow",
+		"slush",
+		"smart",
+		"smear",
+		"smell",
+		"smirk",
+		"smith",
+		"smoking",
+		"smug",
+		"snake",
+		"snapshot",
+		"sniff",
+		"society",
+		"software",
+		"soldier",
+		"solution",
+		"soul",
+		"source",
+		"space",
+		"spark",
+		"speak",
+		"species",
+		"spelling",
+		"spend",
+		"spew",
+		"spider",
+		"spill",
+		"spine",
+		"spirit",
+		"spit",
+		"spray",
+		"sprinkle",
+		"square",
+		"squeeze",
+		"stadium",
+		"staff",
+		"standard",
+		"starting",
+		"station",
+		"stay",
+		"steady",
+		"step",
+		"stick",
+		"stilt",
+		"story",
+		"strategy",
+		"strike",
+		"style",
+		"subject",
+		"submit",
+		"sugar",
+		"suitable",
+		"sunlight",
+		"superior",
+		"surface",
+		"surprise",
+		"survive",
+		"sweater",
+		"swimming",
+		"swing",
+		"switch",
+		"symbolic",
+		"sympathy",
+		"syndrome",
+		"system",
+		"tackle",
+		"tactics",
+		"tadpole",
+		"talent",
+		"task",
+		"taste",
+		"taught",
+		"taxi",
+		"teacher",
+		"teammate",
+		"teaspoon",
+		"temple",
+		"tenant",
+		"tendency",
+		"tension",
+		"terminal",
+		"testify",
+		"texture",
+		"thank",
+		"that",
+		"theater",
+		"theory",
+		"therapy",
+		"thorn",
+		"threaten",
+		"thumb",
+		"thunder",
+		"ticket",
+		"tidy",
+		"timber",
+		"timely",
+		"ting",
+		"tofu",
+		"together",
+		"tolerate",
+		"total",
+		"toxic",
+		"tracks",
+		"traffic",
+		"training",
+		"transfer",
+		"trash",
+		"traveler",
+		"treat",
+		"trend",
+		"trial",
+		"tricycle",
+		"trip",
+		"triumph",
+		"trouble",
+		"true",
+		"trust",
+		"twice",
+		"twin",
+		"type",
+		"typical",
+		"ugly",
+		"ultimate",
+		"umbrella",
+		"uncover",
+		"undergo",
+		"unfair",
+		"unfold",
+		"unhappy",
+		"union",
+		"universe",
+		"unkind",
+		"unknown",
+		"unusual",
+		"unwrap",
+		"upgrade",
+		"upstairs",
+		"username",
+		"usher",
+		"usual",
+		"valid",
+		"valuable",
+		"vampire",
+		"vanish",
+		"various",
+		"vegan",
+		"velvet",
+		"venture",
+		"verdict",
+		"verify",
+		"very",
+		"veteran",
+		"vexed",
+		"victim",
+		"video",
+		"view",
+		"vintage",
+		"violence",
+		"viral",
+		"visitor",
+		"visual",
+		"vitamins",
+		"vocal",
+		"voice",
+		"volume",
+		"voter",
+		"voting",
+		"walnut",
+		"warmth",
+		"warn",
+		"watch",
+		"wavy",
+		"wealthy",
+		"weapon",
+		"webcam",
+		"welcome",
+		"welfare",
+		"western",
+		"width",
+		"wildlife",
+		"window",
+		"wine",
+		"wireless",
+		"wisdom",
+		"withdraw",
+		"wits",
+		"wolf",
+		"woman",
+		"work",
+		"worthy",
+		"wrap",
+		"wrist",
+		"writing",
+		"wrote",
+		"year",
+		"yelp",
+		"yield",
+		"yoga",
+		"zero",
+	}
+};
+
+wordlist_t wordlist_bip39_english = {
+	.elt.key = "english",
+	.family = "bip39",
+	.max_word_length = 8,
+	.min_word_length = 3,
+	.words = (char *[]){
+		"abandon",
+		"ability",
+		"able",
+		"about",
+		"above",
+		"absent",
+		"absorb",
+		"abstract",
+		"absurd",
+		"abuse",
+		"access",
+		"accident",
+		"account",
+		"accuse",
+		"achieve",
+		"acid",
+		"acoustic",
+		"acquire",
+		"across",
+		"act",
+		"action",
+		"actor",
+		"actress",
+		"actual",
+		"adapt",
+		"add",
+		"addict",
+		"address",
+		"adjust",
+		"admit",
+		"adult",
+		"advance",
+		"advice",
+		"aerobic",
+		"affair",
+		"afford",
+		"afraid",
+		"again",
+		"age",
+		"agent",
+		"agree",
+		"ahead",
+		"aim",
+		"air",
+		"airport",
+		"aisle",
+		"alarm",
+		"album",
+		"alcohol",
+		"alert",
+		"alien",
+		"all",
+		"alley",
+		"allow",
+		"almost",
+		"alone",
+		"alpha",
+		"already",
+		"also",
+		"alter",
+		"always",
+		"amateur",
+		"amazing",
+		"among",
+		"amount",
+		"amused",
+		"analyst",
+		"anchor",
+		"ancient",
+		"anger",
+		"angle",
+		"angry",
+		"animal",
+		"ankle",
+		"announce",
+		"annual",
+		"another",
+		"answer",
+		"antenna",
+		"antique",
+		"anxiety",
+		"any",
+		"apart",
+		"apology",
+		"appear",
+		"apple",
+		"approve",
+		"april",
+		"arch",
+		"arctic",
+		"area",
+		"arena",
+		"argue",
+		"arm",
+		"armed",
+		"armor",
+		"army",
+		"around",
+		"arrange",
+		"arrest",
+		"arrive",
+		"arrow",
+		"art",
+		"artefact",
+		"artist",
+		"artwork",
+		"ask",
+		"aspect",
+		"assault",
+		"asset",
+		"assist",
+		"assume",
+		"asthma",
+		"athlete",
+		"atom",
+		"attack",
+		"attend",
+		"attitude",
+		"attract",
+		"auction",
+		"audit",
+		"august",
+		"aunt",
+		"author",
+		"auto",
+		"autumn",
+		"average",
+		"avocado",
+		"avoid",
+		"awake",
+		"aware",
+		"away",
+		"awesome",
+		"awful",
+		"awkward",
+		"axis",
+		"baby",
+		"bachelor",
+		"bacon",
+		"badge",
+		"bag",
+		"balance",
+		"balcony",
+		"ball",
+		"bamboo",
+		"banana",
+		"banner",
+		"bar",
+		"barely",
+		"bargain",
+		"barrel",
+		"base",
+		"basic",
+		"basket",
+		"battle",
+		"beach",
+		"bean",
+		"beauty",
+		"because",
+		"become",
+		"beef",
+		"before",
+		"begin",
+		"behave",
+		"behind",
+		"believe",
+		"below",
+		"belt",
+		"bench",
+		"benefit",
+		"best",
+		"betray",
+		"better",
+		"between",
+		"beyond",
+		"bicycle",
+		"bid",
+		"bike",
+		"bind",
+		"biology",
+		"bird",
+		"birth",
+		"bitter",
+		"black",
+		"blade",
+		"blame",
+		"blanket",
+		"blast",
+		"bleak",
+		"bless",
+		"blind",
+		"blood",
+		"blossom",
+		"blouse",
+		"blue",
+		"blur",
+		"blush",
+		"board",
+		"boat",
+		"body",
+		"boil",
+		"bomb",
+		"bone",
+		"bonus",
+		"book",
+		"boost",
+		"border",
+		"boring",
+		"borrow",
+		"boss",
+		"bottom",
+		"bounce",
+		"box",
+		"boy",
+		"bracket",
+		"brain",
+		"brand",
+		"brass",
+		"brave",
+		"bread",
+		"breeze",
+		"brick",
+		"bridge",
+		"brief",
+		"bright",
+		"bring",
+		"brisk",
+		"broccoli",
+		"broken",
+		"bronze",
+		"broom",
+		"brother",
+		"brown",
+		"brush",
+		"bubble",
+		"buddy",
+		"budget",
+		"buffalo",
+		"build",
+		"bulb",
+		"bulk",
+		"bullet",
+		"bundle",
+		"bunker",
+		"burden",
+		"burger",
+		"burst",
+		"bus",
+		"business",
+		"busy",
+		"butter",
+		"buyer",
+		"buzz",
+		"cabbage",
+		"cabin",
+		"cable",
+		"cactus",
+		"cage",
+		"cake",
+		"call",
+		"calm",
+		"camera",
+		"camp",
+		"can",
+		"canal",
+		"cancel",
+		"candy",
+		"cannon",
+		"canoe",
+		"canvas",
+		"canyon",
+		"capable",
+		"capital",
+		"captain",
+		"car",
+		"carbon",
+		"card",
+		"cargo",
+		"carpet",
+		"carry",
+		"cart",
+		"case",
+		"cash",
+		"casino",
+		"castle",
+		"casual",
+		"cat",
+		"catalog",
+		"catch",
+		"category",
+		"cattle",
+		"caught",
+		"cause",
+		"caution",
+		"cave",
+		"ceiling",
+		"celery",
+		"cement",
+		"census",
+		"century",
+		"cereal",
+		"certain",
+		"chair",
+		"chalk",
+		"champion",
+		"change",
+		"chaos",
+		"chapter",
+		"charge",
+		"chase",
+		"chat",
+		"cheap",
+		"check",
+		"cheese",
+		"chef",
+		"cherry",
+		"chest",
+		"chicken",
+		"chief",
+		"child",
+		"chimney",
+		"choice",
+		"choose",
+		"chronic",
+		"chuckle",
+		"chunk",
+		"churn",
+		"cigar",
+		"cinnamon",
+		"circle",
+		"citizen",
+		"city",
+		"civil",
+		"claim",
+		"clap",
+		"clarify",
+		"claw",
+		"clay",
+		"clean",
+		"clerk",
+		"clever",
+		"click",
+		"client",
+		"cliff",
+		"climb",
+		"clinic",
+		"clip",
+		"clock",
+		"clog",
+		"close",
+		"cloth",
+		"cloud",
+		"clown",
+		"club",
+		"clump",
+		"cluster",
+		"clutch",
+		"coach",
+		"coast",
+		"coconut",
+		"code",
+		"coffee",
+		"coil",
+		"coin",
+		"collect",
+		"color",
+		"column",
+		"combine",
+		"come",
+		"comfort",
+		"comic",
+		"common",
+		"company",
+		"concert",
+		"conduct",
+		"confirm",
+		"congress",
+		"connect",
+		"consider",
+		"control",
+		"convince",
+		"cook",
+		"cool",
+		"copper",
+		"copy",
+		"coral",
+		"core",
+		"corn",
+		"correct",
+		"cost",
+		"cotton",
+		"couch",
+		"country",
+		"couple",
+		"course",
+		"cousin",
+		"cover",
+		"coyote",
+		"crack",
+		"cradle",
+		"craft",
+		"cram",
+		"crane",
+		"crash",
+		"crater",
+		"crawl",
+		"crazy",
+		"cream",
+		"credit",
+		"creek",
+		"crew",
+		"cricket",
+		"crime",
+		"crisp",
+		"critic",
+		"crop",
+		"cross",
+		"crouch",
+		"crowd",
+		"crucial",
+		"cruel",
+		"cruise",
+		"crumble",
+		"crunch",
+		"crush",
+		"cry",
+		"crystal",
+		"cube",
+		"culture",
+		"cup",
+		"cupboard",
+		"curious",
+		"current",
+		"curtain",
+		"curve",
+		"cushion",
+		"custom",
+		"cute",
+		"cycle",
+		"dad",
+		"damage",
+		"damp",
+		"dance",
+		"danger",
+		"daring",
+		"dash",
+		"daughter",
+		"dawn",
+		"day",
+		"deal",
+		"debate",
+		"debris",
+		"decade",
+		"december",
+		"decide",
+		"decline",
+		"decorate",
+		"decrease",
+		"deer",
+		"defense",
+		"define",
+		"defy",
+		"degree",
+		"delay",
+		"deliver",
+		"demand",
+		"demise",
+		"denial",
+		"dentist",
+		"deny",
+		"depart",
+		"depend",
+		"deposit",
+		"depth",
+		"deputy",
+		"derive",
+		"describe",
+		"desert",
+		"design",
+		"desk",
+		"despair",
+		"destroy",
+		"detail",
+		"detect",
+		"develop",
+		"device",
+		"devote",
+		"diagram",
+		"dial",
+		"diamond",
+		"diary",
+		"dice",
+		"diesel",
+		"diet",
+		"differ",
+		"digital",
+		"dignity",
+		"dilemma",
+		"dinner",
+		"dinosaur",
+		"direct",
+		"dirt",
+		"disagree",
+		"discover",
+		"disease",
+		"dish",
+		"dismiss",
+		"disorder",
+		"display",
+		"distance",
+		"divert",
+		"divide",
+		"divorce",
+		"dizzy",
+		"doctor",
+		"document",
+		"dog",
+		"doll",
+		"dolphin",
+		"domain",
+		"donate",
+		"donkey",
+		"donor",
+		"door",
+		"dose",
+		"double",
+		"dove",
+		"draft",
+		"dragon",
+		"drama",
+		"drastic",
+		"draw",
+		"dream",
+		"dress",
+		"drift",
+		"drill",
+		"drink",
+		"drip",
+		"drive",
+		"drop",
+		"drum",
+		"dry",
+		"duck",
+		"dumb",
+		"dune",
+		"during",
+		"dust",
+		"dutch",
+		"duty",
+		"dwarf",
+		"dynamic",
+		"eager",
+		"eagle",
+		"early",
+		"earn",
+		"earth",
+		"easily",
+		"east",
+		"easy",
+		"echo",
+		"ecology",
+		"economy",
+		"edge",
+		"edit",
+		"educate",
+		"effort",
+		"egg",
+		"eight",
+		"either",
+		"elbow",
+		"elder",
+		"electric",
+		"elegant",
+		"element",
+		"elephant",
+		"elevator",
+		"elite",
+		"else",
+		"embark",
+		"embody",
+		"embrace",
+		"emerge",
+		"emotion",
+		"employ",
+		"empower",
+		"empty",
+		"enable",
+		"enact",
+		"end",
+		"endless",
+		"endorse",
+		"enemy",
+		"energy",
+		"enforce",
+		"engage",
+		"engine",
+		"enhance",
+		"enjoy",
+		"enlist",
+		"enough",
+		"enrich",
+		"enroll",
+		"ensure",
+		"enter",
+		"entire",
+		"entry",
+		"envelope",
+		"episode",
+		"equal",
+		"equip",
+		"era",
+		"erase",
+		"erode",
+		"erosion",
+		"error",
+		"erupt",
+		"escape",
+		"essay",
+		"essence",
+		"estate",
+		"eternal",
+		"ethics",
+		"evidence",
+		"evil",
+		"evoke",
+		"evolve",
+		"exact",
+		"example",
+		"excess",
+		"exchange",
+		"excite",
+		"exclude",
+		"excuse",
+		"execute",
+		"exercise",
+		"exhaust",
+		"exhibit",
+		"exile",
+		"exist",
+		"exit",
+		"exotic",
+		"expand",
+		"expect",
+		"expire",
+		"explain",
+		"expose",
+		"express",
+		"extend",
+		"extra",
+		"eye",
+		"eyebrow",
+		"fabric",
+		"face",
+		"faculty",
+		"fade",
+		"faint",
+		"faith",
+		"fall",
+		"false",
+		"fame",
+		"family",
+		"famous",
+		"fan",
+		"fancy",
+		"fantasy",
+		"farm",
+		"fashion",
+		"fat",
+		"fatal",
+		"father",
+		"fatigue",
+		"fault",
+		"favorite",
+		"feature",
+		"february",
+		"federal",
+		"fee",
+		"feed",
+		"feel",
+		"female",
+		"fence",
+		"festival",
+		"fetch",
+		"fever",
+		"few",
+		"fiber",
+		"fiction",
+		"field",
+		"figure",
+		"file",
+		"film",
+		"filter",
+		"final",
+		"find",
+		"fine",
+		"finger",
+		"finish",
+		"fire",
+		"firm",
+		"first",
+		"fiscal",
+		"fish",
+		"fit",
+		"fitness",
+		"fix",
+		"flag",
+		"flame",
+		"flash",
+		"flat",
+		"flavor",
+		"flee",
+		"flight",
+		"flip",
+		"float",
+		"flock",
+		"floor",
+		"flower",
+		"fluid",
+		"flush",
+		"fly",
+		"foam",
+		"focus",
+		"fog",
+		"foil",
+		"fold",
+		"follow",
+		"food",
+		"foot",
+		"force",
+		"forest",
+		"forget",
+		"fork",
+		"fortune",
+		"forum",
+		"forward",
+		"fossil",
+		"foster",
+		"found",
+		"fox",
+		"fragile",
+		"frame",
+		"frequent",
+		"fresh",
+		"friend",
+		"fringe",
+		"frog",
+		"front",
+		"frost",
+		"frown",
+		"frozen",
+		"fruit",
+		"fuel",
+		"fun",
+		"funny",
+		"furnace",
+		"fury",
+		"future",
+		"gadget",
+		"gain",
+		"galaxy",
+		"gallery",
+		"game",
+		"gap",
+		"garage",
+		"garbage",
+		"garden",
+		"garlic",
+		"garment",
+		"gas",
+		"gasp",
+		"gate",
+		"gather",
+		"gauge",
+		"gaze",
+		"general",
+		"genius",
+		"genre",
+		"gentle",
+		"genuine",
+		"gesture",
+		"ghost",
+		"giant",
+		"gift",
+		"giggle",
+		"ginger",
+		"giraffe",
+		"girl",
+		"give",
+		"glad",
+		"glance",
+		"glare",
+		"glass",
+		"glide",
+		"glimpse",
+		"globe",
+		"gloom",
+		"glory",
+		"glove",
+		"glow",
+		"glue",
+		"goat",
+		"goddess",
+		"gold",
+		"good",
+		"goose",
+		"gorilla",
+		"gospel",
+		"gossip",
+		"govern",
+		"gown",
+		"grab",
+		"grace",
+		"grain",
+		"grant",
+		"grape",
+		"grass",
+		"gravity",
+		"great",
+		"green",
+		"grid",
+		"grief",
+		"grit",
+		"grocery",
+		"group",
+		"grow",
+		"grunt",
+		"guard",
+		"guess",
+		"guide",
+		"guilt",
+		"guitar",
+		"gun",
+		"gym",
+		"habit",
+		"hair",
+		"half",
+		"hammer",
+		"hamster",
+		"hand",
+		"happy",
+		"harbor",
+		"hard",
+		"harsh",
+		"harvest",
+		"hat",
+		"have",
+		"hawk",
+		"hazard",
+		"head",
+		"health",
+		"heart",
+		"heavy",
+		"hedgehog",
+		"height",
+		"hello",
+		"helmet",
+		"help",
+		"hen",
+		"hero",
+		"hidden",
+		"high",
+		"hill",
+		"hint",
+		"hip",
+		"hire",
+		"history",
+		"hobby",
+		"hockey",
+		"hold",
+		"hole",
+		"holiday",
+		"hollow",
+		"home",
+		"honey",
+		"hood",
+		"hope",
+		"horn",
+		"horror",
+		"horse",
+		"hospital",
+		"host",
+		"hotel",
+		"hour",
+		"hover",
+		"hub",
+		"huge",
+		"human",
+		"humble",
+		"humor",
+		"hundred",
+		"hungry",
+		"hunt",
+		"hurdle",
+		"hurry",
+		"hurt",
+		"husband",
+		"hybrid",
+		"ice",
+		"icon",
+		"idea",
+		"identify",
+		"idle",
+		"ignore",
+		"ill",
+		"illegal",
+		"illness",
+		"image",
+		"imitate",
+		"immense",
+		"immune",
+		"impact",
+		"impose",
+		"improve",
+		"impulse",
+		"inch",
+		"include",
+		"income",
+		"increase",
+		"index",
+		"indicate",
+		"indoor",
+		"industry",
+		"infant",
+		"inflict",
+		"inform",
+		"inhale",
+		"inherit",
+		"initial",
+		"inject",
+		"injury",
+		"inmate",
+		"inner",
+		"innocent",
+		"input",
+		"inquiry",
+		"insane",
+		"insect",
+		"inside",
+		"inspire",
+		"install",
+		"intact",
+		"interest",
+		"into",
+		"invest",
+		"invite",
+		"involve",
+		"iron",
+		"island",
+		"isolate",
+		"issue",
+		"item",
+		"ivory",
+		"jacket",
+		"jaguar",
+		"jar",
+		"jazz",
+		"jealous",
+		"jeans",
+		"jelly",
+		"jewel",
+		"job",
+		"join",
+		"joke",
+		"journey",
+		"joy",
+		"judge",
+		"juice",
+		"jump",
+		"jungle",
+		"junior",
+		"junk",
+		"just",
+		"kangaroo",
+		"keen",
+		"keep",
+		"ketchup",
+		"key",
+		"kick",
+		"kid",
+		"kidney",
+		"kind",
+		"kingdom",
+		"kiss",
+		"kit",
+		"kitchen",
+		"kite",
+		"kitten",
+		"kiwi",
+		"knee",
+		"knife",
+		"knock",
+		"know",
+		"lab",
+		"label",
+		"labor",
+		"ladder",
+		"lady",
+		"lake",
+		"lamp",
+		"language",
+		"laptop",
+		"large",
+		"later",
+		"latin",
+		"laugh",
+		"laundry",
+		"lava",
+		"law",
+		"lawn",
+		"lawsuit",
+		"layer",
+		"lazy",
+		"leader",
+		"leaf",
+		"learn",
+		"leave",
+		"lecture",
+		"left",
+		"leg",
+		"legal",
+		"legend",
+		"leisure",
+		"lemon",
+		"lend",
+		"length",
+		"lens",
+		"leopard",
+		"lesson",
+		"letter",
+		"level",
+		"liar",
+		"liberty",
+		"library",
+		"license",
+		"life",
+		"lift",
+		"light",
+		"like",
+		"limb",
+		"limit",
+		"link",
+		"lion",
+		"liquid",
+		"list",
+		"little",
+		"live",
+		"lizard",
+		"load",
+		"loan",
+		"lobster",
+		"local",
+		"lock",
+		"logic",
+		"lonely",
+		"long",
+		"loop",
+		"lottery",
+		"loud",
+		"lounge",
+		"love",
+		"loyal",
+		"lucky",
+		"luggage",
+		"lumber",
+		"lunar",
+		"lunch",
+		"luxury",
+		"lyrics",
+		"machine",
+		"mad",
+		"magic",
+		"magnet",
+		"maid",
+		"mail",
+		"main",
+		"major",
+		"make",
+		"mammal",
+		"man",
+		"manage",
+		"mandate",
+		"mango",
+		"mansion",
+		"manual",
+		"maple",
+		"marble",
+		"march",
+		"margin",
+		"marine",
+		"market",
+		"marriage",
+		"mask",
+		"mass",
+		"master",
+		"match",
+		"material",
+		"math",
+		"matrix",
+		"matter",
+		"maximum",
+		"maze",
+		"meadow",
+		"mean",
+		"measure",
+		"meat",
+		"mechanic",
+		"medal",
+		"media",
+		"melody",
+		"melt",
+		"member",
+		"memory",
+		"mention",
+		"menu",
+		"mercy",
+		"merge",
+		"merit",
+		"merry",
+		"mesh",
+		"message",
+		"metal",
+		"method",
+		"middle",
+		"midnight",
+		"milk",
+		"million",
+		"mimic",
+		"mind",
+		"minimum",
+		"minor",
+		"minute",
+		"miracle",
+		"mirror",
+		"misery",
+		"miss",
+		"mistake",
+		"mix",
+		"mixed",
+		"mixture",
+		"mobile",
+		"model",
+		"modify",
+		"mom",
+		"moment",
+		"monitor",
+		"monkey",
+		"monster",
+		"month",
+		"moon",
+		"moral",
+		"more",
+		"morning",
+		"mosquito",
+		"mother",
+		"motion",
+		"motor",
+		"mountain",
+		"mouse",
+		"move",
+		"movie",
+		"much",
+		"muffin",
+		"mule",
+		"multiply",
+		"muscle",
+		"museum",
+		"mushroom",
+		"music",
+		"must",
+		"mutual",
+		"myself",
+		"mystery",
+		"myth",
+		"naive",
+		"name",
+		"napkin",
+		"narrow",
+		"nasty",
+		"nation",
+		"nature",
+		"near",
+		"neck",
+		"need",
+		"negative",
+		"neglect",
+		"neither",
+		"nephew",
+		"nerve",
+		"nest",
+		"net",
+		"network",
+		"neutral",
+		"never",
+		"news",
+		"next",
+		"nice",
+		"night",
+		"noble",
+		"noise",
+		"nominee",
+		"noodle",
+		"normal",
+		"north",
+		"nose",
+		"notable",
+		"note",
+		"nothing",
+		"notice",
+		"novel",
+		"now",
+		"nuclear",
+		"number",
+		"nurse",
+		"nut",
+		"oak",
+		"obey",
+		"object",
+		"oblige",
+		"obscure",
+		"observe",
+		"obtain",
+		"obvious",
+		"occur",
+		"ocean",
+		"october",
+		"odor",
+		"off",
+		"offer",
+		"office",
+		"often",
+		"oil",
+		"okay",
+		"old",
+		"olive",
+		"olympic",
+		"omit",
+		"once",
+		"one",
+		"onion",
+		"online",
+		"only",
+		"open",
+		"opera",
+		"opinion",
+		"oppose",
+		"option",
+		"orange",
+		"orbit",
+		"orchard",
+		"order",
+		"ordinary",
+		"organ",
+		"orient",
+		"original",
+		"orphan",
+		"ostrich",
+		"other",
+		"outdoor",
+		"outer",
+		"output",
+		"outside",
+		"oval",
+		"oven",
+		"over",
+		"own",
+		"owner",
+		"oxygen",
+		"oyster",
+		"ozone",
+		"pact",
+		"paddle",
+		"page",
+		"pair",
+		"palace",
+		"palm",
+		"panda",
+		"panel",
+		"panic",
+		"panther",
+		"paper",
+		"parade",
+		"parent",
+		"park",
+		"parrot",
+		"party",
+		"pass",
+		"patch",
+		"path",
+		"patient",
+		"patrol",
+		"pattern",
+		"pause",
+		"pave",
+		"payment",
+		"peace",
+		"peanut",
+		"pear",
+		"peasant",
+		"pelican",
+		"pen",
+		"penalty",
+		"pencil",
+		"people",
+		"pepper",
+		"perfect",
+		"permit",
+		"person",
+		"pet",
+		"phone",
+		"photo",
+		"phrase",
+		"physical",
+		"piano",
+		"picnic",
+		"picture",
+		"piece",
+		"pig",
+		"pigeon",
+		"pill",
+		"pilot",
+		"pink",
+		"pioneer",
+		"pipe",
+		"pistol",
+		"pitch",
+		"pizza",
+		"place",
+		"planet",
+		"plastic",
+		"plate",
+		"play",
+		"please",
+		"pledge",
+		"pluck",
+		"plug",
+		"plunge",
+		"poem",
+		"poet",
+		"point",
+		"polar",
+		"pole",
+		"police",
+		"pond",
+		"pony",
+		"pool",
+		"popular",
+		"portion",
+		"position",
+		"possible",
+		"post",
+		"potato",
+		"pottery",
+		"poverty",
+		"powder",
+		"power",
+		"practice",
+		"praise",
+		"predict",
+		"prefer",
+		"prepare",
+		"present",
+		"pretty",
+		"prevent",
+		"price",
+		"pride",
+		"primary",
+		"print",
+		"priority",
+		"prison",
+		"private",
+		"prize",
+		"problem",
+		"process",
+		"produce",
+		"profit",
+		"program",
+		"project",
+		"promote",
+		"proof",
+		"property",
+		"prosper",
+		"protect",
+		"proud",
+		"provide",
+		"public",
+		"pudding",
+		"pull",
+		"pulp",
+		"pulse",
+		"pumpkin",
+		"punch",
+		"pupil",
+		"puppy",
+		"purchase",
+		"purity",
+		"purpose",
+		"purse",
+		"push",
+		"put",
+		"puzzle",
+		"pyramid",
+		"quality",
+		"quantum",
+		"quarter",
+		"question",
+		"quick",
+		"quit",
+		"quiz",
+		"quote",
+		"rabbit",
+		"raccoon",
+		"race",
+		"rack",
+		"radar",
+		"radio",
+		"rail",
+		"rain",
+		"raise",
+		"rally",
+		"ramp",
+		"ranch",
+		"random",
+		"range",
+		"rapid",
+		"rare",
+		"rate",
+		"rather",
+		"raven",
+		"raw",
+		"razor",
+		"ready",
+		"real",
+		"reason",
+		"rebel",
+		"rebuild",
+		"recall",
+		"receive",
+		"recipe",
+		"record",
+		"recycle",
+		"reduce",
+		"reflect",
+		"reform",
+		"refuse",
+		"region",
+		"regret",
+		"regular",
+		"reject",
+		"relax",
+		"release",
+		"relief",
+		"rely",
+		"remain",
+		"remember",
+		"remind",
+		"remove",
+		"render",
+		"renew",
+		"rent",
+		"reopen",
+		"repair",
+		"repeat",
+		"replace",
+		"report",
+		"require",
+		"rescue",
+		"resemble",
+		"resist",
+		"resource",
+		"response",
+		"result",
+		"retire",
+		"retreat",
+		"return",
+		"reunion",
+		"reveal",
+		"review",
+		"reward",
+		"rhythm",
+		"rib",
+		"ribbon",
+		"rice",
+		"rich",
+		"ride",
+		"ridge",
+		"rifle",
+		"right",
+		"rigid",
+		"ring",
+		"riot",
+		"ripple",
+		"risk",
+		"ritual",
+		"rival",
+		"river",
+		"road",
+		"roast",
+		"robot",
+		"robust",
+		"rocket",
+		"romance",
+		"roof",
+		"rookie",
+		"room",
+		"rose",
+		"rotate",
+		"rough",
+		"round",
+		"route",
+		"royal",
+		"rubber",
+		"rude",
+		"rug",
+		"rule",
+		"run",
+		"runway",
+		"rural",
+		"sad",
+		"saddle",
+		"sadness",
+		"safe",
+		"sail",
+		"salad",
+		"salmon",
+		"salon",
+		"salt",
+		"salute",
+		"same",
+		"sample",
+		"sand",
+		"satisfy",
+		"satoshi",
+		"sauce",
+		"sausage",
+		"save",
+		"say",
+		"scale",
+		"scan",
+		"scare",
+		"scatter",
+		"scene",
+		"scheme",
+		"school",
+		"science",
+		"scissors",
+		"scorpion",
+		"scout",
+		"scrap",
+		"screen",
+		"script",
+		"scrub",
+		"sea",
+		"search",
+		"season",
+		"seat",
+		"second",
+		"secret",
+		"section",
+		"security",
+		"seed",
+		"seek",
+		"segment",
+		"select",
+		"sell",
+		"seminar",
+		"senior",
+		"sense",
+		"sentence",
+		"series",
+		"service",
+		"session",
+		"settle",
+		"setup",
+		"seven",
+		"shadow",
+		"shaft",
+		"shallow",
+		"share",
+		"shed",
+		"shell",
+		"sheriff",
+		"shield",
+		"shift",
+		"shine",
+		"ship",
+		"shiver",
+		"shock",
+		"shoe",
+		"shoot",
+		"shop",
+		"short",
+		"shoulder",
+		"shove",
+		"shrimp",
+		"shrug",
+		"shuffle",
+		"shy",
+		"sibling",
+		"sick",
+		"side",
+		"siege",
+		"sight",
+		"sign",
+		"silent",
+		"silk",
+		"silly",
+		"silver",
+		"similar",
+		"simple",
+		"since",
+		"sing",
+		"siren",
+		"sister",
+		"situate",
+		"six",
+		"size",
+		"skate",
+		"sketch",
+		"ski",
+		"skill",
+		"skin",
+		"skirt",
+		"skull",
+		"slab",
+		"slam",
+		"sleep",
+		"slender",
+		"slice",
+		"slide",
+		"slight",
+		"slim",
+		"slogan",
+		"slot",
+		"slow",
+		"slush",
+		"small",
+		"smart",
+		"smile",
+		"smoke",
+		"smooth",
+		"snack",
+		"snake",
+		"snap",
+		"sniff",
+		"snow",
+		"soap",
+		"soccer",
+		"social",
+		"sock",
+		"soda",
+		"soft",
+		"solar",
+		"soldier",
+		"solid",
+		"solution",
+		"solve",
+		"someone",
+		"song",
+		"soon",
+		"sorry",
+		"sort",
+		"soul",
+		"sound",
+		"soup",
+		"source",
+		"south",
+		"space",
+		"spare",
+		"spatial",
+		"spawn",
+		"speak",
+		"special",
+		"speed",
+		"spell",
+		"spend",
+		"sphere",
+		"spice",
+		"spider",
+		"spike",
+		"spin",
+		"spirit",
+		"split",
+		"spoil",
+		"sponsor",
+		"spoon",
+		"sport",
+		"spot",
+		"spray",
+		"spread",
+		"spring",
+		"spy",
+		"square",
+		"squeeze",
+		"squirrel",
+		"stable",
+		"stadium",
+		"staff",
+		"stage",
+		"stairs",
+		"stamp",
+		"stand",
+		"start",
+		"state",
+		"stay",
+		"steak",
+		"steel",
+		"stem",
+		"step",
+		"stereo",
+		"stick",
+		"still",
+		"sting",
+		"stock",
+		"stomach",
+		"stone",
+		"stool",
+		"story",
+		"stove",
+		"strategy",
+		"street",
+		"strike",
+		"strong",
+		"struggle",
+		"student",
+		"stuff",
+		"stumble",
+		"style",
+		"subject",
+		"submit",
+		"subway",
+		"success",
+		"such",
+		"sudden",
+		"suffer",
+		"sugar",
+		"suggest",
+		"suit",
+		"summer",
+		"sun",
+		"sunny",
+		"sunset",
+		"super",
+		"supply",
+		"supreme",
+		"sure",
+		"surface",
+		"surge",
+		"surprise",
+		"surround",
+		"survey",
+		"suspect",
+		"sustain",
+		"swallow",
+		"swamp",
+		"swap",
+		"swarm",
+		"swear",
+		"sweet",
+		"swift",
+		"swim",
+		"swing",
+		"switch",
+		"sword",
+		"symbol",
+		"symptom",
+		"syrup",
+		"system",
+		"table",
+		"tackle",
+		"tag",
+		"tail",
+		"talent",
+		"talk",
+		"tank",
+		"tape",
+		"target",
+		"task",
+		"taste",
+		"tattoo",
+		"taxi",
+		"teach",
+		"team",
+		"tell",
+		"ten",
+		"tenant",
+		"tennis",
+		"tent",
+		"term",
+		"test",
+		"text",
+		"thank",
+		"that",
+		"theme",
+		"then",
+		"theory",
+		"there",
+		"they",
+		"thing",
+		"this",
+		"thought",
+		"three",
+		"thrive",
+		"throw",
+		"thumb",
+		"thunder",
+		"ticket",
+		"tide",
+		"tiger",
+		"tilt",
+		"timber",
+		"time",
+		"tiny",
+		"tip",
+		"tired",
+		"tissue",
+		"title",
+		"toast",
+		"tobacco",
+		"today",
+		"toddler",
+		"toe",
+		"together",
+		"toilet",
+		"token",
+		"tomato",
+		"tomorrow",
+		"tone",
+		"tongue",
+		"tonight",
+		"tool",
+		"tooth",
+		"top",
+		"topic",
+		"topple",
+		"torch",
+		"tornado",
+		"tortoise",
+		"toss",
+		"total",
+		"tourist",
+		"toward",
+		"tower",
+		"town",
+		"toy",
+		"track",
+		"trade",
+		"traffic",
+		"tragic",
+		"train",
+		"transfer",
+		"trap",
+		"trash",
+		"travel",
+		"tray",
+		"treat",
+		"tree",
+		"trend",
+		"trial",
+		"tribe",
+		"trick",
+		"trigger",
+		"trim",
+		"trip",
+		"trophy",
+		"trouble",
+		"truck",
+		"true",
+		"truly",
+		"trumpet",
+		"trust",
+		"truth",
+		"try",
+		"tube",
+		"tuition",
+		"tumble",
+		"tuna",
+		"tunnel",
+		"turkey",
+		"turn",
+		"turtle",
+		"twelve",
+		"twenty",
+		"twice",
+		"twin",
+		"twist",
+		"two",
+		"type",
+		"typical",
+		"ugly",
+		"umbrella",
+		"unable",
+		"unaware",
+		"uncle",
+		"uncover",
+		"under",
+		"undo",
+		"unfair",
+		"unfold",
+		"unhappy",
+		"uniform",
+		"unique",
+		"unit",
+		"universe",
+		"unknown",
+		"unlock",
+		"until",
+		"unusual",
+		"unveil",
+		"update",
+		"upgrade",
+		"uphold",
+		"upon",
+		"upper",
+		"upset",
+		"urban",
+		"urge",
+		"usage",
+		"use",
+		"used",
+		"useful",
+		"useless",
+		"usual",
+		"utility",
+		"vacant",
+		"vacuum",
+		"vague",
+		"valid",
+		"valley",
+		"valve",
+		"van",
+		"vanish",
+		"vapor",
+		"various",
+		"vast",
+		"vault",
+		"vehicle",
+		"velvet",
+		"vendor",
+		"venture",
+		"venue",
+		"verb",
+		"verify",
+		"version",
+		"very",
+		"vessel",
+		"veteran",
+		"viable",
+		"vibrant",
+		"vicious",
+		"victory",
+		"video",
+		"view",
+		"village",
+		"vintage",
+		"violin",
+		"virtual",
+		"virus",
+		"visa",
+		"visit",
+		"visual",
+		"vital",
+		"vivid",
+		"vocal",
+		"voice",
+		"void",
+		"volcano",
+		"volume",
+		"vote",
+		"voyage",
+		"wage",
+		"wagon",
+		"wait",
+		"walk",
+		"wall",
+		"walnut",
+		"want",
+		"warfare",
+		"warm",
+		"warrior",
+		"wash",
+		"wasp",
+		"waste",
+		"water",
+		"wave",
+		"way",
+		"wealth",
+		"weapon",
+		"wear",
+		"weasel",
+		"weather",
+		"web",
+		"wedding",
+		"weekend",
+		"weird",
+		"welcome",
+		"west",
+		"wet",
+		"whale",
+		"what",
+		"wheat",
+		"wheel",
+		"when",
+		"where",
+		"whip",
+		"whisper",
+		"wide",
+		"width",
+		"wife",
+		"wild",
+		"will",
+		"win",
+		"window",
+		"wine",
+		"wing",
+		"wink",
+		"winner",
+		"winter",
+		"wire",
+		"wisdom",
+		"wise",
+		"wish",
+		"witness",
+		"wolf",
+		"woman",
+		"wonder",
+		"wood",
+		"wool",
+		"word",
+		"work",
+		"world",
+		"worry",
+		"worth",
+		"wrap",
+		"wreck",
+		"wrestle",
+		"wrist",
+		"write",
+		"wrong",
+		"yard",
+		"year",
+		"yellow",
+		"you",
+		"young",
+		"youth",
+		"zebra",
+		"zero",
+		"zone",
+		"zoo",
+	}
+};
+
+wordlist_t wordlist_bip39_spanish = {
+	.elt.key = "spanish",
+	.family = "bip39",
+	.max_word_length = 10,
+	.min_word_length = 3,
+	.words = (char *[]){
+		"ábaco",
+		"abdomen",
+		"abeja",
+		"abierto",
+		"abogado",
+		"abono",
+		"aborto",
+		"abrazo",
+		"abrir",
+		"abuelo",
+		"abuso",
+		"acabar",
+		"academia",
+		"acceso",
+		"acción",
+		"aceite",
+		"acelga",
+		"acento",
+		"aceptar",
+		"ácido",
+		"aclarar",
+		"acné",
+		"acoger",
+		"acoso",
+		"activo",
+		"acto",
+		"actriz",
+		"actuar",
+		"acudir",
+		"acuerdo",
+		"acusar",
+		"adicto",
+		"admitir",
+		"adoptar",
+		"adorno",
+		"aduana",
+		"adulto",
+		"aéreo",
+		"afectar",
+		"afición",
+		"afinar",
+		"afirmar",
+		"ágil",
+		"agitar",
+		"agonía",
+		"agosto",
+		"agotar",
+		"agregar",
+		"agrio",
+		"agua",
+		"agudo",
+		"águila",
+		"aguja",
+		"ahogo",
+		"ahorro",
+		"aire",
+		"aislar",
+		"ajedrez",
+		"ajeno",
+		"ajuste",
+		"alacrán",
+		"alambre",
+		"alarma",
+		"alba",
+		"álbum",
+		"alcalde",
+		"aldea",
+		"alegre",
+		"alejar",
+		"alerta",
+		"aleta",
+		"alfiler",
+		"alga",
+		"algodón",
+		"aliado",
+		"aliento",
+		"alivio",
+		"alma",
+		"almeja",
+		"almíbar",
+		"altar",
+		"alteza",
+		"altivo",
+		"alto",
+		"altura",
+		"alumno",
+		"alzar",
+		"amable",
+		"amante",
+		"amapola",
+		"amargo",
+		"amasar",
+		"ámbar",
+		"ámbito",
+		"ameno",
+		"amigo",
+		"amistad",
+		"amor",
+		"amparo",
+		"amplio",
+		"ancho",
+		"anciano",
+		"ancla",
+		"andar",
+		"andén",
+		"anemia",
+		"ángulo",
+		"anillo",
+		"ánimo",
+		"anís",
+		"anotar",
+		"antena",
+		"antiguo",
+		"antojo",
+		"anual",
+		"anular",
+		"anuncio",
+		"añadir",
+		"añejo",
+		"año",
+		"apagar",
+		"aparato",
+		"apetito",
+		"apio",
+		"aplicar",
+		"apodo",
+		"aporte",
+		"apoyo",
+		"aprender",
+		"aprobar",
+		"apuesta",
+		"apuro",
+		"arado",
+		"araña",
+		"arar",
+		"árbitro",
+		"árbol",
+		"arbusto",
+		"archivo",
+		"arco",
+		"arder",
+		"ardilla",
+		"arduo",
+		"área",
+		"árido",
+		"aries",
+		"armonía",
+		"arnés",
+		"aroma",
+		"arpa",
+		"arpón",
+		"arreglo",
+		"arroz",
+		"arruga",
+		"arte",
+		"artista",
+		"asa",
+		"asado",
+		"asalto",
+		"ascenso",
+		"asegurar",
+		"aseo",
+		"asesor",
+		"asiento",
+		"asilo",
+		"asistir",
+		"asno",
+		"asombro",
+		"áspero",
+		"astilla",
+		"astro",
+		"astuto",
+		"asumir",
+		"asunto",
+		"atajo",
+		"ataque",
+		"atar",
+		"atento",
+		"ateo",
+		"ático",
+		"atleta",
+		"átomo",
+		"atraer",
+		"atroz",
+		"atún",
+		"audaz",
+		"audio",
+		"auge",
+		"aula",
+		"aumento",
+		"ausente",
+		"autor",
+		"aval",
+		"avance",
+		"avaro",
+		"ave",
+		"avellana",
+		"avena",
+		"avestruz",
+		"avión",
+		"aviso",
+		"ayer",
+		"ayuda",
+		"ayuno",
+		"azafrán",
+		"azar",
+		"azote",
+		"azúcar",
+		"azufre",
+		"azul",
+		"baba",
+		"babor",
+		"bache",
+		"bahía",
+		"baile",
+		"bajar",
+		"balanza",
+		"balcón",
+		"balde",
+		"bambú",
+		"banco",
+		"banda",
+		"baño",
+		"barba",
+		"barco",
+		"barniz",
+		"barro",
+		"báscula",
+		"bastón",
+		"basura",
+		"batalla",
+		"batería",
+		"batir",
+		"batuta",
+		"baúl",
+		"bazar",
+		"bebé",
+		"bebida",
+		"bello",
+		"besar",
+		"beso",
+		"bestia",
+		"bicho",
+		"bien",
+		"bingo",
+		"blanco",
+		"bloque",
+		"blusa",
+		"boa",
+		"bobina",
+		"bobo",
+		"boca",
+		"bocina",
+		"boda",
+		"bodega",
+		"boina",
+		"bola",
+		"bolero",
+		"bolsa",
+		"bomba",
+		"bondad",
+		"bonito",
+		"bono",
+		"bonsái",
+		"borde",
+		"borrar",
+		"bosque",
+		"bote",
+		"botín",
+		"bóveda",
+		"bozal",
+		"bravo",
+		"brazo",
+		"brecha",
+		"breve",
+		"brillo",
+		"brinco",
+		"brisa",
+		"broca",
+		"broma",
+		"bronce",
+		"brote",
+		"bruja",
+		"brusco",
+		"bruto",
+		"buceo",
+		"bucle",
+		"bueno",
+		"buey",
+		"bufanda",
+		"bufón",
+		"búho",
+		"buitre",
+		"bulto",
+		"burbuja",
+		"burla",
+		"burro",
+		"buscar",
+		"butaca",
+		"buzón",
+		"caballo",
+		"cabeza",
+		"cabina",
+		"cabra",
+		"cacao",
+		"cadáver",
+		"cadena",
+		"caer",
+		"café",
+		"caída",
+		"caimán",
+		"caja",
+		"cajón",
+		"cal",
+		"calamar",
+		"calcio",
+		"caldo",
+		"calidad",
+		"calle",
+		"calma",
+		"calor",
+		"calvo",
+		"cama",
+		"cambio",
+		"camello",
+		"camino",
+		"campo",
+		"cáncer",
+		"candil",
+		"canela",
+		"canguro",
+		"canica",
+		"canto",
+		"caña",
+		"cañón",
+		"caoba",
+		"caos",
+		"capaz",
+		"capitán",
+		"capote",
+		"captar",
+		"capucha",
+		"cara",
+		"carbón",
+		"cárcel",
+		"careta",
+		"carga",
+		"cariño",
+		"carne",
+		"carpeta",
+		"carro",
+		"carta",
+		"casa",
+		"casco",
+		"casero",
+		"caspa",
+		"castor",
+		"catorce",
+		"catre",
+		"caudal",
+		"causa",
+		"cazo",
+		"cebolla",
+		"ceder",
+		"cedro",
+		"celda",
+		"célebre",
+		"celoso",
+		"célula",
+		"cemento",
+		"ceniza",
+		"centro",
+		"cerca",
+		"cerdo",
+		"cereza",
+		"cero",
+		"cerrar",
+		"certeza",
+		"césped",
+		"cetro",
+		"chacal",
+		"chaleco",
+		"champú",
+		"chancla",
+		"chapa",
+		"charla",
+		"chico",
+		"chiste",
+		"chivo",
+		"choque",
+		"choza",
+		"chuleta",
+		"chupar",
+		"ciclón",
+		"ciego",
+		"cielo",
+		"cien",
+		"cierto",
+		"cifra",
+		"cigarro",
+		"cima",
+		"cinco",
+		"cine",
+		"cinta",
+		"ciprés",
+		"circo",
+		"ciruela",
+		"cisne",
+		"cita",
+		"ciudad",
+		"clamor",
+		"clan",
+		"claro",
+		"clase",
+		"clave",
+		"cliente",
+		"clima",
+		"clínica",
+		"cobre",
+		"cocción",
+		"cochino",
+		"cocina",
+		"coco",
+		"código",
+		"codo",
+		"cofre",
+		"coger",
+		"cohete",
+		"cojín",
+		"cojo",
+		"cola",
+		"colcha",
+		"colegio",
+		"colgar",
+		"colina",
+		"collar",
+		"colmo",
+		"columna",
+		"combate",
+		"comer",
+		"comida",
+		"cómodo",
+		"compra",
+		"conde",
+		"conejo",
+		"conga",
+		"conocer",
+		"consejo",
+		"contar",
+		"copa",
+		"copia",
+		"corazón",
+		"corbata",
+		"corcho",
+		"cordón",
+		"corona",
+		"correr",
+		"coser",
+		"cosmos",
+		"costa",
+		"cráneo",
+		"cráter",
+		"crear",
+		"crecer",
+		"creído",
+		"crema",
+		"cría",
+		"crimen",
+		"cripta",
+		"crisis",
+		"cromo",
+		"crónica",
+		"croqueta",
+		"crudo",
+		"cruz",
+		"cuadro",
+		"cuarto",
+		"cuatro",
+		"cubo",
+		"cubrir",
+		"cuchara",
+		"cuello",
+		"cuento",
+		"cuerda",
+		"cuesta",
+		"cueva",
+		"cuidar",
+		"culebra",
+		"culpa",
+		"culto",
+		"cumbre",
+		"cumplir",
+		"cuna",
+		"cuneta",
+		"cuota",
+		"cupón",
+		"cúpula",
+		"curar",
+		"curioso",
+		"curso",
+		"curva",
+		"cutis",
+		"dama",
+		"danza",
+		"dar",
+		"dardo",
+		"dátil",
+		"deber",
+		"débil",
+		"década",
+		"decir",
+		"dedo",
+		"defensa",
+		"definir",
+		"dejar",
+		"delfín",
+		"delgado",
+		"delito",
+		"demora",
+		"denso",
+		"dental",
+		"deporte",
+		"derecho",
+		"derrota",
+		"desayuno",
+		"deseo",
+		"desfile",
+		"desnudo",
+		"destino",
+		"desvío",
+		"detalle",
+		"detener",
+		"deuda",
+		"día",
+		"diablo",
+		"diadema",
+		"diamante",
+		"diana",
+		"diario",
+		"dibujo",
+		"dictar",
+		"diente",
+		"dieta",
+		"diez",
+		"difícil",
+		"digno",
+		"dilema",
+		"diluir",
+		"dinero",
+		"directo",
+		"dirigir",
+		"disco",
+		"diseño",
+		"disfraz",
+		"diva",
+		"divino",
+		"doble",
+		"doce",
+		"dolor",
+		"domingo",
+		"don",
+		"donar",
+		"dorado",
+		"dormir",
+		"dorso",
+		"dos",
+		"dosis",
+		"dragón",
+		"droga",
+		"ducha",
+		"duda",
+		"duelo",
+		"dueño",
+		"dulce",
+		"dúo",
+		"duque",
+		"durar",
+		"dureza",
+		"duro",
+		"ébano",
+		"ebrio",
+		"echar",
+		"eco",
+		"ecuador",
+		"edad",
+		"edición",
+		"edificio",
+		"editor",
+		"educar",
+		"efecto",
+		"eficaz",
+		"eje",
+		"ejemplo",
+		"elefante",
+		"elegir",
+		"elemento",
+		"elevar",
+		"elipse",
+		"élite",
+		"elixir",
+		"elogio",
+		"eludir",
+		"embudo",
+		"emitir",
+		"emoción",
+		"empate",
+		"empeño",
+		"empleo",
+		"empresa",
+		"enano",
+		"encargo",
+		"enchufe",
+		"encía",
+		"enemigo",
+		"enero",
+		"enfado",
+		"enfermo",
+		"engaño",
+		"enigma",
+		"enlace",
+		"enorme",
+		"enredo",
+		"ensayo",
+		"enseñar",
+		"entero",
+		"entrar",
+		"envase",
+		"envío",
+		"época",
+		"equipo",
+		"erizo",
+		"escala",
+		"escena",
+		"escolar",
+		"escribir",
+		"escudo",
+		"esencia",
+		"esfera",
+		"esfuerzo",
+		"espada",
+		"espejo",
+		"espía",
+		"esposa",
+		"espuma",
+		"esquí",
+		"estar",
+		"este",
+		"estilo",
+		"estufa",
+		"etapa",
+		"eterno",
+		"ética",
+		"etnia",
+		"evadir",
+		"evaluar",
+		"evento",
+		"evitar",
+		"exacto",
+		"examen",
+		"exceso",
+		"excusa",
+		"exento",
+		"exigir",
+		"exilio",
+		"existir",
+		"éxito",
+		"experto",
+		"explicar",
+		"exponer",
+		"extremo",
+		"fábrica",
+		"fábula",
+		"fachada",
+		"fácil",
+		"factor",
+		"faena",
+		"faja",
+		"falda",
+		"fallo",
+		"falso",
+		"faltar",
+		"fama",
+		"familia",
+		"famoso",
+		"faraón",
+		"farmacia",
+		"farol",
+		"farsa",
+		"fase",
+		"fatiga",
+		"fauna",
+		"favor",
+		"fax",
+		"febrero",
+		"fecha",
+		"feliz",
+		"feo",
+		"feria",
+		"feroz",
+		"fértil",
+		"fervor",
+		"festín",
+		"fiable",
+		"fianza",
+		"fiar",
+		"fibra",
+		"ficción",
+		"ficha",
+		"fideo",
+		"fiebre",
+		"fiel",
+		"fiera",
+		"fiesta",
+		"figura",
+		"fijar",
+		"fijo",
+		"fila",
+		"filete",
+		"filial",
+		"filtro",
+		"fin",
+		"finca",
+		"fingir",
+		"finito",
+		"firma",
+		"flaco",
+		"flauta",
+		"flecha",
+		"flor",
+		"flota",
+		"fluir",
+		"flujo",
+		"flúor",
+		"fobia",
+		"foca",
+		"fogata",
+		"fogón",
+		"folio",
+		"folleto",
+		"fondo",
+		"forma",
+		"forro",
+		"fortuna",
+		"forzar",
+		"fosa",
+		"foto",
+		"fracaso",
+		"frágil",
+		"franja",
+		"frase",
+		"fraude",
+		"freír",
+		"freno",
+		"fresa",
+		"frío",
+		"frito",
+		"fruta",
+		"fuego",
+		"fuente",
+		"fuerza",
+		"fuga",
+		"fumar",
+		"función",
+		"funda",
+		"furgón",
+		"furia",
+		"fusil",
+		"fútbol",
+		"futuro",
+		"gacela",
+		"gafas",
+		"gaita",
+		"gajo",
+		"gala",
+		"galería",
+		"gallo",
+		"gamba",
+		"ganar",
+		"gancho",
+		"ganga",
+		"ganso",
+		"garaje",
+		"garza",
+		"gasolina",
+		"gastar",
+		"gato",
+		"gavilán",
+		"gemelo",
+		"gemir",
+		"gen",
+		"género",
+		"genio",
+		"gente",
+		"geranio",
+		"gerente",
+		"germen",
+		"gesto",
+		"gigante",
+		"gimnasio",
+		"girar",
+		"giro",
+		"glaciar",
+		"globo",
+		"gloria",
+		"gol",
+		"golfo",
+		"goloso",
+		"golpe",
+		"goma",
+		"gordo",
+		"gorila",
+		"gorra",
+		"gota",
+		"goteo",
+		"gozar",
+		"grada",
+		"gráfico",
+		"grano",
+		"grasa",
+		"gratis",
+		"grave",
+		"grieta",
+		"grillo",
+		"gripe",
+		"gris",
+		"grito",
+		"grosor",
+		"grúa",
+		"grueso",
+		"grumo",
+		"grupo",
+		"guante",
+		"guapo",
+		"guardia",
+		"guerra",
+		"guía",
+		"guiño",
+		"guion",
+		"guiso",
+		"guitarra",
+		"gusano",
+		"gustar",
+		"haber",
+		"hábil",
+		"hablar",
+		"hacer",
+		"hacha",
+		"hada",
+		"hallar",
+		"hamaca",
+		"harina",
+		"haz",
+		"hazaña",
+		"hebilla",
+		"hebra",
+		"hecho",
+		"helado",
+		"helio",
+		"hembra",
+		"herir",
+		"hermano",
+		"héroe",
+		"hervir",
+		"hielo",
+		"hierro",
+		"hígado",
+		"higiene",
+		"hijo",
+		"himno",
+		"historia",
+		"hocico",
+		"hogar",
+		"hoguera",
+		"hoja",
+		"hombre",
+		"hongo",
+		"honor",
+		"honra",
+		"hora",
+		"hormiga",
+		"horno",
+		"hostil",
+		"hoyo",
+		"hueco",
+		"huelga",
+		"huerta",
+		"hueso",
+		"huevo",
+		"huida",
+		"huir",
+		"humano",
+		"húmedo",
+		"humilde",
+		"humo",
+		"hundir",
+		"huracán",
+		"hurto",
+		"icono",
+		"ideal",
+		"idioma",
+		"ídolo",
+		"iglesia",
+		"iglú",
+		"igual",
+		"ilegal",
+		"ilusión",
+		"imagen",
+		"imán",
+		"imitar",
+		"impar",
+		"imperio",
+		"imponer",
+		"impulso",
+		"incapaz",
+		"índice",
+		"inerte",
+		"infiel",
+		"informe",
+		"ingenio",
+		"inicio",
+		"inmenso",
+		"inmune",
+		"innato",
+		"insecto",
+		"instante",
+		"interés",
+		"íntimo",
+		"intuir",
+		"inútil",
+		"invierno",
+		"ira",
+		"iris",
+		"ironía",
+		"isla",
+		"islote",
+		"jabalí",
+		"jabón",
+		"jamón",
+		"jarabe",
+		"jardín",
+		"jarra",
+		"jaula",
+		"jazmín",
+		"jefe",
+		"jeringa",
+		"jinete",
+		"jornada",
+		"joroba",
+		"joven",
+		"joya",
+		"juerga",
+		"jueves",
+		"juez",
+		"jugador",
+		"jugo",
+		"juguete",
+		"juicio",
+		"junco",
+		"jungla",
+		"junio",
+		"juntar",
+		"júpiter",
+		"jurar",
+		"justo",
+		"juvenil",
+		"juzgar",
+		"kilo",
+		"koala",
+		"labio",
+		"lacio",
+		"lacra",
+		"lado",
+		"ladrón",
+		"lagarto",
+		"lágrima",
+		"laguna",
+		"laico",
+		"lamer",
+		"lámina",
+		"lámpara",
+		"lana",
+		"lancha",
+		"langosta",
+		"lanza",
+		"lápiz",
+		"largo",
+		"larva",
+		"lástima",
+		"lata",
+		"látex",
+		"latir",
+		"laurel",
+		"lavar",
+		"lazo",
+		"leal",
+		"lección",
+		"leche",
+		"lector",
+		"leer",
+		"legión",
+		"legumbre",
+		"lejano",
+		"lengua",
+		"lento",
+		"leña",
+		"león",
+		"leopardo",
+		"lesión",
+		"letal",
+		"letra",
+		"leve",
+		"leyenda",
+		"libertad",
+		"libro",
+		"licor",
+		"líder",
+		"lidiar",
+		"lienzo",
+		"liga",
+		"ligero",
+		"lima",
+		"límite",
+		"limón",
+		"limpio",
+		"lince",
+		"lindo",
+		"línea",
+		"lingote",
+		"lino",
+		"linterna",
+		"líquido",
+		"liso",
+		"lista",
+		"litera",
+		"litio",
+		"litro",
+		"llaga",
+		"llama",
+		"llanto",
+		"llave",
+		"llegar",
+		"llenar",
+		"llevar",
+		"llorar",
+		"llover",
+		"lluvia",
+		"lobo",
+		"loción",
+		"loco",
+		"locura",
+		"lógica",
+		"logro",
+		"lombriz",
+		"lomo",
+		"lonja",
+		"lote",
+		"lucha",
+		"lucir",
+		"lugar",
+		"lujo",
+		"luna",
+		"lunes",
+		"lupa",
+		"lustro",
+		"luto",
+		"luz",
+		"maceta",
+		"macho",
+		"madera",
+		"madre",
+		"maduro",
+		"maestro",
+		"mafia",
+		"magia",
+		"mago",
+		"maíz",
+		"maldad",
+		"maleta",
+		"malla",
+		"malo",
+		"mamá",
+		"mambo",
+		"mamut",
+		"manco",
+		"mando",
+		"manejar",
+		"manga",
+		"maniquí",
+		"manjar",
+		"mano",
+		"manso",
+		"manta",
+		"mañana",
+		"mapa",
+		"máquina",
+		"mar",
+		"marco",
+		"marea",
+		"marfil",
+		"margen",
+		"marido",
+		"mármol",
+		"marrón",
+		"martes",
+		"marzo",
+		"masa",
+		"máscara",
+		"masivo",
+		"matar",
+		"materia",
+		"matiz",
+		"matriz",
+		"máximo",
+		"mayor",
+		"mazorca",
+		"mecha",
+		"medalla",
+		"medio",
+		"médula",
+		"mejilla",
+		"mejor",
+		"melena",
+		"melón",
+		"memoria",
+		"menor",
+		"mensaje",
+		"mente",
+		"menú",
+		"mercado",
+		"merengue",
+		"mérito",
+		"mes",
+		"mesón",
+		"meta",
+		"meter",
+		"método",
+		"metro",
+		"mezcla",
+		"miedo",
+		"miel",
+		"miembro",
+		"miga",
+		"mil",
+		"milagro",
+		"militar",
+		"millón",
+		"mimo",
+		"mina",
+		"minero",
+		"mínimo",
+		"minuto",
+		"miope",
+		"mirar",
+		"misa",
+		"miseria",
+		"misil",
+		"mismo",
+		"mitad",
+		"mito",
+		"mochila",
+		"moción",
+		"moda",
+		"modelo",
+		"moho",
+		"mojar",
+		"molde",
+		"moler",
+		"molino",
+		"momento",
+		"momia",
+		"monarca",
+		"moneda",
+		"monja",
+		"monto",
+		"moño",
+		"morada",
+		"morder",
+		"moreno",
+		"morir",
+		"morro",
+		"morsa",
+		"mortal",
+		"mosca",
+		"mostrar",
+		"motivo",
+		"mover",
+		"móvil",
+		"mozo",
+		"mucho",
+		"mudar",
+		"mueble",
+		"muela",
+		"muerte",
+		"muestra",
+		"mugre",
+		"mujer",
+		"mula",
+		"muleta",
+		"multa",
+		"mundo",
+		"muñeca",
+		"mural",
+		"muro",
+		"músculo",
+		"museo",
+		"musgo",
+		"música",
+		"muslo",
+		"nácar",
+		"nación",
+		"nadar",
+		"naipe",
+		"naranja",
+		"nariz",
+		"narrar",
+		"nasal",
+		"natal",
+		"nativo",
+		"natural",
+		"náusea",
+		"naval",
+		"nave",
+		"navidad",
+		"necio",
+		"néctar",
+		"negar",
+		"negocio",
+		"negro",
+		"neón",
+		"nervio",
+		"neto",
+		"neutro",
+		"nevar",
+		"nevera",
+		"nicho",
+		"nido",
+		"niebla",
+		"nieto",
+		"niñez",
+		"niño",
+		"nítido",
+		"nivel",
+		"nobleza",
+		"noche",
+		"nómina",
+		"noria",
+		"norma",
+		"norte",
+		"nota",
+		"noticia",
+		"novato",
+		"novela",
+		"novio",
+		"nube",
+		"nuca",
+		"núcleo",
+		"nudillo",
+		"nudo",
+		"nuera",
+		"nueve",
+		"nuez",
+		"nulo",
+		"número",
+		"nutria",
+		"oasis",
+		"obeso",
+		"obispo",
+		"objeto",
+		"obra",
+		"obrero",
+		"observar",
+		"obtener",
+		"obvio",
+		"oca",
+		"ocaso",
+		"océano",
+		"ochenta",
+		"ocho",
+		"ocio",
+		"ocre",
+		"octavo",
+		"octubre",
+		"oculto",
+		"ocupar",
+		"ocurrir",
+		"odiar",
+		"odio",
+		"odisea",
+		"oeste",
+		"ofensa",
+		"oferta",
+		"oficio",
+		"ofrecer",
+		"ogro",
+		"oído",
+		"oír",
+		"ojo",
+		"ola",
+		"oleada",
+		"olfato",
+		"olivo",
+		"olla",
+		"olmo",
+		"olor",
+		"olvido",
+		"ombligo",
+		"onda",
+		"onza",
+		"opaco",
+		"opción",
+		"ópera",
+		"opinar",
+		"oponer",
+		"optar",
+		"óptica",
+		"opuesto",
+		"oración",
+		"orador",
+		"oral",
+		"órbita",
+		"orca",
+		"orden",
+		"oreja",
+		"órgano",
+		"orgía",
+		"orgullo",
+		"oriente",
+		"origen",
+		"orilla",
+		"oro",
+		"orquesta",
+		"oruga",
+		"osadía",
+		"oscuro",
+		"osezno",
+		"oso",
+		"ostra",
+		"otoño",
+		"otro",
+		"oveja",
+		"óvulo",
+		"óxido",
+		"oxígeno",
+		"oyente",
+		"ozono",
+		"pacto",
+		"padre",
+		"paella",
+		"página",
+		"pago",
+		"país",
+		"pájaro",
+		"palabra",
+		"palco",
+		"paleta",
+		"pálido",
+		"palma",
+		"paloma",
+		"palpar",
+		"pan",
+		"panal",
+		"pánico",
+		"pantera",
+		"pañuelo",
+		"papá",
+		"papel",
+		"papilla",
+		"paquete",
+		"parar",
+		"parcela",
+		"pared",
+		"parir",
+		"paro",
+		"párpado",
+		"parque",
+		"párrafo",
+		"parte",
+		"pasar",
+		"paseo",
+		"pasión",
+		"paso",
+		"pasta",
+		"pata",
+		"patio",
+		"patria",
+		"pausa",
+		"pauta",
+		"pavo",
+		"payaso",
+		"peatón",
+		"pecado",
+		"pecera",
+		"pecho",
+		"pedal",
+		"pedir",
+		"pegar",
+		"peine",
+		"pelar",
+		"peldaño",
+		"pelea",
+		"peligro",
+		"pellejo",
+		"pelo",
+		"peluca",
+		"pena",
+		"pensar",
+		"peñón",
+		"peón",
+		"peor",
+		"pepino",
+		"pequeño",
+		"pera",
+		"percha",
+		"perder",
+		"pereza",
+		"perfil",
+		"perico",
+		"perla",
+		"permiso",
+		"perro",
+		"persona",
+		"pesa",
+		"pesca",
+		"pésimo",
+		"pestaña",
+		"pétalo",
+		"petróleo",
+		"pez",
+		"pezuña",
+		"picar",
+		"pichón",
+		"pie",
+		"piedra",
+		"pierna",
+		"pieza",
+		"pijama",
+		"pilar",
+		"piloto",
+		"pimienta",
+		"pino",
+		"pintor",
+		"pinza",
+		"piña",
+		"piojo",
+		"pipa",
+		"pirata",
+		"pisar",
+		"piscina",
+		"piso",
+		"pista",
+		"pitón",
+		"pizca",
+		"placa",
+		"plan",
+		"plata",
+		"playa",
+		"plaza",
+		"pleito",
+		"pleno",
+		"plomo",
+		"pluma",
+		"plural",
+		"pobre",
+		"poco",
+		"poder",
+		"podio",
+		"poema",
+		"poesía",
+		"poeta",
+		"polen",
+		"policía",
+		"pollo",
+		"polvo",
+		"pomada",
+		"pomelo",
+		"pomo",
+		"pompa",
+		"poner",
+		"porción",
+		"portal",
+		"posada",
+		"poseer",
+		"posible",
+		"poste",
+		"potencia",
+		"potro",
+		"pozo",
+		"prado",
+		"precoz",
+		"pregunta",
+		"premio",
+		"prensa",
+		"preso",
+		"previo",
+		"primo",
+		"príncipe",
+		"prisión",
+		"privar",
+		"proa",
+		"probar",
+		"proceso",
+		"producto",
+		"proeza",
+		"profesor",
+		"programa",
+		"prole",
+		"promesa",
+		"pronto",
+		"propio",
+		"próximo",
+		"prueba",
+		"público",
+		"puchero",
+		"pudor",
+		"pueblo",
+		"puerta",
+		"puesto",
+		"pulga",
+		"pulir",
+		"pulmón",
+		"pulpo",
+		"pulso",
+		"puma",
+		"punto",
+		"puñal",
+		"puño",
+		"pupa",
+		"pupila",
+		"puré",
+		"quedar",
+		"queja",
+		"quemar",
+		"querer",
+		"queso",
+		"quieto",
+		"química",
+		"quince",
+		"quitar",
+		"rábano",
+		"rabia",
+		"rabo",
+		"ración",
+		"radical",
+		"raíz",
+		"rama",
+		"rampa",
+		"rancho",
+		"rango",
+		"rapaz",
+		"rápido",
+		"rapto",
+		"rasgo",
+		"raspa",
+		"rato",
+		"rayo",
+		"raza",
+		"razón",
+		"reacción",
+		"realidad",
+		"rebaño",
+		"rebote",
+		"recaer",
+		"receta",
+		"rechazo",
+		"recoger",
+		"recreo",
+		"recto",
+		"recurso",
+		"red",
+		"redondo",
+		"reducir",
+		"reflejo",
+		"reforma",
+		"refrán",
+		"refugio",
+		"regalo",
+		"regir",
+		"regla",
+		"regreso",
+		"rehén",
+		"reino",
+		"reír",
+		"reja",
+		"relato",
+		"relevo",
+		"relieve",
+		"relleno",
+		"reloj",
+		"remar",
+		"remedio",
+		"remo",
+		"rencor",
+		"rendir",
+		"renta",
+		"reparto",
+		"repetir",
+		"reposo",
+		"reptil",
+		"res",
+		"rescate",
+		"resina",
+		"respeto",
+		"resto",
+		"resumen",
+		"retiro",
+		"retorno",
+		"retrato",
+		"reunir",
+		"revés",
+		"revista",
+		"rey",
+		"rezar",
+		"rico",
+		"riego",
+		"rienda",
+		"riesgo",
+		"rifa",
+		"rígido",
+		"rigor",
+		"rincón",
+		"riñón",
+		"río",
+		"riqueza",
+		"risa",
+		"ritmo",
+		"rito",
+		"rizo",
+		"roble",
+		"roce",
+		"rociar",
+		"rodar",
+		"rodeo",
+		"rodilla",
+		"roer",
+		"rojizo",
+		"rojo",
+		"romero",
+		"romper",
+		"ron",
+		"ronco",
+		"ronda",
+		"ropa",
+		"ropero",
+		"rosa",
+		"rosca",
+		"rostro",
+		"rotar",
+		"rubí",
+		"rubor",
+		"rudo",
+		"rueda",
+		"rugir",
+		"ruido",
+		"ruina",
+		"ruleta",
+		"rulo",
+		"rumbo",
+		"rumor",
+		"ruptura",
+		"ruta",
+		"rutina",
+		"sábado",
+		"saber",
+		"sabio",
+		"sable",
+		"sacar",
+		"sagaz",
+		"sagrado",
+		"sala",
+		"saldo",
+		"salero",
+		"salir",
+		"salmón",
+		"salón",
+		"salsa",
+		"salto",
+		"salud",
+		"salvar",
+		"samba",
+		"sanción",
+		"sandía",
+		"sanear",
+		"sangre",
+		"sanidad",
+		"sano",
+		"santo",
+		"sapo",
+		"saque",
+		"sardina",
+		"sartén",
+		"sastre",
+		"satán",
+		"sauna",
+		"saxofón",
+		"sección",
+		"seco",
+		"secreto",
+		"secta",
+		"sed",
+		"seguir",
+		"seis",
+		"sello",
+		"selva",
+		"semana",
+		"semilla",
+		"senda",
+		"sensor",
+		"señal",
+		"señor",
+		"separar",
+		"sepia",
+		"sequía",
+		"ser",
+		"serie",
+		"sermón",
+		"servir",
+		"sesenta",
+		"sesión",
+		"seta",
+		"setenta",
+		"severo",
+		"sexo",
+		"sexto",
+		"sidra",
+		"siesta",
+		"siete",
+		"siglo",
+		"signo",
+		"sílaba",
+		"silbar",
+		"silencio",
+		"silla",
+		"símbolo",
+		"simio",
+		"sirena",
+		"sistema",
+		"sitio",
+		"situar",
+		"sobre",
+		"socio",
+		"sodio",
+		"sol",
+		"solapa",
+		"soldado",
+		"soledad",
+		"sólido",
+		"soltar",
+		"solución",
+		"sombra",
+		"sondeo",
+		"sonido",
+		"sonoro",
+		"sonrisa",
+		"sopa",
+		"soplar",
+		"soporte",
+		"sordo",
+		"sorpresa",
+		"sorteo",
+		"sostén",
+		"sótano",
+		"suave",
+		"subir",
+		"suceso",
+		"sudor",
+		"suegra",
+		"suelo",
+		"sueño",
+		"suerte",
+		"sufrir",
+		"sujeto",
+		"sultán",
+		"sumar",
+		"superar",
+		"suplir",
+		"suponer",
+		"supremo",
+		"sur",
+		"surco",
+		"sureño",
+		"surgir",
+		"susto",
+		"sutil",
+		"tabaco",
+		"tabique",
+		"tabla",
+		"tabú",
+		"taco",
+		"tacto",
+		"tajo",
+		"talar",
+		"talco",
+		"talento",
+		"talla",
+		"talón",
+		"tamaño",
+		"tambor",
+		"tango",
+		"tanque",
+		"tapa",
+		"tapete",
+		"tapia",
+		"tapón",
+		"taquilla",
+		"tarde",
+		"tarea",
+		"tarifa",
+		"tarjeta",
+		"tarot",
+		"tarro",
+		"tarta",
+		"tatuaje",
+		"tauro",
+		"taza",
+		"tazón",
+		"teatro",
+		"techo",
+		"tecla",
+		"técnica",
+		"tejado",
+		"tejer",
+		"tejido",
+		"tela",
+		"teléfono",
+		"tema",
+		"temor",
+		"templo",
+		"tenaz",
+		"tender",
+		"tener",
+		"tenis",
+		"tenso",
+		"teoría",
+		"terapia",
+		"terco",
+		"término",
+		"ternura",
+		"terror",
+		"tesis",
+		"tesoro",
+		"testigo",
+		"tetera",
+		"texto",
+		"tez",
+		"tibio",
+		"tiburón",
+		"tiempo",
+		"tienda",
+		"tierra",
+		"tieso",
+		"tigre",
+		"tijera",
+		"tilde",
+		"timbre",
+		"tímido",
+		"timo",
+		"tinta",
+		"tío",
+		"típico",
+		"tipo",
+		"tira",
+		"tirón",
+		"titán",
+		"títere",
+		"título",
+		"tiza",
+		"toalla",
+		"tobillo",
+		"tocar",
+		"tocino",
+		"todo",
+		"toga",
+		"toldo",
+		"tomar",
+		"tono",
+		"tonto",
+		"topar",
+		"tope",
+		"toque",
+		"tórax",
+		"torero",
+		"tormenta",
+		"torneo",
+		"toro",
+		"torpedo",
+		"torre",
+		"torso",
+		"tortuga",
+		"tos",
+		"tosco",
+		"toser",
+		"tóxico",
+		"trabajo",
+		"tractor",
+		"traer",
+		"tráfico",
+		"trago",
+		"traje",
+		"tramo",
+		"trance",
+		"trato",
+		"trauma",
+		"trazar",
+		"trébol",
+		"tregua",
+		"treinta",
+		"tren",
+		"trepar",
+		"tres",
+		"tribu",
+		"trigo",
+		"tripa",
+		"triste",
+		"triunfo",
+		"trofeo",
+		"trompa",
+		"tronco",
+		"tropa",
+		"trote",
+		"trozo",
+		"truco",
+		"trueno",
+		"trufa",
+		"tubería",
+		"tubo",
+		"tuerto",
+		"tumba",
+		"tumor",
+		"túnel",
+		"túnica",
+		"turbina",
+		"turismo",
+		"turno",
+		"tutor",
+		"ubicar",
+		"úlcera",
+		"umbral",
+		"unidad",
+		"unir",
+		"universo",
+		"uno",
+		"untar",
+		"uña",
+		"urbano",
+		"urbe",
+		"urgente",
+		"urna",
+		"usar",
+		"usuario",
+		"útil",
+		"utopía",
+		"uva",
+		"vaca",
+		"vacío",
+		"vacuna",
+		"vagar",
+		"vago",
+		"vaina",
+		"vajilla",
+		"vale",
+		"válido",
+		"valle",
+		"valor",
+		"válvula",
+		"vampiro",
+		"vara",
+		"variar",
+		"varón",
+		"vaso",
+		"vecino",
+		"vector",
+		"vehículo",
+		"veinte",
+		"vejez",
+		"vela",
+		"velero",
+		"veloz",
+		"vena",
+		"vencer",
+		"venda",
+		"veneno",
+		"vengar",
+		"venir",
+		"venta",
+		"venus",
+		"ver",
+		"verano",
+		"verbo",
+		"verde",
+		"vereda",
+		"verja",
+		"verso",
+		"verter",
+		"vía",
+		"viaje",
+		"vibrar",
+		"vicio",
+		"víctima",
+		"vida",
+		"vídeo",
+		"vidrio",
+		"viejo",
+		"viernes",
+		"vigor",
+		"vil",
+		"villa",
+		"vinagre",
+		"vino",
+		"viñedo",
+		"violín",
+		"viral",
+		"virgo",
+		"virtud",
+		"visor",
+		"víspera",
+		"vista",
+		"vitamina",
+		"viudo",
+		"vivaz",
+		"vivero",
+		"vivir",
+		"vivo",
+		"volcán",
+		"volumen",
+		"volver",
+		"voraz",
+		"votar",
+		"voto",
+		"voz",
+		"vuelo",
+		"vulgar",
+		"yacer",
+		"yate",
+		"yegua",
+		"yema",
+		"yerno",
+		"yeso",
+		"yodo",
+		"yoga",
+		"yogur",
+		"zafiro",
+		"zanja",
+		"zapato",
+		"zarza",
+		"zona",
+		"zorro",
+		"zumo",
+		"zurdo",
+	}
+};
+
+wordlist_t wordlist_diceware_english = {
+	.elt.key = "english",
+	.family = "diceware",
+	.max_word_length = 6,
+	.min_word_length = 1,
+	.words = (char *[]){
+		"a",
+		"a&p",
+		"a's",
+		"aa",
+		"aaa",
+		"aaaa",
+		"aaron",
+		"ab",
+		"aba",
+		"ababa",
+		"aback",
+		"abase",
+		"abash",
+		"abate",
+		"abbas",
+		"abbe",
+		"abbey",
+		"abbot",
+		"abbott",
+		"abc",
+		"abe",
+		"abed",
+		"abel",
+		"abet",
+		"abide",
+		"abject",
+		"ablaze",
+		"able",
+		"abner",
+		"abo",
+		"abode",
+		"abort",
+		"about",
+		"above",
+		"abrade",
+		"abram",
+		"absorb",
+		"abuse",
+		"abut",
+		"abyss",
+		"ac",
+		"acadia",
+		"accra",
+		"accrue",
+		"ace",
+		"acetic",
+		"ache",
+		"acid",
+		"acidic",
+		"acm",
+		"acme",
+		"acorn",
+		"acre",
+		"acrid",
+		"act",
+		"acton",
+		"actor",
+		"acts",
+		"acuity",
+		"acute",
+		"ad",
+		"ada",
+		"adage",
+		"adagio",
+		"adair",
+		"adam",
+		"adams",
+		"adapt",
+		"add",
+		"added",
+		"addict",
+		"addis",
+		"addle",
+		"adele",
+		"aden",
+		"adept",
+		"adieu",
+		"adjust",
+		"adler",
+		"admit",
+		"admix",
+		"ado",
+		"adobe",
+		"adonis",
+		"adopt",
+		"adore",
+		"adorn",
+		"adult",
+		"advent",
+		"advert",
+		"advise",
+		"ae",
+		"aegis",
+		"aeneid",
+		"af",
+		"afar",
+		"affair",
+		"affine",
+		"affix",
+		"afire",
+		"afoot",
+		"afraid",
+		"africa",
+		"afro",
+		"aft",
+		"ag",
+		"again",
+		"agate",
+		"agave",
+		"age",
+		"agee",
+		"agenda",
+		"agent",
+		"agile",
+		"aging",
+		"agnes",
+		"agnew",
+		"ago",
+		"agone",
+		"agony",
+		"agree",
+		"ague",
+		"agway",
+		"ah",
+		"ahead",
+		"ahem",
+		"ahoy",
+		"ai",
+		"aid",
+		"aida",
+		"aide",
+		"aides",
+		"aiken",
+		"ail",
+		"aile",
+		"aim",
+		"ain't",
+		"ainu",
+		"air",
+		"aires",
+		"airman",
+		"airway",
+		"airy",
+		"aisle",
+		"aj",
+		"ajar",
+		"ajax",
+		"ak",
+		"akers",
+		"akin",
+		"akron",
+		"al",
+		"ala",
+		"alai",
+		"alamo",
+		"alan",
+		"alarm",
+		"alaska",
+		"alb",
+		"alba",
+		"album",
+		"alcoa",
+		"alden",
+		"alder",
+		"ale",
+		"alec",
+		"aleck",
+		"aleph",
+		"alert",
+		"alex",
+		"alexei",
+		"alga",
+		"algae",
+		"algal",
+		"alger",
+		"algol",
+		"ali",
+		"alia",
+		"alias",
+		"alibi",
+		"alice",
+		"alien",
+		"alight",
+		"align",
+		"alike",
+		"alive",
+		"all",
+		"allah",
+		"allan",
+		"allay",
+		"allen",
+		"alley",
+		"allied",
+		"allis",
+		"allot",
+		"allow",
+		"alloy",
+		"allure",
+		"ally",
+		"allyl",
+		"allyn",
+		"alma",
+		"almost",
+		"aloe",
+		"aloft",
+		"aloha",
+		"alone",
+		"along",
+		"aloof",
+		"aloud",
+		"alp",
+		"alpha",
+		"alps",
+		"also",
+		"alsop",
+		"altair",
+		"altar",
+		"alter",
+		"alto",
+		"alton",
+		"alum",
+		"alumni",
+		"alva",
+		"alvin",
+		"alway",
+		"am",
+		"ama",
+		"amass",
+		"amaze",
+		"amber",
+		"amble",
+		"ambush",
+		"amen",
+		"amend",
+		"ames",
+		"ami",
+		"amid",
+		"amide",
+		"amigo",
+		"amino",
+		"amiss",
+		"amity",
+		"amman",
+		"ammo",
+		"amoco",
+		"amok",
+		"among",
+		"amort",
+		"amos",
+		"amp",
+		"ampere",
+		"ampex",
+		"ample",
+		"amply",
+		"amra",
+		"amulet",
+		"amuse",
+		"amy",
+		"an",
+		"ana",
+		"and",
+		"andes",
+		"andre",
+		"andrew",
+		"andy",
+		"anent",
+		"anew",
+		"angel",
+		"angelo",
+		"anger",
+		"angie",
+		"angle",
+		"anglo",
+		"angola",
+		"angry",
+		"angst",
+		"angus",
+		"ani",
+		"anion",
+		"anise",
+		"anita",
+		"ankle",
+		"ann",
+		"anna",
+		"annal",
+		"anne",
+		"annex",
+		"annie",
+		"annoy",
+		"annul",
+		"annuli",
+		"annum",
+		"anode",
+		"ansi",
+		"answer",
+		"ant",
+		"ante",
+		"anti",
+		"antic",
+		"anton",
+		"anus",
+		"anvil",
+		"any",
+		"anyhow",
+		"anyway",
+		"ao",
+		"aok",
+		"aorta",
+		"ap",
+		"apart",
+		"apathy",
+		"ape",
+		"apex",
+		"aphid",
+		"aplomb",
+		"appeal",
+		"append",
+		"apple",
+		"apply",
+		"april",
+		"apron",
+		"apse",
+		"apt",
+		"aq",
+		"aqua",
+		"ar",
+		"arab",
+		"araby",
+		"arc",
+		"arcana",
+		"arch",
+		"archer",
+		"arden",
+		"ardent",
+		"are",
+		"area",
+		"arena",
+		"ares",
+		"argive",
+		"argo",
+		"argon",
+		"argot",
+		"argue",
+		"argus",
+		"arhat",
+		"arid",
+		"aries",
+		"arise",
+		"ark",
+		"arlen",
+		"arlene",
+		"arm",
+		"armco",
+		"army",
+		"arnold",
+		"aroma",
+		"arose",
+		"arpa",
+		"array",
+		"arrear",
+		"arrow",
+		"arson",
+		"art",
+		"artery",
+		"arthur",
+		"artie",
+		"arty",
+		"aruba",
+		"arum",
+		"aryl",
+		"as",
+		"ascend",
+		"ash",
+		"ashen",
+		"asher",
+		"ashley",
+		"ashy",
+		"asia",
+		"aside",
+		"ask",
+		"askew",
+		"asleep",
+		"aspen",
+		"aspire",
+		"ass",
+		"assai",
+		"assam",
+		"assay",
+		"asset",
+		"assort",
+		"assure",
+		"aster",
+		"astm",
+		"astor",
+		"astral",
+		"at",
+		"at&t",
+		"ate",
+		"athens",
+		"atlas",
+		"atom",
+		"atomic",
+		"atone",
+		"atop",
+		"attic",
+		"attire",
+		"au",
+		"aubrey",
+		"audio",
+		"audit",
+		"aug",
+		"auger",
+		"augur",
+		"august",
+		"auk",
+		"aunt",
+		"aura",
+		"aural",
+		"auric",
+		"austin",
+		"auto",
+		"autumn",
+		"av",
+		"avail",
+		"ave",
+		"aver",
+		"avert",
+		"avery",
+		"aviate",
+		"avid",
+		"avis",
+		"aviv",
+		"avoid",
+		"avon",
+		"avow",
+		"aw",
+		"await",
+		"awake",
+		"award",
+		"aware",
+		"awash",
+		"away",
+		"awe",
+		"awful",
+		"awl",
+		"awn",
+		"awoke",
+		"awry",
+		"ax",
+		"axe",
+		"axes",
+		"axial",
+		"axiom",
+		"axis",
+		"axle",
+		"axon",
+		"ay",
+		"aye",
+		"ayers",
+		"az",
+		"aztec",
+		"azure",
+		"b",
+		"b's",
+		"ba",
+		"babe",
+		"babel",
+		"baby",
+		"bach",
+		"back",
+		"backup",
+		"bacon",
+		"bad",
+		"bade",
+		"baden",
+		"badge",
+		"baffle",
+		"bag",
+		"baggy",
+		"bah",
+		"bahama",
+		"bail",
+		"baird",
+		"bait",
+		"bake",
+		"baku",
+		"bald",
+		"baldy",
+		"bale",
+		"bali",
+		"balk",
+		"balkan",
+		"balky",
+		"ball",
+		"balled",
+		"ballot",
+		"balm",
+		"balmy",
+		"balsa",
+		"bam",
+		"bambi",
+		"ban",
+		"banal",
+		"band",
+		"bandit",
+		"bandy",
+		"bane",
+		"bang",
+		"banish",
+		"banjo",
+		"bank",
+		"banks",
+		"bantu",
+		"bar",
+		"barb",
+		"bard",
+		"bare",
+		"barfly",
+		"barge",
+		"bark",
+		"barley",
+		"barn",
+		"barnes",
+		"baron",
+		"barony",
+		"barr",
+		"barre",
+		"barry",
+		"barter",
+		"barth",
+		"barton",
+		"basal",
+		"base",
+		"basel",
+		"bash",
+		"basic",
+		"basil",
+		"basin",
+		"basis",
+		"bask",
+		"bass",
+		"bassi",
+		"basso",
+		"baste",
+		"bat",
+		"batch",
+		"bate",
+		"bater",
+		"bates",
+		"bath",
+		"bathe",
+		"batik",
+		"baton",
+		"bator",
+		"batt",
+		"bauble",
+		"baud",
+		"bauer",
+		"bawd",
+		"bawdy",
+		"bawl",
+		"baxter",
+		"bay",
+		"bayda",
+		"bayed",
+		"bayou",
+		"bazaar",
+		"bb",
+		"bbb",
+		"bbbb",
+		"bc",
+		"bcd",
+		"bd",
+		"be",
+		"beach",
+		"bead",
+		"beady",
+		"beak",
+		"beam",
+		"bean",
+		"bear",
+		"beard",
+		"beast",
+		"beat",
+		"beau",
+		"beauty",
+		"beaux",
+		"bebop",
+		"becalm",
+		"beck",
+		"becker",
+		"becky",
+		"bed",
+		"bedim",
+		"bee",
+		"beebe",
+		"beech",
+		"beef",
+		"beefy",
+		"been",
+		"beep",
+		"beer",
+		"beet",
+		"befall",
+		"befit",
+		"befog",
+		"beg",
+		"began",
+		"beget",
+		"beggar",
+		"begin",
+		"begun",
+		"behind",
+		"beige",
+		"being",
+		"beirut",
+		"bel",
+		"bela",
+		"belch",
+		"belfry",
+		"belie",
+		"bell",
+		"bella",
+		"belle",
+		"belly",
+		"below",
+		"belt",
+		"bema",
+		"beman",
+		"bemoan",
+		"ben",
+		"bench",
+		"bend",
+		"bender",
+		"benny",
+		"bent",
+		"benz",
+		"berea",
+		"bereft",
+		"beret",
+		"berg",
+		"berlin",
+		"bern",
+		"berne",
+		"bernet",
+		"berra",
+		"berry",
+		"bert",
+		"berth",
+		"beryl",
+		"beset",
+		"bess",
+		"bessel",
+		"best",
+		"bestir",
+		"bet",
+		"beta",
+		"betel",
+		"beth",
+		"bethel",
+		"betsy",
+		"bette",
+		"betty",
+		"bevel",
+		"bevy",
+		"beware",
+		"bey",
+		"bezel",
+		"bf",
+		"bg",
+		"bh",
+		"bhoy",
+		"bi",
+		"bias",
+		"bib",
+		"bibb",
+		"bible",
+		"bicep",
+		"biceps",
+		"bid",
+		"biddy",
+		"bide",
+		"bien",
+		"big",
+		"biggs",
+		"bigot",
+		"bile",
+		"bilge",
+		"bilk",
+		"bill",
+		"billow",
+		"billy",
+		"bin",
+		"binary",
+		"bind",
+		"bing",
+		"binge",
+		"bingle",
+		"bini",
+		"biota",
+		"birch",
+		"bird",
+		"birdie",
+		"birth",
+		"bison",
+		"bisque",
+		"bit",
+		"bitch",
+		"bite",
+		"bitt",
+		"bitten",
+		"biz",
+		"bizet",
+		"bj",
+		"bk",
+		"bl",
+		"blab",
+		"black",
+		"blade",
+		"blair",
+		"blake",
+		"blame",
+		"blanc",
+		"bland",
+		"blank",
+		"blare",
+		"blast",
+		"blat",
+		"blatz",
+		"blaze",
+		"bleak",
+		"bleat",
+		"bled",
+		"bleed",
+		"blend",
+		"bless",
+		"blest",
+		"blew",
+		"blimp",
+		"blind",
+		"blink",
+		"blinn",
+		"blip",
+		"bliss",
+		"blithe",
+		"blitz",
+		"bloat",
+		"blob",
+		"bloc",
+		"bloch",
+		"block",
+		"bloke",
+		"blond",
+		"blonde",
+		"blood",
+		"bloom",
+		"bloop",
+		"blot",
+		"blotch",
+		"blow",
+		"blown",
+		"blue",
+		"bluet",
+		"bluff",
+		"blum",
+		"blunt",
+		"blur",
+		"blurt",
+		"blush",
+		"blvd",
+		"blythe",
+		"bm",
+		"bmw",
+		"bn",
+		"bo",
+		"boa",
+		"boar",
+		"board",
+		"boast",
+		"boat",
+		"bob",
+		"bobbin",
+		"bobby",
+		"bobcat",
+		"boca",
+		"bock",
+		"bode",
+		"body",
+		"bog",
+		"bogey",
+		"boggy",
+		"bogus",
+		"bogy",
+		"bohr",
+		"boil",
+		"bois",
+		"boise",
+		"bold",
+		"bole",
+		"bolo",
+		"bolt",
+		"bomb",
+		"bombay",
+		"bon",
+		"bona",
+		"bond",
+		"bone",
+		"bong",
+		"bongo",
+		"bonn",
+		"bonus",
+		"bony",
+		"bonze",
+		"boo",
+		"booby",
+		"boogie",
+		"book",
+		"booky",
+		"boom",
+		"boon",
+		"boone",
+		"boor",
+		"boost",
+		"boot",
+		"booth",
+		"booty",
+		"booze",
+		"bop",
+		"borax",
+		"border",
+		"bore",
+		"borg",
+		"boric",
+		"boris",
+		"born",
+		"borne",
+		"borneo",
+		"boron",
+		"bosch",
+		"bose",
+		"bosom",
+		"boson",
+		"boss",
+		"boston",
+		"botch",
+		"both",
+		"bottle",
+		"bough",
+		"bouncy",
+		"bound",
+		"bourn",
+		"bout",
+		"bovine",
+		"bow",
+		"bowel",
+		"bowen",
+		"bowie",
+		"bowl",
+		"box",
+		"boxy",
+		"boy",
+		"boyar",
+		"boyce",
+		"boyd",
+		"boyle",
+		"bp",
+		"bq",
+		"br",
+		"brace",
+		"bract",
+		"brad",
+		"brady",
+		"brae",
+		"brag",
+		"bragg",
+		"braid",
+		"brain",
+		"brainy",
+		"brake",
+		"bran",
+		"brand",
+		"brandt",
+		"brant",
+		"brash",
+		"brass",
+		"brassy",
+		"braun",
+		"brave",
+		"bravo",
+		"brawl",
+		"bray",
+		"bread",
+		"break",
+		"bream",
+		"breath",
+		"bred",
+		"breed",
+		"breeze",
+		"bremen",
+		"brent",
+		"brest",
+		"brett",
+		"breve",
+		"brew",
+		"brian",
+		"briar",
+		"bribe",
+		"brice",
+		"brick",
+		"bride",
+		"brief",
+		"brig",
+		"briggs",
+		"brim",
+		"brine",
+		"bring",
+		"brink",
+		"briny",
+		"brisk",
+		"broad",
+		"brock",
+		"broil",
+		"broke",
+		"broken",
+		"bronx",
+		"brood",
+		"brook",
+		"brooke",
+		"broom",
+		"broth",
+		"brow",
+		"brown",
+		"browse",
+		"bruce",
+		"bruit",
+		"brunch",
+		"bruno",
+		"brunt",
+		"brush",
+		"brute",
+		"bryan",
+		"bryant",
+		"bryce",
+		"bryn",
+		"bs",
+		"bstj",
+		"bt",
+		"btl",
+		"bu",
+		"bub",
+		"buck",
+		"bud",
+		"budd",
+		"buddy",
+		"budge",
+		"buena",
+		"buenos",
+		"buff",
+		"bug",
+		"buggy",
+		"bugle",
+		"buick",
+		"build",
+		"built",
+		"bulb",
+		"bulge",
+		"bulk",
+		"bulky",
+		"bull",
+		"bully",
+		"bum",
+		"bump",
+		"bun",
+		"bunch",
+		"bundy",
+		"bunk",
+		"bunny",
+		"bunt",
+		"bunyan",
+		"buoy",
+		"burch",
+		"bureau",
+		"buret",
+		"burg",
+		"buried",
+		"burke",
+		"burl",
+		"burly",
+		"burma",
+		"burn",
+		"burnt",
+		"burp",
+		"burr",
+		"burro",
+		"burst",
+		"burt",
+		"burton",
+		"burtt",
+		"bury",
+		"bus",
+		"busch",
+		"bush",
+		"bushel",
+		"bushy",
+		"buss",
+		"bust",
+		"busy",
+		"but",
+		"butane",
+		"butch",
+		"buteo",
+		"butt",
+		"butte",
+		"butyl",
+		"buxom",
+		"buy",
+		"buyer",
+		"buzz",
+		"buzzy",
+		"bv",
+		"bw",
+		"bx",
+		"by",
+		"bye",
+		"byers",
+		"bylaw",
+		"byline",
+		"byrd",
+		"byrne",
+		"byron",
+		"byte",
+		"byway",
+		"byword",
+		"bz",
+		"c",
+		"c's",
+		"ca",
+		"cab",
+		"cabal",
+		"cabin",
+		"cable",
+		"cabot",
+		"cacao",
+		"cache",
+		"cacm",
+		"cacti",
+		"caddy",
+		"cadent",
+		"cadet",
+		"cadre",
+		"cady",
+		"cafe",
+		"cage",
+		"cagey",
+		"cahill",
+		"caiman",
+		"cain",
+		"caine",
+		"cairn",
+		"cairo",
+		"cake",
+		"cal",
+		"calder",
+		"caleb",
+		"calf",
+		"call",
+		"calla",
+		"callus",
+		"calm",
+		"calve",
+		"cam",
+		"camber",
+		"came",
+		"camel",
+		"cameo",
+		"camp",
+		"can",
+		"can't",
+		"canal",
+		"canary",
+		"cancer",
+		"candle",
+		"candy",
+		"cane",
+		"canis",
+		"canna",
+		"cannot",
+		"canny",
+		"canoe",
+		"canon",
+		"canopy",
+		"cant",
+		"canto",
+		"canton",
+		"cap",
+		"cape",
+		"caper",
+		"capo",
+		"car",
+		"carbon",
+		"card",
+		"care",
+		"caress",
+		"caret",
+		"carey",
+		"cargo",
+		"carib",
+		"carl",
+		"carla",
+		"carlo",
+		"carne",
+		"carob",
+		"carol",
+		"carp",
+		"carpet",
+		"carr",
+		"carrie",
+		"carry",
+		"carson",
+		"cart",
+		"carte",
+		"caruso",
+		"carve",
+		"case",
+		"casey",
+		"cash",
+		"cashew",
+		"cask",
+		"casket",
+		"cast",
+		"caste",
+		"cat",
+		"catch",
+		"cater",
+		"cathy",
+		"catkin",
+		"catsup",
+		"cauchy",
+		"caulk",
+		"cause",
+		"cave",
+		"cavern",
+		"cavil",
+		"cavort",
+		"caw",
+		"cayuga",
+		"cb",
+		"cbs",
+		"cc",
+		"ccc",
+		"cccc",
+		"cd",
+		"cdc",
+		"ce",
+		"cease",
+		"cecil",
+		"cedar",
+		"cede",
+		"ceil",
+		"celia",
+		"cell",
+		"census",
+		"cent",
+		"ceres",
+		"cern",
+		"cetera",
+		"cetus",
+		"cf",
+		"cg",
+		"ch",
+		"chad",
+		"chafe",
+		"chaff",
+		"chai",
+		"chain",
+		"chair",
+		"chalk",
+		"champ",
+		"chance",
+		"chang",
+		"chant",
+		"chao",
+		"chaos",
+		"chap",
+		"chapel",
+		"char",
+		"chard",
+		"charm",
+		"chart",
+		"chase",
+		"chasm",
+		"chaste",
+		"chat",
+		"chaw",
+		"cheap",
+		"cheat",
+		"check",
+		"cheek",
+		"cheeky",
+		"cheer",
+		"chef",
+		"chen",
+		"chert",
+		"cherub",
+		"chess",
+		"chest",
+		"chevy",
+		"chew",
+		"chi",
+		"chic",
+		"chick",
+		"chide",
+		"chief",
+		"child",
+		"chile",
+		"chili",
+		"chill",
+		"chilly",
+		"chime",
+		"chin",
+		"china",
+		"chine",
+		"chink",
+		"chip",
+		"chirp",
+		"chisel",
+		"chit",
+		"chive",
+		"chock",
+		"choir",
+		"choke",
+		"chomp",
+		"chop",
+		"chopin",
+		"choral",
+		"chord",
+		"chore",
+		"chose",
+		"chosen",
+		"chou",
+		"chow",
+		"chris",
+		"chub",
+		"chuck",
+		"chuff",
+		"chug",
+		"chum",
+		"chump",
+		"chunk",
+		"churn",
+		"chute",
+		"ci",
+		"cia",
+		"cicada",
+		"cider",
+		"cigar",
+		"cilia",
+		"cinch",
+		"cindy",
+		"cipher",
+		"circa",
+		"circe",
+		"cite",
+		"citrus",
+		"city",
+		"civet",
+		"civic",
+		"civil",
+		"cj",
+		"ck",
+		"cl",
+		"clad",
+		"claim",
+		"clam",
+		"clammy",
+		"clamp",
+		"clan",
+		"clang",
+		"clank",
+		"clap",
+		"clara",
+		"clare",
+		"clark",
+		"clarke",
+		"clash",
+		"clasp",
+		"class",
+		"claus",
+		"clause",
+		"claw",
+		"clay",
+		"clean",
+		"clear",
+		"cleat",
+		"cleft",
+		"clerk",
+		"cliche",
+		"click",
+		"cliff",
+		"climb",
+		"clime",
+		"cling",
+		"clink",
+		"clint",
+		"clio",
+		"clip",
+		"clive",
+		"cloak",
+		"clock",
+		"clod",
+		"clog",
+		"clomp",
+		"clone",
+		"close",
+		"closet",
+		"clot",
+		"cloth",
+		"cloud",
+		"clout",
+		"clove",
+		"clown",
+		"cloy",
+		"club",
+		"cluck",
+		"clue",
+		"cluj",
+		"clump",
+		"clumsy",
+		"clung",
+		"clyde",
+		"cm",
+		"cn",
+		"co",
+		"coach",
+		"coal",
+		"coast",
+		"coat",
+		"coax",
+		"cobb",
+		"cobble",
+		"cobol",
+		"cobra",
+		"coca",
+		"cock",
+		"cockle",
+		"cocky",
+		"coco",
+		"cocoa",
+		"cod",
+		"coda",
+		"coddle",
+		"code",
+		"codon",
+		"cody",
+		"coed",
+		"cog",
+		"cogent",
+		"cohen",
+		"cohn",
+		"coil",
+		"coin",
+		"coke",
+		"col",
+		"cola",
+		"colby",
+		"cold",
+		"cole",
+		"colon",
+		"colony",
+		"colt",
+		"colza",
+		"coma",
+		"comb",
+		"combat",
+		"come",
+		"comet",
+		"cometh",
+		"comic",
+		"comma",
+		"con",
+		"conch",
+		"cone",
+		"coney",
+		"congo",
+		"conic",
+		"conn",
+		"conner",
+		"conway",
+		"cony",
+		"coo",
+		"cook",
+		"cooke",
+		"cooky",
+		"cool",
+		"cooley",
+		"coon",
+		"coop",
+		"coors",
+		"coot",
+		"cop",
+		"cope",
+		"copra",
+		"copy",
+		"coral",
+		"corbel",
+		"cord",
+		"core",
+		"corey",
+		"cork",
+		"corn",
+		"corny",
+		"corp",
+		"corps",
+		"corvus",
+		"cos",
+		"cosec",
+		"coset",
+		"cosh",
+		"cost",
+		"costa",
+		"cosy",
+		"cot",
+		"cotta",
+		"cotty",
+		"couch",
+		"cough",
+		"could",
+		"count",
+		"coup",
+		"coupe",
+		"court",
+		"cousin",
+		"cove",
+		"coven",
+		"cover",
+		"covet",
+		"cow",
+		"cowan",
+		"cowl",
+		"cowman",
+		"cowry",
+		"cox",
+		"coy",
+		"coyote",
+		"coypu",
+		"cozen",
+		"cozy",
+		"cp",
+		"cpa",
+		"cq",
+		"cr",
+		"crab",
+		"crack",
+		"craft",
+		"crag",
+		"craig",
+		"cram",
+		"cramp",
+		"crane",
+		"crank",
+		"crap",
+		"crash",
+		"crass",
+		"crate",
+		"crater",
+		"crave",
+		"craw",
+		"crawl",
+		"craze",
+		"crazy",
+		"creak",
+		"cream",
+		"credit",
+		"credo",
+		"creed",
+		"creek",
+		"creep",
+		"creole",
+		"creon",
+		"crepe",
+		"crept",
+		"cress",
+		"crest",
+		"crete",
+		"crew",
+		"crib",
+		"cried",
+		"crime",
+		"crimp",
+		"crisp",
+		"criss",
+		"croak",
+		"crock",
+		"crocus",
+		"croft",
+		"croix",
+		"crone",
+		"crony",
+		"crook",
+		"croon",
+		"crop",
+		"cross",
+		"crow",
+		"crowd",
+		"crown",
+		"crt",
+		"crud",
+		"crude",
+		"cruel",
+		"crumb",
+		"crump",
+		"crush",
+		"crust",
+		"crux",
+		"cruz",
+		"cry",
+		"crypt",
+		"cs",
+		"ct",
+		"cu",
+		"cub",
+		"cuba",
+		"cube",
+		"cubic",
+		"cud",
+		"cuddle",
+		"cue",
+		"cuff",
+		"cull",
+		"culpa",
+		"cult",
+		"cumin",
+		"cuny",
+		"cup",
+		"cupful",
+		"cupid",
+		"cur",
+		"curb",
+		"curd",
+		"cure",
+		"curfew",
+		"curia",
+		"curie",
+		"curio",
+		"curl",
+		"curry",
+		"curse",
+		"curt",
+		"curve",
+		"cusp",
+		"cut",
+		"cute",
+		"cutlet",
+		"cv",
+		"cw",
+		"cx",
+		"cy",
+		"cycad",
+		"cycle",
+		"cynic",
+		"cyril",
+		"cyrus",
+		"cyst",
+		"cz",
+		"czar",
+		"czech",
+		"d",
+		"d'art",
+		"d's",
+		"da",
+		"dab",
+		"dacca",
+		"dactyl",
+		"dad",
+		"dada",
+		"daddy",
+		"dade",
+		"daffy",
+		"dahl",
+		"dahlia",
+		"dairy",
+		"dais",
+		"daisy",
+		"dakar",
+		"dale",
+		"daley",
+		"dally",
+		"daly",
+		"dam",
+		"dame",
+		"damn",
+		"damon",
+		"damp",
+		"damsel",
+		"dan",
+		"dana",
+		"dance",
+		"dandy",
+		"dane",
+		"dang",
+		"dank",
+		"danny",
+		"dante",
+		"dar",
+		"dare",
+		"dark",
+		"darken",
+		"darn",
+		"darry",
+		"dart",
+		"dash",
+		"data",
+		"date",
+		"dater",
+		"datum",
+		"daub",
+		"daunt",
+		"dave",
+		"david",
+		"davis",
+		"davit",
+		"davy",
+		"dawn",
+		"dawson",
+		"day",
+		"daze",
+		"db",
+		"dc",
+		"dd",
+		"ddd",
+		"dddd",
+		"de",
+		"deacon",
+		"dead",
+		"deaf",
+		"deal",
+		"dealt",
+		"dean",
+		"deane",
+		"dear",
+		"death",
+		"debar",
+		"debby",
+		"debit",
+		"debra",
+		"debris",
+		"debt",
+		"debug",
+		"debut",
+		"dec",
+		"decal",
+		"decay",
+		"decca",
+		"deck",
+		"decker",
+		"decor",
+		"decree",
+		"decry",
+		"dee",
+		"deed",
+		"deem",
+		"deep",
+		"deer",
+		"deere",
+		"def",
+		"defer",
+		"deform",
+		"deft",
+		"defy",
+		"degas",
+		"degum",
+		"deify",
+		"deign",
+		"deity",
+		"deja",
+		"del",
+		"delay",
+		"delft",
+		"delhi",
+		"delia",
+		"dell",
+		"della",
+		"delta",
+		"delve",
+		"demark",
+		"demit",
+		"demon",
+		"demur",
+		"den",
+		"deneb",
+		"denial",
+		"denny",
+		"dense",
+		"dent",
+		"denton",
+		"deny",
+		"depot",
+		"depth",
+		"depute",
+		"derby",
+		"derek",
+		"des",
+		"desist",
+		"desk",
+		"detach",
+		"deter",
+		"deuce",
+		"deus",
+		"devil",
+		"devoid",
+		"devon",
+		"dew",
+		"dewar",
+		"dewey",
+		"dewy",
+		"dey",
+		"df",
+		"dg",
+		"dh",
+		"dhabi",
+		"di",
+		"dial",
+		"diana",
+		"diane",
+		"diary",
+		"dibble",
+		"dice",
+		"dick",
+		"dicta",
+		"did",
+		"dido",
+		"die",
+		"died",
+		"diego",
+		"diem",
+		"diesel",
+		"diet",
+		"diety",
+		"dietz",
+		"dig",
+		"digit",
+		"dilate",
+		"dill",
+		"dim",
+		"dime",
+		"din",
+		"dinah",
+		"dine",
+		"ding",
+		"dingo",
+		"dingy",
+		"dint",
+		"diode",
+		"dip",
+		"dirac",
+		"dire",
+		"dirge",
+		"dirt",
+		"dirty",
+		"dis",
+		"disc",
+		"dish",
+		"disk",
+		"disney",
+		"ditch",
+		"ditto",
+		"ditty",
+		"diva",
+		"divan",
+		"dive",
+		"dixie",
+		"dixon",
+		"dizzy",
+		"dj",
+		"dk",
+		"dl",
+		"dm",
+		"dn",
+		"dna",
+		"do",
+		"dobbs",
+		"dobson",
+		"dock",
+		"docket",
+		"dod",
+		"dodd",
+		"dodge",
+		"dodo",
+		"doe",
+		"doff",
+		"dog",
+		"doge",
+		"dogma",
+		"dolan",
+		"dolce",
+		"dole",
+		"doll",
+		"dolly",
+		"dolt",
+		"dome",
+		"don",
+		"don't",
+		"done",
+		"doneck",
+		"donna",
+		"donor",
+		"doom",
+		"door",
+		"dope",
+		"dora",
+		"doria",
+		"doric",
+		"doris",
+		"dose",
+		"dot",
+		"dote",
+		"double",
+		"doubt",
+		"douce",
+		"doug",
+		"dough",
+		"dour",
+		"douse",
+		"dove",
+		"dow",
+		"dowel",
+		"down",
+		"downs",
+		"dowry",
+		"doyle",
+		"doze",
+		"dozen",
+		"dp",
+		"dq",
+		"dr",
+		"drab",
+		"draco",
+		"draft",
+		"drag",
+		"drain",
+		"drake",
+		"dram",
+		"drama",
+		"drank",
+		"drape",
+		"draw",
+		"drawl",
+		"drawn",
+		"dread",
+		"dream",
+		"dreamy",
+		"dreg",
+		"dress",
+		"dressy",
+		"drew",
+		"drib",
+		"dried",
+		"drier",
+		"drift",
+		"drill",
+		"drink",
+		"drip",
+		"drive",
+		"droll",
+		"drone",
+		"drool",
+		"droop",
+		"drop",
+		"dross",
+		"drove",
+		"drown",
+		"drub",
+		"drug",
+		"druid",
+		"drum",
+		"drunk",
+		"drury",
+		"dry",
+		"dryad",
+		"ds",
+		"dt",
+		"du",
+		"dual",
+		"duane",
+		"dub",
+		"dubhe",
+		"dublin",
+		"ducat",
+		"duck",
+		"duct",
+		"dud",
+		"due",
+		"duel",
+		"duet",
+		"duff",
+		"duffy",
+		"dug",
+		"dugan",
+		"duke",
+		"dull",
+		"dully",
+		"dulse",
+		"duly",
+		"duma",
+		"dumb",
+		"dummy",
+		"dump",
+		"dumpy",
+		"dun",
+		"dunce",
+		"dune",
+		"dung",
+		"dunham",
+		"dunk",
+		"dunlop",
+		"dunn",
+		"dupe",
+		"durer",
+		"dusk",
+		"dusky",
+		"dust",
+		"dusty",
+		"dutch",
+		"duty",
+		"dv",
+		"dw",
+		"dwarf",
+		"dwell",
+		"dwelt",
+		"dwight",
+		"dwyer",
+		"dx",
+		"dy",
+		"dyad",
+		"dye",
+		"dyer",
+		"dying",
+		"dyke",
+		"dylan",
+		"dyne",
+		"dz",
+		"e",
+		"e'er",
+		"e's",
+		"ea",
+		"each",
+		"eagan",
+		"eager",
+		"eagle",
+		"ear",
+		"earl",
+		"earn",
+		"earth",
+		"ease",
+		"easel",
+		"east",
+		"easy",
+		"eat",
+		"eaten",
+		"eater",
+		"eaton",
+		"eave",
+		"eb",
+		"ebb",
+		"eben",
+		"ebony",
+		"ec",
+		"echo",
+		"eclat",
+		"ecole",
+		"ed",
+		"eddie",
+		"eddy",
+		"eden",
+		"edgar",
+		"edge",
+		"edgy",
+		"edict",
+		"edify",
+		"edit",
+		"edith",
+		"editor",
+		"edna",
+		"edt",
+		"edwin",
+		"ee",
+		"eee",
+		"eeee",
+		"eel",
+		"eeoc",
+		"eerie",
+		"ef",
+		"efface",
+		"effie",
+		"efg",
+		"eft",
+		"eg",
+		"egan",
+		"egg",
+		"ego",
+		"egress",
+		"egret",
+		"egypt",
+		"eh",
+		"ei",
+		"eider",
+		"eight",
+		"eire",
+		"ej",
+		"eject",
+		"ek",
+		"eke",
+		"el",
+		"elan",
+		"elate",
+		"elba",
+		"elbow",
+		"elder",
+		"eldon",
+		"elect",
+		"elegy",
+		"elena",
+		"eleven",
+		"elfin",
+		"elgin",
+		"eli",
+		"elide",
+		"eliot",
+		"elite",
+		"elk",
+		"ell",
+		"ella",
+		"ellen",
+		"ellis",
+		"elm",
+		"elmer",
+		"elope",
+		"else",
+		"elsie",
+		"elton",
+		"elude",
+		"elute",
+		"elves",
+		"ely",
+		"em",
+		"embalm",
+		"embark",
+		"embed",
+		"ember",
+		"emcee",
+		"emery",
+		"emil",
+		"emile",
+		"emily",
+		"emit",
+		"emma",
+		"emory",
+		"empty",
+		"en",
+		"enact",
+		"enamel",
+		"end",
+		"endow",
+		"enemy",
+		"eng",
+		"engel",
+		"engle",
+		"engulf",
+		"enid",
+		"enjoy",
+		"enmity",
+		"enoch",
+		"enol",
+		"enos",
+		"enrico",
+		"ensue",
+		"enter",
+		"entrap",
+		"entry",
+		"envoy",
+		"envy",
+		"eo",
+		"ep",
+		"epa",
+		"epic",
+		"epoch",
+		"epoxy",
+		"epsom",
+		"eq",
+		"equal",
+		"equip",
+		"er",
+		"era",
+		"erase",
+		"erato",
+		"erda",
+		"ere",
+		"erect",
+		"erg",
+		"eric",
+		"erich",
+		"erie",
+		"erik",
+		"ernest",
+		"ernie",
+		"ernst",
+		"erode",
+		"eros",
+		"err",
+		"errand",
+		"errol",
+		"error",
+		"erupt",
+		"ervin",
+		"erwin",
+		"es",
+		"essay",
+		"essen",
+		"essex",
+		"est",
+		"ester",
+		"estes",
+		"estop",
+		"et",
+		"eta",
+		"etc",
+		"etch",
+		"ethan",
+		"ethel",
+		"ether",
+		"ethic",
+		"ethos",
+		"ethyl",
+		"etude",
+		"eu",
+		"eucre",
+		"euler",
+		"eureka",
+		"ev",
+		"eva",
+		"evade",
+		"evans",
+		"eve",
+		"even",
+		"event",
+		"every",
+		"evict",
+		"evil",
+		"evoke",
+		"evolve",
+		"ew",
+		"ewe",
+		"ewing",
+		"ex",
+		"exact",
+		"exalt",
+		"exam",
+		"excel",
+		"excess",
+		"exert",
+		"exile",
+		"exist",
+		"exit",
+		"exodus",
+		"expel",
+		"extant",
+		"extent",
+		"extol",
+		"extra",
+		"exude",
+		"exult",
+		"exxon",
+		"ey",
+		"eye",
+		"eyed",
+		"ez",
+		"ezra",
+		"f",
+		"f's",
+		"fa",
+		"faa",
+		"faber",
+		"fable",
+		"face",
+		"facet",
+		"facile",
+		"fact",
+		"facto",
+		"fad",
+		"fade",
+		"faery",
+		"fag",
+		"fahey",
+		"fail",
+		"fain",
+		"faint",
+		"fair",
+		"fairy",
+		"faith",
+		"fake",
+		"fall",
+		"false",
+		"fame",
+		"fan",
+		"fancy",
+		"fang",
+		"fanny",
+		"fanout",
+		"far",
+		"farad",
+		"farce",
+		"fare",
+		"fargo",
+		"farley",
+		"farm",
+		"faro",
+		"fast",
+		"fat",
+		"fatal",
+		"fate",
+		"fatty",
+		"fault",
+		"faun",
+		"fauna",
+		"faust",
+		"fawn",
+		"fay",
+		"faze",
+		"fb",
+		"fbi",
+		"fc",
+		"fcc",
+		"fd",
+		"fda",
+		"fe",
+		"fear",
+		"feast",
+		"feat",
+		"feb",
+		"fed",
+		"fee",
+		"feed",
+		"feel",
+		"feet",
+		"feign",
+		"feint",
+		"felice",
+		"felix",
+		"fell",
+		"felon",
+		"felt",
+		"femur",
+		"fence",
+		"fend",
+		"fermi",
+		"fern",
+		"ferric",
+		"ferry",
+		"fest",
+		"fetal",
+		"fetch",
+		"fete",
+		"fetid",
+		"fetus",
+		"feud",
+		"fever",
+		"few",
+		"ff",
+		"fff",
+		"ffff",
+		"fg",
+		"fgh",
+		"fh",
+		"fi",
+		"fiat",
+		"fib",
+		"fibrin",
+		"fiche",
+		"fide",
+		"fief",
+		"field",
+		"fiend",
+		"fiery",
+		"fife",
+		"fifo",
+		"fifth",
+		"fifty",
+		"fig",
+		"fight",
+		"filch",
+		"file",
+		"filet",
+		"fill",
+		"filler",
+		"filly",
+		"film",
+		"filmy",
+		"filth",
+		"fin",
+		"final",
+		"finale",
+		"finch",
+		"find",
+		"fine",
+		"finite",
+		"fink",
+		"finn",
+		"finny",
+		"fir",
+		"fire",
+		"firm",
+		"first",
+		"fish",
+		"fishy",
+		"fisk",
+		"fiske",
+		"fist",
+		"fit",
+		"fitch",
+		"five",
+		"fix",
+		"fj",
+		"fjord",
+		"fk",
+		"fl",
+		"flack",
+		"flag",
+		"flail",
+		"flair",
+		"flak",
+		"flake",
+		"flaky",
+		"flam",
+		"flame",
+		"flank",
+		"flap",
+		"flare",
+		"flash",
+		"flask",
+		"flat",
+		"flatus",
+		"flaw",
+		"flax",
+		"flea",
+		"fleck",
+		"fled",
+		"flee",
+		"fleet",
+		"flesh",
+		"flew",
+		"flex",
+		"flick",
+		"flier",
+		"flinch",
+		"fling",
+		"flint",
+		"flip",
+		"flirt",
+		"flit",
+		"flo",
+		"float",
+		"floc",
+		"flock",
+		"floe",
+		"flog",
+		"flood",
+		"floor",
+		"flop",
+		"floppy",
+		"flora",
+		"flour",
+		"flout",
+		"flow",
+		"flown",
+		"floyd",
+		"flu",
+		"flub",
+		"flue",
+		"fluff",
+		"fluid",
+		"fluke",
+		"flung",
+		"flush",
+		"flute",
+		"flux",
+		"fly",
+		"flyer",
+		"flynn",
+		"fm",
+		"fmc",
+		"fn",
+		"fo",
+		"foal",
+		"foam",
+		"foamy",
+		"fob",
+		"focal",
+		"foci",
+		"focus",
+		"fodder",
+		"foe",
+		"fog",
+		"foggy",
+		"fogy",
+		"foil",
+		"foist",
+		"fold",
+		"foley",
+		"folio",
+		"folk",
+		"folly",
+		"fond",
+		"font",
+		"food",
+		"fool",
+		"foot",
+		"foote",
+		"fop",
+		"for",
+		"foray",
+		"force",
+		"ford",
+		"fore",
+		"forge",
+		"forgot",
+		"fork",
+		"form",
+		"fort",
+		"forte",
+		"forth",
+		"forty",
+		"forum",
+		"foss",
+		"fossil",
+		"foul",
+		"found",
+		"fount",
+		"four",
+		"fovea",
+		"fowl",
+		"fox",
+		"foxy",
+		"foyer",
+		"fp",
+		"fpc",
+		"fq",
+		"fr",
+		"frail",
+		"frame",
+		"fran",
+		"franc",
+		"franca",
+		"frank",
+		"franz",
+		"frau",
+		"fraud",
+		"fray",
+		"freak",
+		"fred",
+		"free",
+		"freed",
+		"freer",
+		"frenzy",
+		"freon",
+		"fresh",
+		"fret",
+		"freud",
+		"frey",
+		"freya",
+		"friar",
+		"frick",
+		"fried",
+		"frill",
+		"frilly",
+		"frisky",
+		"fritz",
+		"fro",
+		"frock",
+		"frog",
+		"from",
+		"front",
+		"frost",
+		"froth",
+		"frown",
+		"froze",
+		"fruit",
+		"fry",
+		"frye",
+		"fs",
+		"ft",
+		"ftc",
+		"fu",
+		"fuchs",
+		"fudge",
+		"fuel",
+		"fugal",
+		"fugue",
+		"fuji",
+		"full",
+		"fully",
+		"fum",
+		"fume",
+		"fun",
+		"fund",
+		"fungal",
+		"fungi",
+		"funk",
+		"funny",
+		"fur",
+		"furl",
+		"furry",
+		"fury",
+		"furze",
+		"fuse",
+		"fuss",
+		"fussy",
+		"fusty",
+		"fuzz",
+		"fuzzy",
+		"fv",
+		"fw",
+		"fx",
+		"fy",
+		"fz",
+		"g",
+		"g's",
+		"ga",
+		"gab",
+		"gable",
+		"gabon",
+		"gad",
+		"gadget",
+		"gaff",
+		"gaffe",
+		"gag",
+		"gage",
+		"gail",
+		"gain",
+		"gait",
+		"gal",
+		"gala",
+		"galaxy",
+		"gale",
+		"galen",
+		"gall",
+		"gallop",
+		"galt",
+		"gam",
+		"game",
+		"gamin",
+		"gamma",
+		"gamut",
+		"gander",
+		"gang",
+		"gao",
+		"gap",
+		"gape",
+		"gar",
+		"garb",
+		"garish",
+		"garner",
+		"garry",
+		"garth",
+		"gary",
+		"gas",
+		"gash",
+		"gasp",
+		"gassy",
+		"gate",
+		"gates",
+		"gator",
+		"gauche",
+		"gaudy",
+		"gauge",
+		"gaul",
+		"gaunt",
+		"gaur",
+		"gauss",
+		"gauze",
+		"gave",
+		"gavel",
+		"gavin",
+		"gawk",
+		"gawky",
+		"gay",
+		"gaze",
+		"gb",
+		"gc",
+		"gd",
+		"ge",
+		"gear",
+		"gecko",
+		"gee",
+		"geese",
+		"geigy",
+		"gel",
+		"geld",
+		"gem",
+		"gemma",
+		"gene",
+		"genie",
+		"genii",
+		"genoa",
+		"genre",
+		"gent",
+		"gentry",
+		"genus",
+		"gerbil",
+		"germ",
+		"gerry",
+		"get",
+		"getty",
+		"gf",
+		"gg",
+		"ggg",
+		"gggg",
+		"gh",
+		"ghana",
+		"ghent",
+		"ghetto",
+		"ghi",
+		"ghost",
+		"ghoul",
+		"gi",
+		"giant",
+		"gibbs",
+		"gibby",
+		"gibe",
+		"giddy",
+		"gift",
+		"gig",
+		"gil",
+		"gila",
+		"gild",
+		"giles",
+		"gill",
+		"gilt",
+		"gimbal",
+		"gimpy",
+		"gin",
+		"gina",
+		"ginn",
+		"gino",
+		"gird",
+		"girl",
+		"girth",
+		"gist",
+		"give",
+		"given",
+		"gj",
+		"gk",
+		"gl",
+		"glad",
+		"gladdy",
+		"glade",
+		"glamor",
+		"gland",
+		"glans",
+		"glare",
+		"glass",
+		"glaze",
+		"gleam",
+		"glean",
+		"glee",
+		"glen",
+		"glenn",
+		"glib",
+		"glide",
+		"glint",
+		"gloat",
+		"glob",
+		"globe",
+		"glom",
+		"gloom",
+		"glory",
+		"gloss",
+		"glove",
+		"glow",
+		"glue",
+		"glued",
+		"gluey",
+		"gluing",
+		"glum",
+		"glut",
+		"glyph",
+		"gm",
+		"gmt",
+		"gn",
+		"gnarl",
+		"gnash",
+		"gnat",
+		"gnaw",
+		"gnome",
+		"gnp",
+		"gnu",
+		"go",
+		"goa",
+		"goad",
+		"goal",
+		"goat",
+		"gob",
+		"goer",
+		"goes",
+		"goff",
+		"gog",
+		"goggle",
+		"gogh",
+		"gogo",
+		"gold",
+		"golf",
+		"golly",
+		"gone",
+		"gong",
+		"goo",
+		"good",
+		"goode",
+		"goody",
+		"goof",
+		"goofy",
+		"goose",
+		"gop",
+		"gordon",
+		"gore",
+		"goren",
+		"gorge",
+		"gorky",
+		"gorse",
+		"gory",
+		"gosh",
+		"gospel",
+		"got",
+		"gouda",
+		"gouge",
+		"gould",
+		"gourd",
+		"gout",
+		"gown",
+		"gp",
+		"gpo",
+		"gq",
+		"gr",
+		"grab",
+		"grace",
+		"grad",
+		"grade",
+		"grady",
+		"graff",
+		"graft",
+		"grail",
+		"grain",
+		"grand",
+		"grant",
+		"grape",
+		"graph",
+		"grasp",
+		"grass",
+		"grata",
+		"grate",
+		"grater",
+		"grave",
+		"gravy",
+		"gray",
+		"graze",
+		"great",
+		"grebe",
+		"greed",
+		"greedy",
+		"greek",
+		"green",
+		"greer",
+		"greet",
+		"greg",
+		"gregg",
+		"greta",
+		"grew",
+		"grey",
+		"grid",
+		"grief",
+		"grieve",
+		"grill",
+		"grim",
+		"grime",
+		"grimm",
+		"grin",
+		"grind",
+		"grip",
+		"gripe",
+		"grist",
+		"grit",
+		"groan",
+		"groat",
+		"groin",
+		"groom",
+		"grope",
+		"gross",
+		"groton",
+		"group",
+		"grout",
+		"grove",
+		"grow",
+		"growl",
+		"grown",
+		"grub",
+		"gruff",
+		"grunt",
+		"gs",
+		"gsa",
+		"gt",
+		"gu",
+		"guam",
+		"guano",
+		"guard",
+		"guess",
+		"guest",
+		"guide",
+		"guild",
+		"guile",
+		"guilt",
+		"guise",
+		"guitar",
+		"gules",
+		"gulf",
+		"gull",
+		"gully",
+		"gulp",
+		"gum",
+		"gumbo",
+		"gummy",
+		"gun",
+		"gunk",
+		"gunky",
+		"gunny",
+		"gurgle",
+		"guru",
+		"gus",
+		"gush",
+		"gust",
+		"gusto",
+		"gusty",
+		"gut",
+		"gutsy",
+		"guy",
+		"guyana",
+		"gv",
+		"gw",
+		"gwen",
+		"gwyn",
+		"gx",
+		"gy",
+		"gym",
+		"gyp",
+		"gypsy",
+		"gyro",
+		"gz",
+		"h",
+		"h's",
+		"ha",
+		"haag",
+		"haas",
+		"habib",
+		"habit",
+		"hack",
+		"had",
+		"hades",
+		"hadron",
+		"hagen",
+		"hager",
+		"hague",
+		"hahn",
+		"haifa",
+		"haiku",
+		"hail",
+		"hair",
+		"hairy",
+		"haiti",
+		"hal",
+		"hale",
+		"haley",
+		"half",
+		"hall",
+		"halma",
+		"halo",
+		"halt",
+		"halvah",
+		"halve",
+		"ham",
+		"hamal",
+		"hamlin",
+		"han",
+		"hand",
+		"handy",
+		"haney",
+		"hang",
+		"hank",
+		"hanna",
+		"hanoi",
+		"hans",
+		"hansel",
+		"hap",
+		"happy",
+		"hard",
+		"hardy",
+		"hare",
+		"harem",
+		"hark",
+		"harley",
+		"harm",
+		"harp",
+		"harpy",
+		"harry",
+		"harsh",
+		"hart",
+		"harvey",
+		"hash",
+		"hasp",
+		"hast",
+		"haste",
+		"hasty",
+		"hat",
+		"hatch",
+		"hate",
+		"hater",
+		"hath",
+		"hatred",
+		"haul",
+		"haunt",
+		"have",
+		"haven",
+		"havoc",
+		"haw",
+		"hawk",
+		"hay",
+		"haydn",
+		"hayes",
+		"hays",
+		"hazard",
+		"haze",
+		"hazel",
+		"hazy",
+		"hb",
+		"hc",
+		"hd",
+		"he",
+		"he'd",
+		"he'll",
+		"head",
+		"heady",
+		"heal",
+		"healy",
+		"heap",
+		"hear",
+		"heard",
+		"heart",
+		"heat",
+		"heath",
+		"heave",
+		"heavy",
+		"hebe",
+		"hebrew",
+		"heck",
+		"heckle",
+		"hedge",
+		"heed",
+		"heel",
+		"heft",
+		"hefty",
+		"heigh",
+		"heine",
+		"heinz",
+		"heir",
+		"held",
+		"helen",
+		"helga",
+		"helix",
+		"hell",
+		"hello",
+		"helm",
+		"helmut",
+		"help",
+		"hem",
+		"hemp",
+		"hen",
+		"hence",
+		"henri",
+		"henry",
+		"her",
+		"hera",
+		"herb",
+		"herd",
+		"here",
+		"hero",
+		"heroic",
+		"heron",
+		"herr",
+		"hertz",
+		"hess",
+		"hesse",
+		"hettie",
+		"hetty",
+		"hew",
+		"hewitt",
+		"hewn",
+		"hex",
+		"hey",
+		"hf",
+		"hg",
+		"hh",
+		"hhh",
+		"hhhh",
+		"hi",
+		"hiatt",
+		"hick",
+		"hicks",
+		"hid",
+		"hide",
+		"high",
+		"hij",
+		"hike",
+		"hill",
+		"hilly",
+		"hilt",
+		"hilum",
+		"him",
+		"hind",
+		"hindu",
+		"hines",
+		"hinge",
+		"hint",
+		"hip",
+		"hippo",
+		"hippy",
+		"hiram",
+		"hire",
+		"hirsch",
+		"his",
+		"hiss",
+		"hit",
+		"hitch",
+		"hive",
+		"hj",
+		"hk",
+		"hl",
+		"hm",
+		"hn",
+		"ho",
+		"hoagy",
+		"hoar",
+		"hoard",
+		"hob",
+		"hobbs",
+		"hobby",
+		"hobo",
+		"hoc",
+		"hock",
+		"hodge",
+		"hodges",
+		"hoe",
+		"hoff",
+		"hog",
+		"hogan",
+		"hoi",
+		"hokan",
+		"hold",
+		"holdup",
+		"hole",
+		"holly",
+		"holm",
+		"holst",
+		"holt",
+		"home",
+		"homo",
+		"honda",
+		"hondo",
+		"hone",
+		"honey",
+		"hong",
+		"honk",
+		"hooch",
+		"hood",
+		"hoof",
+		"hook",
+		"hookup",
+		"hoop",
+		"hoot",
+		"hop",
+		"hope",
+		"horde",
+		"horn",
+		"horny",
+		"horse",
+		"horus",
+		"hose",
+		"host",
+		"hot",
+		"hotbox",
+		"hotel",
+		"hough",
+		"hound",
+		"hour",
+		"house",
+		"hove",
+		"hovel",
+		"hover",
+		"how",
+		"howdy",
+		"howe",
+		"howl",
+		"hoy",
+		"hoyt",
+		"hp",
+		"hq",
+		"hr",
+		"hs",
+		"ht",
+		"hu",
+		"hub",
+		"hubbub",
+		"hubby",
+		"huber",
+		"huck",
+		"hue",
+		"hued",
+		"huff",
+		"hug",
+		"huge",
+		"hugh",
+		"hughes",
+		"hugo",
+		"huh",
+		"hulk",
+		"hull",
+		"hum",
+		"human",
+		"humid",
+		"hump",
+		"humus",
+		"hun",
+		"hunch",
+		"hung",
+		"hunk",
+		"hunt",
+		"hurd",
+		"hurl",
+		"huron",
+		"hurrah",
+		"hurry",
+		"hurst",
+		"hurt",
+		"hurty",
+		"hush",
+		"husky",
+		"hut",
+		"hutch",
+		"hv",
+		"hw",
+		"hx",
+		"hy",
+		"hyde",
+		"hydra",
+		"hydro",
+		"hyena",
+		"hying",
+		"hyman",
+		"hymen",
+		"hymn",
+		"hymnal",
+		"hz",
+		"i",
+		"i'd",
+		"i'll",
+		"i'm",
+		"i's",
+		"i've",
+		"ia",
+		"iambic",
+		"ian",
+		"ib",
+		"ibex",
+		"ibid",
+		"ibis",
+		"ibm",
+		"ibn",
+		"ic",
+		"icc",
+		"ice",
+		"icing",
+		"icky",
+		"icon",
+		"icy",
+		"id",
+		"ida",
+		"idaho",
+		"idea",
+		"ideal",
+		"idiom",
+		"idiot",
+		"idle",
+		"idol",
+		"idyll",
+		"ie",
+		"ieee",
+		"if",
+		"iffy",
+		"ifni",
+		"ig",
+		"igloo",
+		"igor",
+		"ih",
+		"ii",
+		"iii",
+		"iiii",
+		"ij",
+		"ijk",
+		"ik",
+		"ike",
+		"il",
+		"ileum",
+		"iliac",
+		"iliad",
+		"ill",
+		"illume",
+		"ilona",
+		"im",
+		"image",
+		"imbue",
+		"imp",
+		"impel",
+		"import",
+		"impute",
+		"in",
+		"inane",
+		"inapt",
+		"inc",
+		"inca",
+		"incest",
+		"inch",
+		"incur",
+		"index",
+		"india",
+		"indies",
+		"indy",
+		"inept",
+		"inert",
+		"infect",
+		"infer",
+		"infima",
+		"infix",
+		"infra",
+		"ingot",
+		"inhere",
+		"injun",
+		"ink",
+		"inlay",
+		"inlet",
+		"inman",
+		"inn",
+		"inner",
+		"input",
+		"insect",
+		"inset",
+		"insult",
+		"intend",
+		"inter",
+		"into",
+		"inure",
+		"invoke",
+		"io",
+		"ion",
+		"ionic",
+		"iota",
+		"iowa",
+		"ip",
+		"ipso",
+		"iq",
+		"ir",
+		"ira",
+		"iran",
+		"iraq",
+		"irate",
+		"ire",
+		"irene",
+		"iris",
+		"irish",
+		"irk",
+		"irma",
+		"iron",
+		"irony",
+		"irs",
+		"irvin",
+		"irwin",
+		"is",
+		"isaac",
+		"isabel",
+		"ising",
+		"isis",
+		"islam",
+		"island",
+		"isle",
+		"isn't",
+		"israel",
+		"issue",
+		"it",
+		"it&t",
+		"it'd",
+		"it'll",
+		"italy",
+		"itch",
+		"item",
+		"ito",
+		"itt",
+		"iu",
+		"iv",
+		"ivan",
+		"ive",
+		"ivory",
+		"ivy",
+		"iw",
+		"ix",
+		"iy",
+		"iz",
+		"j",
+		"j's",
+		"ja",
+		"jab",
+		"jack",
+		"jacky",
+		"jacm",
+		"jacob",
+		"jacobi",
+		"jade",
+		"jag",
+		"jail",
+		"jaime",
+		"jake",
+		"jam",
+		"james",
+		"jan",
+		"jane",
+		"janet",
+		"janos",
+		"janus",
+		"japan",
+		"jar",
+		"jason",
+		"java",
+		"jaw",
+		"jay",
+		"jazz",
+		"jazzy",
+		"jb",
+		"jc",
+		"jd",
+		"je",
+		"jean",
+		"jed",
+		"jeep",
+		"jeff",
+		"jejune",
+		"jelly",
+		"jenny",
+		"jeres",
+		"jerk",
+		"jerky",
+		"jerry",
+		"jersey",
+		"jess",
+		"jesse",
+		"jest",
+		"jesus",
+		"jet",
+		"jew",
+		"jewel",
+		"jewett",
+		"jewish",
+		"jf",
+		"jg",
+		"jh",
+		"ji",
+		"jibe",
+		"jiffy",
+		"jig",
+		"jill",
+		"jilt",
+		"jim",
+		"jimmy",
+		"jinx",
+		"jive",
+		"jj",
+		"jjj",
+		"jjjj",
+		"jk",
+		"jkl",
+		"jl",
+		"jm",
+		"jn",
+		"jo",
+		"joan",
+		"job",
+		"jock",
+		"jockey",
+		"joe",
+		"joel",
+		"joey",
+		"jog",
+		"john",
+		"johns",
+		"join",
+		"joint",
+		"joke",
+		"jolla",
+		"jolly",
+		"jolt",
+		"jon",
+		"jonas",
+		"jones",
+		"jorge",
+		"jose",
+		"josef",
+		"joshua",
+		"joss",
+		"jostle",
+		"jot",
+		"joule",
+		"joust",
+		"jove",
+		"jowl",
+		"jowly",
+		"joy",
+		"joyce",
+		"jp",
+		"jq",
+		"jr",
+		"js",
+		"jt",
+		"ju",
+		"juan",
+		"judas",
+		"judd",
+		"jude",
+		"judge",
+		"judo",
+		"judy",
+		"jug",
+		"juggle",
+		"juice",
+		"juicy",
+		"juju",
+		"juke",
+		"jukes",
+		"julep",
+		"jules",
+		"julia",
+		"julie",
+		"julio",
+		"july",
+		"jumbo",
+		"jump",
+		"jumpy",
+		"junco",
+		"june",
+		"junk",
+		"junky",
+		"juno",
+		"junta",
+		"jura",
+		"jure",
+		"juror",
+		"jury",
+		"just",
+		"jut",
+		"jute",
+		"jv",
+		"jw",
+		"jx",
+		"jy",
+		"jz",
+		"k",
+		"k's",
+		"ka",
+		"kabul",
+		"kafka",
+		"kahn",
+		"kajar",
+		"kale",
+		"kalmia",
+		"kane",
+		"kant",
+		"kapok",
+		"kappa",
+		"karate",
+		"karen",
+		"karl",
+		"karma",
+		"karol",
+		"karp",
+		"kate",
+		"kathy",
+		"katie",
+		"katz",
+		"kava",
+		"kay",
+		"kayo",
+		"kazoo",
+		"kb",
+		"kc",
+		"kd",
+		"ke",
+		"keats",
+		"keel",
+		"keen",
+		"keep",
+		"keg",
+		"keith",
+		"keller",
+		"kelly",
+		"kelp",
+		"kemp",
+		"ken",
+		"keno",
+		"kent",
+		"kenya",
+		"kepler",
+		"kept",
+		"kern",
+		"kerr",
+		"kerry",
+		"ketch",
+		"kevin",
+		"key",
+		"keyed",
+		"keyes",
+		"keys",
+		"kf",
+		"kg",
+		"kh",
+		"khaki",
+		"khan",
+		"khmer",
+		"ki",
+		"kick",
+		"kid",
+		"kidde",
+		"kidney",
+		"kiev",
+		"kigali",
+		"kill",
+		"kim",
+		"kin",
+		"kind",
+		"king",
+		"kink",
+		"kinky",
+		"kiosk",
+		"kiowa",
+		"kirby",
+		"kirk",
+		"kirov",
+		"kiss",
+		"kit",
+		"kite",
+		"kitty",
+		"kiva",
+		"kivu",
+		"kiwi",
+		"kj",
+		"kk",
+		"kkk",
+		"kkkk",
+		"kl",
+		"klan",
+		"klaus",
+		"klein",
+		"kline",
+		"klm",
+		"klux",
+		"km",
+		"kn",
+		"knack",
+		"knapp",
+		"knauer",
+		"knead",
+		"knee",
+		"kneel",
+		"knelt",
+		"knew",
+		"knick",
+		"knife",
+		"knit",
+		"knob",
+		"knock",
+		"knoll",
+		"knot",
+		"knott",
+		"know",
+		"known",
+		"knox",
+		"knurl",
+		"ko",
+		"koala",
+		"koch",
+		"kodak",
+		"kola",
+		"kombu",
+		"kong",
+		"koran",
+		"korea",
+		"kp",
+		"kq",
+		"kr",
+		"kraft",
+		"krause",
+		"kraut",
+		"krebs",
+		"kruse",
+		"ks",
+		"kt",
+		"ku",
+		"kudo",
+		"kudzu",
+		"kuhn",
+		"kulak",
+		"kurd",
+		"kurt",
+		"kv",
+		"kw",
+		"kx",
+		"ky",
+		"kyle",
+		"kyoto",
+		"kz",
+		"l",
+		"l's",
+		"la",
+		"lab",
+		"laban",
+		"label",
+		"labia",
+		"labile",
+		"lac",
+		"lace",
+		"lack",
+		"lacy",
+		"lad",
+		"laden",
+		"ladle",
+		"lady",
+		"lag",
+		"lager",
+		"lagoon",
+		"lagos",
+		"laid",
+		"lain",
+		"lair",
+		"laity",
+		"lake",
+		"lam",
+		"lamar",
+		"lamb",
+		"lame",
+		"lamp",
+		"lana",
+		"lance",
+		"land",
+		"lane",
+		"lang",
+		"lange",
+		"lanka",
+		"lanky",
+		"lao",
+		"laos",
+		"lap",
+		"lapel",
+		"lapse",
+		"larch",
+		"lard",
+		"lares",
+		"large",
+		"lark",
+		"larkin",
+		"larry",
+		"lars",
+		"larva",
+		"lase",
+		"lash",
+		"lass",
+		"lasso",
+		"last",
+		"latch",
+		"late",
+		"later",
+		"latest",
+		"latex",
+		"lath",
+		"lathe",
+		"latin",
+		"latus",
+		"laud",
+		"laue",
+		"laugh",
+		"launch",
+		"laura",
+		"lava",
+		"law",
+		"lawn",
+		"lawson",
+		"lax",
+		"lay",
+		"layup",
+		"laze",
+		"lazy",
+		"lb",
+		"lc",
+		"ld",
+		"le",
+		"lea",
+		"leach",
+		"lead",
+		"leaf",
+		"leafy",
+		"leak",
+		"leaky",
+		"lean",
+		"leap",
+		"leapt",
+		"lear",
+		"learn",
+		"lease",
+		"leash",
+		"least",
+		"leave",
+		"led",
+		"ledge",
+		"lee",
+		"leech",
+		"leeds",
+		"leek",
+		"leer",
+		"leery",
+		"leeway",
+		"left",
+		"lefty",
+		"leg",
+		"legal",
+		"leggy",
+		"legion",
+		"leigh",
+		"leila",
+		"leland",
+		"lemma",
+		"lemon",
+		"len",
+		"lena",
+		"lend",
+		"lenin",
+		"lenny",
+		"lens",
+		"lent",
+		"leo",
+		"leon",
+		"leona",
+		"leone",
+		"leper",
+		"leroy",
+		"less",
+		"lessee",
+		"lest",
+		"let",
+		"lethe",
+		"lev",
+		"levee",
+		"level",
+		"lever",
+		"levi",
+		"levin",
+		"levis",
+		"levy",
+		"lew",
+		"lewd",
+		"lewis",
+		"leyden",
+		"lf",
+		"lg",
+		"lh",
+		"li",
+		"liar",
+		"libel",
+		"libido",
+		"libya",
+		"lice",
+		"lick",
+		"lid",
+		"lie",
+		"lied",
+		"lien",
+		"lieu",
+		"life",
+		"lifo",
+		"lift",
+		"light",
+		"like",
+		"liken",
+		"lila",
+		"lilac",
+		"lilly",
+		"lilt",
+		"lily",
+		"lima",
+		"limb",
+		"limbo",
+		"lime",
+		"limit",
+		"limp",
+		"lin",
+		"lind",
+		"linda",
+		"linden",
+		"line",
+		"linen",
+		"lingo",
+		"link",
+		"lint",
+		"linus",
+		"lion",
+		"lip",
+		"lipid",
+		"lisa",
+		"lise",
+		"lisle",
+		"lisp",
+		"list",
+		"listen",
+		"lit",
+		"lithe",
+		"litton",
+		"live",
+		"liven",
+		"livid",
+		"livre",
+		"liz",
+		"lizzie",
+		"lj",
+		"lk",
+		"ll",
+		"lll",
+		"llll",
+		"lloyd",
+		"lm",
+		"lmn",
+		"ln",
+		"lo",
+		"load",
+		"loaf",
+		"loam",
+		"loamy",
+		"loan",
+		"loath",
+		"lob",
+		"lobar",
+		"lobby",
+		"lobe",
+		"lobo",
+		"local",
+		"loci",
+		"lock",
+		"locke",
+		"locus",
+		"lodge",
+		"loeb",
+		"loess",
+		"loft",
+		"lofty",
+		"log",
+		"logan",
+		"loge",
+		"logic",
+		"loin",
+		"loire",
+		"lois",
+		"loiter",
+		"loki",
+		"lola",
+		"loll",
+		"lolly",
+		"lomb",
+		"lome",
+		"lone",
+		"long",
+		"look",
+		"loom",
+		"loon",
+		"loop",
+		"loose",
+		"loot",
+		"lop",
+		"lope",
+		"lopez",
+		"lord",
+		"lore",
+		"loren",
+		"los",
+		"lose",
+		"loss",
+		"lossy",
+		"lost",
+		"lot",
+		"lotte",
+		"lotus",
+		"lou",
+		"loud",
+		"louis",
+		"louise",
+		"louse",
+		"lousy",
+		"louver",
+		"love",
+		"low",
+		"lowe",
+		"lower",
+		"lowry",
+		"loy",
+		"loyal",
+		"lp",
+		"lq",
+		"lr",
+		"ls",
+		"lsi",
+		"lt",
+		"ltv",
+		"lu",
+		"lucas",
+		"lucia",
+		"lucid",
+		"luck",
+		"lucky",
+		"lucre",
+		"lucy",
+		"lug",
+		"luge",
+		"luger",
+		"luis",
+		"luke",
+		"lull",
+		"lulu",
+		"lumbar",
+		"lumen",
+		"lump",
+		"lumpy",
+		"lunar",
+		"lunch",
+		"lund",
+		"lung",
+		"lunge",
+		"lura",
+		"lurch",
+		"lure",
+		"lurid",
+		"lurk",
+		"lush",
+		"lust",
+		"lusty",
+		"lute",
+		"lutz",
+		"lux",
+		"luxe",
+		"luzon",
+		"lv",
+		"lw",
+		"lx",
+		"ly",
+		"lydia",
+		"lye",
+		"lying",
+		"lykes",
+		"lyle",
+		"lyman",
+		"lymph",
+		"lynch",
+		"lynn",
+		"lynx",
+		"lyon",
+		"lyons",
+		"lyra",
+		"lyric",
+		"lz",
+		"m",
+		"m&m",
+		"m's",
+		"ma",
+		"mabel",
+		"mac",
+		"mace",
+		"mach",
+		"macho",
+		"mack",
+		"mackey",
+		"macon",
+		"macro",
+		"mad",
+		"madam",
+		"made",
+		"madman",
+		"madsen",
+		"mae",
+		"magi",
+		"magic",
+		"magma",
+		"magna",
+		"magog",
+		"maid",
+		"maier",
+		"mail",
+		"maim",
+		"main",
+		"maine",
+		"major",
+		"make",
+		"malady",
+		"malay",
+		"male",
+		"mali",
+		"mall",
+		"malt",
+		"malta",
+		"mambo",
+		"mamma",
+		"mammal",
+		"man",
+		"mana",
+		"manama",
+		"mane",
+		"mange",
+		"mania",
+		"manic",
+		"mann",
+		"manna",
+		"manor",
+		"mans",
+		"manse",
+		"mantle",
+		"many",
+		"mao",
+		"maori",
+		"map",
+		"maple",
+		"mar",
+		"marc",
+		"march",
+		"marco",
+		"marcy",
+		"mardi",
+		"mare",
+		"margo",
+		"maria",
+		"marie",
+		"marin",
+		"marine",
+		"mario",
+		"mark",
+		"marks",
+		"marlin",
+		"marrow",
+		"marry",
+		"mars",
+		"marsh",
+		"mart",
+		"marty",
+		"marx",
+		"mary",
+		"maser",
+		"mash",
+		"mask",
+		"mason",
+		"masque",
+		"mass",
+		"mast",
+		"mat",
+		"match",
+		"mate",
+		"mateo",
+		"mater",
+		"math",
+		"matte",
+		"maul",
+		"mauve",
+		"mavis",
+		"maw",
+		"mawr",
+		"max",
+		"maxim",
+		"maxima",
+		"may",
+		"maya",
+		"maybe",
+		"mayer",
+		"mayhem",
+		"mayo",
+		"mayor",
+		"mayst",
+		"mazda",
+		"maze",
+		"mb",
+		"mba",
+		"mc",
+		"mccoy",
+		"mcgee",
+		"mckay",
+		"mckee",
+		"mcleod",
+		"md",
+		"me",
+		"mead",
+		"meal",
+		"mealy",
+		"mean",
+		"meant",
+		"meat",
+		"meaty",
+		"mecca",
+		"mecum",
+		"medal",
+		"medea",
+		"media",
+		"medic",
+		"medley",
+		"meek",
+		"meet",
+		"meg",
+		"mega",
+		"meier",
+		"meir",
+		"mel",
+		"meld",
+		"melee",
+		"mellow",
+		"melon",
+		"melt",
+		"memo",
+		"memoir",
+		"men",
+		"mend",
+		"menlo",
+		"menu",
+		"merck",
+		"mercy",
+		"mere",
+		"merge",
+		"merit",
+		"merle",
+		"merry",
+		"mesa",
+		"mescal",
+		"mesh",
+		"meson",
+		"mess",
+		"messy",
+		"met",
+		"metal",
+		"mete",
+		"meter",
+		"metro",
+		"mew",
+		"meyer",
+		"meyers",
+		"mezzo",
+		"mf",
+		"mg",
+		"mh",
+		"mi",
+		"miami",
+		"mica",
+		"mice",
+		"mickey",
+		"micky",
+		"micro",
+		"mid",
+		"midas",
+		"midge",
+		"midst",
+		"mien",
+		"miff",
+		"mig",
+		"might",
+		"mike",
+		"mila",
+		"milan",
+		"milch",
+		"mild",
+		"mildew",
+		"mile",
+		"miles",
+		"milk",
+		"milky",
+		"mill",
+		"mills",
+		"milt",
+		"mimi",
+		"mimic",
+		"mince",
+		"mind",
+		"mine",
+		"mini",
+		"minim",
+		"mink",
+		"minnow",
+		"minor",
+		"minos",
+		"minot",
+		"minsk",
+		"mint",
+		"minus",
+		"mira",
+		"mirage",
+		"mire",
+		"mirth",
+		"miser",
+		"misery",
+		"miss",
+		"missy",
+		"mist",
+		"misty",
+		"mit",
+		"mite",
+		"mitre",
+		"mitt",
+		"mix",
+		"mixup",
+		"mizar",
+		"mj",
+		"mk",
+		"ml",
+		"mm",
+		"mmm",
+		"mmmm",
+		"mn",
+		"mno",
+		"mo",
+		"moan",
+		"moat",
+		"mob",
+		"mobil",
+		"mock",
+		"modal",
+		"mode",
+		"model",
+		"modem",
+		"modish",
+		"moe",
+		"moen",
+		"mohr",
+		"moire",
+		"moist",
+		"molal",
+		"molar",
+		"mold",
+		"mole",
+		"moll",
+		"mollie",
+		"molly",
+		"molt",
+		"molten",
+		"mommy",
+		"mona",
+		"monad",
+		"mondo",
+		"monel",
+		"money",
+		"monic",
+		"monk",
+		"mont",
+		"monte",
+		"month",
+		"monty",
+		"moo",
+		"mood",
+		"moody",
+		"moon",
+		"moor",
+		"moore",
+		"moose",
+		"moot",
+		"mop",
+		"moral",
+		"morale",
+		"moran",
+		"more",
+		"morel",
+		"morn",
+		"moron",
+		"morse",
+		"morsel",
+		"mort",
+		"mosaic",
+		"moser",
+		"moses",
+		"moss",
+		"mossy",
+		"most",
+		"mot",
+		"motel",
+		"motet",
+		"moth",
+		"mother",
+		"motif",
+		"motor",
+		"motto",
+		"mould",
+		"mound",
+		"mount",
+		"mourn",
+		"mouse",
+		"mousy",
+		"mouth",
+		"move",
+		"movie",
+		"mow",
+		"moyer",
+		"mp",
+		"mph",
+		"mq",
+		"mr",
+		"mrs",
+		"ms",
+		"mt",
+		"mu",
+		"much",
+		"muck",
+		"mucus",
+		"mud",
+		"mudd",
+		"muddy",
+		"muff",
+		"muffin",
+		"mug",
+		"muggy",
+		"mugho",
+		"muir",
+		"mulch",
+		"mulct",
+		"mule",
+		"mull",
+		"multi",
+		"mum",
+		"mummy",
+		"munch",
+		"mung",
+		"munson",
+		"muon",
+		"muong",
+		"mural",
+		"muriel",
+		"murk",
+		"murky",
+		"murre",
+		"muse",
+		"mush",
+		"mushy",
+		"music",
+		"musk",
+		"muslim",
+		"must",
+		"musty",
+		"mute",
+		"mutt",
+		"muzak",
+		"muzo",
+		"mv",
+		"mw",
+		"mx",
+		"my",
+		"myel",
+		"myers",
+		"mylar",
+		"mynah",
+		"myopia",
+		"myra",
+		"myron",
+		"myrrh",
+		"myself",
+		"myth",
+		"mz",
+		"n",
+		"n's",
+		"na",
+		"naacp",
+		"nab",
+		"nadir",
+		"nag",
+		"nagoya",
+		"nagy",
+		"naiad",
+		"nail",
+		"nair",
+		"naive",
+		"naked",
+		"name",
+		"nan",
+		"nancy",
+		"naomi",
+		"nap",
+		"nary",
+		"nasa",
+		"nasal",
+		"nash",
+		"nasty",
+		"nat",
+		"natal",
+		"nate",
+		"nato",
+		"natty",
+		"nature",
+		"naval",
+		"nave",
+		"navel",
+		"navy",
+		"nay",
+		"nazi",
+		"nb",
+		"nbc",
+		"nbs",
+		"nc",
+		"ncaa",
+		"ncr",
+		"nd",
+		"ne",
+		"neal",
+		"near",
+		"neat",
+		"neath",
+		"neck",
+		"ned",
+		"nee",
+		"need",
+		"needy",
+		"neff",
+		"negate",
+		"negro",
+		"nehru",
+		"neil",
+		"nell",
+		"nelsen",
+		"neon",
+		"nepal",
+		"nero",
+		"nerve",
+		"ness",
+		"nest",
+		"net",
+		"neuron",
+		"neva",
+		"neve",
+		"new",
+		"newel",
+		"newt",
+		"next",
+		"nf",
+		"ng",
+		"nh",
+		"ni",
+		"nib",
+		"nibs",
+		"nice",
+		"nicety",
+		"niche",
+		"nick",
+		"niece",
+		"niger",
+		"nigh",
+		"night",
+		"nih",
+		"nikko",
+		"nil",
+		"nile",
+		"nimbus",
+		"nimh",
+		"nina",
+		"nine",
+		"ninth",
+		"niobe",
+		"nip",
+		"nit",
+		"nitric",
+		"nitty",
+		"nixon",
+		"nj",
+		"nk",
+		"nl",
+		"nm",
+		"nn",
+		"nnn",
+		"nnnn",
+		"no",
+		"noaa",
+		"noah",
+		"nob",
+		"nobel",
+		"noble",
+		"nod",
+		"nodal",
+		"node",
+		"noel",
+		"noise",
+		"noisy",
+		"nolan",
+		"noll",
+		"nolo",
+		"nomad",
+		"non",
+		"nonce",
+		"none",
+		"nook",
+		"noon",
+		"noose",
+		"nop",
+		"nor",
+		"nora",
+		"norm",
+		"norma",
+		"north",
+		"norway",
+		"nose",
+		"not",
+		"notch",
+		"note",
+		"notre",
+		"noun",
+		"nov",
+		"nova",
+		"novak",
+		"novel",
+		"novo",
+		"now",
+		"np",
+		"nq",
+		"nr",
+		"nrc",
+		"ns",
+		"nsf",
+		"nt",
+		"ntis",
+		"nu",
+		"nuance",
+		"nubia",
+		"nuclei",
+		"nude",
+		"nudge",
+		"null",
+		"numb",
+		"nun",
+		"nurse",
+		"nut",
+		"nv",
+		"nw",
+		"nx",
+		"ny",
+		"nyc",
+		"nylon",
+		"nymph",
+		"nyu",
+		"nz",
+		"o",
+		"o'er",
+		"o's",
+		"oa",
+		"oaf",
+		"oak",
+		"oaken",
+		"oakley",
+		"oar",
+		"oases",
+		"oasis",
+		"oat",
+		"oath",
+		"ob",
+		"obese",
+		"obey",
+		"objet",
+		"oboe",
+		"oc",
+		"occur",
+		"ocean",
+		"oct",
+		"octal",
+		"octave",
+		"octet",
+		"od",
+		"odd",
+		"ode",
+		"odin",
+		"odium",
+		"oe",
+		"of",
+		"off",
+		"offal",
+		"offend",
+		"offer",
+		"oft",
+		"often",
+		"og",
+		"ogden",
+		"ogle",
+		"ogre",
+		"oh",
+		"ohio",
+		"ohm",
+		"ohmic",
+		"oi",
+		"oil",
+		"oily",
+		"oint",
+		"oj",
+		"ok",
+		"okay",
+		"ol",
+		"olaf",
+		"olav",
+		"old",
+		"olden",
+		"oldy",
+		"olga",
+		"olin",
+		"olive",
+		"olsen",
+		"olson",
+		"om",
+		"omaha",
+		"oman",
+		"omega",
+		"omen",
+		"omit",
+		"on",
+		"once",
+		"one",
+		"onion",
+		"only",
+		"onset",
+		"onto",
+		"onus",
+		"onward",
+		"onyx",
+		"oo",
+		"ooo",
+		"oooo",
+		"ooze",
+		"op",
+		"opal",
+		"opec",
+		"opel",
+		"open",
+		"opera",
+		"opium",
+		"opt",
+		"optic",
+		"opus",
+		"oq",
+		"or",
+		"oral",
+		"orate",
+		"orb",
+		"orbit",
+		"orchid",
+		"ordain",
+		"order",
+		"ore",
+		"organ",
+		"orgy",
+		"orin",
+		"orion",
+		"ornery",
+		"orono",
+		"orr",
+		"os",
+		"osaka",
+		"oscar",
+		"osier",
+		"oslo",
+		"ot",
+		"other",
+		"otis",
+		"ott",
+		"otter",
+		"otto",
+		"ou",
+		"ouch",
+		"ought",
+		"ounce",
+		"our",
+		"oust",
+		"out",
+		"ouvre",
+		"ouzel",
+		"ouzo",
+		"ov",
+		"ova",
+		"oval",
+		"ovary",
+		"ovate",
+		"oven",
+		"over",
+		"overt",
+		"ovid",
+		"ow",
+		"owe",
+		"owens",
+		"owing",
+		"owl",
+		"owly",
+		"own",
+		"ox",
+		"oxen",
+		"oxeye",
+		"oxide",
+		"oxnard",
+		"oy",
+		"oz",
+		"ozark",
+		"ozone",
+		"p",
+		"p's",
+		"pa",
+		"pablo",
+		"pabst",
+		"pace",
+		"pack",
+		"packet",
+		"pact",
+		"pad",
+		"paddy",
+		"padre",
+		"paean",
+		"pagan",
+		"page",
+		"paid",
+		"pail",
+		"pain",
+		"paine",
+		"paint",
+		"pair",
+		"pal",
+		"pale",
+		"pall",
+		"palm",
+		"palo",
+		"palsy",
+		"pam",
+		"pampa",
+		"pan",
+		"panama",
+		"panda",
+		"pane",
+		"panel",
+		"pang",
+		"panic",
+		"pansy",
+		"pant",
+		"panty",
+		"paoli",
+		"pap",
+		"papa",
+		"papal",
+		"papaw",
+		"paper",
+		"pappy",
+		"papua",
+		"par",
+		"parch",
+		"pardon",
+		"pare",
+		"pareto",
+		"paris",
+		"park",
+		"parke",
+		"parks",
+		"parr",
+		"parry",
+		"parse",
+		"part",
+		"party",
+		"pascal",
+		"pasha",
+		"paso",
+		"pass",
+		"passe",
+		"past",
+		"paste",
+		"pasty",
+		"pat",
+		"patch",
+		"pate",
+		"pater",
+		"path",
+		"patio",
+		"patsy",
+		"patti",
+		"patton",
+		"patty",
+		"paul",
+		"paula",
+		"pauli",
+		"paulo",
+		"pause",
+		"pave",
+		"paw",
+		"pawn",
+		"pax",
+		"pay",
+		"payday",
+		"payne",
+		"paz",
+		"pb",
+		"pbs",
+		"pc",
+		"pd",
+		"pe",
+		"pea",
+		"peace",
+		"peach",
+		"peak",
+		"peaky",
+		"peal",
+		"peale",
+		"pear",
+		"pearl",
+		"pease",
+		"peat",
+		"pebble",
+		"pecan",
+		"peck",
+		"pecos",
+		"pedal",
+		"pedro",
+		"pee",
+		"peed",
+		"peek",
+		"peel",
+		"peep",
+		"peepy",
+		"peer",
+		"peg",
+		"peggy",
+		"pelt",
+		"pen",
+		"penal",
+		"pence",
+		"pencil",
+		"pend",
+		"penh",
+		"penn",
+		"penna",
+		"penny",
+		"pent",
+		"peony",
+		"pep",
+		"peppy",
+		"pepsi",
+		"per",
+		"perch",
+		"percy",
+		"perez",
+		"peril",
+		"perk",
+		"perky",
+		"perle",
+		"perry",
+		"persia",
+		"pert",
+		"perth",
+		"peru",
+		"peruse",
+		"pest",
+		"peste",
+		"pet",
+		"petal",
+		"pete",
+		"peter",
+		"petit",
+		"petri",
+		"petty",
+		"pew",
+		"pewee",
+		"pf",
+		"pg",
+		"ph",
+		"ph.d",
+		"phage",
+		"phase",
+		"phd",
+		"phenol",
+		"phi",
+		"phil",
+		"phlox",
+		"phon",
+		"phone",
+		"phony",
+		"photo",
+		"phyla",
+		"physic",
+		"pi",
+		"piano",
+		"pica",
+		"pick",
+		"pickup",
+		"picky",
+		"pie",
+		"piece",
+		"pier",
+		"pierce",
+		"piety",
+		"pig",
+		"piggy",
+		"pike",
+		"pile",
+		"pill",
+		"pilot",
+		"pimp",
+		"pin",
+		"pinch",
+		"pine",
+		"ping",
+		"pinion",
+		"pink",
+		"pint",
+		"pinto",
+		"pion",
+		"piotr",
+		"pious",
+		"pip",
+		"pipe",
+		"piper",
+		"pique",
+		"pit",
+		"pitch",
+		"pith",
+		"pithy",
+		"pitney",
+		"pitt",
+		"pity",
+		"pius",
+		"pivot",
+		"pixel",
+		"pixy",
+		"pizza",
+		"pj",
+		"pk",
+		"pl",
+		"place",
+		"plague",
+		"plaid",
+		"plain",
+		"plan",
+		"plane",
+		"plank",
+		"plant",
+		"plasm",
+		"plat",
+		"plate",
+		"plato",
+		"play",
+		"playa",
+		"plaza",
+		"plea",
+		"plead",
+		"pleat",
+		"pledge",
+		"pliny",
+		"plod",
+		"plop",
+		"plot",
+		"plow",
+		"pluck",
+		"plug",
+		"plum",
+		"plumb",
+		"plume",
+		"plump",
+		"plunk",
+		"plus",
+		"plush",
+		"plushy",
+		"pluto",
+		"ply",
+		"pm",
+		"pn",
+		"po",
+		"poach",
+		"pobox",
+		"pod",
+		"podge",
+		"podia",
+		"poe",
+		"poem",
+		"poesy",
+		"poet",
+		"poetry",
+		"pogo",
+		"poi",
+		"point",
+		"poise",
+		"poke",
+		"pol",
+		"polar",
+		"pole",
+		"police",
+		"polio",
+		"polis",
+		"polk",
+		"polka",
+		"poll",
+		"polo",
+		"pomona",
+		"pomp",
+		"ponce",
+		"pond",
+		"pong",
+		"pont",
+		"pony",
+		"pooch",
+		"pooh",
+		"pool",
+		"poole",
+		"poop",
+		"poor",
+		"pop",
+		"pope",
+		"poppy",
+		"porch",
+		"pore",
+		"pork",
+		"porous",
+		"port",
+		"porte",
+		"portia",
+		"porto",
+		"pose",
+		"posey",
+		"posh",
+		"posit",
+		"posse",
+		"post",
+		"posy",
+		"pot",
+		"potts",
+		"pouch",
+		"pound",
+		"pour",
+		"pout",
+		"pow",
+		"powder",
+		"power",
+		"pp",
+		"ppm",
+		"ppp",
+		"pppp",
+		"pq",
+		"pqr",
+		"pr",
+		"prado",
+		"pram",
+		"prank",
+		"pratt",
+		"pray",
+		"preen",
+		"prefix",
+		"prep",
+		"press",
+		"prexy",
+		"prey",
+		"priam",
+		"price",
+		"prick",
+		"pride",
+		"prig",
+		"prim",
+		"prima",
+		"prime",
+		"primp",
+		"prince",
+		"print",
+		"prior",
+		"prism",
+		"prissy",
+		"privy",
+		"prize",
+		"pro",
+		"probe",
+		"prod",
+		"prof",
+		"prom",
+		"prone",
+		"prong",
+		"proof",
+		"prop",
+		"propyl",
+		"prose",
+		"proud",
+		"prove",
+		"prow",
+		"prowl",
+		"proxy",
+		"prune",
+		"pry",
+		"ps",
+		"psalm",
+		"psi",
+		"psych",
+		"pt",
+		"pta",
+		"pu",
+		"pub",
+		"puck",
+		"puddly",
+		"puerto",
+		"puff",
+		"puffy",
+		"pug",
+		"pugh",
+		"puke",
+		"pull",
+		"pulp",
+		"pulse",
+		"puma",
+		"pump",
+		"pun",
+		"punch",
+		"punic",
+		"punish",
+		"punk",
+		"punky",
+		"punt",
+		"puny",
+		"pup",
+		"pupal",
+		"pupil",
+		"puppy",
+		"pure",
+		"purge",
+		"purl",
+		"purr",
+		"purse",
+		"pus",
+		"pusan",
+		"pusey",
+		"push",
+		"pussy",
+		"put",
+		"putt",
+		"putty",
+		"pv",
+		"pvc",
+		"pw",
+		"px",
+		"py",
+		"pygmy",
+		"pyle",
+		"pyre",
+		"pyrex",
+		"pyrite",
+		"pz",
+		"q",
+		"q's",
+		"qa",
+		"qatar",
+		"qb",
+		"qc",
+		"qd",
+		"qe",
+		"qed",
+		"qf",
+		"qg",
+		"qh",
+		"qi",
+		"qj",
+		"qk",
+		"ql",
+		"qm",
+		"qn",
+		"qo",
+		"qp",
+		"qq",
+		"qqq",
+		"qqqq",
+		"qr",
+		"qrs",
+		"qs",
+		"qt",
+		"qu",
+		"qua",
+		"quack",
+		"quad",
+		"quaff",
+		"quail",
+		"quake",
+		"qualm",
+		"quark",
+		"quarry",
+		"quart",
+		"quash",
+		"quasi",
+		"quay",
+		"queasy",
+		"queen",
+		"queer",
+		"quell",
+		"query",
+		"quest",
+		"queue",
+		"quick",
+		"quid",
+		"quiet",
+		"quill",
+		"quilt",
+		"quinn",
+		"quint",
+		"quip",
+		"quirk",
+		"quirt",
+		"quit",
+		"quite",
+		"quito",
+		"quiz",
+		"quo",
+		"quod",
+		"quota",
+		"quote",
+		"qv",
+		"qw",
+		"qx",
+		"qy",
+		"qz",
+		"r",
+		"r&d",
+		"r's",
+		"ra",
+		"rabat",
+		"rabbi",
+		"rabbit",
+		"rabid",
+		"rabin",
+		"race",
+		"rack",
+		"racy",
+		"radar",
+		"radii",
+		"radio",
+		"radium",
+		"radix",
+		"radon",
+		"rae",
+		"rafael",
+		"raft",
+		"rag",
+		"rage",
+		"raid",
+		"rail",
+		"rain",
+		"rainy",
+		"raise",
+		"raj",
+		"rajah",
+		"rake",
+		"rally",
+		"ralph",
+		"ram",
+		"raman",
+		"ramo",
+		"ramp",
+		"ramsey",
+		"ran",
+		"ranch",
+		"rand",
+		"randy",
+		"rang",
+		"range",
+		"rangy",
+		"rank",
+		"rant",
+		"raoul",
+		"rap",
+		"rape",
+		"rapid",
+		"rapt",
+		"rare",
+		"rasa",
+		"rascal",
+		"rash",
+		"rasp",
+		"rat",
+		"rata",
+		"rate",
+		"rater",
+		"ratio",
+		"rattle",
+		"raul",
+		"rave",
+		"ravel",
+		"raven",
+		"raw",
+		"ray",
+		"raze",
+		"razor",
+		"rb",
+		"rc",
+		"rca",
+		"rd",
+		"re",
+		"reach",
+		"read",
+		"ready",
+		"reagan",
+		"real",
+		"realm",
+		"ream",
+		"reap",
+		"rear",
+		"reave",
+		"reb",
+		"rebel",
+		"rebut",
+		"recipe",
+		"reck",
+		"recur",
+		"red",
+		"redeem",
+		"reduce",
+		"reed",
+		"reedy",
+		"reef",
+		"reek",
+		"reel",
+		"reese",
+		"reeve",
+		"refer",
+		"regal",
+		"regina",
+		"regis",
+		"reich",
+		"reid",
+		"reign",
+		"rein",
+		"relax",
+		"relay",
+		"relic",
+		"reman",
+		"remedy",
+		"remit",
+		"remus",
+		"rena",
+		"renal",
+		"rend",
+		"rene",
+		"renown",
+		"rent",
+		"rep",
+		"repel",
+		"repent",
+		"resin",
+		"resort",
+		"rest",
+		"ret",
+		"retch",
+		"return",
+		"reub",
+		"rev",
+		"reveal",
+		"revel",
+		"rever",
+		"revet",
+		"revved",
+		"rex",
+		"rf",
+		"rg",
+		"rh",
+		"rhea",
+		"rheum",
+		"rhine",
+		"rhino",
+		"rho",
+		"rhoda",
+		"rhode",
+		"rhyme",
+		"ri",
+		"rib",
+		"rica",
+		"rice",
+		"rich",
+		"rick",
+		"rico",
+		"rid",
+		"ride",
+		"ridge",
+		"rifle",
+		"rift",
+		"rig",
+		"riga",
+		"rigel",
+		"riggs",
+		"right",
+		"rigid",
+		"riley",
+		"rill",
+		"rilly",
+		"rim",
+		"rime",
+		"rimy",
+		"ring",
+		"rink",
+		"rinse",
+		"rio",
+		"riot",
+		"rip",
+		"ripe",
+		"ripen",
+		"ripley",
+		"rise",
+		"risen",
+		"risk",
+		"risky",
+		"rite",
+		"ritz",
+		"rival",
+		"riven",
+		"river",
+		"rivet",
+		"riyadh",
+		"rj",
+		"rk",
+		"rl",
+		"rm",
+		"rn",
+		"ro",
+		"roach",
+		"road",
+		"roam",
+		"roar",
+		"roast",
+		"rob",
+		"robe",
+		"robin",
+		"robot",
+		"rock",
+		"rocket",
+		"rocky",
+		"rod",
+		"rode",
+		"rodeo",
+		"roe",
+		"roger",
+		"rogue",
+		"roil",
+		"role",
+		"roll",
+		"roman",
+		"rome",
+		"romeo",
+		"romp",
+		"ron",
+		"rondo",
+		"rood",
+		"roof",
+		"rook",
+		"rookie",
+		"rooky",
+		"room",
+		"roomy",
+		"roost",
+		"root",
+		"rope",
+		"rosa",
+		"rose",
+		"rosen",
+		"ross",
+		"rosy",
+		"rot",
+		"rotc",
+		"roth",
+		"rotor",
+		"rouge",
+		"rough",
+		"round",
+		"rouse",
+		"rout",
+		"route",
+		"rove",
+		"row",
+		"rowdy",
+		"rowe",
+		"roy",
+		"royal",
+		"royce",
+		"rp",
+		"rpm",
+		"rq",
+		"rr",
+		"rrr",
+		"rrrr",
+		"rs",
+		"rst",
+		"rsvp",
+		"rt",
+		"ru",
+		"ruanda",
+		"rub",
+		"rube",
+		"ruben",
+		"rubin",
+		"rubric",
+		"ruby",
+		"ruddy",
+		"rude",
+		"rudy",
+		"rue",
+		"rufus",
+		"rug",
+		"ruin",
+		"rule",
+		"rum",
+		"rumen",
+		"rummy",
+		"rump",
+		"rumpus",
+		"run",
+		"rune",
+		"rung",
+		"runge",
+		"runic",
+		"runt",
+		"runty",
+		"rupee",
+		"rural",
+		"ruse",
+		"rush",
+		"rusk",
+		"russ",
+		"russo",
+		"rust",
+		"rusty",
+		"rut",
+		"ruth",
+		"rutty",
+		"rv",
+		"rw",
+		"rx",
+		"ry",
+		"ryan",
+		"ryder",
+		"rye",
+		"rz",
+		"s",
+		"s's",
+		"sa",
+		"sabine",
+		"sable",
+		"sabra",
+		"sac",
+		"sachs",
+		"sack",
+		"sad",
+		"saddle",
+		"sadie",
+		"safari",
+		"safe",
+		"sag",
+		"saga",
+		"sage",
+		"sago",
+		"said",
+		"sail",
+		"saint",
+		"sake",
+		"sal",
+		"salad",
+		"sale",
+		"salem",
+		"saline",
+		"salk",
+		"salle",
+		"sally",
+		"salon",
+		"salt",
+		"salty",
+		"salve",
+		"salvo",
+		"sam",
+		"samba",
+		"same",
+		"sammy",
+		"samoa",
+		"samuel",
+		"san",
+		"sana",
+		"sand",
+		"sandal",
+		"sandy",
+		"sane",
+		"sang",
+		"sank",
+		"sans",
+		"santa",
+		"santo",
+		"sao",
+		"sap",
+		"sappy",
+		"sara",
+		"sarah",
+		"saran",
+		"sari",
+		"sash",
+		"sat",
+		"satan",
+		"satin",
+		"satyr",
+		"sauce",
+		"saucy",
+		"saud",
+		"saudi",
+		"saul",
+		"sault",
+		"saute",
+		"save",
+		"savoy",
+		"savvy",
+		"saw",
+		"sawyer",
+		"sax",
+		"saxon",
+		"say",
+		"sb",
+		"sc",
+		"scab",
+		"scala",
+		"scald",
+		"scale",
+		"scalp",
+		"scam",
+		"scamp",
+		"scan",
+		"scant",
+		"scar",
+		"scare",
+		"scarf",
+		"scary",
+		"scat",
+		"scaup",
+		"scene",
+		"scent",
+		"school",
+		"scion",
+		"scm",
+		"scoff",
+		"scold",
+		"scoop",
+		"scoot",
+		"scope",
+		"scops",
+		"score",
+		"scoria",
+		"scorn",
+		"scot",
+		"scott",
+		"scour",
+		"scout",
+		"scowl",
+		"scram",
+		"scrap",
+		"scrape",
+		"screw",
+		"scrim",
+		"scrub",
+		"scuba",
+		"scud",
+		"scuff",
+		"scull",
+		"scum",
+		"scurry",
+		"sd",
+		"se",
+		"sea",
+		"seal",
+		"seam",
+		"seamy",
+		"sean",
+		"sear",
+		"sears",
+		"season",
+		"seat",
+		"sec",
+		"secant",
+		"sect",
+		"sedan",
+		"seder",
+		"sedge",
+		"see",
+		"seed",
+		"seedy",
+		"seek",
+		"seem",
+		"seen",
+		"seep",
+		"seethe",
+		"seize",
+		"self",
+		"sell",
+		"selma",
+		"semi",
+		"sen",
+		"send",
+		"seneca",
+		"senor",
+		"sense",
+		"sent",
+		"sentry",
+		"seoul",
+		"sepal",
+		"sepia",
+		"sepoy",
+		"sept",
+		"septa",
+		"sequin",
+		"sera",
+		"serf",
+		"serge",
+		"serif",
+		"serum",
+		"serve",
+		"servo",
+		"set",
+		"seth",
+		"seton",
+		"setup",
+		"seven",
+		"sever",
+		"severe",
+		"sew",
+		"sewn",
+		"sex",
+		"sexy",
+		"sf",
+		"sg",
+		"sh",
+		"shack",
+		"shad",
+		"shade",
+		"shady",
+		"shafer",
+		"shaft",
+		"shag",
+		"shah",
+		"shake",
+		"shaken",
+		"shako",
+		"shaky",
+		"shale",
+		"shall",
+		"sham",
+		"shame",
+		"shank",
+		"shape",
+		"shard",
+		"share",
+		"shari",
+		"shark",
+		"sharp",
+		"shave",
+		"shaw",
+		"shawl",
+		"shay",
+		"she",
+		"she'd",
+		"shea",
+		"sheaf",
+		"shear",
+		"sheath",
+		"shed",
+		"sheen",
+		"sheep",
+		"sheer",
+		"sheet",
+		"sheik",
+		"shelf",
+		"shell",
+		"shied",
+		"shift",
+		"shill",
+		"shim",
+		"shin",
+		"shine",
+		"shinto",
+		"shiny",
+		"ship",
+		"shire",
+		"shirk",
+		"shirt",
+		"shish",
+		"shiv",
+		"shoal",
+		"shock",
+		"shod",
+		"shoe",
+		"shoji",
+		"shone",
+		"shoo",
+		"shook",
+		"shoot",
+		"shop",
+		"shore",
+		"short",
+		"shot",
+		"shout",
+		"shove",
+		"show",
+		"shown",
+		"showy",
+		"shrank",
+		"shred",
+		"shrew",
+		"shrike",
+		"shrub",
+		"shrug",
+		"shu",
+		"shuck",
+		"shun",
+		"shunt",
+		"shut",
+		"shy",
+		"si",
+		"sial",
+		"siam",
+		"sian",
+		"sib",
+		"sibley",
+		"sibyl",
+		"sic",
+		"sick",
+		"side",
+		"sidle",
+		"siege",
+		"siena",
+		"sieve",
+		"sift",
+		"sigh",
+		"sight",
+		"sigma",
+		"sign",
+		"signal",
+		"signor",
+		"silas",
+		"silk",
+		"silky",
+		"sill",
+		"silly",
+		"silo",
+		"silt",
+		"silty",
+		"sima",
+		"simon",
+		"simons",
+		"sims",
+		"sin",
+		"sinai",
+		"since",
+		"sine",
+		"sinew",
+		"sing",
+		"singe",
+		"sinh",
+		"sink",
+		"sinus",
+		"sioux",
+		"sip",
+		"sir",
+		"sire",
+		"siren",
+		"sis",
+		"sisal",
+		"sit",
+		"site",
+		"situ",
+		"situs",
+		"siva",
+		"six",
+		"sixgun",
+		"sixth",
+		"sixty",
+		"size",
+		"sj",
+		"sk",
+		"skat",
+		"skate",
+		"skeet",
+		"skew",
+		"ski",
+		"skid",
+		"skied",
+		"skiff",
+		"skill",
+		"skim",
+		"skimp",
+		"skimpy",
+		"skin",
+		"skip",
+		"skirt",
+		"skit",
+		"skulk",
+		"skull",
+		"skunk",
+		"sky",
+		"skye",
+		"sl",
+		"slab",
+		"slack",
+		"slag",
+		"slain",
+		"slake",
+		"slam",
+		"slang",
+		"slant",
+		"slap",
+		"slash",
+		"slat",
+		"slate",
+		"slater",
+		"slav",
+		"slave",
+		"slay",
+		"sled",
+		"sleek",
+		"sleep",
+		"sleet",
+		"slept",
+		"slew",
+		"slice",
+		"slick",
+		"slid",
+		"slide",
+		"slim",
+		"slime",
+		"slimy",
+		"sling",
+		"slip",
+		"slit",
+		"sliver",
+		"sloan",
+		"slob",
+		"sloe",
+		"slog",
+		"sloop",
+		"slop",
+		"slope",
+		"slosh",
+		"slot",
+		"sloth",
+		"slow",
+		"slug",
+		"sluice",
+		"slum",
+		"slump",
+		"slung",
+		"slur",
+		"slurp",
+		"sly",
+		"sm",
+		"smack",
+		"small",
+		"smart",
+		"smash",
+		"smear",
+		"smell",
+		"smelt",
+		"smile",
+		"smirk",
+		"smith",
+		"smithy",
+		"smog",
+		"smoke",
+		"smoky",
+		"smug",
+		"smut",
+		"sn",
+		"snack",
+		"snafu",
+		"snag",
+		"snail",
+		"snake",
+		"snap",
+		"snare",
+		"snark",
+		"snarl",
+		"snatch",
+		"sneak",
+		"sneer",
+		"snell",
+		"snick",
+		"sniff",
+		"snip",
+		"snipe",
+		"snob",
+		"snook",
+		"snoop",
+		"snore",
+		"snort",
+		"snout",
+		"snow",
+		"snowy",
+		"snub",
+		"snuff",
+		"snug",
+		"so",
+		"soak",
+		"soap",
+		"soapy",
+		"soar",
+		"sob",
+		"sober",
+		"social",
+		"sock",
+		"sod",
+		"soda",
+		"sofa",
+		"sofia",
+		"soft",
+		"soften",
+		"soggy",
+		"soil",
+		"sol",
+		"solar",
+		"sold",
+		"sole",
+		"solemn",
+		"solid",
+		"solo",
+		"solon",
+		"solve",
+		"soma",
+		"somal",
+		"some",
+		"son",
+		"sonar",
+		"song",
+		"sonic",
+		"sonny",
+		"sonora",
+		"sony",
+		"soon",
+		"soot",
+		"sooth",
+		"sop",
+		"sora",
+		"sorb",
+		"sore",
+		"sorry",
+		"sort",
+		"sos",
+		"sou",
+		"sough",
+		"soul",
+		"sound",
+		"soup",
+		"sour",
+		"source",
+		"sousa",
+		"south",
+		"sow",
+		"sown",
+		"soy",
+		"soya",
+		"sp",
+		"spa",
+		"space",
+		"spade",
+		"spain",
+		"span",
+		"spar",
+		"spare",
+		"sparge",
+		"spark",
+		"spasm",
+		"spat",
+		"spate",
+		"spawn",
+		"spay",
+		"speak",
+		"spear",
+		"spec",
+		"speck",
+		"sped",
+		"speed",
+		"spell",
+		"spend",
+		"spent",
+		"sperm",
+		"sperry",
+		"spew",
+		"spica",
+		"spice",
+		"spicy",
+		"spike",
+		"spiky",
+		"spill",
+		"spilt",
+		"spin",
+		"spine",
+		"spiny",
+		"spire",
+		"spiro",
+		"spit",
+		"spite",
+		"spitz",
+		"splat",
+		"splay",
+		"spline",
+		"split",
+		"spoil",
+		"spoke",
+		"spoof",
+		"spook",
+		"spooky",
+		"spool",
+		"spoon",
+		"spore",
+		"sport",
+		"spot",
+		"spout",
+		"sprain",
+		"spray",
+		"spree",
+		"sprig",
+		"spruce",
+		"sprue",
+		"spud",
+		"spume",
+		"spun",
+		"spunk",
+		"spur",
+		"spurn",
+		"spurt",
+		"spy",
+		"sq",
+		"squad",
+		"squat",
+		"squaw",
+		"squibb",
+		"squid",
+		"squint",
+		"sr",
+		"sri",
+		"ss",
+		"sss",
+		"ssss",
+		"sst",
+		"st",
+		"st.",
+		"stab",
+		"stack",
+		"stacy",
+		"staff",
+		"stag",
+		"stage",
+		"stagy",
+		"stahl",
+		"staid",
+		"stain",
+		"stair",
+		"stake",
+		"stale",
+		"stalk",
+		"stall",
+		"stamp",
+		"stan",
+		"stance",
+		"stand",
+		"stank",
+		"staph",
+		"star",
+		"stare",
+		"stark",
+		"starr",
+		"start",
+		"stash",
+		"state",
+		"statue",
+		"stave",
+		"stay",
+		"stead",
+		"steak",
+		"steal",
+		"steam",
+		"steed",
+		"steel",
+		"steele",
+		"steen",
+		"steep",
+		"steer",
+		"stein",
+		"stella",
+		"stem",
+		"step",
+		"stern",
+		"steve",
+		"stew",
+		"stick",
+		"stiff",
+		"stile",
+		"still",
+		"stilt",
+		"sting",
+		"stingy",
+		"stink",
+		"stint",
+		"stir",
+		"stock",
+		"stoic",
+		"stoke",
+		"stole",
+		"stomp",
+		"stone",
+		"stony",
+		"stood",
+		"stool",
+		"stoop",
+		"stop",
+		"store",
+		"storey",
+		"stork",
+		"storm",
+		"story",
+		"stout",
+		"stove",
+		"stow",
+		"strafe",
+		"strap",
+		"straw",
+		"stray",
+		"strewn",
+		"strip",
+		"stroll",
+		"strom",
+		"strop",
+		"strum",
+		"strut",
+		"stu",
+		"stuart",
+		"stub",
+		"stuck",
+		"stud",
+		"study",
+		"stuff",
+		"stuffy",
+		"stump",
+		"stun",
+		"stung",
+		"stunk",
+		"stunt",
+		"sturm",
+		"style",
+		"styli",
+		"styx",
+		"su",
+		"suave",
+		"sub",
+		"subtly",
+		"such",
+		"suck",
+		"sud",
+		"sudan",
+		"suds",
+		"sue",
+		"suey",
+		"suez",
+		"sugar",
+		"suit",
+		"suite",
+		"sulfa",
+		"sulk",
+		"sulky",
+		"sully",
+		"sultry",
+		"sum",
+		"sumac",
+		"summon",
+		"sun",
+		"sung",
+		"sunk",
+		"sunny",
+		"sunset",
+		"suny",
+		"sup",
+		"super",
+		"supra",
+		"sure",
+		"surf",
+		"surge",
+		"sus",
+		"susan",
+		"sushi",
+		"susie",
+		"sutton",
+		"sv",
+		"sw",
+		"swab",
+		"swag",
+		"swain",
+		"swam",
+		"swami",
+		"swamp",
+		"swampy",
+		"swan",
+		"swank",
+		"swap",
+		"swarm",
+		"swart",
+		"swat",
+		"swath",
+		"sway",
+		"swear",
+		"sweat",
+		"sweaty",
+		"swede",
+		"sweep",
+		"sweet",
+		"swell",
+		"swelt",
+		"swept",
+		"swift",
+		"swig",
+		"swim",
+		"swine",
+		"swing",
+		"swipe",
+		"swirl",
+		"swish",
+		"swiss",
+		"swoop",
+		"sword",
+		"swore",
+		"sworn",
+		"swum",
+		"swung",
+		"sx",
+		"sy",
+		"sybil",
+		"sykes",
+		"sylow",
+		"sylvan",
+		"synge",
+		"synod",
+		"syria",
+		"syrup",
+		"sz",
+		"t",
+		"t's",
+		"ta",
+		"tab",
+		"table",
+		"taboo",
+		"tabu",
+		"tabula",
+		"tacit",
+		"tack",
+		"tacky",
+		"tacoma",
+		"tact",
+		"tad",
+		"taffy",
+		"taft",
+		"tag",
+		"tahoe",
+		"tail",
+		"taint",
+		"take",
+		"taken",
+		"talc",
+		"tale",
+		"talk",
+		"talky",
+		"tall",
+		"tallow",
+		"tally",
+		"talon",
+		"talus",
+		"tam",
+		"tame",
+		"tamp",
+		"tampa",
+		"tan",
+		"tang",
+		"tango",
+		"tangy",
+		"tanh",
+		"tank",
+		"tansy",
+		"tanya",
+		"tao",
+		"taos",
+		"tap",
+		"tapa",
+		"tape",
+		"taper",
+		"tapir",
+		"tapis",
+		"tappa",
+		"tar",
+		"tara",
+		"tardy",
+		"tariff",
+		"tarry",
+		"tart",
+		"task",
+		"tass",
+		"taste",
+		"tasty",
+		"tat",
+		"tate",
+		"tater",
+		"tattle",
+		"tatty",
+		"tau",
+		"taunt",
+		"taut",
+		"tavern",
+		"tawny",
+		"tax",
+		"taxi",
+		"tb",
+		"tc",
+		"td",
+		"te",
+		"tea",
+		"teach",
+		"teal",
+		"team",
+		"tear",
+		"tease",
+		"teat",
+		"tech",
+		"tecum",
+		"ted",
+		"teddy",
+		"tee",
+		"teem",
+		"teen",
+		"teensy",
+		"teet",
+		"teeth",
+		"telex",
+		"tell",
+		"tempo",
+		"tempt",
+		"ten",
+		"tend",
+		"tenet",
+		"tenney",
+		"tenon",
+		"tenor",
+		"tense",
+		"tensor",
+		"tent",
+		"tenth",
+		"tepee",
+		"tepid",
+		"term",
+		"tern",
+		"terra",
+		"terre",
+		"terry",
+		"terse",
+		"tess",
+		"test",
+		"testy",
+		"tete",
+		"texan",
+		"texas",
+		"text",
+		"tf",
+		"tg",
+		"th",
+		"thai",
+		"than",
+		"thank",
+		"that",
+		"thaw",
+		"the",
+		"thea",
+		"thee",
+		"theft",
+		"their",
+		"them",
+		"theme",
+		"then",
+		"there",
+		"these",
+		"theta",
+		"they",
+		"thick",
+		"thief",
+		"thigh",
+		"thin",
+		"thine",
+		"thing",
+		"think",
+		"third",
+		"this",
+		"thong",
+		"thor",
+		"thorn",
+		"thorny",
+		"those",
+		"thou",
+		"thread",
+		"three",
+		"threw",
+		"throb",
+		"throes",
+		"throw",
+		"thrum",
+		"thud",
+		"thug",
+		"thule",
+		"thumb",
+		"thump",
+		"thus",
+		"thy",
+		"thyme",
+		"ti",
+		"tiber",
+		"tibet",
+		"tibia",
+		"tic",
+		"tick",
+		"ticket",
+		"tid",
+		"tidal",
+		"tidbit",
+		"tide",
+		"tidy",
+		"tie",
+		"tied",
+		"tier",
+		"tift",
+		"tiger",
+		"tight",
+		"til",
+		"tilde",
+		"tile",
+		"till",
+		"tilt",
+		"tilth",
+		"tim",
+		"time",
+		"timex",
+		"timid",
+		"timon",
+		"tin",
+		"tina",
+		"tine",
+		"tinge",
+		"tint",
+		"tiny",
+		"tioga",
+		"tip",
+		"tipoff",
+		"tippy",
+		"tipsy",
+		"tire",
+		"tit",
+		"titan",
+		"tithe",
+		"title",
+		"titus",
+		"tj",
+		"tk",
+		"tl",
+		"tm",
+		"tn",
+		"tnt",
+		"to",
+		"toad",
+		"toady",
+		"toast",
+		"toby",
+		"today",
+		"todd",
+		"toe",
+		"tofu",
+		"tog",
+		"togo",
+		"togs",
+		"toil",
+		"toilet",
+		"token",
+		"tokyo",
+		"told",
+		"toll",
+		"tom",
+		"tomb",
+		"tome",
+		"tommy",
+		"ton",
+		"tonal",
+		"tone",
+		"tong",
+		"toni",
+		"tonic",
+		"tonk",
+		"tonsil",
+		"tony",
+		"too",
+		"took",
+		"tool",
+		"toot",
+		"tooth",
+		"top",
+		"topaz",
+		"topic",
+		"topple",
+		"topsy",
+		"tor",
+		"torah",
+		"torch",
+		"tore",
+		"tori",
+		"torn",
+		"torr",
+		"torso",
+		"tort",
+		"torus",
+		"tory",
+		"toss",
+		"tot",
+		"total",
+		"tote",
+		"totem",
+		"touch",
+		"tough",
+		"tour",
+		"tout",
+		"tow",
+		"towel",
+		"tower",
+		"town",
+		"toxic",
+		"toxin",
+		"toy",
+		"tp",
+		"tq",
+		"tr",
+		"trace",
+		"track",
+		"tract",
+		"tracy",
+		"trade",
+		"trag",
+		"trail",
+		"train",
+		"trait",
+		"tram",
+		"tramp",
+		"trap",
+		"trash",
+		"trawl",
+		"tray",
+		"tread",
+		"treat",
+		"treble",
+		"tree",
+		"trek",
+		"trench",
+		"trend",
+		"tress",
+		"triad",
+		"trial",
+		"tribe",
+		"trick",
+		"tried",
+		"trig",
+		"trill",
+		"trim",
+		"trio",
+		"trip",
+		"tripe",
+		"trite",
+		"triton",
+		"trod",
+		"troll",
+		"troop",
+		"trot",
+		"trout",
+		"troy",
+		"truce",
+		"truck",
+		"trudge",
+		"trudy",
+		"true",
+		"truly",
+		"trump",
+		"trunk",
+		"truss",
+		"trust",
+		"truth",
+		"trw",
+		"try",
+		"ts",
+		"tsar",
+		"tt",
+		"ttl",
+		"ttt",
+		"tttt",
+		"tty",
+		"tu",
+		"tub",
+		"tuba",
+		"tube",
+		"tuck",
+		"tudor",
+		"tuff",
+		"tuft",
+		"tug",
+		"tulane",
+		"tulip",
+		"tulle",
+		"tulsa",
+		"tum",
+		"tun",
+		"tuna",
+		"tune",
+		"tung",
+		"tunic",
+		"tunis",
+		"tunnel",
+		"tuple",
+		"turf",
+		"turin",
+		"turk",
+		"turn",
+		"turvy",
+		"tusk",
+		"tussle",
+		"tutor",
+		"tutu",
+		"tuv",
+		"tv",
+		"tva",
+		"tw",
+		"twa",
+		"twain",
+		"tweak",
+		"tweed",
+		"twice",
+		"twig",
+		"twill",
+		"twin",
+		"twine",
+		"twirl",
+		"twist",
+		"twisty",
+		"twit",
+		"two",
+		"twx",
+		"tx",
+		"ty",
+		"tyburn",
+		"tying",
+		"tyler",
+		"type",
+		"typic",
+		"typo",
+		"tyson",
+		"tz",
+		"u",
+		"u's",
+		"ua",
+		"ub",
+		"uc",
+		"ucla",
+		"ud",
+		"ue",
+		"uf",
+		"ug",
+		"ugh",
+		"ugly",
+		"uh",
+		"ui",
+		"uj",
+		"uk",
+		"ul",
+		"ulan",
+		"ulcer",
+		"ultra",
+		"um",
+		"umber",
+		"umbra",
+		"umpire",
+		"un",
+		"unary",
+		"uncle",
+		"under",
+		"unify",
+		"union",
+		"unit",
+		"unite",
+		"unity",
+		"unix",
+		"until",
+		"uo",
+		"up",
+		"upend",
+		"uphold",
+		"upon",
+		"upper",
+		"uproar",
+		"upset",
+		"uptake",
+		"upton",
+		"uq",
+		"ur",
+		"urban",
+		"urbane",
+		"urea",
+		"urge",
+		"uri",
+		"urine",
+		"uris",
+		"urn",
+		"ursa",
+		"us",
+		"usa",
+		"usaf",
+		"usage",
+		"usc",
+		"usda",
+		"use",
+		"useful",
+		"usgs",
+		"usher",
+		"usia",
+		"usn",
+		"usps",
+		"ussr",
+		"usual",
+		"usurp",
+		"usury",
+		"ut",
+		"utah",
+		"utica",
+		"utile",
+		"utmost",
+		"utter",
+		"uu",
+		"uuu",
+		"uuuu",
+		"uv",
+		"uvw",
+		"uw",
+		"ux",
+		"uy",
+		"uz",
+		"v",
+		"v's",
+		"va",
+		"vacua",
+		"vacuo",
+		"vade",
+		"vaduz",
+		"vague",
+		"vail",
+		"vain",
+		"vale",
+		"valet",
+		"valeur",
+		"valid",
+		"value",
+		"valve",
+		"vamp",
+		"van",
+		"vance",
+		"vane",
+		"vary",
+		"vase",
+		"vast",
+		"vat",
+		"vault",
+		"vb",
+		"vc",
+		"vd",
+		"ve",
+		"veal",
+		"veda",
+		"vee",
+		"veer",
+		"veery",
+		"vega",
+		"veil",
+		"vein",
+		"velar",
+		"veldt",
+		"vella",
+		"vellum",
+		"venal",
+		"vend",
+		"venial",
+		"venom",
+		"vent",
+		"venus",
+		"vera",
+		"verb",
+		"verde",
+		"verdi",
+		"verge",
+		"verity",
+		"verna",
+		"verne",
+		"versa",
+		"verse",
+		"verve",
+		"very",
+		"vessel",
+		"vest",
+		"vet",
+		"vetch",
+		"veto",
+		"vex",
+		"vf",
+		"vg",
+		"vh",
+		"vi",
+		"via",
+		"vial",
+		"vicar",
+		"vice",
+		"vichy",
+		"vicky",
+		"vida",
+		"video",
+		"vie",
+		"viet",
+		"view",
+		"vigil",
+		"vii",
+		"viii",
+		"vile",
+		"villa",
+		"vine",
+		"vinyl",
+		"viola",
+		"violet",
+		"virgil",
+		"virgo",
+		"virus",
+		"vis",
+		"visa",
+		"vise",
+		"visit",
+		"visor",
+		"vista",
+		"vita",
+		"vitae",
+		"vital",
+		"vito",
+		"vitro",
+		"viva",
+		"vivian",
+		"vivid",
+		"vivo",
+		"vixen",
+		"viz",
+		"vj",
+		"vk",
+		"vl",
+		"vm",
+		"vn",
+		"vo",
+		"vocal",
+		"vogel",
+		"vogue",
+		"voice",
+		"void",
+		"volt",
+		"volta",
+		"volvo",
+		"vomit",
+		"von",
+		"voss",
+		"vote",
+		"vouch",
+		"vow",
+		"vowel",
+		"vp",
+		"vq",
+		"vr",
+		"vs",
+		"vt",
+		"vu",
+		"vulcan",
+		"vv",
+		"vvv",
+		"vvvv",
+		"vw",
+		"vx",
+		"vy",
+		"vying",
+		"vz",
+		"w",
+		"w's",
+		"wa",
+		"waals",
+		"wac",
+		"wack",
+		"wacke",
+		"wacky",
+		"waco",
+		"wad",
+		"wade",
+		"wadi",
+		"wafer",
+		"wag",
+		"wage",
+		"waggle",
+		"wah",
+		"wahl",
+		"wail",
+		"waist",
+		"wait",
+		"waite",
+		"waive",
+		"wake",
+		"waken",
+		"waldo",
+		"wale",
+		"walk",
+		"walkie",
+		"wall",
+		"walls",
+		"wally",
+		"walsh",
+		"walt",
+		"walton",
+		"waltz",
+		"wan",
+		"wand",
+		"wane",
+		"wang",
+		"want",
+		"war",
+		"ward",
+		"ware",
+		"warm",
+		"warmth",
+		"warn",
+		"warp",
+		"warren",
+		"wart",
+		"warty",
+		"wary",
+		"was",
+		"wash",
+		"washy",
+		"wasp",
+		"wast",
+		"waste",
+		"watch",
+		"water",
+		"watt",
+		"watts",
+		"wave",
+		"wavy",
+		"wax",
+		"waxen",
+		"waxy",
+		"way",
+		"wayne",
+		"wb",
+		"wc",
+		"wd",
+		"we",
+		"we'd",
+		"we'll",
+		"we're",
+		"we've",
+		"weak",
+		"weal",
+		"wealth",
+		"wean",
+		"wear",
+		"weary",
+		"weave",
+		"web",
+		"webb",
+		"weber",
+		"weco",
+		"wed",
+		"wedge",
+		"wee",
+		"weed",
+		"weedy",
+		"week",
+		"weeks",
+		"weep",
+		"wehr",
+		"wei",
+		"weigh",
+		"weir",
+		"weird",
+		"weiss",
+		"welch",
+		"weld",
+		"well",
+		"wells",
+		"welsh",
+		"welt",
+		"wendy",
+		"went",
+		"wept",
+		"were",
+		"wert",
+		"west",
+		"wet",
+		"wf",
+		"wg",
+		"wh",
+		"whack",
+		"whale",
+		"wham",
+		"wharf",
+		"what",
+		"wheat",
+		"whee",
+		"wheel",
+		"whelk",
+		"whelm",
+		"whelp",
+		"when",
+		"where",
+		"whet",
+		"which",
+		"whiff",
+		"whig",
+		"while",
+		"whim",
+		"whine",
+		"whinny",
+		"whip",
+		"whir",
+		"whirl",
+		"whisk",
+		"whit",
+		"white",
+		"whiz",
+		"who",
+		"who'd",
+		"whoa",
+		"whole",
+		"whom",
+		"whoop",
+		"whoosh",
+		"whop",
+		"whose",
+		"whup",
+		"why",
+		"wi",
+		"wick",
+		"wide",
+		"widen",
+		"widow",
+		"width",
+		"wield",
+		"wier",
+		"wife",
+		"wig",
+		"wild",
+		"wile",
+		"wiley",
+		"wilkes",
+		"will",
+		"willa",
+		"wills",
+		"wilma",
+		"wilt",
+		"wily",
+		"win",
+		"wince",
+		"winch",
+		"wind",
+		"windy",
+		"wine",
+		"wing",
+		"wink",
+		"winnie",
+		"wino",
+		"winter",
+		"winy",
+		"wipe",
+		"wire",
+		"wiry",
+		"wise",
+		"wish",
+		"wishy",
+		"wisp",
+		"wispy",
+		"wit",
+		"witch",
+		"with",
+		"withe",
+		"withy",
+		"witt",
+		"witty",
+		"wive",
+		"wj",
+		"wk",
+		"wl",
+		"wm",
+		"wn",
+		"wo",
+		"woe",
+		"wok",
+		"woke",
+		"wold",
+		"wolf",
+		"wolfe",
+		"wolff",
+		"wolve",
+		"woman",
+		"womb",
+		"women",
+		"won",
+		"won't",
+		"wonder",
+		"wong",
+		"wont",
+		"woo",
+		"wood",
+		"woods",
+		"woody",
+		"wool",
+		"woozy",
+		"word",
+		"wordy",
+		"wore",
+		"work",
+		"world",
+		"worm",
+		"wormy",
+		"worn",
+		"worry",
+		"worse",
+		"worst",
+		"worth",
+		"wotan",
+		"would",
+		"wound",
+		"wove",
+		"woven",
+		"wow",
+		"wp",
+		"wq",
+		"wr",
+		"wrack",
+		"wrap",
+		"wrath",
+		"wreak",
+		"wreck",
+		"wrest",
+		"wring",
+		"wrist",
+		"writ",
+		"write",
+		"writhe",
+		"wrong",
+		"wrote",
+		"wry",
+		"ws",
+		"wt",
+		"wu",
+		"wuhan",
+		"wv",
+		"ww",
+		"www",
+		"wwww",
+		"wx",
+		"wxy",
+		"wy",
+		"wyatt",
+		"wyeth",
+		"wylie",
+		"wyman",
+		"wyner",
+		"wynn",
+		"wz",
+		"x",
+		"x's",
+		"xa",
+		"xb",
+		"xc",
+		"xd",
+		"xe",
+		"xenon",
+		"xerox",
+		"xf",
+		"xg",
+		"xh",
+		"xi",
+		"xj",
+		"xk",
+		"xl",
+		"xm",
+		"xn",
+		"xo",
+		"xp",
+		"xq",
+		"xr",
+		"xs",
+		"xt",
+		"xu",
+		"xv",
+		"xw",
+		"xx",
+		"xxx",
+		"xxxx",
+		"xy",
+		"xylem",
+		"xyz",
+		"xz",
+		"y",
+		"y's",
+		"ya",
+		"yacht",
+		"yah",
+		"yak",
+		"yale",
+		"yalta",
+		"yam",
+		"yamaha",
+		"yang",
+		"yank",
+		"yap",
+		"yaqui",
+		"yard",
+		"yarn",
+		"yates",
+		"yaw",
+		"yawl",
+		"yawn",
+		"yb",
+		"yc",
+		"yd",
+		"ye",
+		"yea",
+		"yeah",
+		"year",
+		"yearn",
+		"yeast",
+		"yeasty",
+		"yeats",
+		"yell",
+		"yelp",
+		"yemen",
+		"yen",
+		"yet",
+		"yf",
+		"yg",
+		"yh",
+		"yi",
+		"yield",
+		"yin",
+		"yip",
+		"yj",
+		"yk",
+		"yl",
+		"ym",
+		"ymca",
+		"yn",
+		"yo",
+		"yodel",
+		"yoder",
+		"yoga",
+		"yogi",
+		"yoke",
+		"yokel",
+		"yolk",
+		"yon",
+		"yond",
+		"yore",
+		"york",
+		"yost",
+		"you",
+		"you'd",
+		"young",
+		"your",
+		"youth",
+		"yow",
+		"yp",
+		"yq",
+		"yr",
+		"ys",
+		"yt",
+		"yu",
+		"yucca",
+		"yuck",
+		"yuh",
+		"yuki",
+		"yukon",
+		"yule",
+		"yv",
+		"yves",
+		"yw",
+		"ywca",
+		"yx",
+		"yy",
+		"yyy",
+		"yyyy",
+		"yz",
+		"z",
+		"z's",
+		"za",
+		"zag",
+		"zaire",
+		"zan",
+		"zap",
+		"zazen",
+		"zb",
+		"zc",
+		"zd",
+		"ze",
+		"zeal",
+		"zealot",
+		"zebra",
+		"zeiss",
+		"zen",
+		"zero",
+		"zest",
+		"zesty",
+		"zeta",
+		"zeus",
+		"zf",
+		"zg",
+		"zh",
+		"zi",
+		"zig",
+		"zilch",
+		"zinc",
+		"zing",
+		"zion",
+		"zip",
+		"zj",
+		"zk",
+		"zl",
+		"zloty",
+		"zm",
+		"zn",
+		"zo",
+		"zoe",
+		"zomba",
+		"zone",
+		"zoo",
+		"zoom",
+		"zorn",
+		"zp",
+		"zq",
+		"zr",
+		"zs",
+		"zt",
+		"zu",
+		"zurich",
+		"zv",
+		"zw",
+		"zx",
+		"zy",
+		"zz",
+		"zzz",
+		"zzzz",
+		"0",
+		"1",
+		"2",
+		"3",
+		"4",
+		"5",
+		"6",
+		"7",
+		"8",
+		"9",
+		"10",
+		"11",
+		"12",
+		"13",
+		"14",
+		"15",
+		"16",
+		"17",
+		"18",
+		"19",
+		"20",
+		"21",
+		"22",
+		"23",
+		"24",
+		"25",
+		"26",
+		"27",
+		"28",
+		"29",
+		"30",
+		"31",
+		"32",
+		"33",
+		"34",
+		"35",
+		"36",
+		"37",
+		"38",
+		"39",
+		"40",
+		"41",
+		"42",
+		"43",
+		"44",
+		"45",
+		"46",
+		"47",
+		"48",
+		"49",
+		"50",
+		"51",
+		"52",
+		"53",
+		"54",
+		"55",
+		"56",
+		"57",
+		"58",
+		"59",
+		"60",
+		"61",
+		"62",
+		"63",
+		"64",
+		"65",
+		"66",
+		"67",
+		"68",
+		"69",
+		"70",
+		"71",
+		"72",
+		"73",
+		"74",
+		"75",
+		"76",
+		"77",
+		"78",
+		"79",
+		"80",
+		"81",
+		"82",
+		"83",
+		"84",
+		"85",
+		"86",
+		"87",
+		"88",
+		"89",
+		"90",
+		"91",
+		"92",
+		"93",
+		"94",
+		"95",
+		"96",
+		"97",
+		"98",
+		"99",
+		"100",
+		"101",
+		"111",
+		"123",
+		"200",
+		"222",
+		"234",
+		"300",
+		"333",
+		"345",
+		"400",
+		"444",
+		"456",
+		"500",
+		"555",
+		"567",
+		"600",
+		"666",
+		"678",
+		"700",
+		"777",
+		"789",
+		"800",
+		"888",
+		"900",
+		"999",
+		"1000",
+		"1111",
+		"1234",
+		"1492",
+		"1500",
+		"1600",
+		"1700",
+		"1776",
+		"1800",
+		"1812",
+		"1900",
+		"1910",
+		"1920",
+		"1925",
+		"1930",
+		"1935",
+		"1940",
+		"1945",
+		"1950",
+		"1955",
+		"1960",
+		"1965",
+		"1970",
+		"1975",
+		"1980",
+		"1985",
+		"1990",
+		"1991",
+		"1992",
+		"1993",
+		"1994",
+		"1995",
+		"1996",
+		"1997",
+		"2000",
+		"2001",
+		"2020",
+		"2222",
+		"2345",
+		"2468",
+		"3000",
+		"3333",
+		"3456",
+		"4000",
+		"4321",
+		"4444",
+		"4567",
+		"5000",
+		"5555",
+		"5678",
+		"6000",
+		"6666",
+		"6789",
+		"7000",
+		"7777",
+		"8000",
+		"8888",
+		"9000",
+		"9876",
+		"9999",
+		"100th",
+		"101st",
+		"10th",
+		"11th",
+		"12th",
+		"13th",
+		"14th",
+		"15th",
+		"16th",
+		"17th",
+		"18th",
+		"19th",
+		"1st",
+		"20th",
+		"21st",
+		"22nd",
+		"23rd",
+		"24th",
+		"25th",
+		"26th",
+		"27th",
+		"28th",
+		"29th",
+		"2nd",
+		"30th",
+		"31st",
+		"32nd",
+		"33rd",
+		"34th",
+		"35th",
+		"36th",
+		"37th",
+		"38th",
+		"39th",
+		"3rd",
+		"40th",
+		"41st",
+		"42nd",
+		"43rd",
+		"44th",
+		"45th",
+		"46th",
+		"47th",
+		"48th",
+		"49th",
+		"4th",
+		"50th",
+		"51st",
+		"52nd",
+		"53rd",
+		"54th",
+		"55th",
+		"56th",
+		"57th",
+		"58th",
+		"59th",
+		"5th",
+		"60th",
+		"61st",
+		"62nd",
+		"63rd",
+		"65th",
+		"66th",
+		"67th",
+		"68th",
+		"69th",
+		"6th",
+		"70th",
+		"71st",
+		"72nd",
+		"73rd",
+		"74th",
+		"75th",
+		"76th",
+		"77th",
+		"78th",
+		"79th",
+		"7th",
+		"80th",
+		"81st",
+		"82nd",
+		"83rd",
+		"84th",
+		"85th",
+		"86th",
+		"87th",
+		"88th",
+		"89th",
+		"8th",
+		"90th",
+		"91st",
+		"92nd",
+		"93rd",
+		"94th",
+		"95th",
+		"96th",
+		"97th",
+		"98th",
+		"99th",
+		"9th",
+		"!",
+		"!!",
+		"\"",
+		"#",
+		"##",
+		"$",
+		"$$",
+		"%",
+		"%%",
+		"&",
+		"(",
+		"()",
+		")",
+		"*",
+		"**",
+		"+",
+		"-",
+		":",
+		";",
+		"=",
+		"?",
+		"??",
+		"@",
+	}
+};
+
+wordlist_t wordlist_diceware_german = {
+	.elt.key = "german",
+	.family = "diceware",
+	.max_word_length = 7,
+	.min_word_length = 1,
+	.words = (char *[]){
+		"0",
+		"1",
+		"2",
+		"3",
+		"4",
+		"5",
+		"6",
+		"7",
+		"8",
+		"9",
+		"10",
+		"11",
+		"12",
+		"13",
+		"14",
+		"15",
+		"16",
+		"17",
+		"18",
+		"19",
+		"20",
+		"21",
+		"22",
+		"23",
+		"24",
+		"25",
+		"26",
+		"27",
+		"28",
+		"29",
+		"30",
+		"31",
+		"32",
+		"33",
+		"34",
+		"35",
+		"36",
+		"37",
+		"38",
+		"39",
+		"40",
+		"41",
+		"42",
+		"43",
+		"44",
+		"45",
+		"46",
+		"47",
+		"48",
+		"49",
+		"50",
+		"51",
+		"52",
+		"53",
+		"54",
+		"55",
+		"56",
+		"57",
+		"58",
+		"59",
+		"60",
+		"61",
+		"62",
+		"63",
+		"64",
+		"65",
+		"66",
+		"67",
+		"68",
+		"69",
+		"70",
+		"71",
+		"72",
+		"73",
+		"74",
+		"75",
+		"76",
+		"77",
+		"78",
+		"79",
+		"80",
+		"81",
+		"82",
+		"83",
+		"84",
+		"85",
+		"86",
+		"87",
+		"88",
+		"89",
+		"90",
+		"91",
+		"92",
+		"93",
+		"94",
+		"95",
+		"96",
+		"97",
+		"98",
+		"99",
+		"100",
+		"101",
+		"111",
+		"123",
+		"200",
+		"222",
+		"234",
+		"300",
+		"333",
+		"345",
+		"400",
+		"444",
+		"456",
+		"500",
+		"555",
+		"567",
+		"600",
+		"666",
+		"678",
+		"700",
+		"777",
+		"789",
+		"800",
+		"888",
+		"900",
+		"999",
+		"1000",
+		"1111",
+		"1234",
+		"1492",
+		"1500",
+		"1600",
+		"1700",
+		"1800",
+		"1900",
+		"1910",
+		"1920",
+		"1925",
+		"1930",
+		"1935",
+		"1940",
+		"1945",
+		"1950",
+		"1955",
+		"1960",
+		"1965",
+		"1970",
+		"1975",
+		"1980",
+		"1985",
+		"1990",
+		"1991",
+		"1992",
+		"1993",
+		"1994",
+		"1995",
+		"1996",
+		"1997",
+		"1998",
+		"1999",
+		"2000",
+		"2001",
+		"2002",
+		"2003",
+		"2004",
+		"2005",
+		"2006",
+		"2007",
+		"2008",
+		"2009",
+		"2010",
+		"2015",
+		"2020",
+		"2030",
+		"2035",
+		"2040",
+		"2045",
+		"2050",
+		"2222",
+		"2345",
+		"2468",
+		"3000",
+		"3333",
+		"3456",
+		"4000",
+		"4321",
+		"4444",
+		"4567",
+		"5000",
+		"5555",
+		"5678",
+		"6000",
+		"6666",
+		"6789",
+		"7000",
+		"7777",
+		"8000",
+		"8888",
+		"9000",
+		"9876",
+		"9999",
+		"-",
+		"--",
+		"---",
+		"!",
+		"!!",
+		"!!!",
+		"\"",
+		"#",
+		"##",
+		"###",
+		"$",
+		"$$",
+		"$$$",
+		"%",
+		"%%",
+		"%%%",
+		"&",
+		"(",
+		"()",
+		")",
+		"*",
+		"**",
+		"***",
+		":",
+		":(",
+		":-(",
+		":)",
+		":-)",
+		";",
+		"?",
+		"??",
+		"???",
+		"@",
+		"+",
+		"++",
+		"+++",
+		"=",
+		"==",
+		"===",
+		"a",
+		"aa",
+		"aaa",
+		"aaaa",
+		"aachen",
+		"aal",
+		"aao",
+		"aas",
+		"aasig",
+		"ab",
+		"abart",
+		"abb",
+		"abbau",
+		"abbe",
+		"abbild",
+		"abc",
+		"abdomen",
+		"abend",
+		"aber",
+		"abf",
+		"abfall",
+		"abflug",
+		"abfuhr",
+		"abgabe",
+		"abgang",
+		"abgas",
+		"abgott",
+		"abguss",
+		"abhang",
+		"abitur",
+		"abk",
+		"abkehr",
+		"abladen",
+		"ablage",
+		"ablass",
+		"ablauf",
+		"ablaut",
+		"abluft",
+		"abnorm",
+		"abo",
+		"abraum",
+		"abrede",
+		"abrieb",
+		"abriss",
+		"abruf",
+		"abrupt",
+		"abs",
+		"absage",
+		"absatz",
+		"abschn",
+		"absenz",
+		"absurd",
+		"abt",
+		"abtei",
+		"abteil",
+		"abtun",
+		"abu",
+		"abuja",
+		"abweg",
+		"abwehr",
+		"abwurf",
+		"abzgl",
+		"abzug",
+		"ac",
+		"accra",
+		"aceton",
+		"ach",
+		"achat",
+		"achse",
+		"achsel",
+		"acht",
+		"achte",
+		"achten",
+		"achtet",
+		"acker",
+		"acryl",
+		"ad",
+		"adac",
+		"adagio",
+		"adana",
+		"addier",
+		"ade",
+		"adel",
+		"adeln",
+		"adelnd",
+		"adelt",
+		"adelte",
+		"adenom",
+		"ader",
+		"adis",
+		"adisch",
+		"adj",
+		"adler",
+		"adlig",
+		"adlige",
+		"adm",
+		"adn",
+		"adr",
+		"adrett",
+		"adria",
+		"adv",
+		"advent",
+		"adverb",
+		"ae",
+		"aegide",
+		"aehre",
+		"aelter",
+		"aeon",
+		"aerger",
+		"aermel",
+		"aerob",
+		"aesche",
+		"aether",
+		"aethyl",
+		"aetna",
+		"aetzen",
+		"af",
+		"affe",
+		"affig",
+		"affin",
+		"afrika",
+		"after",
+		"ag",
+		"agar",
+		"agent",
+		"agiert",
+		"agio",
+		"agonie",
+		"agra",
+		"agrar",
+		"ah",
+		"aha",
+		"ahle",
+		"ahmt",
+		"ahmte",
+		"ahn",
+		"ahndet",
+		"ahndete",
+		"ahnen",
+		"ahnend",
+		"ahnt",
+		"ahnte",
+		"ahnung",
+		"ahorn",
+		"ai",
+		"aids",
+		"airbus",
+		"aj",
+		"ak",
+		"aka",
+		"akazie",
+		"akelei",
+		"akkord",
+		"akne",
+		"akt",
+		"akte",
+		"akten",
+		"akteur",
+		"aktie",
+		"aktien",
+		"aktion",
+		"aktiv",
+		"aktiva",
+		"aktive",
+		"aktor",
+		"akut",
+		"akutes",
+		"akzent",
+		"akzept",
+		"al",
+		"alanin",
+		"alarm",
+		"alaska",
+		"alaun",
+		"albern",
+		"albert",
+		"albino",
+		"album",
+		"alge",
+		"alias",
+		"alibi",
+		"alkali",
+		"all",
+		"alle",
+		"allee",
+		"allein",
+		"allel",
+		"allem",
+		"allen",
+		"alles",
+		"allg",
+		"alltag",
+		"allzu",
+		"alm",
+		"alma",
+		"aloe",
+		"alofi",
+		"alp",
+		"alpen",
+		"alpin",
+		"alraun",
+		"als",
+		"alse",
+		"also",
+		"alt",
+		"altai",
+		"altar",
+		"altbau",
+		"alte",
+		"alter",
+		"altern",
+		"altert",
+		"altes",
+		"altoel",
+		"am",
+		"ama",
+		"amateur",
+		"amber",
+		"amboss",
+		"ambra",
+		"ameise",
+		"ami",
+		"amman",
+		"amme",
+		"amnion",
+		"amoebe",
+		"amok",
+		"amoll",
+		"amor",
+		"amorph",
+		"ampel",
+		"amsel",
+		"amt",
+		"amtl",
+		"amur",
+		"an",
+		"anabol",
+		"anal",
+		"analog",
+		"ananas",
+		"anatom",
+		"anbau",
+		"anbei",
+		"andere",
+		"anders",
+		"andora",
+		"anemone",
+		"anfall",
+		"anfang",
+		"anflug",
+		"anfuhr",
+		"angabe",
+		"angara",
+		"angel",
+		"angeln",
+		"anger",
+		"angina",
+		"angler",
+		"angola",
+		"angst",
+		"anguss",
+		"anh",
+		"anhand",
+		"anhang",
+		"anis",
+		"ank",
+		"ankara",
+		"ankauf",
+		"anker",
+		"ankert",
+		"ankunft",
+		"anl",
+		"anlage",
+		"anlass",
+		"anlauf",
+		"anlaut",
+		"anm",
+		"anmut",
+		"annona",
+		"anode",
+		"anomal",
+		"anomie",
+		"anonym",
+		"anorak",
+		"anrede",
+		"anreiz",
+		"anruf",
+		"ans",
+		"ansage",
+		"ansatz",
+		"ansaug",
+		"anschl",
+		"anshan",
+		"anteil",
+		"anti",
+		"antik",
+		"antrag",
+		"antw",
+		"anurie",
+		"anwalt",
+		"anzahl",
+		"anzug",
+		"ao",
+		"aorta",
+		"ap",
+		"apart",
+		"apfel",
+		"aphel",
+		"apia",
+		"apnoe",
+		"apo",
+		"app",
+		"appell",
+		"april",
+		"aq",
+		"aquana",
+		"ar",
+		"araber",
+		"arbeit",
+		"arbok",
+		"archiv",
+		"ard",
+		"arena",
+		"arglos",
+		"argon",
+		"arh",
+		"arie",
+		"arier",
+		"arkade",
+		"arktis",
+		"arm",
+		"armada",
+		"arme",
+		"armee",
+		"armer",
+		"armut",
+		"aroma",
+		"arrest",
+		"arsch",
+		"arsen",
+		"art",
+		"artig",
+		"artist",
+		"aruba",
+		"arznei",
+		"arzt",
+		"as",
+		"asbest",
+		"asche",
+		"aschig",
+		"asiat",
+		"asien",
+		"askese",
+		"asket",
+		"asmara",
+		"aspekt",
+		"aspik",
+		"ass",
+		"ast",
+		"astana",
+		"astat",
+		"aster",
+		"asthma",
+		"astral",
+		"asyl",
+		"at",
+		"ataxie",
+		"atem",
+		"athlet",
+		"atlas",
+		"atm",
+		"atmen",
+		"atmend",
+		"atmet",
+		"atmete",
+		"atmung",
+		"atoll",
+		"atom",
+		"atomar",
+		"atonie",
+		"atopie",
+		"atrial",
+		"atrium",
+		"attest",
+		"au",
+		"auch",
+		"aue",
+		"auf",
+		"aufbau",
+		"aufl",
+		"aufruf",
+		"aufs",
+		"aufzug",
+		"auge",
+		"augen",
+		"august",
+		"aula",
+		"aura",
+		"aural",
+		"aus",
+		"ausbau",
+		"aushub",
+		"ausruf",
+		"aussen",
+		"ausser",
+		"auster",
+		"austin",
+		"ausweg",
+		"auszug",
+		"autark",
+		"auto",
+		"autogen",
+		"autor",
+		"autsch",
+		"av",
+		"avarua",
+		"avis",
+		"aw",
+		"ax",
+		"axial",
+		"axiom",
+		"axt",
+		"ay",
+		"az",
+		"azalee",
+		"azetat",
+		"azeton",
+		"azimut",
+		"azoren",
+		"azteke",
+		"b",
+		"baby",
+		"bach",
+		"back",
+		"backe",
+		"backen",
+		"bad",
+		"baden",
+		"badet",
+		"badete",
+		"baehen",
+		"baeht",
+		"baehte",
+		"baer",
+		"baerin",
+		"baff",
+		"bafoeg",
+		"bagel",
+		"bagger",
+		"bahn",
+		"bahre",
+		"baku",
+		"bald",
+		"baldig",
+		"balg",
+		"balkan",
+		"balken",
+		"balkon",
+		"ball",
+		"ballade",
+		"ballen",
+		"ballig",
+		"ballon",
+		"ballt",
+		"balsa",
+		"balsam",
+		"bamako",
+		"bambus",
+		"banal",
+		"banane",
+		"band",
+		"bandar",
+		"bande",
+		"bandit",
+		"bange",
+		"bangen",
+		"bangt",
+		"bangte",
+		"bangui",
+		"banjo",
+		"banjul",
+		"bank",
+		"banner",
+		"baotou",
+		"bar",
+		"barbar",
+		"barde",
+		"barium",
+		"bark",
+		"barock",
+		"baron",
+		"barren",
+		"barsch",
+		"bart",
+		"baryon",
+		"basal",
+		"basalt",
+		"basar",
+		"basic",
+		"basis",
+		"baske",
+		"bass",
+		"bast",
+		"bastei",
+		"bat",
+		"baten",
+		"batik",
+		"batist",
+		"bau",
+		"bauamt",
+		"bauart",
+		"bauch",
+		"baud",
+		"baude",
+		"bauen",
+		"bauend",
+		"bauer",
+		"baum",
+		"bausch",
+		"baut",
+		"baute",
+		"bauxit",
+		"bauzaun",
+		"bayer",
+		"bayern",
+		"bayrut",
+		"bb",
+		"bbb",
+		"bbbb",
+		"bc",
+		"bcd",
+		"bd",
+		"bde",
+		"be",
+		"beamte",
+		"bebaut",
+		"beben",
+		"bebend",
+		"bebt",
+		"bebte",
+		"becher",
+		"becken",
+		"bedarf",
+		"bedenk",
+		"beehrt",
+		"beeil",
+		"beeilt",
+		"beere",
+		"beet",
+		"befahl",
+		"befehl",
+		"befiel",
+		"befugt",
+		"befuhr",
+		"befund",
+		"begab",
+		"begabt",
+		"begann",
+		"begebe",
+		"begeht",
+		"begibt",
+		"beging",
+		"beginn",
+		"begoss",
+		"begrub",
+		"beguss",
+		"behalt",
+		"behaut",
+		"behebt",
+		"behext",
+		"bei",
+		"beide",
+		"beige",
+		"beil",
+		"beim",
+		"bein",
+		"beinah",
+		"beinig",
+		"beirat",
+		"beirrt",
+		"beirut",
+		"beisst",
+		"beiwort",
+		"bejaht",
+		"bekam",
+		"belag",
+		"belaubt",
+		"belebt",
+		"beleg",
+		"belegt",
+		"belem",
+		"belieh",
+		"belize",
+		"bellen",
+		"beller",
+		"bellt",
+		"bellte",
+		"belo",
+		"belud",
+		"bemass",
+		"benahm",
+		"benennt",
+		"bengel",
+		"benin",
+		"benzin",
+		"benzol",
+		"bequem",
+		"beraet",
+		"bereit",
+		"berg",
+		"bergab",
+		"bergan",
+		"bergen",
+		"berief",
+		"berlin",
+		"berme",
+		"bern",
+		"beruf",
+		"beruft",
+		"beruht",
+		"beryll",
+		"bes",
+		"besagt",
+		"besann",
+		"besass",
+		"besatz",
+		"besen",
+		"besitz",
+		"besser",
+		"beste",
+		"bester",
+		"bestnr",
+		"besuch",
+		"beten",
+		"betend",
+		"betet",
+		"betete",
+		"beton",
+		"betont",
+		"betr",
+		"betraf",
+		"betrag",
+		"betrat",
+		"betrog",
+		"betrug",
+		"bett",
+		"betten",
+		"bettet",
+		"beugen",
+		"beugt",
+		"beugte",
+		"beule",
+		"beulen",
+		"beute",
+		"beutel",
+		"beutet",
+		"bev",
+		"bevor",
+		"bewarb",
+		"bewegt",
+		"beweis",
+		"bez",
+		"bezirk",
+		"bezog",
+		"bezug",
+		"bf",
+		"bg",
+		"bgb",
+		"bgh",
+		"bh",
+		"bhf",
+		"bhopal",
+		"bhutan",
+		"bi",
+		"bias",
+		"bibel",
+		"biber",
+		"bibor",
+		"bieder",
+		"biegen",
+		"biegt",
+		"biene",
+		"bier",
+		"biest",
+		"bieten",
+		"bieter",
+		"bietet",
+		"bigott",
+		"bikini",
+		"bilanz",
+		"bilbao",
+		"bild",
+		"bilden",
+		"bilder",
+		"bildet",
+		"billig",
+		"bimsen",
+		"bin",
+		"binaer",
+		"binde",
+		"binden",
+		"binder",
+		"bindet",
+		"bingo",
+		"binom",
+		"binse",
+		"biogas",
+		"bionik",
+		"biopsie",
+		"bios",
+		"bip",
+		"birgt",
+		"birke",
+		"birne",
+		"bis",
+		"bisam",
+		"bisher",
+		"bismut",
+		"biss",
+		"bissau",
+		"bissen",
+		"bissig",
+		"bistum",
+		"bit",
+		"bitmap",
+		"bitte",
+		"bitten",
+		"bitter",
+		"bittet",
+		"biwak",
+		"bizarr",
+		"bizeps",
+		"bj",
+		"bk",
+		"bl",
+		"blaeht",
+		"blaest",
+		"blaeue",
+		"blank",
+		"blase",
+		"blasen",
+		"blasig",
+		"blass",
+		"blatt",
+		"blau",
+		"blauer",
+		"blaues",
+		"blazer",
+		"blech",
+		"blei",
+		"bleibt",
+		"bleich",
+		"blende",
+		"blick",
+		"blind",
+		"blinde",
+		"blitz",
+		"blitza",
+		"block",
+		"bloed",
+		"blond",
+		"blonde",
+		"blosse",
+		"bluete",
+		"bluff",
+		"blume",
+		"blumen",
+		"bluse",
+		"blut",
+		"bluten",
+		"bluter",
+		"blutig",
+		"bluts",
+		"blz",
+		"bm",
+		"bmw",
+		"bn",
+		"bnd",
+		"bo",
+		"boa",
+		"bob",
+		"bochum",
+		"bock",
+		"bocken",
+		"bodden",
+		"boden",
+		"boehme",
+		"boeig",
+		"boerse",
+		"boese",
+		"bogen",
+		"bogota",
+		"bohle",
+		"bohne",
+		"bohnen",
+		"bohren",
+		"bohrer",
+		"boje",
+		"bolero",
+		"bolzen",
+		"bombe",
+		"bomber",
+		"bonbon",
+		"bongo",
+		"bonn",
+		"bonus",
+		"boom",
+		"boot",
+		"bor",
+		"borax",
+		"bord",
+		"bordell",
+		"borste",
+		"boskop",
+		"boss",
+		"boston",
+		"bote",
+		"bowle",
+		"box",
+		"boxen",
+		"boxer",
+		"bozen",
+		"bp",
+		"bq",
+		"br",
+		"brand",
+		"braten",
+		"brauch",
+		"braue",
+		"braun",
+		"braut",
+		"bravo",
+		"brd",
+		"brei",
+		"breiig",
+		"breite",
+		"bremen",
+		"bremse",
+		"brett",
+		"brezel",
+		"brie",
+		"brief",
+		"brigg",
+		"brille",
+		"brise",
+		"brit",
+		"brite",
+		"brokat",
+		"brom",
+		"bronze",
+		"brot",
+		"brt",
+		"bruch",
+		"bruder",
+		"bruehe",
+		"bruesk",
+		"brunei",
+		"brunst",
+		"brust",
+		"brut",
+		"brutal",
+		"brutei",
+		"brutto",
+		"bs",
+		"bse",
+		"bsp",
+		"bt",
+		"bu",
+		"bub",
+		"bube",
+		"buccal",
+		"buch",
+		"buche",
+		"buchen",
+		"buchse",
+		"bucht",
+		"buckel",
+		"bude",
+		"buegel",
+		"buehne",
+		"buenos",
+		"buerge",
+		"buero",
+		"bueste",
+		"buett",
+		"buette",
+		"bug",
+		"buhlen",
+		"bukett",
+		"bulle",
+		"bulloes",
+		"bump",
+		"bums",
+		"bund",
+		"bunker",
+		"bunny",
+		"bunt",
+		"bursa",
+		"bus",
+		"busch",
+		"busen",
+		"buss",
+		"busse",
+		"butler",
+		"butter",
+		"butzen",
+		"bv",
+		"bw",
+		"bx",
+		"by",
+		"bypass",
+		"byte",
+		"bz",
+		"bzgl",
+		"bzw",
+		"c",
+		"cabrio",
+		"cache",
+		"cad",
+		"cafe",
+		"cai",
+		"cali",
+		"cam",
+		"cand",
+		"carrel",
+		"cayenne",
+		"cb",
+		"cc",
+		"ccc",
+		"cccc",
+		"ccitt",
+		"cd",
+		"cde",
+		"cdrom",
+		"cdu",
+		"ce",
+		"cebu",
+		"cerium",
+		"cf",
+		"cg",
+		"ch",
+		"chance",
+		"chaos",
+		"charge",
+		"chef",
+		"chemie",
+		"chile",
+		"chili",
+		"china",
+		"chinin",
+		"chip",
+		"chips",
+		"chlor",
+		"chor",
+		"choral",
+		"chr",
+		"christ",
+		"chrom",
+		"chuzpe",
+		"chylus",
+		"ci",
+		"cim",
+		"citrin",
+		"ciudad",
+		"cj",
+		"ck",
+		"cl",
+		"claim",
+		"clever",
+		"clique",
+		"clogs",
+		"cm",
+		"cm³",
+		"cmos",
+		"cn",
+		"cnc",
+		"co",
+		"cobalt",
+		"cochin",
+		"code",
+		"codec",
+		"comic",
+		"cook",
+		"cookie",
+		"costa",
+		"cote",
+		"coup",
+		"coupon",
+		"cousin",
+		"cp",
+		"cq",
+		"cr",
+		"crash",
+		"cs",
+		"csu",
+		"ct",
+		"cu",
+		"curium",
+		"cursor",
+		"cv",
+		"cvjm",
+		"cw",
+		"cx",
+		"cy",
+		"cz",
+		"d",
+		"dabei",
+		"dach",
+		"dachs",
+		"dachte",
+		"dackel",
+		"dada",
+		"daemmt",
+		"daemon",
+		"daene",
+		"dafuer",
+		"dag",
+		"daheim",
+		"daher",
+		"dahlie",
+		"dakar",
+		"dalian",
+		"dallas",
+		"damals",
+		"damast",
+		"dame",
+		"damen",
+		"damit",
+		"damm",
+		"dampf",
+		"dampft",
+		"danach",
+		"dandy",
+		"dank",
+		"danke",
+		"danken",
+		"dankt",
+		"dann",
+		"dar",
+		"daran",
+		"darauf",
+		"daraus",
+		"darf",
+		"darin",
+		"darm",
+		"darum",
+		"das",
+		"dasein",
+		"dass",
+		"datei",
+		"daten",
+		"dativ",
+		"dato",
+		"datong",
+		"dattel",
+		"datum",
+		"dauer",
+		"dauern",
+		"dauert",
+		"daumen",
+		"daune",
+		"davao",
+		"davon",
+		"davor",
+		"dazu",
+		"db",
+		"dc",
+		"dd",
+		"ddd",
+		"dddd",
+		"ddr",
+		"de",
+		"debuet",
+		"deck",
+		"decke",
+		"deckel",
+		"decken",
+		"deckt",
+		"def",
+		"defekt",
+		"defizit",
+		"degen",
+		"dehnen",
+		"dehnt",
+		"dehnte",
+		"deich",
+		"dein",
+		"deine",
+		"deist",
+		"dekade",
+		"dekan",
+		"dekor",
+		"dekret",
+		"delfin",
+		"delikt",
+		"delle",
+		"dem",
+		"demut",
+		"den",
+		"denise",
+		"denk",
+		"denken",
+		"denker",
+		"denkt",
+		"denn",
+		"dental",
+		"denver",
+		"deo",
+		"depot",
+		"depp",
+		"der",
+		"derart",
+		"derb",
+		"derber",
+		"deren",
+		"des",
+		"despot",
+		"dessen",
+		"dessert",
+		"desto",
+		"detail",
+		"deuten",
+		"deutet",
+		"devon",
+		"devot",
+		"dezent",
+		"df",
+		"dfb",
+		"dg",
+		"dgb",
+		"dgl",
+		"dgr",
+		"dh",
+		"dhaka",
+		"di",
+		"dia",
+		"diadem",
+		"diaet",
+		"diag",
+		"diakon",
+		"dialog",
+		"dich",
+		"dicht",
+		"dichte",
+		"dick",
+		"dicke",
+		"dicker",
+		"dickes",
+		"die",
+		"dieb",
+		"diele",
+		"dienen",
+		"diener",
+		"dienst",
+		"dient",
+		"diente",
+		"dies",
+		"diese",
+		"diesel",
+		"dieser",
+		"dieses",
+		"diffus",
+		"diktat",
+		"dildo",
+		"dill",
+		"dimmer",
+		"din",
+		"ding",
+		"dingen",
+		"dinghy",
+		"dinkel",
+		"diode",
+		"dioxyd",
+		"dip",
+		"dipl",
+		"diplom",
+		"dipol",
+		"dir",
+		"direkt",
+		"dirndl",
+		"dirne",
+		"diskus",
+		"distal",
+		"distel",
+		"dito",
+		"diva",
+		"divers",
+		"diwan",
+		"dj",
+		"djh",
+		"dk",
+		"dkp",
+		"dl",
+		"dm",
+		"dn",
+		"do",
+		"doch",
+		"docht",
+		"dock",
+		"docke",
+		"doebel",
+		"doesen",
+		"doest",
+		"doeste",
+		"dogge",
+		"doha",
+		"dohle",
+		"doktor",
+		"dolch",
+		"dolde",
+		"dollar",
+		"dom",
+		"domino",
+		"don",
+		"donau",
+		"donner",
+		"doof",
+		"dopen",
+		"doping",
+		"doppel",
+		"dorf",
+		"dorn",
+		"dornig",
+		"dorsal",
+		"dorsch",
+		"dort",
+		"dose",
+		"dosis",
+		"dotter",
+		"douala",
+		"double",
+		"doz",
+		"dozent",
+		"dozer",
+		"dp",
+		"dpa",
+		"dq",
+		"dr",
+		"drache",
+		"draht",
+		"drall",
+		"dralle",
+		"drama",
+		"drang",
+		"dreck",
+		"dreckt",
+		"drehen",
+		"dreher",
+		"drehst",
+		"dreht",
+		"drehte",
+		"drei",
+		"dreist",
+		"drell",
+		"drg",
+		"drift",
+		"drill",
+		"drillt",
+		"drin",
+		"dringt",
+		"dritte",
+		"droben",
+		"droge",
+		"drohen",
+		"dronte",
+		"drops",
+		"drosch",
+		"druck",
+		"druckt",
+		"druese",
+		"druse",
+		"ds",
+		"dt",
+		"dtzd",
+		"du",
+		"dublin",
+		"ducken",
+		"duckt",
+		"duckte",
+		"duebel",
+		"duell",
+		"duene",
+		"duengt",
+		"duenn",
+		"duenne",
+		"duerr",
+		"duerre",
+		"duese",
+		"duester",
+		"duett",
+		"duft",
+		"duften",
+		"duftet",
+		"duftig",
+		"dulden",
+		"duldet",
+		"dumas",
+		"dumdum",
+		"dumm",
+		"dumme",
+		"dummer",
+		"dummes",
+		"dumpf",
+		"dung",
+		"dunkel",
+		"dunst",
+		"duo",
+		"duplex",
+		"dur",
+		"durban",
+		"durch",
+		"durst",
+		"dusche",
+		"dussel",
+		"dutt",
+		"dv",
+		"dw",
+		"dx",
+		"dy",
+		"dynamo",
+		"dysurie",
+		"dz",
+		"e",
+		"eb",
+		"ebbe",
+		"ebd",
+		"eben",
+		"ebene",
+		"ebenso",
+		"eber",
+		"ebnen",
+		"ebonit",
+		"ec",
+		"echo",
+		"echt",
+		"echter",
+		"echtes",
+		"ecke",
+		"eckig",
+		"eckige",
+		"eckt",
+		"ecma",
+		"ed",
+		"edamer",
+		"edel",
+		"editor",
+		"edv",
+		"edwin",
+		"ee",
+		"eee",
+		"eeee",
+		"ef",
+		"efeu",
+		"effekt",
+		"efg",
+		"efre",
+		"efta",
+		"eg",
+		"egge",
+		"eggend",
+		"egoist",
+		"eh",
+		"ehe",
+		"ehedem",
+		"ehem",
+		"eher",
+		"ehern",
+		"ehrbar",
+		"ehre",
+		"ehren",
+		"ehrend",
+		"ehrlos",
+		"ehrt",
+		"ehrte",
+		"ehrung",
+		"ei",
+		"eibe",
+		"eiche",
+		"eichel",
+		"eichen",
+		"eid",
+		"eidam",
+		"eides",
+		"eidg",
+		"eier",
+		"eifer",
+		"eifern",
+		"eifert",
+		"eifrig",
+		"eigelb",
+		"eigen",
+		"eigene",
+		"eignet",
+		"eigtl",
+		"eile",
+		"eilen",
+		"eilend",
+		"eilig",
+		"eilzug",
+		"eimer",
+		"ein",
+		"einbau",
+		"einbit",
+		"eine",
+		"einehe",
+		"einem",
+		"einen",
+		"einer",
+		"eines",
+		"einfach",
+		"einheit",
+		"einher",
+		"einige",
+		"einmal",
+		"einoede",
+		"einrad",
+		"eins",
+		"einsam",
+		"einser",
+		"einst",
+		"einweg",
+		"einzeln",
+		"einzig",
+		"einzug",
+		"eis",
+		"eisen",
+		"eisern",
+		"eisig",
+		"eistee",
+		"eitel",
+		"eiter",
+		"eitern",
+		"eitert",
+		"eitrig",
+		"ej",
+		"ek",
+		"ekd",
+		"ekel",
+		"ekelnd",
+		"ekelt",
+		"ekelte",
+		"ekg",
+		"eklig",
+		"ekzem",
+		"el",
+		"elan",
+		"elbe",
+		"elch",
+		"elend",
+		"elf",
+		"elfe",
+		"elfte",
+		"elite",
+		"elle",
+		"elsass",
+		"elster",
+		"eltern",
+		"em",
+		"email",
+		"emb",
+		"emblem",
+		"embryo",
+		"emesis",
+		"emirat",
+		"empor",
+		"empore",
+		"empyem",
+		"emsig",
+		"en",
+		"end",
+		"ende",
+		"enden",
+		"endend",
+		"endet",
+		"endlos",
+		"endung",
+		"eng",
+		"engel",
+		"enger",
+		"enges",
+		"engl",
+		"engt",
+		"engte",
+		"enkel",
+		"enorm",
+		"ente",
+		"enthob",
+		"entity",
+		"entkam",
+		"entspr",
+		"entzog",
+		"entzug",
+		"enzian",
+		"enzym",
+		"eo",
+		"eozaen",
+		"ep",
+		"epilog",
+		"episch",
+		"epoche",
+		"eponym",
+		"epos",
+		"eq",
+		"er",
+		"erb",
+		"erbat",
+		"erbaut",
+		"erbe",
+		"erbend",
+		"erbin",
+		"erbium",
+		"erbot",
+		"erbse",
+		"erbt",
+		"erde",
+		"erden",
+		"erdgas",
+		"erdig",
+		"erdoel",
+		"ereilt",
+		"ererbt",
+		"erfand",
+		"erfolg",
+		"erfuhr",
+		"erfurt",
+		"ergab",
+		"ergeben",
+		"ergibt",
+		"erguss",
+		"erhalt",
+		"erhebt",
+		"erhob",
+		"erholen",
+		"erholt",
+		"erker",
+		"erlass",
+		"erle",
+		"erlebt",
+		"erlegt",
+		"erloes",
+		"erneut",
+		"ernst",
+		"ernte",
+		"ernten",
+		"erntet",
+		"erogen",
+		"erotik",
+		"errang",
+		"erregt",
+		"ersann",
+		"ersatz",
+		"erst",
+		"erste",
+		"erster",
+		"erstes",
+		"erw",
+		"erwarb",
+		"erwerb",
+		"erz",
+		"es",
+		"esa",
+		"esche",
+		"esel",
+		"espe",
+		"ess",
+		"essay",
+		"essbar",
+		"essen",
+		"essenz",
+		"esser",
+		"essig",
+		"este",
+		"eszb",
+		"et",
+		"etage",
+		"etappe",
+		"etat",
+		"ethanol",
+		"ethik",
+		"etuede",
+		"etui",
+		"etwa",
+		"etwaig",
+		"etwas",
+		"etws",
+		"eu",
+		"euer",
+		"eugh",
+		"eule",
+		"eunuch",
+		"euro",
+		"europa",
+		"euter",
+		"ev",
+		"evoli",
+		"evtl",
+		"ew",
+		"ewenke",
+		"ewi",
+		"ewig",
+		"ewige",
+		"ews",
+		"ewwu",
+		"ex",
+		"exakt",
+		"examen",
+		"exil",
+		"exkl",
+		"exkurs",
+		"expl",
+		"export",
+		"extern",
+		"extra",
+		"extrem",
+		"exzess",
+		"ey",
+		"ez",
+		"ezb",
+		"f",
+		"fabel",
+		"fabrik",
+		"fach",
+		"fackel",
+		"fad",
+		"fade",
+		"faden",
+		"faehig",
+		"faehre",
+		"faehrt",
+		"faekal",
+		"faelle",
+		"faellt",
+		"faengt",
+		"faerbt",
+		"faerse",
+		"fagott",
+		"fahl",
+		"fahne",
+		"fahren",
+		"fahrer",
+		"fahrig",
+		"fahrt",
+		"faible",
+		"fair",
+		"fakir",
+		"fakt",
+		"fakten",
+		"faktor",
+		"falb",
+		"falbel",
+		"falke",
+		"fall",
+		"falle",
+		"fallen",
+		"falls",
+		"falte",
+		"falten",
+		"falter",
+		"faltet",
+		"faltig",
+		"falz",
+		"falzen",
+		"falzt",
+		"fam",
+		"famos",
+		"fan",
+		"fanal",
+		"fand",
+		"fang",
+		"fangen",
+		"fao",
+		"farad",
+		"farbe",
+		"farbig",
+		"farm",
+		"farmer",
+		"farn",
+		"fasan",
+		"fascia",
+		"fase",
+		"faseln",
+		"faser",
+		"fasert",
+		"fass",
+		"fasse",
+		"fassen",
+		"fasst",
+		"fasste",
+		"fast",
+		"fasten",
+		"fastet",
+		"fatal",
+		"faul",
+		"faulen",
+		"fauler",
+		"faulig",
+		"faulte",
+		"faun",
+		"fauna",
+		"faust",
+		"fax",
+		"faxe",
+		"fazit",
+		"fb",
+		"fbi",
+		"fc",
+		"fd",
+		"fddi",
+		"fdgb",
+		"fdp",
+		"fe",
+		"feder",
+		"fee",
+		"fegen",
+		"fegt",
+		"fegten",
+		"fehde",
+		"fehl",
+		"fehlen",
+		"fehler",
+		"fehlt",
+		"fehlte",
+		"feier",
+		"feiern",
+		"feiert",
+		"feige",
+		"feile",
+		"feilen",
+		"fein",
+		"feind",
+		"feine",
+		"feiner",
+		"feines",
+		"feld",
+		"felge",
+		"fell",
+		"fels",
+		"felsig",
+		"fender",
+		"ferien",
+		"ferkel",
+		"fern",
+		"ferne",
+		"ferner",
+		"ferrat",
+		"ferrit",
+		"ferse",
+		"fertig",
+		"fesch",
+		"fessel",
+		"fest",
+		"feste",
+		"fester",
+		"festes",
+		"festtag",
+		"fete",
+		"feten",
+		"fett",
+		"fette",
+		"fetten",
+		"fettig",
+		"fetzen",
+		"feucht",
+		"feudal",
+		"feuer",
+		"feuern",
+		"feurig",
+		"ff",
+		"fff",
+		"ffff",
+		"fg",
+		"fgh",
+		"fh",
+		"fi",
+		"fiasko",
+		"fibel",
+		"fichte",
+		"fick",
+		"ficken",
+		"fidel",
+		"fieber",
+		"fiedel",
+		"fiedelt",
+		"fiel",
+		"fies",
+		"fig",
+		"figur",
+		"fiktiv",
+		"file",
+		"filet",
+		"film",
+		"filme",
+		"filmen",
+		"filmte",
+		"filter",
+		"filz",
+		"filzen",
+		"filzig",
+		"fimmel",
+		"finale",
+		"finanz",
+		"finden",
+		"finder",
+		"findet",
+		"findig",
+		"fing",
+		"finger",
+		"finite",
+		"fink",
+		"finne",
+		"finte",
+		"firma",
+		"firmen",
+		"fisch",
+		"fische",
+		"fischt",
+		"fiskus",
+		"fistel",
+		"fitis",
+		"fixen",
+		"fixend",
+		"fixer",
+		"fixt",
+		"fixte",
+		"fixum",
+		"fj",
+		"fjord",
+		"fk",
+		"fl",
+		"flach",
+		"flache",
+		"flachs",
+		"flag",
+		"flagge",
+		"flak",
+		"flakon",
+		"flame",
+		"flamme",
+		"flanke",
+		"flansch",
+		"flau",
+		"flaum",
+		"flaute",
+		"fleck",
+		"flegel",
+		"flehen",
+		"fleht",
+		"flehte",
+		"fleiss",
+		"flickt",
+		"flieder",
+		"fliege",
+		"fliegt",
+		"flink",
+		"flinte",
+		"flirt",
+		"flocke",
+		"floete",
+		"floez",
+		"floh",
+		"flora",
+		"floss",
+		"flosse",
+		"flott",
+		"flotte",
+		"fluch",
+		"flucht",
+		"fluege",
+		"fluenz",
+		"flug",
+		"flugs",
+		"fluke",
+		"flunke",
+		"fluor",
+		"flur",
+		"flusen",
+		"fluss",
+		"flut",
+		"fm",
+		"fn",
+		"fo",
+		"fock",
+		"foehn",
+		"foehre",
+		"foetal",
+		"foetus",
+		"fohlen",
+		"fokal",
+		"fokus",
+		"folg",
+		"folge",
+		"folgen",
+		"folger",
+		"folgt",
+		"folgte",
+		"folie",
+		"folter",
+		"fond",
+		"fondue",
+		"foppen",
+		"foppt",
+		"foppte",
+		"form",
+		"formal",
+		"format",
+		"formel",
+		"formen",
+		"former",
+		"formt",
+		"formte",
+		"forsch",
+		"fort",
+		"fortan",
+		"forts",
+		"fortsf",
+		"forum",
+		"fossil",
+		"fotze",
+		"fp",
+		"fq",
+		"fr",
+		"fracht",
+		"frack",
+		"fraese",
+		"fraest",
+		"frag",
+		"frage",
+		"fragen",
+		"frager",
+		"fragt",
+		"fragte",
+		"franko",
+		"franse",
+		"frass",
+		"fratze",
+		"frau",
+		"frauen",
+		"freak",
+		"frech",
+		"frei",
+		"freie",
+		"freier",
+		"freies",
+		"freite",
+		"fremd",
+		"fremde",
+		"fresko",
+		"freu",
+		"freude",
+		"freund",
+		"freut",
+		"freute",
+		"frevel",
+		"friede",
+		"friert",
+		"fries",
+		"frisch",
+		"frisst",
+		"frist",
+		"frisur",
+		"fritte",
+		"frivol",
+		"frl",
+		"froh",
+		"frohe",
+		"fromm",
+		"fron",
+		"front",
+		"fror",
+		"froren",
+		"frosch",
+		"frost",
+		"frucht",
+		"frueh",
+		"fruehe",
+		"frz",
+		"fs",
+		"ft",
+		"fu",
+		"fuchs",
+		"fuder",
+		"fuegt",
+		"fuegte",
+		"fuehlt",
+		"fuehrt",
+		"fuehrte",
+		"fuelle",
+		"fuellt",
+		"fuenf",
+		"fuer",
+		"fuers",
+		"fuerst",
+		"fuge",
+		"fugen",
+		"fuhr",
+		"fuhre",
+		"fund",
+		"fundus",
+		"funke",
+		"funkt",
+		"furche",
+		"furcht",
+		"furie",
+		"furier",
+		"furt",
+		"furz",
+		"furzen",
+		"fushun",
+		"fusion",
+		"fuss",
+		"fussel",
+		"futsch",
+		"futter",
+		"fuzhou",
+		"fuzzy",
+		"fv",
+		"fw",
+		"fx",
+		"fy",
+		"fz",
+		"g",
+		"gab",
+		"gabel",
+		"gabeln",
+		"gabelt",
+		"gabun",
+		"gaehnt",
+		"gaele",
+		"gaemse",
+		"gaeren",
+		"gaffen",
+		"gaffer",
+		"gafft",
+		"gaffte",
+		"gag",
+		"gage",
+		"gala",
+		"galant",
+		"galgen",
+		"galle",
+		"gallen",
+		"gallig",
+		"galmei",
+		"galopp",
+		"galt",
+		"galten",
+		"gambe",
+		"gambia",
+		"gambit",
+		"gamma",
+		"gammler",
+		"gang",
+		"ganove",
+		"gans",
+		"ganz",
+		"ganze",
+		"gap",
+		"gar",
+		"garage",
+		"garant",
+		"garbe",
+		"garde",
+		"garn",
+		"garten",
+		"gas",
+		"gasse",
+		"gast",
+		"gatt",
+		"gatte",
+		"gatter",
+		"gattin",
+		"gaudi",
+		"gaul",
+		"gaumen",
+		"gauner",
+		"gaze",
+		"gb",
+		"gc",
+		"gd",
+		"ge",
+		"geb",
+		"gebaut",
+		"geben",
+		"geber",
+		"gebet",
+		"gebiet",
+		"gebiss",
+		"gebot",
+		"gebr",
+		"geburt",
+		"geck",
+		"gecko",
+		"gedieh",
+		"gedoest",
+		"geduld",
+		"geeggt",
+		"geehrt",
+		"geeilt",
+		"geerbt",
+		"gefahr",
+		"gefeit",
+		"gefiel",
+		"gegen",
+		"gegend",
+		"gegner",
+		"gegr",
+		"geh",
+		"gehabt",
+		"gehalt",
+		"gehaut",
+		"gehege",
+		"geheim",
+		"gehen",
+		"gehend",
+		"geheul",
+		"gehirn",
+		"gehoer",
+		"geholt",
+		"gehren",
+		"geht",
+		"gehuft",
+		"gehupt",
+		"gehweg",
+		"geier",
+		"geige",
+		"geiger",
+		"geil",
+		"geisel",
+		"geiser",
+		"geiss",
+		"geist",
+		"geiz",
+		"geizen",
+		"geizig",
+		"gejagt",
+		"gek",
+		"gekaut",
+		"gelage",
+		"gelang",
+		"gelass",
+		"gelb",
+		"gelbe",
+		"gelber",
+		"gelbes",
+		"geld",
+		"gelder",
+		"gelee",
+		"gelege",
+		"gelegt",
+		"geleit",
+		"gelenk",
+		"gelobt",
+		"gelost",
+		"gelten",
+		"gemalt",
+		"gemein",
+		"gemuet",
+		"gemuht",
+		"gen",
+		"genagt",
+		"genas",
+		"genau",
+		"genaue",
+		"genese",
+		"genial",
+		"genick",
+		"genie",
+		"genius",
+		"genoss",
+		"genre",
+		"genua",
+		"genug",
+		"genus",
+		"genuss",
+		"geoelt",
+		"george",
+		"gepard",
+		"gerade",
+		"geraet",
+		"gerast",
+		"geraum",
+		"gerben",
+		"gerber",
+		"gerede",
+		"gering",
+		"gern",
+		"gerne",
+		"gerste",
+		"gerte",
+		"geruch",
+		"geruhe",
+		"geruht",
+		"ges",
+		"gesaet",
+		"gesagt",
+		"gesamt",
+		"gesang",
+		"gesch",
+		"gesenk",
+		"gesetz",
+		"gest",
+		"geste",
+		"gesuch",
+		"gesund",
+		"getagt",
+		"getaut",
+		"geteilt",
+		"getobt",
+		"getto",
+		"getue",
+		"getunkt",
+		"geuebt",
+		"gew",
+		"gewagt",
+		"gewahr",
+		"gewalt",
+		"gewand",
+		"gewann",
+		"gewebe",
+		"gewebt",
+		"gewehr",
+		"geweht",
+		"geweih",
+		"gewinn",
+		"gewirr",
+		"gewiss",
+		"gewogt",
+		"gez",
+		"gf",
+		"gg",
+		"ggf",
+		"ggg",
+		"gggg",
+		"gh",
+		"ghana",
+		"ghi",
+		"gi",
+		"gib",
+		"gibbon",
+		"gibt",
+		"gicht",
+		"giebel",
+		"gier",
+		"gieren",
+		"gierig",
+		"gierte",
+		"giesst",
+		"gift",
+		"giftig",
+		"gigant",
+		"gigolo",
+		"gilde",
+		"gimpe",
+		"gimpel",
+		"gin",
+		"ging",
+		"gingen",
+		"gipfel",
+		"gips",
+		"gischt",
+		"gitter",
+		"gj",
+		"gk",
+		"gl",
+		"glanz",
+		"glas",
+		"glaser",
+		"glasig",
+		"glasur",
+		"glatt",
+		"glatte",
+		"glatze",
+		"glaube",
+		"glauben",
+		"glaubt",
+		"gleich",
+		"gleis",
+		"gleit",
+		"gleite",
+		"gleiten",
+		"glich",
+		"glied",
+		"glimmt",
+		"glitt",
+		"global",
+		"globus",
+		"glocke",
+		"glomm",
+		"glossar",
+		"glosse",
+		"glotze",
+		"glotzt",
+		"glucke",
+		"glueck",
+		"glueht",
+		"glukose",
+		"glurak",
+		"glut",
+		"glycin",
+		"gm",
+		"gmbh",
+		"gn",
+		"gnade",
+		"gneis",
+		"gnom",
+		"gnu",
+		"go",
+		"goetze",
+		"gokart",
+		"gold",
+		"golden",
+		"golf",
+		"gon",
+		"gondel",
+		"gong",
+		"gospel",
+		"goss",
+		"gosse",
+		"gotik",
+		"gott",
+		"gp",
+		"gps",
+		"gq",
+		"gr",
+		"grab",
+		"graben",
+		"grad",
+		"graebt",
+		"graf",
+		"grafik",
+		"gram",
+		"gramm",
+		"granat",
+		"grand",
+		"grande",
+		"granit",
+		"granne",
+		"grapen",
+		"graph",
+		"gras",
+		"grasen",
+		"grasig",
+		"grat",
+		"gratis",
+		"grau",
+		"grauen",
+		"grauer",
+		"gravur",
+		"grease",
+		"green",
+		"greift",
+		"greis",
+		"grell",
+		"grelle",
+		"grenze",
+		"grenzt",
+		"griebe",
+		"griess",
+		"griff",
+		"grill",
+		"grille",
+		"grimm",
+		"gringo",
+		"grinst",
+		"grippe",
+		"grips",
+		"grob",
+		"grober",
+		"grobes",
+		"groelt",
+		"grog",
+		"groll",
+		"gros",
+		"gross",
+		"grosse",
+		"grotte",
+		"grub",
+		"grube",
+		"gruen",
+		"gruene",
+		"gruess",
+		"grufti",
+		"grund",
+		"grunge",
+		"grunzt",
+		"gruppe",
+		"gruss",
+		"gs",
+		"gsm",
+		"gt",
+		"gu",
+		"guam",
+		"gucken",
+		"guete",
+		"gueter",
+		"guetig",
+		"guinea",
+		"gummi",
+		"gunst",
+		"gurke",
+		"gurren",
+		"gurt",
+		"guru",
+		"gut",
+		"gute",
+		"guten",
+		"guter",
+		"guyana",
+		"gv",
+		"gvp",
+		"gw",
+		"gx",
+		"gy",
+		"gz",
+		"h",
+		"haar",
+		"haarig",
+		"hab",
+		"habe",
+		"haben",
+		"hacke",
+		"hacken",
+		"hacker",
+		"hackt",
+		"hackte",
+		"haelt",
+		"haende",
+		"haengt",
+		"haerte",
+		"haeufig",
+		"haeuft",
+		"haeuser",
+		"hafen",
+		"hafer",
+		"haft",
+		"haften",
+		"haftet",
+		"hagel",
+		"hageln",
+		"hagelt",
+		"hagen",
+		"hager",
+		"haggis",
+		"hahn",
+		"hai",
+		"hain",
+		"haiti",
+		"haken",
+		"hakend",
+		"hakig",
+		"hakt",
+		"hakte",
+		"halab",
+		"halali",
+		"halb",
+		"halber",
+		"halbgar",
+		"halde",
+		"half",
+		"halle",
+		"hallo",
+		"hallt",
+		"hallte",
+		"halm",
+		"halme",
+		"hals",
+		"halse",
+		"halsen",
+		"halsig",
+		"halt",
+		"halte",
+		"halten",
+		"halter",
+		"halts",
+		"hamlet",
+		"hammel",
+		"hammer",
+		"hand",
+		"handan",
+		"handel",
+		"hanf",
+		"hanfen",
+		"hang",
+		"hanoi",
+		"hans",
+		"hanse",
+		"hantel",
+		"harare",
+		"harbin",
+		"harem",
+		"harfe",
+		"harke",
+		"harken",
+		"hart",
+		"harte",
+		"harz",
+		"harzen",
+		"harzig",
+		"hascht",
+		"hase",
+		"haspe",
+		"hass",
+		"hassen",
+		"hasser",
+		"hasst",
+		"hast",
+		"haste",
+		"hasten",
+		"hastet",
+		"hastig",
+		"hat",
+		"hau",
+		"haube",
+		"hauch",
+		"hauen",
+		"hauend",
+		"hauer",
+		"haufen",
+		"haupt",
+		"haus",
+		"haut",
+		"haute",
+		"hawaii",
+		"hb",
+		"hbf",
+		"hc",
+		"hd",
+		"he",
+		"heard",
+		"hebel",
+		"hebeln",
+		"heben",
+		"hebend",
+		"hebt",
+		"hecht",
+		"heck",
+		"hecke",
+		"heckt",
+		"heer",
+		"hefe",
+		"hefei",
+		"hefig",
+		"heften",
+		"heftet",
+		"heftig",
+		"heide",
+		"heikel",
+		"heil",
+		"heilen",
+		"heiler",
+		"heilig",
+		"heilige",
+		"heilung",
+		"heim",
+		"heimat",
+		"heirat",
+		"heiser",
+		"heiss",
+		"heiter",
+		"heizen",
+		"heizer",
+		"heizt",
+		"heizte",
+		"hektar",
+		"hektik",
+		"held",
+		"heldin",
+		"helfen",
+		"helfer",
+		"helfs",
+		"helium",
+		"hell",
+		"hellt",
+		"helm",
+		"hemd",
+		"hemmen",
+		"hemmt",
+		"hemmte",
+		"hengst",
+		"henkel",
+		"henker",
+		"henne",
+		"herauf",
+		"heraus",
+		"herb",
+		"herbst",
+		"herd",
+		"herde",
+		"herden",
+		"herein",
+		"hering",
+		"hernia",
+		"herold",
+		"herpes",
+		"herr",
+		"herrin",
+		"hertz",
+		"herum",
+		"hervor",
+		"herz",
+		"herzas",
+		"herzig",
+		"herzog",
+		"hesse",
+		"hessen",
+		"hetze",
+		"hetzen",
+		"hetzer",
+		"hetzt",
+		"hetzte",
+		"heu",
+		"heuer",
+		"heul",
+		"heulen",
+		"heult",
+		"heulte",
+		"heute",
+		"heutig",
+		"hexe",
+		"hf",
+		"hg",
+		"hh",
+		"hhh",
+		"hhhh",
+		"hi",
+		"hieb",
+		"hielt",
+		"hier",
+		"hierzu",
+		"hiesig",
+		"hiess",
+		"hieven",
+		"hij",
+		"hilfe",
+		"hilfen",
+		"hilflos",
+		"hilfs",
+		"himmel",
+		"hin",
+		"hinab",
+		"hinauf",
+		"hinaus",
+		"hindert",
+		"hing",
+		"hinken",
+		"hinkt",
+		"hins",
+		"hinten",
+		"hinter",
+		"hinz",
+		"hippie",
+		"hirsch",
+		"hirse",
+		"hirt",
+		"hit",
+		"hitze",
+		"hitzig",
+		"hiv",
+		"hj",
+		"hk",
+		"hl",
+		"hm",
+		"hmilch",
+		"hmmm",
+		"hn",
+		"ho",
+		"hob",
+		"hobby",
+		"hobel",
+		"hobeln",
+		"hobelt",
+		"hoch",
+		"hocken",
+		"hocker",
+		"hockey",
+		"hockt",
+		"hockte",
+		"hoden",
+		"hoehe",
+		"hoehere",
+		"hoehle",
+		"hoelle",
+		"hoer",
+		"hoerbar",
+		"hoeren",
+		"hoerer",
+		"hoert",
+		"hoerte",
+		"hof",
+		"hoffen",
+		"hofft",
+		"hoffte",
+		"hohe",
+		"hoheit",
+		"hoher",
+		"hohes",
+		"hohl",
+		"hohler",
+		"hohn",
+		"hol",
+		"hold",
+		"holen",
+		"holend",
+		"holm",
+		"holst",
+		"holt",
+		"holte",
+		"holz",
+		"holzen",
+		"holzig",
+		"hong",
+		"honig",
+		"honoel",
+		"hopfen",
+		"hoppla",
+		"horcht",
+		"horde",
+		"hormon",
+		"horn",
+		"hornig",
+		"horst",
+		"hort",
+		"horten",
+		"hortet",
+		"hose",
+		"hosen",
+		"hotel",
+		"hotkey",
+		"hp",
+		"hq",
+		"hr",
+		"hrsg",
+		"hs",
+		"ht",
+		"hu",
+		"huang",
+		"hub",
+		"huefte",
+		"huegel",
+		"huelle",
+		"huellt",
+		"huelse",
+		"huepft",
+		"huepfte",
+		"huerde",
+		"huete",
+		"hueten",
+		"hueter",
+		"huetet",
+		"huette",
+		"huf",
+		"huhn",
+		"huker",
+		"human",
+		"humbug",
+		"hummel",
+		"hummer",
+		"humor",
+		"humus",
+		"hund",
+		"hunde",
+		"hunger",
+		"hunne",
+		"hupe",
+		"hupen",
+		"hure",
+		"huren",
+		"hurley",
+		"hurone",
+		"hurra",
+		"hurtig",
+		"husar",
+		"husten",
+		"hut",
+		"hv",
+		"hw",
+		"hx",
+		"hy",
+		"hyaene",
+		"hybrid",
+		"hydrid",
+		"hymne",
+		"hz",
+		"i",
+		"iallg",
+		"iao",
+		"iata",
+		"ib",
+		"ibadan",
+		"ibitak",
+		"ic",
+		"ice",
+		"ich",
+		"id",
+		"idaho",
+		"ideal",
+		"idee",
+		"ideell",
+		"idiot",
+		"idol",
+		"idylle",
+		"ie",
+		"if",
+		"ig",
+		"igel",
+		"iglu",
+		"ih",
+		"ihf",
+		"ihk",
+		"ihm",
+		"ihn",
+		"ihnen",
+		"ihr",
+		"ihre",
+		"ihrer",
+		"ii",
+		"iii",
+		"iiii",
+		"ij",
+		"ijk",
+		"ik",
+		"ikone",
+		"il",
+		"ileus",
+		"illegal",
+		"iltis",
+		"im",
+		"image",
+		"imbiss",
+		"imker",
+		"immer",
+		"immun",
+		"impfen",
+		"impft",
+		"impfte",
+		"import",
+		"impuls",
+		"in",
+		"indem",
+		"inder",
+		"index",
+		"indien",
+		"indigo",
+		"indium",
+		"indore",
+		"info",
+		"infra",
+		"ing",
+		"inger",
+		"ingwer",
+		"inh",
+		"inhalt",
+		"inka",
+		"inkl",
+		"inlett",
+		"innen",
+		"inner",
+		"innere",
+		"innung",
+		"ins",
+		"insekt",
+		"insel",
+		"insult",
+		"intakt",
+		"intern",
+		"intim",
+		"invers",
+		"io",
+		"iod",
+		"iok",
+		"ion",
+		"ionen",
+		"iowa",
+		"ip",
+		"iq",
+		"ir",
+		"ira",
+		"irak",
+		"iraker",
+		"iran",
+		"iraner",
+		"irbil",
+		"irden",
+		"ire",
+		"irin",
+		"irisch",
+		"iritis",
+		"irk",
+		"irland",
+		"ironie",
+		"irre",
+		"irreal",
+		"irren",
+		"irrend",
+		"irrig",
+		"irrt",
+		"irrtum",
+		"irrweg",
+		"is",
+		"isbn",
+		"isebel",
+		"island",
+		"iso",
+		"isomer",
+		"isotop",
+		"israel",
+		"ist",
+		"it",
+		"iu",
+		"iv",
+		"iw",
+		"iwf",
+		"ix",
+		"iy",
+		"iz",
+		"izmir",
+		"j",
+		"jacht",
+		"jacke",
+		"jade",
+		"jaeger",
+		"jaeh",
+		"jaeten",
+		"jagd",
+		"jagen",
+		"jagend",
+		"jagt",
+		"jagte",
+		"jaguar",
+		"jahr",
+		"jaipur",
+		"jammer",
+		"januar",
+		"japan",
+		"jargon",
+		"jasmin",
+		"jauche",
+		"jaulen",
+		"jault",
+		"jaulte",
+		"jawohl",
+		"jawort",
+		"jazz",
+		"jb",
+		"jc",
+		"jd",
+		"je",
+		"jeans",
+		"jede",
+		"jeden",
+		"jeder",
+		"jedes",
+		"jemals",
+		"jemand",
+		"jemen",
+		"jene",
+		"jener",
+		"jetlag",
+		"jetset",
+		"jetten",
+		"jetzt",
+		"jf",
+		"jg",
+		"jh",
+		"jhrl",
+		"jhv",
+		"ji",
+		"jiddah",
+		"jigger",
+		"jilin",
+		"jinan",
+		"jj",
+		"jjj",
+		"jjjj",
+		"jk",
+		"jkl",
+		"jl",
+		"jm",
+		"jn",
+		"jo",
+		"job",
+		"joch",
+		"jod",
+		"jodeln",
+		"jodelt",
+		"jodler",
+		"joga",
+		"joggen",
+		"johlen",
+		"johlt",
+		"joint",
+		"jolle",
+		"jordan",
+		"jota",
+		"joule",
+		"jp",
+		"jq",
+		"jr",
+		"js",
+		"jt",
+		"ju",
+		"jubel",
+		"jubeln",
+		"jubelt",
+		"jucken",
+		"jude",
+		"juedin",
+		"jugend",
+		"juli",
+		"julius",
+		"jumbo",
+		"jumper",
+		"jung",
+		"junge",
+		"jungen",
+		"junger",
+		"junges",
+		"jungs",
+		"juni",
+		"junker",
+		"junkie",
+		"junta",
+		"jur",
+		"jura",
+		"jurist",
+		"jury",
+		"justiz",
+		"jute",
+		"juwel",
+		"jv",
+		"jw",
+		"jx",
+		"jy",
+		"jz",
+		"k",
+		"kabel",
+		"kabine",
+		"kabul",
+		"kachel",
+		"kacke",
+		"kadaver",
+		"kadenz",
+		"kader",
+		"kadett",
+		"kaefer",
+		"kaefig",
+		"kaelte",
+		"kaese",
+		"kaeut",
+		"kaeute",
+		"kaff",
+		"kaffee",
+		"kahl",
+		"kahle",
+		"kahler",
+		"kahmig",
+		"kahn",
+		"kai",
+		"kaiser",
+		"kajak",
+		"kakadu",
+		"kakao",
+		"kaktee",
+		"kalb",
+		"kalben",
+		"kalbte",
+		"kalif",
+		"kalium",
+		"kalk",
+		"kalkig",
+		"kalkte",
+		"kalt",
+		"kalte",
+		"kalter",
+		"kaltes",
+		"kam",
+		"kamel",
+		"kamera",
+		"kamin",
+		"kamm",
+		"kammer",
+		"kampf",
+		"kanada",
+		"kanal",
+		"kandis",
+		"kann",
+		"kanne",
+		"kannst",
+		"kanone",
+		"kanpur",
+		"kansas",
+		"kante",
+		"kanter",
+		"kanton",
+		"kantor",
+		"kanu",
+		"kanzel",
+		"kaolin",
+		"kap",
+		"kapaun",
+		"kaper",
+		"kapern",
+		"kapier",
+		"kappa",
+		"kappe",
+		"kapsel",
+		"kaputt",
+		"karat",
+		"karate",
+		"karbid",
+		"karbol",
+		"karbon",
+		"karde",
+		"kardex",
+		"karo",
+		"karre",
+		"karren",
+		"karst",
+		"karte",
+		"kartei",
+		"karton",
+		"kasack",
+		"kasan",
+		"kasino",
+		"kasse",
+		"kassel",
+		"kaste",
+		"kasten",
+		"katar",
+		"kate",
+		"kater",
+		"kath",
+		"kation",
+		"katode",
+		"kattun",
+		"katze",
+		"kaubar",
+		"kauen",
+		"kauend",
+		"kauer",
+		"kauern",
+		"kauert",
+		"kauf",
+		"kaufen",
+		"kauft",
+		"kaufte",
+		"kaum",
+		"kausal",
+		"kaut",
+		"kaute",
+		"kauten",
+		"kauz",
+		"kaviar",
+		"kb",
+		"kc",
+		"kd",
+		"ke",
+		"kebab",
+		"keck",
+		"kegel",
+		"kegeln",
+		"kegler",
+		"kehle",
+		"kehlig",
+		"kehrer",
+		"kehrt",
+		"kehrte",
+		"keifen",
+		"keift",
+		"keil",
+		"keilt",
+		"keilte",
+		"keim",
+		"keimen",
+		"keimt",
+		"kein",
+		"keine",
+		"keinen",
+		"keiner",
+		"keks",
+		"kelch",
+		"kelle",
+		"keller",
+		"keloid",
+		"kelte",
+		"kenia",
+		"kennen",
+		"kenner",
+		"kenyer",
+		"kerbe",
+		"kerbel",
+		"kerben",
+		"kerbt",
+		"kerbte",
+		"kerker",
+		"kerl",
+		"kern",
+		"kernal",
+		"kernig",
+		"kerze",
+		"kessel",
+		"keton",
+		"kette",
+		"kettet",
+		"ketzer",
+		"keucht",
+		"keule",
+		"keusch",
+		"kf",
+		"kfm",
+		"kfz",
+		"kg",
+		"kh",
+		"khulna",
+		"ki",
+		"kiefer",
+		"kiel",
+		"kieme",
+		"kiepe",
+		"kies",
+		"kiesel",
+		"kigali",
+		"kilo",
+		"kimm",
+		"kimme",
+		"kind",
+		"kinder",
+		"kinn",
+		"kino",
+		"kippe",
+		"kippen",
+		"kipper",
+		"kippt",
+		"kippte",
+		"kirche",
+		"kirmes",
+		"kissen",
+		"kiste",
+		"kitsch",
+		"kitt",
+		"kittel",
+		"kitten",
+		"kittet",
+		"kitz",
+		"kitzel",
+		"kj",
+		"kk",
+		"kkk",
+		"kkkk",
+		"kl",
+		"kladde",
+		"klaert",
+		"klage",
+		"klagen",
+		"klagt",
+		"klagte",
+		"klamm",
+		"klampe",
+		"klan",
+		"klang",
+		"klappe",
+		"klappt",
+		"klaps",
+		"klar",
+		"klasse",
+		"klaue",
+		"klauen",
+		"klause",
+		"klaut",
+		"klaute",
+		"kleben",
+		"kleber",
+		"klebt",
+		"klebte",
+		"klecks",
+		"klee",
+		"kleid",
+		"kleie",
+		"klein",
+		"kleine",
+		"kleiner",
+		"klemme",
+		"klemmt",
+		"klette",
+		"klick",
+		"klient",
+		"kliff",
+		"klima",
+		"klinge",
+		"klingt",
+		"klinik",
+		"klinke",
+		"klinkt",
+		"klippe",
+		"klirrt",
+		"klm",
+		"klo",
+		"kloake",
+		"kloent",
+		"klon",
+		"klonen",
+		"klotz",
+		"klub",
+		"kluft",
+		"klug",
+		"km",
+		"kn",
+		"knabe",
+		"knackt",
+		"knaeul",
+		"knall",
+		"knallt",
+		"knapp",
+		"knappe",
+		"knarre",
+		"knast",
+		"knebel",
+		"knecht",
+		"kneift",
+		"kneipe",
+		"knete",
+		"kneten",
+		"knick",
+		"knicks",
+		"knie",
+		"knien",
+		"kniend",
+		"kniet",
+		"kniete",
+		"kniff",
+		"knilch",
+		"knirps",
+		"knogga",
+		"knolle",
+		"knopf",
+		"knospe",
+		"knoten",
+		"knotet",
+		"knotig",
+		"knowhow",
+		"knurrt",
+		"knut",
+		"knute",
+		"ko",
+		"kobalt",
+		"kobold",
+		"koch",
+		"kochen",
+		"kocher",
+		"kocht",
+		"kochte",
+		"koda",
+		"kodein",
+		"kodex",
+		"koeder",
+		"koeln",
+		"koenig",
+		"koepft",
+		"koernt",
+		"koeter",
+		"koffer",
+		"kognak",
+		"kohl",
+		"kohle",
+		"kohorte",
+		"koitus",
+		"koje",
+		"kojote",
+		"kokain",
+		"kokett",
+		"kokon",
+		"koks",
+		"kokuna",
+		"kolben",
+		"kolik",
+		"kolleg",
+		"kollege",
+		"koller",
+		"koloss",
+		"komet",
+		"komi",
+		"komm",
+		"komma",
+		"kommen",
+		"kommst",
+		"kommt",
+		"kondom",
+		"kondor",
+		"konkav",
+		"konnte",
+		"konsul",
+		"konsum",
+		"konter",
+		"konto",
+		"kontor",
+		"kontra",
+		"konus",
+		"konvex",
+		"kopal",
+		"kopf",
+		"kopie",
+		"koppel",
+		"koran",
+		"korb",
+		"kord",
+		"kordel",
+		"kordon",
+		"korea",
+		"korfu",
+		"kork",
+		"korken",
+		"korn",
+		"koror",
+		"korse",
+		"korund",
+		"kosen",
+		"kosmos",
+		"kosovo",
+		"kost",
+		"kosten",
+		"kostet",
+		"kostuem",
+		"kot",
+		"kotig",
+		"kotzen",
+		"kp",
+		"kpev",
+		"kq",
+		"kr",
+		"krabbe",
+		"krach",
+		"kracht",
+		"kraehe",
+		"kraft",
+		"kragen",
+		"krake",
+		"kralle",
+		"krampf",
+		"kran",
+		"krank",
+		"kranke",
+		"kranz",
+		"krass",
+		"krater",
+		"kratze",
+		"kratzt",
+		"krault",
+		"kraus",
+		"krause",
+		"kraut",
+		"krebs",
+		"kredit",
+		"kreide",
+		"kreis",
+		"kreist",
+		"kreml",
+		"krempe",
+		"krepp",
+		"kresse",
+		"kreta",
+		"kreter",
+		"kreuz",
+		"kreuzt",
+		"krieg",
+		"krill",
+		"krim",
+		"krimi",
+		"kripo",
+		"krippe",
+		"krise",
+		"kritik",
+		"kroate",
+		"kroch",
+		"kroete",
+		"krokus",
+		"krone",
+		"kropf",
+		"kruemmt",
+		"krug",
+		"krumm",
+		"krumme",
+		"krung",
+		"krupp",
+		"kruste",
+		"krypta",
+		"ks",
+		"kt",
+		"kto",
+		"ku",
+		"kuala",
+		"kuba",
+		"kubist",
+		"kuchen",
+		"kuebel",
+		"kueche",
+		"kuehl",
+		"kuehle",
+		"kuehlt",
+		"kuehn",
+		"kueken",
+		"kuer",
+		"kueren",
+		"kuerze",
+		"kuerzt",
+		"kuesst",
+		"kueste",
+		"kufe",
+		"kugel",
+		"kuguar",
+		"kuh",
+		"kulanz",
+		"kuli",
+		"kult",
+		"kultur",
+		"kummer",
+		"kumpan",
+		"kumpel",
+		"kunde",
+		"kunden",
+		"kundig",
+		"kunst",
+		"kupfer",
+		"kuppel",
+		"kur",
+		"kurare",
+		"kurbel",
+		"kurie",
+		"kurier",
+		"kuries",
+		"kuriose",
+		"kurort",
+		"kurs",
+		"kursiv",
+		"kurve",
+		"kurz",
+		"kurze",
+		"kurzen",
+		"kurzer",
+		"kurzum",
+		"kuss",
+		"kutte",
+		"kuweit",
+		"kv",
+		"kw",
+		"kx",
+		"ky",
+		"kyyiv",
+		"kz",
+		"l",
+		"lab",
+		"labend",
+		"labern",
+		"labial",
+		"labil",
+		"labor",
+		"lache",
+		"lachen",
+		"lacher",
+		"lachs",
+		"lacht",
+		"lachte",
+		"lack",
+		"lade",
+		"laden",
+		"ladend",
+		"lader",
+		"ladung",
+		"laedt",
+		"laehmt",
+		"laenge",
+		"laengs",
+		"laerm",
+		"laermt",
+		"laesst",
+		"laeuft",
+		"lag",
+		"lage",
+		"lager",
+		"lagern",
+		"lagert",
+		"lagos",
+		"lagune",
+		"lahm",
+		"lahore",
+		"laib",
+		"laich",
+		"laie",
+		"lakai",
+		"lake",
+		"laken",
+		"lamm",
+		"lammen",
+		"lampe",
+		"land",
+		"landen",
+		"lang",
+		"lange",
+		"lanze",
+		"laos",
+		"laote",
+		"lappen",
+		"laptop",
+		"larve",
+		"larven",
+		"las",
+		"lasch",
+		"lasche",
+		"laser",
+		"lass",
+		"lassen",
+		"lasso",
+		"lasst",
+		"last",
+		"lasten",
+		"laster",
+		"lasur",
+		"latein",
+		"latent",
+		"latte",
+		"latz",
+		"lau",
+		"laub",
+		"laube",
+		"lauern",
+		"lauert",
+		"lauf",
+		"laufen",
+		"lauge",
+		"laugen",
+		"laugt",
+		"laugte",
+		"laune",
+		"launig",
+		"laurie",
+		"laus",
+		"lausen",
+		"lausig",
+		"lauste",
+		"laut",
+		"laute",
+		"lauter",
+		"lautes",
+		"lava",
+		"lawine",
+		"layout",
+		"lb",
+		"lc",
+		"ld",
+		"le",
+		"leb",
+		"lebe",
+		"leben",
+		"lebend",
+		"leber",
+		"leblos",
+		"lebst",
+		"lebt",
+		"lebte",
+		"leck",
+		"lecken",
+		"lecker",
+		"leckt",
+		"led",
+		"leder",
+		"ledern",
+		"ledig",
+		"lee",
+		"leeds",
+		"leefze",
+		"leer",
+		"leere",
+		"leeren",
+		"leeres",
+		"leert",
+		"legal",
+		"legat",
+		"legen",
+		"leger",
+		"legion",
+		"legt",
+		"legte",
+		"leguan",
+		"lehen",
+		"lehm",
+		"lehmig",
+		"lehne",
+		"lehnen",
+		"lehnt",
+		"lehnte",
+		"lehr",
+		"lehre",
+		"lehren",
+		"lehrer",
+		"lehrt",
+		"lehrte",
+		"leib",
+		"leiche",
+		"leicht",
+		"leid",
+		"leiden",
+		"leider",
+		"leidet",
+		"leier",
+		"leihe",
+		"leihen",
+		"leiht",
+		"leim",
+		"leimen",
+		"leimt",
+		"leine",
+		"leinen",
+		"leise",
+		"leiser",
+		"leiste",
+		"leit",
+		"leiten",
+		"leiter",
+		"leitet",
+		"lektor",
+		"lemma",
+		"lena",
+		"lende",
+		"lenken",
+		"lenker",
+		"lenkt",
+		"lenkte",
+		"lenz",
+		"lenzen",
+		"leon",
+		"lepra",
+		"lerche",
+		"lernen",
+		"lernend",
+		"lernst",
+		"lernt",
+		"lernte",
+		"lesart",
+		"lesbar",
+		"lesbe",
+		"lese",
+		"lesen",
+		"lesend",
+		"leser",
+		"lesung",
+		"lette",
+		"letzte",
+		"leucin",
+		"leute",
+		"level",
+		"lewis",
+		"lf",
+		"lfd",
+		"lfg",
+		"lg",
+		"lh",
+		"li",
+		"libero",
+		"libido",
+		"libyen",
+		"libyer",
+		"licht",
+		"lid",
+		"lieb",
+		"liebe",
+		"lieben",
+		"lieber",
+		"liebes",
+		"liebt",
+		"lied",
+		"lief",
+		"liege",
+		"liegen",
+		"liegt",
+		"lieh",
+		"lies",
+		"liess",
+		"liest",
+		"lift",
+		"liga",
+		"likoer",
+		"lila",
+		"lilie",
+		"lille",
+		"lima",
+		"limbo",
+		"limes",
+		"linde",
+		"lineal",
+		"linear",
+		"linie",
+		"linke",
+		"links",
+		"linse",
+		"linux",
+		"lipid",
+		"lippe",
+		"liquor",
+		"lisboa",
+		"list",
+		"liste",
+		"listet",
+		"listig",
+		"litauer",
+		"liter",
+		"litze",
+		"livedo",
+		"lizenz",
+		"lj",
+		"lk",
+		"lkw",
+		"ll",
+		"llkw",
+		"lll",
+		"llll",
+		"lm",
+		"lmaa",
+		"lmn",
+		"ln",
+		"lo",
+		"lob",
+		"loben",
+		"lobend",
+		"lobt",
+		"lobte",
+		"loch",
+		"lochen",
+		"lochia",
+		"locke",
+		"locken",
+		"locker",
+		"lockere",
+		"lockt",
+		"lockte",
+		"loden",
+		"lodz",
+		"loesen",
+		"loeser",
+		"loess",
+		"loest",
+		"loeste",
+		"loeten",
+		"loetend",
+		"loetet",
+		"loewe",
+		"log",
+		"logge",
+		"loggia",
+		"logik",
+		"logo",
+		"lohn",
+		"lohnen",
+		"lohnt",
+		"loipe",
+		"lokal",
+		"lokale",
+		"lokum",
+		"lome",
+		"london",
+		"lore",
+		"los",
+		"losbar",
+		"lose",
+		"loser",
+		"losung",
+		"lot",
+		"loten",
+		"lotion",
+		"lotse",
+		"loyal",
+		"lp",
+		"lq",
+		"lr",
+		"ls",
+		"lt",
+		"ltd",
+		"ltg",
+		"lu",
+		"luanda",
+		"luchs",
+		"lud",
+		"luecke",
+		"lueg",
+		"luege",
+		"luegen",
+		"luffa",
+		"luft",
+		"luftig",
+		"luftweg",
+		"luftzug",
+		"lug",
+		"luke",
+		"lullt",
+		"lullte",
+		"lumbal",
+		"lumen",
+		"lunch",
+		"lunge",
+		"lungen",
+		"lunker",
+		"lupe",
+		"lupine",
+		"lurch",
+		"lusaka",
+		"lust",
+		"lustig",
+		"lustlos",
+		"luth",
+		"luv",
+		"luven",
+		"lux",
+		"luxus",
+		"lv",
+		"lw",
+		"lx",
+		"ly",
+		"lymphe",
+		"lyon",
+		"lyra",
+		"lyrik",
+		"lysin",
+		"lyzeum",
+		"lz",
+		"m",
+		"maat",
+		"macau",
+		"mach",
+		"machen",
+		"macher",
+		"macho",
+		"machs",
+		"machst",
+		"macht",
+		"machte",
+		"macke",
+		"mad",
+		"made",
+		"madig",
+		"madrid",
+		"maedel",
+		"maehen",
+		"maeher",
+		"maehne",
+		"maeht",
+		"maehte",
+		"maekle",
+		"maennl",
+		"maerz",
+		"mafia",
+		"mag",
+		"magd",
+		"magen",
+		"mager",
+		"magere",
+		"magern",
+		"magert",
+		"magie",
+		"magnat",
+		"magnet",
+		"mahl",
+		"mahlen",
+		"mahlt",
+		"mahlte",
+		"mahnen",
+		"mahnt",
+		"mahnte",
+		"mai",
+		"maid",
+		"maine",
+		"mainz",
+		"mais",
+		"major",
+		"majuro",
+		"makel",
+		"makler",
+		"makro",
+		"makula",
+		"mal",
+		"malabo",
+		"malaie",
+		"malawi",
+		"male",
+		"malen",
+		"maler",
+		"mali",
+		"malier",
+		"malt",
+		"malta",
+		"malve",
+		"malz",
+		"malzig",
+		"mamey",
+		"mammon",
+		"mammut",
+		"mampf",
+		"man",
+		"manama",
+		"manaus",
+		"manche",
+		"mandat",
+		"mandel",
+		"manege",
+		"mangan",
+		"mangel",
+		"mango",
+		"manie",
+		"manila",
+		"manko",
+		"mann",
+		"mantel",
+		"manual",
+		"mappe",
+		"maputo",
+		"marder",
+		"mariae",
+		"marij",
+		"marine",
+		"mark",
+		"marke",
+		"marken",
+		"markig",
+		"markt",
+		"marmor",
+		"marone",
+		"mars",
+		"marsch",
+		"marter",
+		"masche",
+		"maser",
+		"masern",
+		"maseru",
+		"maske",
+		"mass",
+		"masse",
+		"massig",
+		"massiv",
+		"masst",
+		"mast",
+		"matrix",
+		"matsch",
+		"matt",
+		"matte",
+		"mauer",
+		"mauern",
+		"mauert",
+		"mauken",
+		"maul",
+		"maurer",
+		"maus",
+		"mauser",
+		"mauzi",
+		"max",
+		"mazare",
+		"mb",
+		"mbh",
+		"mc",
+		"md",
+		"mdb",
+		"mdl",
+		"me",
+		"medan",
+		"median",
+		"medley",
+		"meer",
+		"meere",
+		"meerut",
+		"mega",
+		"mehl",
+		"mehlig",
+		"mehr",
+		"meiden",
+		"meidet",
+		"meile",
+		"meiler",
+		"mein",
+		"meine",
+		"meinen",
+		"meiner",
+		"meint",
+		"meinte",
+		"meise",
+		"meist",
+		"mekka",
+		"mekong",
+		"melden",
+		"meldet",
+		"meldung",
+		"melken",
+		"melkt",
+		"melone",
+		"menge",
+		"mengt",
+		"mensa",
+		"mensch",
+		"mensur",
+		"mental",
+		"mentor",
+		"menue",
+		"mergel",
+		"merk",
+		"merken",
+		"merkte",
+		"merkur",
+		"merlin",
+		"merzt",
+		"mess",
+		"messbar",
+		"messe",
+		"messen",
+		"messer",
+		"met",
+		"metall",
+		"meteor",
+		"meter",
+		"methan",
+		"methyl",
+		"metier",
+		"metro",
+		"metrum",
+		"meute",
+		"mewtu",
+		"mexiko",
+		"mez",
+		"mf",
+		"mfg",
+		"mg",
+		"mh",
+		"mi",
+		"miami",
+		"miauen",
+		"miaut",
+		"miaute",
+		"mich",
+		"micro",
+		"mieden",
+		"mieder",
+		"mief",
+		"miene",
+		"mies",
+		"miete",
+		"mieten",
+		"mieter",
+		"mietet",
+		"mietze",
+		"mikron",
+		"milano",
+		"milbe",
+		"milch",
+		"mild",
+		"milde",
+		"milieu",
+		"miliz",
+		"mill",
+		"milz",
+		"mimend",
+		"mimik",
+		"mimisch",
+		"mimose",
+		"mimt",
+		"mimte",
+		"min",
+		"minder",
+		"mine",
+		"minor",
+		"minsk",
+		"minus",
+		"minute",
+		"minze",
+		"mio",
+		"mir",
+		"misch",
+		"mischt",
+		"misst",
+		"mist",
+		"mistel",
+		"mit",
+		"mitose",
+		"mittag",
+		"mitte",
+		"mittel",
+		"mitten",
+		"mittig",
+		"mitw",
+		"mixer",
+		"mixt",
+		"mixte",
+		"mj",
+		"mk",
+		"ml",
+		"mm",
+		"mmm",
+		"mmmm",
+		"mn",
+		"mno",
+		"mo",
+		"mobil",
+		"mobile",
+		"mod",
+		"modal",
+		"mode",
+		"modell",
+		"modem",
+		"moder",
+		"modern",
+		"modrig",
+		"modul",
+		"modus",
+		"moebel",
+		"moebl",
+		"moegen",
+		"moehre",
+		"moel",
+		"moench",
+		"moese",
+		"moewe",
+		"mofa",
+		"mogeln",
+		"mogelt",
+		"mogul",
+		"mol",
+		"moldau",
+		"mole",
+		"molke",
+		"moll",
+		"molle",
+		"mollig",
+		"mombi",
+		"moment",
+		"monaco",
+		"monat",
+		"mond",
+		"monom",
+		"monsun",
+		"montag",
+		"moor",
+		"moos",
+		"moosig",
+		"mop",
+		"moped",
+		"mops",
+		"moral",
+		"morast",
+		"morbid",
+		"mord",
+		"morden",
+		"morgen",
+		"moroni",
+		"mosaik",
+		"moskva",
+		"moslem",
+		"most",
+		"motel",
+		"motiv",
+		"motor",
+		"motte",
+		"motto",
+		"mousse",
+		"mp",
+		"mq",
+		"mr",
+		"mrd",
+		"ms",
+		"mt",
+		"mtl",
+		"mu",
+		"muecke",
+		"muede",
+		"muehe",
+		"muehle",
+		"muell",
+		"mueller",
+		"muendig",
+		"muenze",
+		"muerbe",
+		"muetze",
+		"muff",
+		"muffe",
+		"muffig",
+		"muhen",
+		"muhend",
+		"mulch",
+		"mulde",
+		"muldex",
+		"mull",
+		"mullah",
+		"multan",
+		"mumbai",
+		"mumie",
+		"mund",
+		"munden",
+		"mungo",
+		"munter",
+		"murmel",
+		"murren",
+		"mus",
+		"muscat",
+		"muschi",
+		"muse",
+		"museum",
+		"musik",
+		"musiker",
+		"muskat",
+		"muskel",
+		"muss",
+		"muster",
+		"mut",
+		"mutig",
+		"mutlos",
+		"mutter",
+		"mutti",
+		"mv",
+		"mw",
+		"mwst",
+		"mx",
+		"my",
+		"myelom",
+		"mykose",
+		"myon",
+		"myopie",
+		"myosin",
+		"myrrhe",
+		"myrthe",
+		"mystik",
+		"mythos",
+		"mz",
+		"n",
+		"nabe",
+		"nabel",
+		"nach",
+		"nachm",
+		"nacht",
+		"nachts",
+		"nacken",
+		"nackig",
+		"nackt",
+		"nackte",
+		"nadel",
+		"naehe",
+		"naehen",
+		"naeher",
+		"naeht",
+		"naehte",
+		"naeml",
+		"naesse",
+		"nagel",
+		"nageln",
+		"nagend",
+		"nagoya",
+		"nagpur",
+		"nagt",
+		"nah",
+		"nahe",
+		"nahen",
+		"nahend",
+		"nahezu",
+		"nahm",
+		"nahost",
+		"naht",
+		"naiv",
+		"name",
+		"namen",
+		"namens",
+		"nannte",
+		"nanu",
+		"naomi",
+		"napalm",
+		"napf",
+		"napoli",
+		"narbe",
+		"narbig",
+		"narr",
+		"nasa",
+		"nasal",
+		"nase",
+		"nashik",
+		"nass",
+		"nassau",
+		"nation",
+		"nato",
+		"natter",
+		"natur",
+		"nauru",
+		"nazi",
+		"nb",
+		"nc",
+		"nchf",
+		"nchr",
+		"nd",
+		"ne",
+		"nebel",
+		"neben",
+		"neblig",
+		"necken",
+		"neckt",
+		"neckte",
+		"neffe",
+		"neg",
+		"neger",
+		"negrid",
+		"nehmen",
+		"neid",
+		"neider",
+		"neigen",
+		"neigt",
+		"neigte",
+		"nein",
+		"nektar",
+		"nelke",
+		"nennen",
+		"nenner",
+		"nennt",
+		"neodym",
+		"neogen",
+		"neon",
+		"nepal",
+		"neppt",
+		"neptun",
+		"nerv",
+		"nerven",
+		"nervig",
+		"nervt",
+		"nervte",
+		"nerz",
+		"nessel",
+		"nest",
+		"nett",
+		"netto",
+		"netz",
+		"neu",
+		"neubau",
+		"neue",
+		"neuer",
+		"neues",
+		"neun",
+		"neunte",
+		"neural",
+		"neuron",
+		"nevada",
+		"new",
+		"nf",
+		"ng",
+		"ngo",
+		"nh",
+		"ni",
+		"niamey",
+		"nicht",
+		"nichte",
+		"nichts",
+		"nickel",
+		"nicken",
+		"nie",
+		"nieder",
+		"niere",
+		"nieren",
+		"niesen",
+		"niest",
+		"niet",
+		"niete",
+		"nieten",
+		"niger",
+		"nigger",
+		"nil",
+		"nimm",
+		"nimmt",
+		"ningbo",
+		"nippel",
+		"nippen",
+		"nippt",
+		"nische",
+		"nisten",
+		"nistet",
+		"nitrit",
+		"niue",
+		"nix",
+		"nixe",
+		"niznij",
+		"nizza",
+		"nj",
+		"nk",
+		"nl",
+		"nm",
+		"nmal",
+		"nn",
+		"nnn",
+		"nnnn",
+		"no",
+		"nobel",
+		"noch",
+		"nocke",
+		"nodoes",
+		"noetig",
+		"nomade",
+		"nonius",
+		"nop",
+		"noppe",
+		"norden",
+		"norm",
+		"normal",
+		"north",
+		"not",
+		"notar",
+		"note",
+		"noten",
+		"notiz",
+		"notruf",
+		"nougat",
+		"noumea",
+		"np",
+		"npd",
+		"nq",
+		"nr",
+		"ns",
+		"nt",
+		"nu",
+		"nudel",
+		"nudist",
+		"nuetze",
+		"nuetzt",
+		"nukleon",
+		"null",
+		"nullen",
+		"nummer",
+		"nun",
+		"nur",
+		"nuss",
+		"nussig",
+		"nut",
+		"nutria",
+		"nutte",
+		"nutzen",
+		"nutzer",
+		"nuuk",
+		"nv",
+		"nw",
+		"nx",
+		"ny",
+		"nylon",
+		"nz",
+		"o",
+		"oas",
+		"oase",
+		"ob",
+		"obb",
+		"obdach",
+		"oben",
+		"obenab",
+		"ober",
+		"obere",
+		"oberer",
+		"oberst",
+		"obige",
+		"objekt",
+		"oblag",
+		"oblate",
+		"oboe",
+		"obst",
+		"obwohl",
+		"oc",
+		"ochse",
+		"ocker",
+		"od",
+		"ode",
+		"oder",
+		"odessa",
+		"odor",
+		"oe",
+		"oecd",
+		"oede",
+		"oedem",
+		"oeffne",
+		"oelbad",
+		"oelen",
+		"oelend",
+		"oeler",
+		"oelig",
+		"oelt",
+		"oelte",
+		"oese",
+		"of",
+		"ofen",
+		"off",
+		"offen",
+		"offene",
+		"offiz",
+		"oft",
+		"og",
+		"oh",
+		"ohchr",
+		"ohg",
+		"ohio",
+		"ohm",
+		"ohne",
+		"ohr",
+		"ohren",
+		"oi",
+		"oj",
+		"ok",
+		"oktal",
+		"oktan",
+		"oktant",
+		"oktave",
+		"okular",
+		"ol",
+		"oliv",
+		"olive",
+		"om",
+		"oma",
+		"oman",
+		"omen",
+		"omsk",
+		"on",
+		"onkel",
+		"onyx",
+		"oo",
+		"ooo",
+		"oooo",
+		"op",
+		"opa",
+		"opal",
+		"opec",
+		"oper",
+		"opfer",
+		"opfern",
+		"opfert",
+		"opiat",
+		"opium",
+		"opq",
+		"oprof",
+		"optik",
+		"option",
+		"opus",
+		"oq",
+		"or",
+		"orakel",
+		"oral",
+		"orange",
+		"orden",
+		"ordnen",
+		"ordner",
+		"ordnet",
+		"oregon",
+		"organ",
+		"orgel",
+		"orgie",
+		"orient",
+		"orig",
+		"oring",
+		"orion",
+		"orkan",
+		"ort",
+		"orten",
+		"ortet",
+		"orth",
+		"ortung",
+		"os",
+		"osaka",
+		"oslo",
+		"osmium",
+		"osmose",
+		"ossi",
+		"ost",
+		"osten",
+		"ostern",
+		"ostsee",
+		"ot",
+		"otitis",
+		"ottawa",
+		"otter",
+		"ou",
+		"ov",
+		"oval",
+		"ovipar",
+		"ovum",
+		"ow",
+		"ox",
+		"oxid",
+		"oy",
+		"oz",
+		"ozean",
+		"ozelot",
+		"ozon",
+		"p",
+		"paar",
+		"paaren",
+		"paarig",
+		"paart",
+		"paarte",
+		"pacht",
+		"pack",
+		"packen",
+		"packer",
+		"packt",
+		"packte",
+		"paddel",
+		"padr",
+		"paella",
+		"paffen",
+		"paffer",
+		"pafft",
+		"paffte",
+		"pago",
+		"pagode",
+		"paket",
+		"pakt",
+		"palast",
+		"palau",
+		"palme",
+		"pampa",
+		"pampe",
+		"panama",
+		"panda",
+		"panik",
+		"panne",
+		"pansen",
+		"panter",
+		"panzer",
+		"pap",
+		"papa",
+		"papaya",
+		"papel",
+		"papier",
+		"pappe",
+		"pappel",
+		"papst",
+		"papua",
+		"parade",
+		"parese",
+		"pari",
+		"paris",
+		"park",
+		"parka",
+		"parken",
+		"parkt",
+		"parole",
+		"partei",
+		"partie",
+		"party",
+		"pascal",
+		"pass",
+		"passen",
+		"passiv",
+		"passt",
+		"passte",
+		"paste",
+		"pastor",
+		"pasty",
+		"patch",
+		"pate",
+		"patent",
+		"pater",
+		"patin",
+		"patna",
+		"patt",
+		"patzer",
+		"patzig",
+		"patzte",
+		"pauke",
+		"pauken",
+		"pause",
+		"pausen",
+		"pavian",
+		"pb",
+		"pc",
+		"pd",
+		"pe",
+		"pecan",
+		"pech",
+		"pedant",
+		"peer",
+		"pegel",
+		"pein",
+		"pelvin",
+		"pelz",
+		"pendel",
+		"peng",
+		"penne",
+		"penny",
+		"pensum",
+		"pepsin",
+		"peptid",
+		"per",
+		"perle",
+		"perm",
+		"pers",
+		"perser",
+		"person",
+		"perth",
+		"peru",
+		"pessar",
+		"pest",
+		"peter",
+		"petit",
+		"petrus",
+		"petzen",
+		"petzer",
+		"petzte",
+		"pf",
+		"pfad",
+		"pfahl",
+		"pfand",
+		"pfanne",
+		"pfau",
+		"pfd",
+		"pfeife",
+		"pfeil",
+		"pferd",
+		"pfiff",
+		"pflege",
+		"pflegt",
+		"pflug",
+		"pfote",
+		"pfriem",
+		"pfropf",
+		"pfuhl",
+		"pfui",
+		"pfund",
+		"pfusch",
+		"pg",
+		"ph",
+		"phase",
+		"phiole",
+		"phlox",
+		"phnum",
+		"phobie",
+		"phon",
+		"phonem",
+		"phrase",
+		"phwert",
+		"physik",
+		"pi",
+		"pickel",
+		"picken",
+		"piepen",
+		"piepst",
+		"pik",
+		"pikant",
+		"pilger",
+		"pille",
+		"pilot",
+		"pilz",
+		"piment",
+		"pimmel",
+		"pin",
+		"pinie",
+		"pinkel",
+		"pinne",
+		"pinsel",
+		"pipi",
+		"piranha",
+		"pirat",
+		"pirol",
+		"pirsch",
+		"pisse",
+		"piste",
+		"pizza",
+		"pj",
+		"pk",
+		"pkt",
+		"pkw",
+		"pl",
+		"plaene",
+		"plage",
+		"plagen",
+		"plagiat",
+		"plagt",
+		"plagte",
+		"plakat",
+		"plan",
+		"plane",
+		"planen",
+		"planet",
+		"planke",
+		"plante",
+		"planum",
+		"plasma",
+		"platin",
+		"platt",
+		"platte",
+		"platz",
+		"platzt",
+		"pleite",
+		"plenum",
+		"plombe",
+		"plugin",
+		"plump",
+		"plumps",
+		"plus",
+		"pluto",
+		"ply",
+		"plz",
+		"pm",
+		"pn",
+		"po",
+		"pocke",
+		"pocken",
+		"podest",
+		"podium",
+		"poebel",
+		"poesie",
+		"poet",
+		"pogrom",
+		"pokal",
+		"pol",
+		"pole",
+		"polen",
+		"police",
+		"polka",
+		"pollen",
+		"poller",
+		"polo",
+		"polung",
+		"polyp",
+		"pomade",
+		"pomp",
+		"poncho",
+		"ponton",
+		"pony",
+		"pop",
+		"popel",
+		"popo",
+		"pore",
+		"porno",
+		"poroes",
+		"porree",
+		"port",
+		"portal",
+		"porto",
+		"pose",
+		"posen",
+		"posse",
+		"possen",
+		"post",
+		"posten",
+		"poster",
+		"postum",
+		"potent",
+		"potenz",
+		"pp",
+		"ppa",
+		"ppp",
+		"pppp",
+		"pq",
+		"pqr",
+		"pr",
+		"pracht",
+		"praegt",
+		"praha",
+		"prahlt",
+		"praia",
+		"prall",
+		"prallt",
+		"praxis",
+		"preis",
+		"preise",
+		"preist",
+		"presse",
+		"presst",
+		"prima",
+		"prime",
+		"primel",
+		"prinz",
+		"prise",
+		"prisma",
+		"privat",
+		"pro",
+		"proa",
+		"probe",
+		"proben",
+		"probt",
+		"prof",
+		"profan",
+		"profi",
+		"profil",
+		"profit",
+		"prolet",
+		"prolin",
+		"prolog",
+		"prompt",
+		"propan",
+		"prosa",
+		"prosit",
+		"proton",
+		"protzt",
+		"pruede",
+		"prueft",
+		"prunk",
+		"ps",
+		"psalm",
+		"pseudo",
+		"pst",
+		"psyche",
+		"pt",
+		"ptose",
+		"pu",
+		"pudel",
+		"puder",
+		"pudern",
+		"puebla",
+		"pueblo",
+		"pueree",
+		"puerto",
+		"puff",
+		"puffen",
+		"puffer",
+		"pulk",
+		"puls",
+		"pult",
+		"pulver",
+		"pulvert",
+		"puma",
+		"pumpe",
+		"pumpen",
+		"pumps",
+		"pumpt",
+		"pumpte",
+		"pune",
+		"punkt",
+		"punkte",
+		"punt",
+		"puppe",
+		"purist",
+		"purpur",
+		"pusan",
+		"pustel",
+		"puter",
+		"putsch",
+		"putten",
+		"putz",
+		"putze",
+		"putzen",
+		"putzt",
+		"putzte",
+		"puzzle",
+		"pv",
+		"pw",
+		"px",
+		"py",
+		"pyogen",
+		"pyrit",
+		"python",
+		"pz",
+		"q",
+		"qb",
+		"qc",
+		"qd",
+		"qe",
+		"qf",
+		"qg",
+		"qh",
+		"qi",
+		"qj",
+		"qk",
+		"qkm",
+		"ql",
+		"qm",
+		"qn",
+		"qo",
+		"qp",
+		"qq",
+		"qqq",
+		"qqqq",
+		"qr",
+		"qrs",
+		"qs",
+		"qt",
+		"qu",
+		"quader",
+		"quaeket",
+		"quaekt",
+		"quaelt",
+		"quaken",
+		"quakt",
+		"quakte",
+		"qual",
+		"qualle",
+		"qualm",
+		"quark",
+		"quarte",
+		"quarz",
+		"quast",
+		"quecke",
+		"quelle",
+		"quer",
+		"querab",
+		"queren",
+		"quiche",
+		"quiekt",
+		"quillt",
+		"quinte",
+		"quirl",
+		"quito",
+		"quitt",
+		"quitte",
+		"quiz",
+		"quoll",
+		"quorum",
+		"quote",
+		"qv",
+		"qw",
+		"qx",
+		"qy",
+		"qz",
+		"r",
+		"rabat",
+		"rabatt",
+		"rabatz",
+		"rabe",
+		"rabiat",
+		"rache",
+		"rachen",
+		"racker",
+		"rad",
+		"radar",
+		"radau",
+		"radelt",
+		"radial",
+		"radio",
+		"radium",
+		"radius",
+		"radler",
+		"radon",
+		"radweg",
+		"raecht",
+		"raet",
+		"raeude",
+		"raeumt",
+		"rage",
+		"ragen",
+		"ragout",
+		"ragt",
+		"rah",
+		"rahm",
+		"rahmen",
+		"raichu",
+		"rakel",
+		"rakete",
+		"rallye",
+		"ramme",
+		"rammen",
+		"rammler",
+		"rampe",
+		"ranch",
+		"rand",
+		"rang",
+		"range",
+		"rank",
+		"ranke",
+		"rannte",
+		"ranzen",
+		"ranzig",
+		"rapier",
+		"rappe",
+		"raps",
+		"rar",
+		"rasant",
+		"rasch",
+		"rasen",
+		"rasend",
+		"raser",
+		"raserei",
+		"raspel",
+		"rasse",
+		"rassel",
+		"rassig",
+		"rast",
+		"raste",
+		"rasten",
+		"raster",
+		"rasur",
+		"rat",
+		"rate",
+		"raten",
+		"ratend",
+		"ratete",
+		"ration",
+		"ratlos",
+		"ratsam",
+		"rattan",
+		"ratte",
+		"rau",
+		"raub",
+		"rauben",
+		"raubt",
+		"raubte",
+		"rauch",
+		"raucht",
+		"raufe",
+		"raufen",
+		"rauft",
+		"rauhe",
+		"rauher",
+		"raum",
+		"raupe",
+		"raupy",
+		"rausch",
+		"raut",
+		"raute",
+		"rayon",
+		"razzia",
+		"rb",
+		"rc",
+		"rd",
+		"re",
+		"reale",
+		"reales",
+		"rebe",
+		"rebell",
+		"rechen",
+		"recht",
+		"rechte",
+		"rechts",
+		"recife",
+		"reck",
+		"red",
+		"rede",
+		"reden",
+		"redend",
+		"redet",
+		"redete",
+		"redner",
+		"reede",
+		"reeder",
+		"reell",
+		"reelle",
+		"reffen",
+		"reflex",
+		"reform",
+		"reg",
+		"regal",
+		"regbez",
+		"rege",
+		"regel",
+		"regeln",
+		"regelt",
+		"regen",
+		"regent",
+		"reggae",
+		"regie",
+		"regime",
+		"region",
+		"regler",
+		"regnen",
+		"regnet",
+		"regt",
+		"regte",
+		"regula",
+		"regung",
+		"reh",
+		"reiben",
+		"reibt",
+		"reich",
+		"reicht",
+		"reif",
+		"reife",
+		"reifen",
+		"reift",
+		"reihe",
+		"reiher",
+		"reiht",
+		"reihte",
+		"reihum",
+		"reim",
+		"reimt",
+		"rein",
+		"reine",
+		"reinen",
+		"reiner",
+		"reis",
+		"reise",
+		"reisen",
+		"reisst",
+		"reist",
+		"reiste",
+		"reiten",
+		"reiter",
+		"reitet",
+		"reiz",
+		"reizen",
+		"reizt",
+		"reizte",
+		"rekeln",
+		"rekelt",
+		"rekord",
+		"rekrut",
+		"rektal",
+		"rektor",
+		"rel",
+		"relais",
+		"relief",
+		"relikt",
+		"reling",
+		"remis",
+		"ren",
+		"renin",
+		"renn",
+		"rennen",
+		"renner",
+		"rennt",
+		"rente",
+		"rep",
+		"replik",
+		"repro",
+		"reptil",
+		"resp",
+		"rest",
+		"reste",
+		"retour",
+		"rettan",
+		"retten",
+		"retter",
+		"rettet",
+		"reue",
+		"reuig",
+		"reuse",
+		"revier",
+		"revue",
+		"rezept",
+		"rf",
+		"rg",
+		"rh",
+		"rhein",
+		"rheuma",
+		"rhode",
+		"ri",
+		"rias",
+		"rieb",
+		"riecht",
+		"rief",
+		"riefe",
+		"riege",
+		"riegel",
+		"riemen",
+		"ries",
+		"riese",
+		"riesen",
+		"riesig",
+		"riff",
+		"riffig",
+		"riga",
+		"rille",
+		"rind",
+		"rinde",
+		"rinden",
+		"rinder",
+		"ring",
+		"ringen",
+		"ringt",
+		"rinne",
+		"rinnen",
+		"rio",
+		"rippe",
+		"risiko",
+		"rispe",
+		"riss",
+		"risse",
+		"rissig",
+		"rist",
+		"ritt",
+		"ritter",
+		"ritual",
+		"ritus",
+		"ritz",
+		"ritze",
+		"ritzel",
+		"ritzen",
+		"ritzt",
+		"ritzte",
+		"rivale",
+		"rj",
+		"rk",
+		"rl",
+		"rm",
+		"rn",
+		"ro",
+		"robbe",
+		"robe",
+		"robust",
+		"rochen",
+		"rocker",
+		"rocky",
+		"rodeln",
+		"rodelt",
+		"roden",
+		"rodend",
+		"rodeo",
+		"rodet",
+		"rodete",
+		"rodung",
+		"roehre",
+		"roem",
+		"roemer",
+		"roete",
+		"roeten",
+		"roeter",
+		"roetet",
+		"roggen",
+		"roh",
+		"rohbau",
+		"rohe",
+		"rohoel",
+		"rohr",
+		"rohre",
+		"rolle",
+		"rollen",
+		"roller",
+		"rollo",
+		"rollt",
+		"rollte",
+		"rom",
+		"roma",
+		"roman",
+		"romeo",
+		"rondo",
+		"rosa",
+		"rose",
+		"roseau",
+		"rosig",
+		"rosine",
+		"ross",
+		"rost",
+		"rosten",
+		"rostet",
+		"rostig",
+		"rot",
+		"rote",
+		"roter",
+		"rotes",
+		"rotte",
+		"rottet",
+		"rotz",
+		"rotzig",
+		"rouge",
+		"route",
+		"router",
+		"rowdy",
+		"rp",
+		"rq",
+		"rr",
+		"rrr",
+		"rrrr",
+		"rs",
+		"rst",
+		"rt",
+		"ru",
+		"ruanda",
+		"rubel",
+		"rubin",
+		"rubrik",
+		"ruck",
+		"rucken",
+		"rudel",
+		"ruder",
+		"rudern",
+		"rudert",
+		"ruebe",
+		"rueck",
+		"rueckt",
+		"ruede",
+		"ruegen",
+		"ruegt",
+		"ruegte",
+		"ruehmt",
+		"ruehrt",
+		"ruest",
+		"ruesten",
+		"ruf",
+		"rufen",
+		"ruft",
+		"ruhe",
+		"ruhen",
+		"ruhend",
+		"ruhig",
+		"ruhige",
+		"ruhm",
+		"ruhr",
+		"ruht",
+		"ruhte",
+		"ruin",
+		"ruine",
+		"rum",
+		"rumba",
+		"rummel",
+		"rumpf",
+		"rund",
+		"runde",
+		"runden",
+		"rune",
+		"runzel",
+		"rupfen",
+		"rupft",
+		"rupie",
+		"ruptur",
+		"russ",
+		"russe",
+		"russig",
+		"rute",
+		"rutsch",
+		"rv",
+		"rw",
+		"rx",
+		"ry",
+		"rz",
+		"s",
+		"saal",
+		"sabbat",
+		"sacha",
+		"sache",
+		"sachen",
+		"sachse",
+		"sachte",
+		"sack",
+		"sacken",
+		"sackt",
+		"sackte",
+		"sadist",
+		"saebel",
+		"saeen",
+		"saeend",
+		"saege",
+		"saegen",
+		"saeger",
+		"saegt",
+		"saemig",
+		"saet",
+		"saete",
+		"saeugt",
+		"saeule",
+		"saeumt",
+		"saeure",
+		"safari",
+		"safcon",
+		"saflor",
+		"safran",
+		"saft",
+		"saftig",
+		"saga",
+		"sage",
+		"sagen",
+		"sagend",
+		"sago",
+		"sagt",
+		"sagte",
+		"sah",
+		"sahnig",
+		"sahnt",
+		"saint",
+		"saite",
+		"sakrale",
+		"salami",
+		"salat",
+		"salbe",
+		"salbei",
+		"salbst",
+		"salbt",
+		"salbte",
+		"saldo",
+		"saline",
+		"salm",
+		"salon",
+		"salopp",
+		"salt",
+		"salto",
+		"salut",
+		"salve",
+		"salz",
+		"salzen",
+		"salzig",
+		"salzt",
+		"samara",
+		"sambia",
+		"same",
+		"samen",
+		"samoa",
+		"sampan",
+		"samt",
+		"samtig",
+		"san",
+		"sana",
+		"sand",
+		"sandan",
+		"sandig",
+		"sandte",
+		"sanft",
+		"sang",
+		"sank",
+		"sanken",
+		"sankt",
+		"santa",
+		"santo",
+		"santos",
+		"sao",
+		"saphir",
+		"sarg",
+		"sari",
+		"sarkom",
+		"sass",
+		"satan",
+		"satin",
+		"satire",
+		"satt",
+		"sattel",
+		"saturn",
+		"satyr",
+		"satz",
+		"satzbau",
+		"sau",
+		"sauber",
+		"saudi",
+		"sauer",
+		"saufen",
+		"sauft",
+		"saufte",
+		"saugen",
+		"saugt",
+		"saugte",
+		"saum",
+		"sauna",
+		"sausen",
+		"saust",
+		"sauste",
+		"sb",
+		"sbb",
+		"sc",
+		"scampi",
+		"schabe",
+		"schach",
+		"schade",
+		"schaem",
+		"schaf",
+		"schaft",
+		"schah",
+		"schal",
+		"schale",
+		"schall",
+		"schalt",
+		"scham",
+		"schar",
+		"scharf",
+		"schart",
+		"schatz",
+		"schau",
+		"schaum",
+		"schaut",
+		"scheck",
+		"schein",
+		"scheit",
+		"schell",
+		"schelm",
+		"schema",
+		"scher",
+		"schere",
+		"scherz",
+		"scheu",
+		"scheut",
+		"schick",
+		"schieb",
+		"schiebt",
+		"schief",
+		"schien",
+		"schiff",
+		"schild",
+		"schilf",
+		"schirm",
+		"schlaf",
+		"schlag",
+		"schlau",
+		"schluf",
+		"schlug",
+		"schmal",
+		"schmerz",
+		"schmus",
+		"schnee",
+		"schnur",
+		"schob",
+		"schock",
+		"schoen",
+		"schon",
+		"schopf",
+		"schor",
+		"schorf",
+		"schoss",
+		"schot",
+		"schott",
+		"schrei",
+		"schrie",
+		"schrot",
+		"schub",
+		"schuber",
+		"schuft",
+		"schuh",
+		"schuld",
+		"schule",
+		"schult",
+		"schund",
+		"schur",
+		"schurz",
+		"schuss",
+		"schutt",
+		"schutz",
+		"schwan",
+		"schwer",
+		"schwor",
+		"schwul",
+		"schwur",
+		"sd",
+		"se",
+		"seance",
+		"sechs",
+		"sechse",
+		"sed",
+		"see",
+		"seebad",
+		"seele",
+		"seenot",
+		"seeweg",
+		"segel",
+		"segeln",
+		"segelnd",
+		"segelt",
+		"segen",
+		"segler",
+		"segnen",
+		"segnet",
+		"sehen",
+		"seher",
+		"sehne",
+		"sehnig",
+		"sehnt",
+		"sehnte",
+		"sehr",
+		"sei",
+		"seicht",
+		"seide",
+		"seiden",
+		"seidig",
+		"seien",
+		"seiend",
+		"seife",
+		"seifig",
+		"seift",
+		"seil",
+		"seiler",
+		"sein",
+		"seine",
+		"seinen",
+		"seiner",
+		"seis",
+		"seit",
+		"seitan",
+		"seite",
+		"seiten",
+		"seitig",
+		"sekr",
+		"sekret",
+		"sekt",
+		"sekte",
+		"sektor",
+		"selbe",
+		"selber",
+		"selbst",
+		"selen",
+		"selten",
+		"semit",
+		"senat",
+		"sendai",
+		"senden",
+		"sender",
+		"senf",
+		"sengen",
+		"senior",
+		"senke",
+		"senker",
+		"senne",
+		"senner",
+		"sense",
+		"sepsis",
+		"septum",
+		"seraph",
+		"serbe",
+		"serge",
+		"serie",
+		"serife",
+		"serin",
+		"sermon",
+		"serum",
+		"servo",
+		"sesam",
+		"sessel",
+		"set",
+		"setz",
+		"setze",
+		"setzei",
+		"setzen",
+		"setzer",
+		"seuche",
+		"sexist",
+		"sexte",
+		"sf",
+		"sg",
+		"sh",
+		"shalom",
+		"shanty",
+		"sherpa",
+		"shimmy",
+		"shiraz",
+		"show",
+		"shunt",
+		"si",
+		"sich",
+		"sichel",
+		"sicher",
+		"sicht",
+		"sie",
+		"sieb",
+		"sieben",
+		"siebt",
+		"siebte",
+		"sieche",
+		"siecht",
+		"sieden",
+		"siedet",
+		"sieg",
+		"siegel",
+		"siegen",
+		"sieger",
+		"siegt",
+		"sieh",
+		"siehe",
+		"siehst",
+		"sieht",
+		"sierra",
+		"signal",
+		"signum",
+		"silbe",
+		"silben",
+		"silber",
+		"silur",
+		"sims",
+		"sind",
+		"singen",
+		"sinken",
+		"sinkt",
+		"sinn",
+		"sinnen",
+		"sinnes",
+		"sinnig",
+		"sinter",
+		"sinus",
+		"sioux",
+		"siphon",
+		"sippe",
+		"sirene",
+		"sirup",
+		"sisal",
+		"sitar",
+		"sitte",
+		"sitz",
+		"sitzen",
+		"sitzt",
+		"sj",
+		"sk",
+		"skala",
+		"skalar",
+		"skalp",
+		"skat",
+		"skeet",
+		"sketch",
+		"ski",
+		"skiff",
+		"skizze",
+		"sklave",
+		"sklera",
+		"skopje",
+		"skotom",
+		"sl",
+		"slalom",
+		"slam",
+		"slang",
+		"slawe",
+		"slick",
+		"slip",
+		"slum",
+		"slums",
+		"sm",
+		"smog",
+		"sn",
+		"snapin",
+		"snob",
+		"so",
+		"so?",
+		"sobald",
+		"socke",
+		"sockel",
+		"soda",
+		"soeben",
+		"sofa",
+		"sofern",
+		"sofia",
+		"sofort",
+		"sog",
+		"sogar",
+		"sohle",
+		"sohn",
+		"soiree",
+		"soja",
+		"solch",
+		"solche",
+		"sold",
+		"soldat",
+		"solide",
+		"solist",
+		"soll",
+		"sollen",
+		"sollst",
+		"sollte",
+		"solo",
+		"sommer",
+		"sonate",
+		"sonde",
+		"sonett",
+		"sonne",
+		"sonnen",
+		"sonnig",
+		"sonor",
+		"sonst",
+		"sooft",
+		"sopran",
+		"sorbet",
+		"sorge",
+		"sorgen",
+		"sorgt",
+		"sorgte",
+		"sorte",
+		"sosse",
+		"soul",
+		"south",
+		"soviel",
+		"sowas",
+		"soweit",
+		"sowie",
+		"sowjet",
+		"sowohl",
+		"sozial",
+		"sp",
+		"spaet",
+		"spalt",
+		"spalte",
+		"spam",
+		"spange",
+		"spanne",
+		"spant",
+		"spar",
+		"sparen",
+		"sparer",
+		"spass",
+		"spat",
+		"spatel",
+		"spaten",
+		"spatz",
+		"spd",
+		"specht",
+		"speck",
+		"speer",
+		"speien",
+		"speise",
+		"spelz",
+		"spende",
+		"sperma",
+		"sperre",
+		"sphinx",
+		"spiegel",
+		"spiel",
+		"spiess",
+		"spike",
+		"spinal",
+		"spinat",
+		"spinne",
+		"spion",
+		"spital",
+		"spitz",
+		"spitze",
+		"spleen",
+		"splice",
+		"splint",
+		"splitt",
+		"spore",
+		"sport",
+		"spott",
+		"spr",
+		"spray",
+		"spreu",
+		"sprich",
+		"sprit",
+		"sproed",
+		"spross",
+		"spruch",
+		"sprung",
+		"spuck",
+		"spucke",
+		"spuele",
+		"spuk",
+		"spuken",
+		"spule",
+		"spund",
+		"spur",
+		"sputum",
+		"sq",
+		"sr",
+		"sri",
+		"ss",
+		"sss",
+		"ssss",
+		"st",
+		"staat",
+		"stab",
+		"stabil",
+		"stadt",
+		"stahl",
+		"staken",
+		"stall",
+		"stamm",
+		"stand",
+		"stange",
+		"stanze",
+		"stapel",
+		"star",
+		"stark",
+		"starr",
+		"start",
+		"stase",
+		"statik",
+		"statur",
+		"status",
+		"statut",
+		"stau",
+		"staub",
+		"stauen",
+		"stauer",
+		"staupe",
+		"std",
+		"steak",
+		"steck",
+		"steg",
+		"stehen",
+		"steher",
+		"steht",
+		"steif",
+		"steig",
+		"steile",
+		"stein",
+		"stele",
+		"stell",
+		"stelle",
+		"stellt",
+		"stellte",
+		"stelze",
+		"stent",
+		"steppe",
+		"steppen",
+		"steppt",
+		"steril",
+		"stern",
+		"stet",
+		"steter",
+		"stetig",
+		"stets",
+		"steuer",
+		"stgb",
+		"stich",
+		"stieg",
+		"stiel",
+		"stier",
+		"stiess",
+		"stift",
+		"stifter",
+		"stigma",
+		"stil",
+		"still",
+		"stille",
+		"stillt",
+		"stimme",
+		"stimmt",
+		"stinkt",
+		"stippt",
+		"stirbt",
+		"stirn",
+		"stock",
+		"stockt",
+		"stoer",
+		"stoert",
+		"stoff",
+		"stola",
+		"stolz",
+		"stopft",
+		"stopp",
+		"storch",
+		"stoss",
+		"stout",
+		"str",
+		"straf",
+		"strafe",
+		"straff",
+		"straft",
+		"strahl",
+		"stramm",
+		"strand",
+		"strang",
+		"straps",
+		"strebe",
+		"strebt",
+		"streik",
+		"streit",
+		"streng",
+		"stress",
+		"streut",
+		"strich",
+		"strick",
+		"strikt",
+		"stritt",
+		"stroh",
+		"strom",
+		"stromer",
+		"struma",
+		"stu",
+		"stuck",
+		"stud",
+		"student",
+		"studie",
+		"stueck",
+		"stufe",
+		"stuft",
+		"stufte",
+		"stuhl",
+		"stumm",
+		"stumpf",
+		"stunde",
+		"stupor",
+		"stupst",
+		"stur",
+		"sturm",
+		"sturz",
+		"stute",
+		"stutzen",
+		"stutzt",
+		"stvo",
+		"styren",
+		"su",
+		"sublim",
+		"subtil",
+		"suche",
+		"suchen",
+		"sucher",
+		"sucht",
+		"suchte",
+		"sudan",
+		"sudeln",
+		"sueden",
+		"suehne",
+		"suelze",
+		"suende",
+		"suess",
+		"suesse",
+		"suesst",
+		"suhle",
+		"suhlen",
+		"suite",
+		"sulfat",
+		"sulfid",
+		"sulfit",
+		"sultan",
+		"summe",
+		"summen",
+		"summer",
+		"summt",
+		"summte",
+		"sumo",
+		"sumpf",
+		"sund",
+		"sunnit",
+		"super",
+		"superb",
+		"suppe",
+		"surat",
+		"surren",
+		"surrt",
+		"suva",
+		"sv",
+		"sw",
+		"sx",
+		"sy",
+		"sydney",
+		"symbol",
+		"synode",
+		"syntax",
+		"syrer",
+		"syrien",
+		"system",
+		"systole",
+		"sz",
+		"szene",
+		"t",
+		"tabak",
+		"tabor",
+		"tabriz",
+		"tabu",
+		"tabula",
+		"tadel",
+		"tadeln",
+		"tadelt",
+		"tadler",
+		"taefeln",
+		"taegu",
+		"taejon",
+		"taeter",
+		"taetig",
+		"tafel",
+		"taft",
+		"tag",
+		"tagaus",
+		"tage",
+		"tagen",
+		"tagend",
+		"tags",
+		"tagt",
+		"tagung",
+		"taifun",
+		"taille",
+		"tainan",
+		"taipei",
+		"taiwan",
+		"takel",
+		"takeln",
+		"takler",
+		"takt",
+		"taktik",
+		"tal",
+		"talent",
+		"talg",
+		"talgig",
+		"talk",
+		"talkum",
+		"talon",
+		"tampa",
+		"tampon",
+		"tamtam",
+		"tan",
+		"tand",
+		"tandem",
+		"tang",
+		"tango",
+		"tank",
+		"tanken",
+		"tanker",
+		"tankt",
+		"tankte",
+		"tanne",
+		"tannin",
+		"tantal",
+		"tante",
+		"tanz",
+		"tanzen",
+		"tanzt",
+		"tanzte",
+		"tapete",
+		"tapfer",
+		"tapsen",
+		"tapst",
+		"tara",
+		"tarawa",
+		"tardiv",
+		"tarif",
+		"tarnen",
+		"tarnte",
+		"tarock",
+		"tartan",
+		"tasche",
+		"tasse",
+		"tast",
+		"taste",
+		"tasten",
+		"taster",
+		"tastet",
+		"tat",
+		"tatar",
+		"taten",
+		"tatort",
+		"tau",
+		"taub",
+		"taube",
+		"tauben",
+		"taubsi",
+		"taucht",
+		"tauen",
+		"taufe",
+		"taufen",
+		"tauft",
+		"taufte",
+		"taugen",
+		"taumel",
+		"tausch",
+		"taut",
+		"taute",
+		"taxi",
+		"tb",
+		"tbruch",
+		"tc",
+		"td",
+		"te",
+		"teak",
+		"tee",
+		"teeei",
+		"teer",
+		"teeren",
+		"teflon",
+		"tehran",
+		"teich",
+		"teig",
+		"teigig",
+		"teil",
+		"teilen",
+		"teiler",
+		"teils",
+		"teilt",
+		"teilte",
+		"tel",
+		"teller",
+		"tellur",
+		"tempeh",
+		"tempel",
+		"tempo",
+		"tender",
+		"tenne",
+		"tennis",
+		"tenor",
+		"tensid",
+		"term",
+		"termin",
+		"terror",
+		"terz",
+		"test",
+		"testen",
+		"tester",
+		"testet",
+		"teuer",
+		"teufel",
+		"texas",
+		"text",
+		"texter",
+		"textil",
+		"tf",
+		"tg",
+		"tgl",
+		"th",
+		"thai",
+		"thanh",
+		"theist",
+		"theke",
+		"thema",
+		"themse",
+		"therme",
+		"these",
+		"thiamin",
+		"thread",
+		"thron",
+		"thront",
+		"thymus",
+		"ti",
+		"tiara",
+		"tibet",
+		"tic",
+		"tick",
+		"ticken",
+		"tickt",
+		"tief",
+		"tiefe",
+		"tiefer",
+		"tiegel",
+		"tier",
+		"tiger",
+		"tigris",
+		"tilde",
+		"tilgen",
+		"tilgt",
+		"tilgte",
+		"timon",
+		"tinte",
+		"tipp",
+		"tippen",
+		"tippt",
+		"tippte",
+		"tirade",
+		"tirana",
+		"tirol",
+		"tisch",
+		"titan",
+		"titel",
+		"titer",
+		"titte",
+		"titus",
+		"tj",
+		"tk",
+		"tl",
+		"tm",
+		"tn",
+		"to",
+		"toben",
+		"tobend",
+		"tobt",
+		"tobte",
+		"tod",
+		"toddy",
+		"toenen",
+		"toerin",
+		"toeten",
+		"toetet",
+		"tofu",
+		"togo",
+		"tokelau",
+		"tokyo",
+		"toll",
+		"tolle",
+		"tollen",
+		"tollt",
+		"toluca",
+		"tomate",
+		"tombak",
+		"ton",
+		"tonarm",
+		"tonart",
+		"tonbad",
+		"tonga",
+		"tonika",
+		"tonlos",
+		"tonne",
+		"tonsur",
+		"tonus",
+		"topas",
+		"topf",
+		"tophus",
+		"topp",
+		"tor",
+		"torf",
+		"torino",
+		"torlos",
+		"torte",
+		"torweg",
+		"tory",
+		"tot",
+		"total",
+		"totale",
+		"tote",
+		"totem",
+		"totes",
+		"toupet",
+		"tour",
+		"toxin",
+		"tp",
+		"tq",
+		"tr",
+		"trab",
+		"traber",
+		"tracht",
+		"traege",
+		"traegt",
+		"traene",
+		"traenen",
+		"traf",
+		"trage",
+		"tragen",
+		"tragik",
+		"trakt",
+		"trampt",
+		"trance",
+		"trank",
+		"trapez",
+		"trat",
+		"tratte",
+		"trau",
+		"traube",
+		"trauen",
+		"trauer",
+		"traufe",
+		"traum",
+		"trauma",
+		"traut",
+		"traute",
+		"treck",
+		"treib",
+		"treibt",
+		"tremor",
+		"trend",
+		"trennt",
+		"treppe",
+		"tresor",
+		"treten",
+		"treu",
+		"treue",
+		"treuer",
+		"trias",
+		"trick",
+		"trieb",
+		"trieft",
+		"triel",
+		"trifft",
+		"triftig",
+		"trikot",
+		"trimm",
+		"trinkt",
+		"trist",
+		"tritt",
+		"trog",
+		"troja",
+		"trollt",
+		"tropf",
+		"trost",
+		"trott",
+		"trotz",
+		"trotzt",
+		"truebe",
+		"truebt",
+		"trug",
+		"trumpf",
+		"truppe",
+		"ts",
+		"tschad",
+		"tshirt",
+		"tt",
+		"ttt",
+		"tttt",
+		"tu",
+		"tuba",
+		"tube",
+		"tuch",
+		"tucuxi",
+		"tue",
+		"tuell",
+		"tuelle",
+		"tuer",
+		"tuerke",
+		"tuev",
+		"tugend",
+		"tulpe",
+		"tumor",
+		"tun",
+		"tundra",
+		"tuner",
+		"tunika",
+		"tunis",
+		"tunkt",
+		"tunkte",
+		"tunnel",
+		"tunte",
+		"tupel",
+		"turban",
+		"turbo",
+		"turf",
+		"turks",
+		"turm",
+		"turnen",
+		"turnt",
+		"turnte",
+		"turtok",
+		"tusche",
+		"tut",
+		"tuten",
+		"tuv",
+		"tuva",
+		"tuvalu",
+		"tv",
+		"tw",
+		"tx",
+		"ty",
+		"type",
+		"typhus",
+		"tz",
+		"u",
+		"uawg",
+		"ub",
+		"ubahn",
+		"uboot",
+		"uc",
+		"ud",
+		"udssr",
+		"ue",
+		"uebel",
+		"ueben",
+		"uebend",
+		"ueber",
+		"uebers",
+		"ueble",
+		"uebrig",
+		"uebte",
+		"uebung",
+		"uefa",
+		"ueppig",
+		"uf",
+		"ufa",
+		"ufer",
+		"uff",
+		"ufo",
+		"ufz",
+		"ug",
+		"uganda",
+		"uh",
+		"uhf",
+		"uhr",
+		"uhu",
+		"ui",
+		"uie",
+		"uj",
+		"uk",
+		"ukw",
+		"ul",
+		"ulcus",
+		"ulk",
+		"ulkig",
+		"ulkus",
+		"ulme",
+		"ulsan",
+		"ulster",
+		"ultimo",
+		"ultra",
+		"um",
+		"umarmt",
+		"umbau",
+		"umber",
+		"umfang",
+		"umfeld",
+		"umflog",
+		"umgab",
+		"umgeht",
+		"umgibt",
+		"umging",
+		"umhang",
+		"umin",
+		"umkehr",
+		"umlage",
+		"umlauf",
+		"umlaut",
+		"umluft",
+		"umriss",
+		"ums",
+		"umsatz",
+		"umweg",
+		"umwelt",
+		"umzu",
+		"umzug",
+		"un",
+		"unart",
+		"uncc",
+		"unccd",
+		"uncdf",
+		"uncrd",
+		"unctad",
+		"und",
+		"undank",
+		"undcp",
+		"undp",
+		"uneben",
+		"unecht",
+		"unedel",
+		"unehre",
+		"unep",
+		"unesco",
+		"unevoc",
+		"unfair",
+		"unfall",
+		"unfccc",
+		"unfein",
+		"unfpa",
+		"unfug",
+		"ungar",
+		"ungarn",
+		"ungern",
+		"ungute",
+		"unhchr",
+		"unhcr",
+		"unheil",
+		"uni",
+		"unicef",
+		"unicri",
+		"unidir",
+		"union",
+		"unklar",
+		"unklug",
+		"unlieb",
+		"unmut",
+		"unops",
+		"unreif",
+		"unrein",
+		"unrisd",
+		"unruh",
+		"unruhe",
+		"unrwa",
+		"uns",
+		"unser",
+		"unsere",
+		"unsinn",
+		"unstet",
+		"untat",
+		"unten",
+		"unter",
+		"untere",
+		"unterm",
+		"untier",
+		"untreu",
+		"unu",
+		"unv",
+		"unwahr",
+		"unweit",
+		"unwohl",
+		"unzahl",
+		"unzart",
+		"unze",
+		"unzeit",
+		"uo",
+		"up",
+		"upu",
+		"uq",
+		"ur",
+		"uralt",
+		"uran",
+		"uranus",
+		"urban",
+		"urform",
+		"urgenz",
+		"urin",
+		"urinal",
+		"urlaub",
+		"urlaut",
+		"urne",
+		"urteil",
+		"urumqi",
+		"urwald",
+		"urzeit",
+		"us",
+		"usa",
+		"usw",
+		"ut",
+		"utah",
+		"utopia",
+		"utopie",
+		"uu",
+		"uuu",
+		"uuuu",
+		"uv",
+		"uvw",
+		"uw",
+		"ux",
+		"uy",
+		"uz",
+		"v",
+		"vaduz",
+		"vaeter",
+		"vagal",
+		"vage",
+		"vakuum",
+		"valenz",
+		"valin",
+		"valuta",
+		"vamp",
+		"vampir",
+		"vasall",
+		"vase",
+		"vater",
+		"vati",
+		"vb",
+		"vc",
+		"vchr",
+		"vd",
+		"ve",
+		"veb",
+		"vektor",
+		"velar",
+		"velin",
+		"vene",
+		"venoes",
+		"ventil",
+		"venus",
+		"verb",
+		"verbal",
+		"verbat",
+		"verbot",
+		"verein",
+		"verf",
+		"vergab",
+		"verh",
+		"verl",
+		"verlag",
+		"verlor",
+		"verrat",
+		"verruf",
+		"vers",
+		"versatz",
+		"versen",
+		"vertan",
+		"verw",
+		"verzug",
+		"vespern",
+		"vf",
+		"vform",
+		"vg",
+		"vgl",
+		"vh",
+		"vhf",
+		"vhs",
+		"vi",
+		"video",
+		"vieh",
+		"viel",
+		"viele",
+		"vielen",
+		"vieles",
+		"vier",
+		"vierte",
+		"vikar",
+		"villa",
+		"vinyl",
+		"vip",
+		"viper",
+		"virus",
+		"visage",
+		"vision",
+		"visum",
+		"vj",
+		"vk",
+		"vl",
+		"vlies",
+		"vm",
+		"vn",
+		"vo",
+		"voegel",
+		"vogel",
+		"vogt",
+		"voile",
+		"volant",
+		"volk",
+		"voll",
+		"voller",
+		"volt",
+		"vom",
+		"von",
+		"voodoo",
+		"vor",
+		"vorab",
+		"voran",
+		"voraus",
+		"vorbau",
+		"vordem",
+		"vorfall",
+		"vorher",
+		"vorhin",
+		"vorhof",
+		"vorhut",
+		"vorige",
+		"vorlaut",
+		"vorm",
+		"vormals",
+		"vorn",
+		"vorne",
+		"vorort",
+		"vorrat",
+		"vors",
+		"vorweg",
+		"vorzug",
+		"vp",
+		"vq",
+		"vr",
+		"vrumpf",
+		"vs",
+		"vt",
+		"vu",
+		"vulkan",
+		"vulva",
+		"vuz",
+		"vv",
+		"vvv",
+		"vvvv",
+		"vw",
+		"vwx",
+		"vx",
+		"vy",
+		"vz",
+		"w",
+		"waage",
+		"wabe",
+		"wach",
+		"wache",
+		"wachen",
+		"wachs",
+		"wachst",
+		"wacht",
+		"wachte",
+		"wacker",
+		"wade",
+		"waegen",
+		"waeger",
+		"waehle",
+		"waehlt",
+		"waehnt",
+		"waelzt",
+		"waende",
+		"waere",
+		"waeren",
+		"waerme",
+		"waermt",
+		"waffe",
+		"waffel",
+		"waffen",
+		"wagen",
+		"waggon",
+		"wagnis",
+		"wahl",
+		"wahn",
+		"wal",
+		"wald",
+		"waldig",
+		"wales",
+		"walker",
+		"wall",
+		"wallis",
+		"waltz",
+		"walze",
+		"walzen",
+		"walzer",
+		"walzte",
+		"wamme",
+		"wand",
+		"wandel",
+		"wandte",
+		"wange",
+		"wanken",
+		"wankt",
+		"wann",
+		"wanze",
+		"wapiti",
+		"wappen",
+		"war",
+		"warb",
+		"ware",
+		"waren",
+		"warf",
+		"warm",
+		"warme",
+		"warnen",
+		"warnt",
+		"warnte",
+		"warpt",
+		"warte",
+		"warten",
+		"wartet",
+		"warum",
+		"warze",
+		"warzig",
+		"was",
+		"wasser",
+		"waten",
+		"watt",
+		"watte",
+		"wb",
+		"wbl",
+		"wc",
+		"wd",
+		"wdhlg",
+		"we",
+		"weben",
+		"webend",
+		"weber",
+		"webt",
+		"webte",
+		"wecken",
+		"wecker",
+		"wedel",
+		"wedeln",
+		"weder",
+		"weg",
+		"wegen",
+		"weh",
+		"wehe",
+		"wehen",
+		"wehend",
+		"wehmut",
+		"wehr",
+		"wehrt",
+		"wehrte",
+		"weht",
+		"wehte",
+		"weich",
+		"weiche",
+		"weicht",
+		"weide",
+		"weiden",
+		"weidend",
+		"weidet",
+		"weih",
+		"weihe",
+		"weiht",
+		"weihte",
+		"weil",
+		"weile",
+		"wein",
+		"weinen",
+		"weint",
+		"weinte",
+		"weise",
+		"weisen",
+		"weiss",
+		"weisse",
+		"weist",
+		"weit",
+		"weite",
+		"weiter",
+		"weizen",
+		"welch",
+		"welche",
+		"welk",
+		"welken",
+		"welle",
+		"wellen",
+		"wellig",
+		"wellt",
+		"welpe",
+		"welt",
+		"wem",
+		"wen",
+		"wende",
+		"wenden",
+		"wendet",
+		"wendig",
+		"wenig",
+		"wenn",
+		"wer",
+		"werben",
+		"werber",
+		"werbt",
+		"werde",
+		"werden",
+		"werfen",
+		"werfer",
+		"werft",
+		"werg",
+		"werk",
+		"wermut",
+		"wert",
+		"wertet",
+		"wertig",
+		"wesen",
+		"wesir",
+		"wespe",
+		"wessen",
+		"wessi",
+		"west",
+		"weste",
+		"westen",
+		"wette",
+		"wetten",
+		"wetter",
+		"wettet",
+		"wetzen",
+		"wetzt",
+		"wetzte",
+		"wez",
+		"wf",
+		"wg",
+		"wh",
+		"whg",
+		"whisky",
+		"whist",
+		"who",
+		"wi",
+		"wich",
+		"wicht",
+		"wicke",
+		"widder",
+		"wider",
+		"widert",
+		"widmen",
+		"widmet",
+		"widrig",
+		"wie",
+		"wie?",
+		"wied",
+		"wieder",
+		"wiege",
+		"wiegen",
+		"wiegt",
+		"wiegte",
+		"wien",
+		"wiener",
+		"wies",
+		"wiese",
+		"wiesel",
+		"wigwam",
+		"wild",
+		"wilde",
+		"wildes",
+		"wille",
+		"willig",
+		"willst",
+		"wimmern",
+		"wimper",
+		"wind",
+		"winde",
+		"windei",
+		"windel",
+		"winden",
+		"windet",
+		"windig",
+		"wink",
+		"winkel",
+		"winken",
+		"winker",
+		"winkt",
+		"winkte",
+		"winsch",
+		"winter",
+		"winzig",
+		"wipfel",
+		"wippen",
+		"wippt",
+		"wippte",
+		"wir",
+		"wirbel",
+		"wirbt",
+		"wird",
+		"wirft",
+		"wirken",
+		"wirkt",
+		"wirkte",
+		"wirr",
+		"wirt",
+		"wirtin",
+		"wisch",
+		"wischt",
+		"wisent",
+		"wissen",
+		"witwe",
+		"witwer",
+		"witz",
+		"witzig",
+		"wj",
+		"wk",
+		"wl",
+		"wm",
+		"wn",
+		"wo",
+		"wobei",
+		"woche",
+		"wodka",
+		"woelbt",
+		"wofuer",
+		"wog",
+		"woge",
+		"wogen",
+		"wogend",
+		"wogt",
+		"wogte",
+		"woher",
+		"wohin",
+		"wohl",
+		"wohn",
+		"wohnen",
+		"wok",
+		"wolf",
+		"wolga",
+		"wolke",
+		"wolkig",
+		"wolle",
+		"wollen",
+		"wollig",
+		"wollte",
+		"womit",
+		"wonach",
+		"wonne",
+		"woran",
+		"worauf",
+		"woraus",
+		"worden",
+		"worin",
+		"world",
+		"wort",
+		"worte",
+		"worum",
+		"wovon",
+		"wovor",
+		"wozu",
+		"wp",
+		"wq",
+		"wr",
+		"wrack",
+		"wringt",
+		"ws",
+		"wsa",
+		"wt",
+		"wto",
+		"wu",
+		"wucher",
+		"wuchs",
+		"wucht",
+		"wuehler",
+		"wuerde",
+		"wuerger",
+		"wuergt",
+		"wuerze",
+		"wuerzen",
+		"wuest",
+		"wueste",
+		"wuetet",
+		"wuhan",
+		"wulst",
+		"wund",
+		"wunde",
+		"wunder",
+		"wunsch",
+		"wurde",
+		"wurden",
+		"wurf",
+		"wurm",
+		"wurmig",
+		"wurst",
+		"wurzel",
+		"wusch",
+		"wusste",
+		"wut",
+		"wuxi",
+		"wv",
+		"ww",
+		"www",
+		"wwww",
+		"wx",
+		"wxy",
+		"wy",
+		"wz",
+		"x",
+		"xb",
+		"xbeine",
+		"xc",
+		"xd",
+		"xe",
+		"xenon",
+		"xf",
+		"xfache",
+		"xg",
+		"xh",
+		"xi",
+		"xian",
+		"xj",
+		"xk",
+		"xl",
+		"xm",
+		"xmal",
+		"xn",
+		"xo",
+		"xp",
+		"xq",
+		"xr",
+		"xs",
+		"xt",
+		"xu",
+		"xuzhou",
+		"xv",
+		"xw",
+		"xx",
+		"xxx",
+		"xxxx",
+		"xy",
+		"xyz",
+		"xz",
+		"y",
+		"yang",
+		"yangon",
+		"yard",
+		"yawl",
+		"yb",
+		"yc",
+		"yd",
+		"ye",
+		"yen",
+		"yeti",
+		"yf",
+		"yg",
+		"yh",
+		"yi",
+		"yj",
+		"yk",
+		"yl",
+		"ym",
+		"yn",
+		"yo",
+		"yoga",
+		"yp",
+		"yq",
+		"yr",
+		"ys",
+		"yt",
+		"yu",
+		"yucca",
+		"yuppie",
+		"yv",
+		"yw",
+		"yx",
+		"yy",
+		"yyy",
+		"yyyy",
+		"yz",
+		"z",
+		"zacke",
+		"zacken",
+		"zackig",
+		"zaeh",
+		"zaeher",
+		"zaehl",
+		"zaehlt",
+		"zaehmt",
+		"zaehne",
+		"zaeunt",
+		"zagreb",
+		"zahl",
+		"zahlen",
+		"zahlt",
+		"zahlte",
+		"zahm",
+		"zahn",
+		"zahnen",
+		"zahnt",
+		"zahnte",
+		"zander",
+		"zange",
+		"zank",
+		"zanken",
+		"zankt",
+		"zankte",
+		"zapfen",
+		"zappen",
+		"zar",
+		"zarge",
+		"zarin",
+		"zart",
+		"zaster",
+		"zauber",
+		"zaum",
+		"zaun",
+		"zausen",
+		"zaust",
+		"zauste",
+		"zb",
+		"zc",
+		"zd",
+		"zdf",
+		"ze",
+		"zebra",
+		"zebu",
+		"zechen",
+		"zecher",
+		"zecht",
+		"zechte",
+		"zecke",
+		"zeder",
+		"zehe",
+		"zehn",
+		"zehner",
+		"zehnte",
+		"zehren",
+		"zehrt",
+		"zeigen",
+		"zeiger",
+		"zeigt",
+		"zeihen",
+		"zeile",
+		"zeilen",
+		"zeit",
+		"zeitgen",
+		"zelle",
+		"zelot",
+		"zelt",
+		"zelten",
+		"zelter",
+		"zement",
+		"zenit",
+		"zensur",
+		"zephir",
+		"zepter",
+		"zerren",
+		"zerrt",
+		"zerrte",
+		"zettel",
+		"zeug",
+		"zeuge",
+		"zeugen",
+		"zeugt",
+		"zeugte",
+		"zf",
+		"zg",
+		"zh",
+		"zhd",
+		"zi",
+		"zibo",
+		"zich",
+		"zicke",
+		"zickig",
+		"ziege",
+		"ziegel",
+		"zieh",
+		"ziehe",
+		"ziehen",
+		"zieht",
+		"ziel",
+		"zielen",
+		"zielt",
+		"ziemen",
+		"ziemt",
+		"zier",
+		"zierde",
+		"ziert",
+		"ziffer",
+		"zikade",
+		"zimmer",
+		"zimt",
+		"zinder",
+		"zink",
+		"zinke",
+		"zinken",
+		"zinn",
+		"zinnen",
+		"zinnie",
+		"zins",
+		"zirkon",
+		"zirkus",
+		"zirpen",
+		"zischt",
+		"zitat",
+		"zither",
+		"zitrat",
+		"zitrus",
+		"zitze",
+		"zivil",
+		"zj",
+		"zk",
+		"zl",
+		"zm",
+		"zn",
+		"zo",
+		"zobel",
+		"zoelle",
+		"zofe",
+		"zog",
+		"zogen",
+		"zoll",
+		"zombie",
+		"zonal",
+		"zone",
+		"zonen",
+		"zoomt",
+		"zoomte",
+		"zopf",
+		"zorn",
+		"zornig",
+		"zotte",
+		"zottig",
+		"zp",
+		"zq",
+		"zr",
+		"zs",
+		"zt",
+		"ztg",
+		"ztschr",
+		"zu",
+		"zucht",
+		"zucken",
+		"zucker",
+		"zuckt",
+		"zuckte",
+		"zudem",
+		"zueckt",
+		"zuege",
+		"zuegel",
+		"zuernt",
+		"zuerst",
+		"zufall",
+		"zug",
+		"zugabe",
+		"zugang",
+		"zugig",
+		"zulage",
+		"zulauf",
+		"zuluft",
+		"zum",
+		"zumal",
+		"zuname",
+		"zunder",
+		"zunft",
+		"zunge",
+		"zupfen",
+		"zupft",
+		"zupfte",
+		"zur",
+		"zurren",
+		"zurrt",
+		"zuruf",
+		"zus",
+		"zusage",
+		"zusatz",
+		"zutat",
+		"zuvor",
+		"zuzug",
+		"zv",
+		"zw",
+		"zwang",
+		"zwangs",
+		"zwar",
+		"zweck",
+		"zwecke",
+		"zwecks",
+		"zwei",
+		"zweier",
+		"zweig",
+		"zweite",
+		"zwerg",
+		"zwingt",
+		"zwirn",
+		"zwirnt",
+		"zwist",
+		"zwoelf",
+		"zx",
+		"zy",
+		"zyanat",
+		"zyanid",
+		"zygote",
+		"zyklon",
+		"zyklop",
+		"zyklus",
+		"zypern",
+		"zyste",
+		"zz",
+		"zzgl",
+		"zzz",
+		"zzzz",
+	}
+};
+
+wordlist_t wordlist_diceware_dutch = {
+	.elt.key = "dutch",
+	.family = "diceware",
+	.max_word_length = 8,
+	.min_word_length = 1,
+	.words = (char *[]){
+		"0",
+		"1",
+		"2",
+		"3",
+		"4",
+		"5",
+		"6",
+		"7",
+		"8",
+		"9",
+		"10",
+		"11",
+		"12",
+		"13",
+		"14",
+		"15",
+		"16",
+		"17",
+		"18",
+		"19",
+		"20",
+		"21",
+		"22",
+		"23",
+		"24",
+		"25",
+		"26",
+		"27",
+		"28",
+		"29",
+		"30",
+		"31",
+		"32",
+		"33",
+		"34",
+		"35",
+		"36",
+		"37",
+		"38",
+		"39",
+		"40",
+		"41",
+		"42",
+		"43",
+		"44",
+		"45",
+		"46",
+		"47",
+		"48",
+		"49",
+		"50",
+		"51",
+		"52",
+		"53",
+		"54",
+		"55",
+		"56",
+		"57",
+		"58",
+		"59",
+		"60",
+		"61",
+		"62",
+		"63",
+		"64",
+		"65",
+		"66",
+		"67",
+		"68",
+		"69",
+		"70",
+		"71",
+		"72",
+		"73",
+		"74",
+		"75",
+		"76",
+		"77",
+		"78",
+		"79",
+		"80",
+		"81",
+		"82",
+		"83",
+		"84",
+		"85",
+		"86",
+		"87",
+		"88",
+		"89",
+		"90",
+		"91",
+		"92",
+		"93",
+		"94",
+		"95",
+		"96",
+		"97",
+		"98",
+		"99",
+		"100",
+		"101",
+		"111",
+		"123",
+		"200",
+		"222",
+		"234",
+		"300",
+		"333",
+		"345",
+		"400",
+		"444",
+		"456",
+		"500",
+		"555",
+		"567",
+		"600",
+		"666",
+		"678",
+		"700",
+		"777",
+		"789",
+		"800",
+		"888",
+		"900",
+		"999",
+		"1000",
+		"1111",
+		"1234",
+		"1492",
+		"1500",
+		"1600",
+		"1700",
+		"1800",
+		"1900",
+		"1910",
+		"1920",
+		"1925",
+		"1930",
+		"1935",
+		"1940",
+		"1945",
+		"1950",
+		"1955",
+		"1960",
+		"1965",
+		"1970",
+		"1975",
+		"1980",
+		"1985",
+		"1990",
+		"1991",
+		"1992",
+		"1993",
+		"1994",
+		"1995",
+		"1996",
+		"1997",
+		"1998",
+		"1999",
+		"2000",
+		"2001",
+		"2002",
+		"2003",
+		"2004",
+		"2005",
+		"2006",
+		"2007",
+		"2008",
+		"2009",
+		"2010",
+		"2015",
+		"2020",
+		"2030",
+		"2035",
+		"2040",
+		"2045",
+		"2050",
+		"2222",
+		"2345",
+		"2468",
+		"3000",
+		"3333",
+		"3456",
+		"4000",
+		"4321",
+		"4444",
+		"4567",
+		"5000",
+		"5555",
+		"5678",
+		"6000",
+		"6666",
+		"6789",
+		"7000",
+		"7777",
+		"8000",
+		"8888",
+		"9000",
+		"9876",
+		"9999",
+		"-",
+		"--",
+		"---",
+		"!",
+		"!!",
+		"!!!",
+		"\"",
+		"#",
+		"##",
+		"###",
+		"$",
+		"$$",
+		"$$$",
+		"%",
+		"%%",
+		"%%%",
+		"&",
+		"(",
+		"()",
+		")",
+		"*",
+		"**",
+		"***",
+		":",
+		":(",
+		":-(",
+		":)",
+		":-)",
+		";",
+		"?",
+		"??",
+		"???",
+		"@",
+		"+",
+		"++",
+		"+++",
+		"=",
+		"==",
+		"===",
+		"a",
+		"aa",
+		"aaa",
+		"aaaa",
+		"Aagje",
+		"aagt",
+		"aagten",
+		"aai",
+		"aaide",
+		"aaien",
+		"aaitje",
+		"aak",
+		"aal",
+		"aalbes",
+		"aalput",
+		"aalt",
+		"aaltje",
+		"aam",
+		"aambei",
+		"aan",
+		"aanbad",
+		"aanbod",
+		"aaneen",
+		"aanhef",
+		"aanleg",
+		"aanpak",
+		"aantal",
+		"aanval",
+		"aanwas",
+		"aanzet",
+		"aap",
+		"aapje",
+		"aapjes",
+		"aapte",
+		"aar",
+		"aard",
+		"aardas",
+		"aardde",
+		"aarde",
+		"aarden",
+		"aardig",
+		"aards",
+		"aardse",
+		"aars",
+		"aarzen",
+		"aas",
+		"aasde",
+		"aasje",
+		"aasjes",
+		"aaszak",
+		"aatje",
+		"aatjes",
+		"ab",
+		"abaci",
+		"abacus",
+		"abc",
+		"abc",
+		"abces",
+		"abdij",
+		"abdis",
+		"abeel",
+		"abel",
+		"abele",
+		"abelen",
+		"abject",
+		"ablaut",
+		"abri",
+		"abrupt",
+		"abscis",
+		"absent",
+		"absint",
+		"absurd",
+		"abt",
+		"abten",
+		"abuis",
+		"ac",
+		"acacia",
+		"acajou",
+		"accent",
+		"accept",
+		"acces",
+		"accres",
+		"accu",
+		"accu's",
+		"ace",
+		"aceton",
+		"ach",
+		"acht",
+		"achten",
+		"achter",
+		"achtte",
+		"acid",
+		"acne",
+		"acquit",
+		"acre",
+		"acres",
+		"acryl",
+		"act",
+		"acteur",
+		"actie",
+		"actief",
+		"actiën",
+		"acties",
+		"activa",
+		"acute",
+		"acuter",
+		"acuut",
+		"ad",
+		"adagia",
+		"adagio",
+		"Adam",
+		"adat",
+		"adder",
+		"adders",
+		"addict",
+		"adel",
+		"adelde",
+		"adelen",
+		"adem",
+		"ademde",
+		"ademen",
+		"adept",
+		"ader",
+		"aderde",
+		"aderen",
+		"adieu",
+		"adios",
+		"adonis",
+		"adres",
+		"advent",
+		"advies",
+		"ae",
+		"aequo",
+		"aëroob",
+		"af",
+		"afasie",
+		"afbouw",
+		"afdak",
+		"afdoen",
+		"afdruk",
+		"affect",
+		"affix",
+		"affuit",
+		"afgaan",
+		"afgang",
+		"afgod",
+		"afijn",
+		"afkeer",
+		"afkoop",
+		"aflaat",
+		"afloop",
+		"afmars",
+		"afname",
+		"afpeil",
+		"afreis",
+		"afrit",
+		"afroep",
+		"afslag",
+		"afstel",
+		"aft",
+		"aftrap",
+		"aftrek",
+		"afval",
+		"afvoer",
+		"afwas",
+		"afweer",
+		"afzet",
+		"afzien",
+		"afzijn",
+		"ag",
+		"agaat",
+		"agamie",
+		"agaten",
+		"agave",
+		"agaven",
+		"agenda",
+		"agens",
+		"agent",
+		"agente",
+		"ageren",
+		"agio",
+		"agnost",
+		"agogie",
+		"agonie",
+		"agoog",
+		"agrafe",
+		"ah",
+		"aha",
+		"ahoi",
+		"ahorn",
+		"ai",
+		"aids",
+		"aikido",
+		"air",
+		"airbag",
+		"airbus",
+		"airco",
+		"airtje",
+		"aïs",
+		"aïssen",
+		"aj",
+		"ajour",
+		"ajuin",
+		"ajuus",
+		"ak",
+		"akant",
+		"a-kant",
+		"akela",
+		"akelei",
+		"akelig",
+		"aker",
+		"akker",
+		"akkers",
+		"akolei",
+		"aks",
+		"aksen",
+		"akst",
+		"aksten",
+		"akte",
+		"akten",
+		"aktes",
+		"al",
+		"alaam",
+		"alarm",
+		"albast",
+		"albe",
+		"alben",
+		"albino",
+		"album",
+		"albums",
+		"aldaar",
+		"aldoor",
+		"aldra",
+		"aldus",
+		"aleer",
+		"alert",
+		"alerte",
+		"alfa",
+		"algauw",
+		"alge",
+		"algen",
+		"alhier",
+		"alias",
+		"alibi",
+		"alinea",
+		"alk",
+		"alkali",
+		"alken",
+		"alkoof",
+		"all",
+		"Allah",
+		"allang",
+		"alle",
+		"allee",
+		"alleen",
+		"allen",
+		"aller",
+		"alles",
+		"allo",
+		"allooi",
+		"allure",
+		"almaar",
+		"almede",
+		"almee",
+		"aloë",
+		"aloë's",
+		"alom",
+		"aloud",
+		"aloude",
+		"alp",
+		"alpaca",
+		"alpen",
+		"alpien",
+		"alpine",
+		"alpino",
+		"alras",
+		"alruin",
+		"als",
+		"alsdan",
+		"alsem",
+		"alsnog",
+		"alsof",
+		"alsook",
+		"alt",
+		"altaar",
+		"alten",
+		"alter",
+		"althea",
+		"altijd",
+		"altist",
+		"altoos",
+		"aluin",
+		"alvast",
+		"alver",
+		"alvers",
+		"alwaar",
+		"alweer",
+		"alzo",
+		"am",
+		"amanda",
+		"amant",
+		"amaril",
+		"amati",
+		"amber",
+		"ambigu",
+		"ambo",
+		"ambt",
+		"ambten",
+		"amen",
+		"amfoor",
+		"amfora",
+		"amice",
+		"amices",
+		"amict",
+		"amigo",
+		"amoebe",
+		"amok",
+		"amorf",
+		"amorfe",
+		"ampel",
+		"ampele",
+		"amper",
+		"ampère",
+		"ampex",
+		"ampul",
+		"amulet",
+		"amuse",
+		"an",
+		"anaal",
+		"anale",
+		"ananas",
+		"ancien",
+		"ander",
+		"andere",
+		"anders",
+		"anemie",
+		"angel",
+		"angels",
+		"angina",
+		"angora",
+		"angst",
+		"anijs",
+		"anima",
+		"animo",
+		"animus",
+		"anion",
+		"anjer",
+		"anjers",
+		"ank",
+		"anker",
+		"ankers",
+		"anklet",
+		"annex",
+		"anno",
+		"anode",
+		"anoden",
+		"anodes",
+		"anomie",
+		"anorak",
+		"ante",
+		"anti",
+		"antiek",
+		"anus",
+		"ao",
+		"aorta",
+		"ap",
+		"apache",
+		"apart",
+		"aparte",
+		"aperçu",
+		"aperij",
+		"apert",
+		"aperte",
+		"apezat",
+		"apin",
+		"aplomb",
+		"aporie",
+		"appel",
+		"appèl",
+		"appels",
+		"april",
+		"aprils",
+		"apsis",
+		"aq",
+		"ar",
+		"ara",
+		"arak",
+		"arbeid",
+		"arcade",
+		"arde",
+		"arduin",
+		"are",
+		"areaal",
+		"aren",
+		"arena",
+		"arend",
+		"argon",
+		"argot",
+		"argots",
+		"argus",
+		"aria",
+		"ariër",
+		"ariërs",
+		"arisch",
+		"ark",
+		"arken",
+		"arm",
+		"armada",
+		"arme",
+		"armee",
+		"armen",
+		"armer",
+		"armoe",
+		"armpje",
+		"armvol",
+		"Arnhem",
+		"aroma",
+		"aromen",
+		"aroom",
+		"arren",
+		"arrest",
+		"arrivé",
+		"ars",
+		"arseen",
+		"art",
+		"arts",
+		"artsen",
+		"as",
+		"asbak",
+		"asbelt",
+		"asbest",
+		"asceet",
+		"ascese",
+		"Asdag",
+		"asem",
+		"asemen",
+		"asfalt",
+		"ashoop",
+		"asiel",
+		"askar",
+		"asla",
+		"aslade",
+		"aspect",
+		"aspic",
+		"aspot",
+		"asrest",
+		"assem",
+		"assen",
+		"Assen",
+		"ast",
+		"asten",
+		"aster",
+		"asters",
+		"astma",
+		"aston",
+		"asurn",
+		"at",
+		"ataxie",
+		"atjar",
+		"Atjees",
+		"atlant",
+		"atlas",
+		"atleet",
+		"atlete",
+		"atol",
+		"atomen",
+		"atoom",
+		"atrium",
+		"attaca",
+		"attent",
+		"attest",
+		"au",
+		"aubade",
+		"auctie",
+		"auctor",
+		"aucuba",
+		"augurk",
+		"aula",
+		"aula's",
+		"aura",
+		"aura's",
+		"aurora",
+		"Aussie",
+		"auteur",
+		"autist",
+		"auto",
+		"auto's",
+		"auxine",
+		"av",
+		"aval",
+		"avance",
+		"avant",
+		"avatar",
+		"ave",
+		"avenue",
+		"averij",
+		"avis",
+		"avond",
+		"aw",
+		"ax",
+		"axel",
+		"axiaal",
+		"axiale",
+		"axioma",
+		"ay",
+		"az",
+		"azalea",
+		"azen",
+		"Aziaat",
+		"azijn",
+		"azimut",
+		"azteek",
+		"azuren",
+		"azuur",
+		"b",
+		"baadde",
+		"baadje",
+		"baai",
+		"baaien",
+		"baak",
+		"baal",
+		"baalde",
+		"baan",
+		"baande",
+		"baar",
+		"baard",
+		"baarde",
+		"baars",
+		"baas",
+		"baasde",
+		"baat",
+		"baatte",
+		"baba",
+		"babbel",
+		"babi",
+		"baboe",
+		"baboes",
+		"baby",
+		"baby's",
+		"bacil",
+		"back",
+		"backen",
+		"bacon",
+		"bacove",
+		"bad",
+		"badcel",
+		"baden",
+		"bader",
+		"baders",
+		"badge",
+		"badjas",
+		"badpak",
+		"badtas",
+		"bagage",
+		"bagger",
+		"bagno",
+		"bah",
+		"bahco",
+		"baisse",
+		"bajes",
+		"bak",
+		"baken",
+		"bakens",
+		"baker",
+		"bakers",
+		"bakken",
+		"bakker",
+		"bakkes",
+		"bakkie",
+		"bakpan",
+		"baksel",
+		"bakte",
+		"bakten",
+		"bakvis",
+		"bal",
+		"balans",
+		"balata",
+		"balde",
+		"balein",
+		"balen",
+		"balg",
+		"balgen",
+		"balie",
+		"balies",
+		"balije",
+		"baljuw",
+		"balk",
+		"balken",
+		"balkon",
+		"balkte",
+		"ballen",
+		"ballet",
+		"ballon",
+		"balpen",
+		"balsa",
+		"balsem",
+		"balts",
+		"balzak",
+		"bamba",
+		"bamboe",
+		"bami",
+		"Bamis",
+		"ban",
+		"banaal",
+		"banaan",
+		"banaat",
+		"banale",
+		"band",
+		"bande",
+		"banden",
+		"banen",
+		"bang",
+		"bange",
+		"banger",
+		"bangig",
+		"banier",
+		"banjer",
+		"banjir",
+		"banjo",
+		"bank",
+		"banken",
+		"banket",
+		"bankje",
+		"bankte",
+		"bannen",
+		"bantoe",
+		"bar",
+		"barak",
+		"bard",
+		"barden",
+		"barder",
+		"bare",
+		"bareel",
+		"baren",
+		"baret",
+		"bariet",
+		"baring",
+		"barium",
+		"bark",
+		"barkas",
+		"barken",
+		"barman",
+		"barok",
+		"baron",
+		"barons",
+		"barre",
+		"barrel",
+		"bars",
+		"barse",
+		"barser",
+		"barst",
+		"barzoi",
+		"bas",
+		"basaal",
+		"basale",
+		"basalt",
+		"base",
+		"basen",
+		"bases",
+		"basis",
+		"basket",
+		"bassen",
+		"basset",
+		"bassin",
+		"bast",
+		"basta",
+		"baste",
+		"basten",
+		"bat",
+		"Bataaf",
+		"bataat",
+		"batch",
+		"bate",
+		"baten",
+		"batig",
+		"batik",
+		"batiks",
+		"batist",
+		"baton",
+		"batten",
+		"baud",
+		"bauwde",
+		"bauwen",
+		"bavet",
+		"baxter",
+		"bazaar",
+		"bazen",
+		"bazig",
+		"bazige",
+		"bazin",
+		"bazuin",
+		"bb",
+		"bbb",
+		"bbbb",
+		"bc",
+		"bcd",
+		"bd",
+		"be",
+		"beaamd",
+		"beaat",
+		"beamen",
+		"beat",
+		"beauté ",
+		"beauty",
+		"beboet",
+		"bebop",
+		"bebost",
+		"bed",
+		"bedden",
+		"bede",
+		"bedekt",
+		"beden",
+		"bederf",
+		"bedild",
+		"beding",
+		"bedolf",
+		"bedong",
+		"bedot",
+		"bedrag",
+		"bedrog",
+		"beduid",
+		"beefde",
+		"beek",
+		"beeld",
+		"beemd",
+		"been",
+		"beende",
+		"beer",
+		"beerde",
+		"beërfd",
+		"beest",
+		"beet",
+		"beetje",
+		"bef",
+		"beffen",
+		"begaan",
+		"begaf",
+		"begijn",
+		"begild",
+		"begin",
+		"beging",
+		"begon",
+		"begoot",
+		"begrip",
+		"beha",
+		"behang",
+		"beha's",
+		"beheer",
+		"behept",
+		"behing",
+		"behoed",
+		"behoef",
+		"behoud",
+		"behulp",
+		"behuwd",
+		"bei",
+		"beidde",
+		"beide",
+		"beiden",
+		"beider",
+		"beien",
+		"Beier",
+		"Beiers",
+		"beige",
+		"beitel",
+		"beits",
+		"bejoeg",
+		"bek",
+		"bekaf",
+		"bekakt",
+		"bekapt",
+		"bekeef",
+		"bekeek",
+		"beken",
+		"bekend",
+		"beker",
+		"bekers",
+		"bekijk",
+		"bekist",
+		"bekken",
+		"beklad",
+		"beklag",
+		"beklom",
+		"beknot",
+		"bekort",
+		"bekte",
+		"bekwam",
+		"bel",
+		"beland",
+		"belang",
+		"belas",
+		"belast",
+		"belde",
+		"beleed",
+		"beleg",
+		"belegd",
+		"beleid",
+		"belet",
+		"Belg",
+		"Belgen",
+		"België",
+		"beliep",
+		"belle",
+		"bellen",
+		"bello",
+		"beloog",
+		"beloop",
+		"belt",
+		"belten",
+		"beluik",
+		"belust",
+		"bemand",
+		"bemest",
+		"bemind",
+		"bemost",
+		"ben",
+		"benam",
+		"benard",
+		"bende",
+		"benden",
+		"bendes",
+		"bene",
+		"benen",
+		"bengel",
+		"benig",
+		"benige",
+		"benijd",
+		"bennen",
+		"bent",
+		"benul",
+		"benut",
+		"benzoë",
+		"benzol",
+		"beo",
+		"beogen",
+		"beoogd",
+		"bepakt",
+		"beraad",
+		"berber",
+		"berd",
+		"berde",
+		"berden",
+		"bereed",
+		"bereid",
+		"bereik",
+		"beren",
+		"berg",
+		"bergaf",
+		"bergen",
+		"Bergen",
+		"bergop",
+		"beried",
+		"beriep",
+		"beril",
+		"berin",
+		"berini",
+		"berk",
+		"berken",
+		"berm",
+		"bermen",
+		"beroep",
+		"beroet",
+		"berouw",
+		"berrie",
+		"berst",
+		"berust",
+		"bes",
+		"besef",
+		"beseft",
+		"besje",
+		"besjes",
+		"beslag",
+		"besmet",
+		"bespot",
+		"bessen",
+		"best",
+		"bestal",
+		"beste",
+		"bestek",
+		"bestel",
+		"besten",
+		"bèta",
+		"betast",
+		"bete",
+		"betel",
+		"beten",
+		"beter",
+		"beton",
+		"betond",
+		"betoog",
+		"betoon",
+		"betrad",
+		"betrof",
+		"betrok",
+		"bette",
+		"betten",
+		"beu",
+		"beug",
+		"beugel",
+		"beugen",
+		"beuk",
+		"beuken",
+		"beuker",
+		"beukte",
+		"beul",
+		"beulde",
+		"beulen",
+		"beun",
+		"beunen",
+		"beurde",
+		"beuren",
+		"beurs",
+		"beurse",
+		"beurt",
+		"beval",
+		"bevat",
+		"bevel",
+		"beven",
+		"bever",
+		"bevers",
+		"beviel",
+		"bevind",
+		"beving",
+		"bevist",
+		"bevit",
+		"bevoer",
+		"bevond",
+		"bewees",
+		"beweid",
+		"bewies",
+		"bewijs",
+		"bewind",
+		"bewoog",
+		"bewust",
+		"bezaan",
+		"bezag",
+		"bezat",
+		"bezem",
+		"bezems",
+		"bezet",
+		"bezie",
+		"bezien",
+		"beziën",
+		"bezig",
+		"bezige",
+		"bezit",
+		"bezoek",
+		"bezon",
+		"bezong",
+		"bezonk",
+		"bezoop",
+		"bf",
+		"bg",
+		"bh",
+		"bi",
+		"bias",
+		"bibs",
+		"bic",
+		"biceps",
+		"biddag",
+		"bidden",
+		"bidder",
+		"bidet",
+		"bidets",
+		"bidon",
+		"bidweg",
+		"bieb",
+		"biecht",
+		"bieden",
+		"bieder",
+		"biel",
+		"biels",
+		"bier",
+		"bieren",
+		"bies",
+		"biesde",
+		"biest",
+		"biet",
+		"bieten",
+		"biezen",
+		"big",
+		"bigde",
+		"biggen",
+		"bigot",
+		"bij",
+		"bijbal",
+		"bijbel",
+		"bijeen",
+		"bijen",
+		"bijl",
+		"bijlen",
+		"bijles",
+		"bijna",
+		"bijou",
+		"bijous",
+		"bijrol",
+		"bijt",
+		"bijten",
+		"bijter",
+		"bijtje",
+		"bijtte",
+		"bijvak",
+		"bijval",
+		"bijzin",
+		"bijzit",
+		"bijzon",
+		"bik",
+		"bikini",
+		"bikkel",
+		"bikken",
+		"bikte",
+		"bil",
+		"bilde",
+		"biljet",
+		"billen",
+		"bimbam",
+		"binair",
+		"binden",
+		"binder",
+		"bingo",
+		"bink",
+		"binken",
+		"binnen",
+		"binst",
+		"bint",
+		"binten",
+		"bintje",
+		"biobak",
+		"biogas",
+		"bios",
+		"bips",
+		"bis",
+		"bisdom",
+		"bismut",
+		"bissen",
+		"bisser",
+		"bister",
+		"bistro",
+		"bit",
+		"bits",
+		"bitse",
+		"bitser",
+		"bitsig",
+		"bitten",
+		"bitter",
+		"bivak",
+		"bizar",
+		"bizon",
+		"bizons",
+		"bj",
+		"bk",
+		"bl",
+		"blaag",
+		"blaam",
+		"blaar",
+		"blaas",
+		"blad",
+		"bladen",
+		"blafte",
+		"blagen",
+		"blague",
+		"blak",
+		"blaken",
+		"blaker",
+		"blakke",
+		"blanco",
+		"blanda",
+		"blank",
+		"blanke",
+		"blaren",
+		"blasé",
+		"blaten",
+		"blauw",
+		"blauwe",
+		"blazen",
+		"blazer",
+		"bleef",
+		"bleek",
+		"blees",
+		"blei",
+		"bleien",
+		"bleke",
+		"bleken",
+		"bleker",
+		"blekte",
+		"blende",
+		"blèrde",
+		"blèren",
+		"bles",
+		"bleten",
+		"bleu",
+		"blezen",
+		"bliek",
+		"bliep",
+		"blies",
+		"blij",
+		"blijde",
+		"blijer",
+		"blijf",
+		"blijk",
+		"blik",
+		"blikte",
+		"blind",
+		"blinde",
+		"blink",
+		"blits",
+		"blo",
+		"blode",
+		"bloder",
+		"bloed",
+		"bloei",
+		"bloem",
+		"bloes",
+		"blok",
+		"blokte",
+		"blom",
+		"blond",
+		"blonde",
+		"bloot",
+		"blos",
+		"blote",
+		"bloter",
+		"blouse",
+		"blow",
+		"blowen",
+		"blower",
+		"blozen",
+		"blues",
+		"bluf",
+		"blufte",
+		"bluste",
+		"blut",
+		"bluts",
+		"bm",
+		"bn",
+		"bo",
+		"boa",
+		"board",
+		"bob",
+		"bobbel",
+		"bobben",
+		"bobby",
+		"bobde",
+		"bobijn",
+		"bobine",
+		"bochel",
+		"bocht",
+		"bock",
+		"bod",
+		"bode",
+		"bodega",
+		"bodem",
+		"bodems",
+		"boden",
+		"bodes",
+		"body",
+		"body's",
+		"boe",
+		"boedel",
+		"boef",
+		"boeg",
+		"boegen",
+		"boei",
+		"boeide",
+		"boeien",
+		"boeier",
+		"boek",
+		"boeken",
+		"boeket",
+		"boekte",
+		"boel",
+		"boelen",
+		"boem",
+		"boeman",
+		"boemel",
+		"boende",
+		"boenen",
+		"boer",
+		"boerde",
+		"boeren",
+		"boerin",
+		"boers",
+		"boerse",
+		"boert",
+		"boes",
+		"boete",
+		"boeten",
+		"boetes",
+		"boette",
+		"boeven",
+		"boezel",
+		"boezem",
+		"boezen",
+		"bof",
+		"boffen",
+		"boffer",
+		"bofte",
+		"bogen",
+		"bohème",
+		"boiler",
+		"bojaar",
+		"bok",
+		"bokaal",
+		"bokken",
+		"bokkig",
+		"boksen",
+		"bokser",
+		"bokste",
+		"bokte",
+		"boktor",
+		"bol",
+		"bolde",
+		"bolder",
+		"boleet",
+		"bolero",
+		"bolide",
+		"bolk",
+		"bolken",
+		"bolkop",
+		"bolle",
+		"bollen",
+		"boller",
+		"bollig",
+		"bolus",
+		"bom",
+		"bombam",
+		"bomde",
+		"bomen",
+		"bomer",
+		"bomers",
+		"bomgat",
+		"bomijs",
+		"bommel",
+		"bommen",
+		"bomvol",
+		"bon",
+		"bonbon",
+		"bond",
+		"bonden",
+		"bondig",
+		"bonen",
+		"bongo",
+		"boni",
+		"bonje",
+		"bonk",
+		"bonken",
+		"bonket",
+		"bonkig",
+		"bonkte",
+		"bonnen",
+		"bonnet",
+		"bonobo",
+		"bons",
+		"bonsai",
+		"bonsde",
+		"bont",
+		"bonte",
+		"bonten",
+		"bonter",
+		"bontje",
+		"bonus",
+		"bonze",
+		"bonzen",
+		"boog",
+		"boogde",
+		"boom",
+		"boomde",
+		"boon",
+		"boor",
+		"booras",
+		"boord",
+		"boorde",
+		"boort",
+		"boos",
+		"boot",
+		"bootee",
+		"bootte",
+		"bopper",
+		"boraat",
+		"borat",
+		"borax",
+		"bord",
+		"borden",
+		"border",
+		"bordes",
+		"boren",
+		"borg",
+		"borgde",
+		"borgen",
+		"boring",
+		"borium",
+		"borrel",
+		"borst",
+		"bos",
+		"bosbes",
+		"bosgod",
+		"bosje",
+		"bosjes",
+		"boskat",
+		"boson",
+		"bospad",
+		"bossen",
+		"boste",
+		"boston",
+		"bosuil",
+		"bot",
+		"boten",
+		"boter",
+		"botje",
+		"botjes",
+		"bots",
+		"botsen",
+		"botste",
+		"botte",
+		"bottel",
+		"botten",
+		"botter",
+		"botweg",
+		"bouclé",
+		"boud",
+		"boude",
+		"bougie",
+		"boules",
+		"bout",
+		"boute",
+		"bouten",
+		"bouw",
+		"bouwde",
+		"bouwen",
+		"bouwer",
+		"boven",
+		"bowl",
+		"bowlde",
+		"bowlen",
+		"bowler",
+		"box",
+		"boxer",
+		"boy",
+		"boycot",
+		"boze",
+		"bozer",
+		"bozig",
+		"bp",
+		"bq",
+		"br",
+		"braaf",
+		"braai",
+		"braak",
+		"braam",
+		"bracht",
+		"braden",
+		"brak",
+		"braken",
+		"brakke",
+		"bralde",
+		"bram",
+		"bramen",
+		"brand",
+		"brandy",
+		"branie",
+		"bras",
+		"brasem",
+		"braste",
+		"brat",
+		"brave",
+		"braver",
+		"bravo",
+		"break",
+		"brede",
+		"breder",
+		"breed",
+		"breide",
+		"breien",
+		"brein",
+		"breken",
+		"breker",
+		"brem",
+		"brems",
+		"bres",
+		"bretel",
+		"Breton",
+		"breuk",
+		"breve",
+		"breven",
+		"brevet",
+		"bridge",
+		"brie",
+		"brief",
+		"bries",
+		"brij",
+		"brijen",
+		"brik",
+		"briket",
+		"bril",
+		"brilde",
+		"brille",
+		"brink",
+		"brio",
+		"Brit",
+		"Brits",
+		"Britse",
+		"broche",
+		"broden",
+		"broed",
+		"broeds",
+		"broei",
+		"broek",
+		"broer",
+		"broes",
+		"brogue",
+		"brok",
+		"broker",
+		"brokte",
+		"brom",
+		"bromde",
+		"bron",
+		"brons",
+		"bronst",
+		"brood",
+		"broom",
+		"broos",
+		"bros",
+		"brosse",
+		"broze",
+		"brozen",
+		"brozer",
+		"brug",
+		"Brugge",
+		"brugje",
+		"brui",
+		"bruid",
+		"bruin",
+		"bruine",
+		"bruis",
+		"brulde",
+		"brunch",
+		"brut",
+		"brute",
+		"bruten",
+		"bruter",
+		"bruto",
+		"bruusk",
+		"bruut",
+		"bs",
+		"bt",
+		"bu",
+		"bubbel",
+		"buddy",
+		"budget",
+		"budo",
+		"buffel",
+		"buffer",
+		"buffet",
+		"bug",
+		"bugel",
+		"bugels",
+		"buggy",
+		"bŸhne",
+		"bui",
+		"buide",
+		"buidel",
+		"buien",
+		"buigen",
+		"buiig",
+		"buik",
+		"buiken",
+		"buikig",
+		"buikje",
+		"buil",
+		"builde",
+		"builen",
+		"buis",
+		"buisde",
+		"buit",
+		"buiten",
+		"buitje",
+		"buitte",
+		"buizen",
+		"bukken",
+		"buks",
+		"buksen",
+		"bukte",
+		"bul",
+		"buldog",
+		"bulk",
+		"bulken",
+		"bulkte",
+		"bullen",
+		"bult",
+		"bulten",
+		"bultig",
+		"bultte",
+		"bumper",
+		"bun",
+		"bundel",
+		"bunder",
+		"bunker",
+		"bunnen",
+		"bunny",
+		"bups",
+		"burcht",
+		"bureau",
+		"bureel",
+		"buren",
+		"buret",
+		"burg",
+		"burgen",
+		"burger",
+		"burijn",
+		"burin",
+		"burins",
+		"bus",
+		"bussel",
+		"bussen",
+		"buste",
+		"busten",
+		"bustes",
+		"butaan",
+		"butler",
+		"butsen",
+		"button",
+		"buur",
+		"buurde",
+		"buurt",
+		"buxus",
+		"bv",
+		"bw",
+		"bx",
+		"by",
+		"bye",
+		"bypass",
+		"byte",
+		"bytes",
+		"bz",
+		"c",
+		"caban",
+		"cabans",
+		"cabine",
+		"cacao",
+		"cachet",
+		"cachot",
+		"cactus",
+		"cadans",
+		"caddie",
+		"cadeau",
+		"cadens",
+		"cadet",
+		"caesar",
+		"café",
+		"cafés",
+		"cahier",
+		"cake",
+		"cakes",
+		"calque",
+		"camber",
+		"camee",
+		"camel",
+		"camera",
+		"camion",
+		"camper",
+		"campus",
+		"canada",
+		"canapé",
+		"canard",
+		"cancan",
+		"canon",
+		"canons",
+		"canto",
+		"cantor",
+		"canule",
+		"canvas",
+		"cape",
+		"capes",
+		"capita",
+		"carbid",
+		"carbol",
+		"carbon",
+		"care",
+		"cargo",
+		"cariës",
+		"carnet",
+		"carré",
+		"carrés",
+		"carter",
+		"casco",
+		"case",
+		"cash",
+		"casino",
+		"cassis",
+		"cast",
+		"casten",
+		"castte",
+		"casus",
+		"catgut",
+		"causa",
+		"cautie",
+		"cavia",
+		"cb",
+		"cc",
+		"ccc",
+		"cccc",
+		"cd",
+		"cde",
+		"ce",
+		"cedel",
+		"cedels",
+		"ceder",
+		"ceders",
+		"ceel",
+		"cel",
+		"celen",
+		"cellen",
+		"cello",
+		"cement",
+		"censor",
+		"census",
+		"cent",
+		"centen",
+		"center",
+		"centra",
+		"cerise",
+		"cervix",
+		"cesium",
+		"cessie",
+		"cesuur",
+		"cetera",
+		"cf",
+		"cg",
+		"ch",
+		"chador",
+		"chalet",
+		"chaoot",
+		"chaos",
+		"charge",
+		"charme",
+		"charta",
+		"cheeta",
+		"chef",
+		"chefs",
+		"chemie",
+		"cheque",
+		"cherub",
+		"chic",
+		"chick",
+		"chijl",
+		"chili",
+		"chintz",
+		"chip",
+		"chips",
+		"chique",
+		"chloor",
+		"choco",
+		"choke",
+		"choken",
+		"chorus",
+		"chroma",
+		"chromo",
+		"chrono",
+		"chroom",
+		"ci",
+		"cicero",
+		"cider",
+		"cijfer",
+		"cijns",
+		"cineac",
+		"cinema",
+		"cipier",
+		"cipres",
+		"circa",
+		"circus",
+		"cirkel",
+		"cirrus",
+		"cis",
+		"cissen",
+		"citaat",
+		"citer",
+		"citers",
+		"city",
+		"civet",
+		"civiel",
+		"cj",
+		"ck",
+		"cl",
+		"claim",
+		"clan",
+		"claque",
+		"claris",
+		"claus",
+		"claves",
+		"claxon",
+		"clean",
+		"cleane",
+		"clerus",
+		"cliché",
+		"click",
+		"cliënt",
+		"climax",
+		"clinch",
+		"clip",
+		"clivia",
+		"cloaca",
+		"close",
+		"closet",
+		"clou",
+		"clown",
+		"club",
+		"cm",
+		"cn",
+		"co",
+		"coach",
+		"coaten",
+		"cobra",
+		"coca",
+		"coccus",
+		"cocon",
+		"cocons",
+		"coda",
+		"code",
+		"codes",
+		"codeur",
+		"codex",
+		"cognac",
+		"cohort",
+		"coïtus",
+		"coke",
+		"cokes",
+		"col",
+		"cola",
+		"cola's",
+		"colli",
+		"collie",
+		"collo",
+		"colt",
+		"column",
+		"coma",
+		"combi",
+		"combo",
+		"comité",
+		"condor",
+		"conga",
+		"congé",
+		"congés",
+		"consul",
+		"conté",
+		"conti",
+		"conto",
+		"contra",
+		"conus",
+		"convex",
+		"corgi",
+		"corner",
+		"cornet",
+		"corona",
+		"corps",
+		"corpus",
+		"corso",
+		"Cortes",
+		"cortex",
+		"corvee",
+		"coup",
+		"coupe",
+		"coupé",
+		"coupes",
+		"coupés",
+		"coupon",
+		"cour",
+		"cover",
+		"cowboy",
+		"coyote",
+		"cp",
+		"cq",
+		"cr",
+		"crack",
+		"crank",
+		"crash",
+		"crawl",
+		"crayon",
+		"crazy",
+		"crèche",
+		"credit",
+		"credo",
+		"crème",
+		"crèmes",
+		"creool",
+		"crêpe",
+		"cretin",
+		"crew",
+		"criant",
+		"crime",
+		"crises",
+		"crisis",
+		"cross",
+		"cru",
+		"cruise",
+		"crux",
+		"crypte",
+		"cs",
+		"ct",
+		"cu",
+		"Cubaan",
+		"cue",
+		"culten",
+		"cultus",
+		"cumul",
+		"cup",
+		"cupido",
+		"curare",
+		"curie",
+		"cursor",
+		"cursus",
+		"curve",
+		"curven",
+		"custos",
+		"cutter",
+		"cv",
+		"cw",
+		"cx",
+		"cy",
+		"cyaan",
+		"cycli",
+		"cyclus",
+		"cynici",
+		"cypers",
+		"cyste",
+		"cysten",
+		"cz",
+		"d",
+		"daad",
+		"daagde",
+		"daags",
+		"daagse",
+		"daalde",
+		"daar",
+		"daaraf",
+		"daarin",
+		"daarna",
+		"daarom",
+		"daarop",
+		"daas",
+		"daasde",
+		"dabben",
+		"dabde",
+		"dacht",
+		"dada",
+		"dadel",
+		"dadels",
+		"daden",
+		"dader",
+		"daders",
+		"dading",
+		"dag",
+		"dage",
+		"dagen",
+		"dager",
+		"dagers",
+		"dagge",
+		"daggen",
+		"daghit",
+		"daging",
+		"dagje",
+		"dagjes",
+		"daguil",
+		"dahlia",
+		"daim",
+		"dak",
+		"daken",
+		"dakpan",
+		"dal",
+		"dalem",
+		"dalems",
+		"dalen",
+		"daling",
+		"daluur",
+		"dam",
+		"damar",
+		"damast",
+		"damde",
+		"dame",
+		"dames",
+		"dammen",
+		"dammer",
+		"damp",
+		"dampen",
+		"dampig",
+		"dampte",
+		"dan",
+		"dandy",
+		"danig",
+		"danige",
+		"dank",
+		"danken",
+		"dankte",
+		"dans",
+		"dansen",
+		"danser",
+		"danste",
+		"dapper",
+		"dar",
+		"darm",
+		"darmen",
+		"darren",
+		"dartel",
+		"darts",
+		"das",
+		"dassen",
+		"dat",
+		"data",
+		"datief",
+		"datje",
+		"datjes",
+		"dato",
+		"datsja",
+		"datum",
+		"datums",
+		"dauw",
+		"dauwde",
+		"dauwen",
+		"daver",
+		"davit",
+		"davits",
+		"dazen",
+		"db",
+		"dc",
+		"dd",
+		"D-day",
+		"ddd",
+		"dddd",
+		"de",
+		"deal",
+		"dealen",
+		"dealer",
+		"debat",
+		"debet",
+		"debiel",
+		"debiet",
+		"debuut",
+		"decaan",
+		"decade",
+		"decent",
+		"deciel",
+		"deck",
+		"decor",
+		"decors",
+		"dédain",
+		"deed",
+		"deeg",
+		"deejay",
+		"deel",
+		"deelde",
+		"deels",
+		"Deen",
+		"Deens",
+		"Deense",
+		"deerde",
+		"deerne",
+		"def",
+		"defect",
+		"defilé",
+		"deftig",
+		"degel",
+		"degels",
+		"degen",
+		"degene",
+		"degens",
+		"degout",
+		"deinde",
+		"deinen",
+		"deïsme",
+		"deïst",
+		"dek",
+		"dekbed",
+		"deken",
+		"dekens",
+		"dekhut",
+		"dekken",
+		"dekker",
+		"deksel",
+		"dekte",
+		"del",
+		"dele",
+		"delen",
+		"deler",
+		"delers",
+		"delfde",
+		"delfts",
+		"delgde",
+		"delgen",
+		"delict",
+		"deling",
+		"dellen",
+		"delta",
+		"delven",
+		"dement",
+		"demi",
+		"demo",
+		"demon",
+		"demons",
+		"demo's",
+		"dempen",
+		"demper",
+		"dempte",
+		"Denen",
+		"denier",
+		"denim",
+		"denken",
+		"denker",
+		"dennen",
+		"Deo",
+		"depot",
+		"depots",
+		"deppen",
+		"depte",
+		"der",
+		"derby",
+		"derde",
+		"derden",
+		"derdes",
+		"deren",
+		"derfde",
+		"derny",
+		"derrie",
+		"dertig",
+		"derven",
+		"des",
+		"desa",
+		"desem",
+		"desems",
+		"design",
+		"desk",
+		"dessen",
+		"dessin",
+		"detail",
+		"deuce",
+		"deugd",
+		"deugde",
+		"deugen",
+		"deuk",
+		"deuken",
+		"deukte",
+		"deun",
+		"deunde",
+		"deunen",
+		"deur",
+		"deuren",
+		"deuvik",
+		"devies",
+		"Devoon",
+		"devoot",
+		"devote",
+		"dewijl",
+		"deze",
+		"dezen",
+		"dezer",
+		"df",
+		"dg",
+		"dh",
+		"di",
+		"dia",
+		"diaken",
+		"dicht",
+		"dichte",
+		"dictee",
+		"dictie",
+		"die",
+		"dieet",
+		"dief",
+		"diefde",
+		"dien",
+		"diende",
+		"dienen",
+		"diens",
+		"dienst",
+		"diep",
+		"diepe",
+		"diepen",
+		"dieper",
+		"diepte",
+		"dier",
+		"dieren",
+		"dies",
+		"diesel",
+		"diëten",
+		"Diets",
+		"Dietse",
+		"dieven",
+		"dij",
+		"dijde",
+		"dijen",
+		"dijk",
+		"dijken",
+		"dijker",
+		"dijkte",
+		"dijn",
+		"dik",
+		"dikbil",
+		"dikke",
+		"dikken",
+		"dikker",
+		"dikkig",
+		"dikkop",
+		"dikoor",
+		"dikte",
+		"dikten",
+		"diktes",
+		"dikzak",
+		"dildo",
+		"dille",
+		"dillen",
+		"dimde",
+		"dimmen",
+		"dimmer",
+		"dimorf",
+		"dinar",
+		"diner",
+		"diners",
+		"ding",
+		"dingen",
+		"dinges",
+		"dingo",
+		"diode",
+		"diodes",
+		"dip",
+		"dippen",
+		"dipte",
+		"direct",
+		"dirk",
+		"dirken",
+		"dirkte",
+		"dis",
+		"disco",
+		"discus",
+		"disk",
+		"dissel",
+		"dissen",
+		"distel",
+		"dit",
+		"ditje",
+		"ditjes",
+		"dito",
+		"diva",
+		"divan",
+		"divans",
+		"diva's",
+		"divers",
+		"dizzy",
+		"dj",
+		"djati",
+		"dk",
+		"dl",
+		"dm",
+		"dn",
+		"do",
+		"dobber",
+		"docent",
+		"doch",
+		"dociel",
+		"doctor",
+		"doddig",
+		"dode",
+		"doden",
+		"doding",
+		"dodo",
+		"doedel",
+		"doek",
+		"doeken",
+		"doekte",
+		"doel",
+		"doelde",
+		"doelen",
+		"doem",
+		"doemde",
+		"doemen",
+		"doen",
+		"doende",
+		"doener",
+		"doerak",
+		"does",
+		"doetje",
+		"doezel",
+		"doezen",
+		"dof",
+		"doffe",
+		"doffen",
+		"doffer",
+		"doft",
+		"dofte",
+		"doften",
+		"dog",
+		"doge",
+		"dogen",
+		"doges",
+		"doggen",
+		"dogger",
+		"dogma",
+		"dok",
+		"doka",
+		"doken",
+		"dokken",
+		"dokte",
+		"dokter",
+		"dol",
+		"dolby",
+		"dolde",
+		"dolen",
+		"doler",
+		"dolik",
+		"doling",
+		"dolk",
+		"dolken",
+		"dollar",
+		"dolle",
+		"dollen",
+		"doller",
+		"dolly",
+		"dolman",
+		"dolmen",
+		"dolven",
+		"dom",
+		"domein",
+		"domen",
+		"domino",
+		"domkop",
+		"domme",
+		"dommel",
+		"dommer",
+		"domoor",
+		"dompel",
+		"domper",
+		"dompig",
+		"domweg",
+		"don",
+		"doña",
+		"donaat",
+		"donder",
+		"dong",
+		"donjon",
+		"donk",
+		"donker",
+		"donkey",
+		"donna",
+		"donor",
+		"donors",
+		"dons",
+		"donsje",
+		"donut",
+		"donzen",
+		"donzig",
+		"dood",
+		"doodde",
+		"doodop",
+		"doods",
+		"doodse",
+		"doof",
+		"doofde",
+		"dooi",
+		"dooide",
+		"dooie",
+		"dooien",
+		"dooier",
+		"dook",
+		"dool",
+		"doolde",
+		"doom",
+		"doomde",
+		"doop",
+		"doopte",
+		"door",
+		"doorn",
+		"doos",
+		"dop",
+		"dope",
+		"dopen",
+		"doper",
+		"dopers",
+		"dophei",
+		"doping",
+		"doppen",
+		"dopper",
+		"dopte",
+		"dor",
+		"dorade",
+		"dorado",
+		"dorde",
+		"dorder",
+		"doren",
+		"dorens",
+		"dorp",
+		"dorpel",
+		"dorpen",
+		"dorper",
+		"dorps",
+		"dorpse",
+		"dorre",
+		"dorren",
+		"dors",
+		"dorsen",
+		"dorst",
+		"dorste",
+		"dos",
+		"doses",
+		"dosis",
+		"dossen",
+		"doste",
+		"dot",
+		"dotaal",
+		"dotten",
+		"dotter",
+		"douane",
+		"doublé",
+		"douche",
+		"douw",
+		"douwde",
+		"douwen",
+		"dove",
+		"doven",
+		"dover",
+		"down",
+		"dozen",
+		"dozijn",
+		"dp",
+		"dq",
+		"dr",
+		"dra",
+		"draad",
+		"draai",
+		"draak",
+		"drab",
+		"dracht",
+		"draden",
+		"draf",
+		"dragee",
+		"dragen",
+		"drager",
+		"dragon",
+		"draken",
+		"dralen",
+		"drama",
+		"dramde",
+		"drang",
+		"drank",
+		"dras",
+		"drasse",
+		"draven",
+		"draver",
+		"dravik",
+		"draw",
+		"dreef",
+		"dreg",
+		"dregde",
+		"drek",
+		"dreun",
+		"drevel",
+		"dreven",
+		"drie",
+		"drieën",
+		"dries",
+		"driest",
+		"drift",
+		"dril",
+		"drilde",
+		"drive",
+		"drives",
+		"droef",
+		"droeg",
+		"droes",
+		"droeve",
+		"droge",
+		"drogen",
+		"droger",
+		"drol",
+		"drom",
+		"dromde",
+		"dromen",
+		"dromer",
+		"drong",
+		"dronk",
+		"droog",
+		"droom",
+		"drop",
+		"dropje",
+		"drops",
+		"dropte",
+		"drost",
+		"droste",
+		"drozen",
+		"drug",
+		"druïde",
+		"druif",
+		"druil",
+		"druk",
+		"drukke",
+		"drukte",
+		"drum",
+		"drumde",
+		"drup",
+		"drupte",
+		"dry",
+		"dryade",
+		"ds",
+		"dt",
+		"du",
+		"duaal",
+		"duale",
+		"dualis",
+		"dubbel",
+		"dubben",
+		"dubde",
+		"dubio",
+		"duel",
+		"duels",
+		"duet",
+		"duf",
+		"duffe",
+		"duffel",
+		"duffer",
+		"duidde",
+		"duiden",
+		"duif",
+		"duig",
+		"duigen",
+		"duik",
+		"duiken",
+		"duiker",
+		"duim",
+		"duimde",
+		"duimen",
+		"duin",
+		"duinen",
+		"duist",
+		"duit",
+		"duiten",
+		"Duits",
+		"Duitse",
+		"duivel",
+		"duiven",
+		"duiver",
+		"duivin",
+		"dukaat",
+		"duldde",
+		"dulden",
+		"dumdum",
+		"dummy",
+		"dump",
+		"dumpen",
+		"dumpte",
+		"dun",
+		"dunde",
+		"dunk",
+		"dunken",
+		"dunne",
+		"dunnen",
+		"dunner",
+		"dunsel",
+		"dunte",
+		"duo",
+		"dupe",
+		"dupes",
+		"duplo",
+		"dure",
+		"duren",
+		"durf",
+		"durfal",
+		"durfde",
+		"duro",
+		"durven",
+		"dus",
+		"duster",
+		"dusver",
+		"dut",
+		"dutje",
+		"duts",
+		"dutsen",
+		"dutte",
+		"dutten",
+		"duur",
+		"duurde",
+		"duurte",
+		"duvel",
+		"duvels",
+		"duw",
+		"duwbak",
+		"duwde",
+		"duwen",
+		"duwtje",
+		"dv",
+		"dw",
+		"dwaal",
+		"dwaas",
+		"dwalen",
+		"dwang",
+		"dwars",
+		"dwarse",
+		"dwaze",
+		"dwazen",
+		"dwazer",
+		"dweil",
+		"dwepen",
+		"dweper",
+		"dwerg",
+		"dx",
+		"dy",
+		"dynamo",
+		"dynast",
+		"dyne",
+		"dynes",
+		"dz",
+		"e",
+		"eau",
+		"eb",
+		"ebbe",
+		"ebben",
+		"ebde",
+		"ebdeur",
+		"ec",
+		"ecarté",
+		"echec",
+		"echel",
+		"echo",
+		"echode",
+		"echoën",
+		"echt",
+		"echte",
+		"echten",
+		"echter",
+		"echtte",
+		"eclair",
+		"eclips",
+		"ecru",
+		"eczeem",
+		"eczema",
+		"ed",
+		"edel",
+		"edele",
+		"edeler",
+		"Eden",
+		"edict",
+		"edik",
+		"editie",
+		"edoch",
+		"ee",
+		"eed",
+		"eee",
+		"eeee",
+		"eega",
+		"eegaas",
+		"eega's",
+		"eek",
+		"eelt",
+		"eeltig",
+		"een",
+		"eenarm",
+		"eend",
+		"eenden",
+		"eender",
+		"eenoog",
+		"eens",
+		"eentje",
+		"eer",
+		"eerde",
+		"eerder",
+		"eerst",
+		"eerste",
+		"eervol",
+		"eest",
+		"eesten",
+		"eestte",
+		"eeuw",
+		"eeuwen",
+		"eeuwig",
+		"ef",
+		"effect",
+		"effen",
+		"efg",
+		"eg",
+		"egaal",
+		"egale",
+		"egaler",
+		"egard",
+		"egde",
+		"egel",
+		"egge",
+		"eggen",
+		"ego",
+		"egoïst",
+		"eh",
+		"ei",
+		"eiber",
+		"eibers",
+		"eicel",
+		"eieren",
+		"eigen",
+		"eik",
+		"eikel",
+		"eikels",
+		"eiken",
+		"eilaas",
+		"eiland",
+		"eind",
+		"eindde",
+		"einde",
+		"einden",
+		"einder",
+		"eindig",
+		"eindje",
+		"eins",
+		"einze",
+		"einzen",
+		"eirond",
+		"eis",
+		"eisen",
+		"eiser",
+		"eisers",
+		"eiste",
+		"eitje",
+		"eitjes",
+		"eivol",
+		"eiwit",
+		"ej",
+		"ek",
+		"eken",
+		"ekster",
+		"el",
+		"elan",
+		"eland",
+		"elders",
+		"elegie",
+		"elf",
+		"elfde",
+		"elfden",
+		"elfen",
+		"elft",
+		"elftal",
+		"elften",
+		"elisie",
+		"elite",
+		"elixer",
+		"elk",
+		"elkaar",
+		"elke",
+		"elkeen",
+		"ellen",
+		"ellens",
+		"ellips",
+		"elpee",
+		"elpees",
+		"elpen",
+		"els",
+		"elven",
+		"elzen",
+		"em",
+		"email",
+		"embryo",
+		"emfase",
+		"emir",
+		"emmer",
+		"emmers",
+		"emoe",
+		"emotie",
+		"empire",
+		"en",
+		"end",
+		"enden",
+		"ener",
+		"enfin",
+		"eng",
+		"enge",
+		"engel",
+		"Engels",
+		"enger",
+		"engerd",
+		"engte",
+		"engten",
+		"engtes",
+		"enig",
+		"enige",
+		"enigma",
+		"enigst",
+		"enk",
+		"enkel",
+		"enkele",
+		"enkels",
+		"enken",
+		"enorm",
+		"enorme",
+		"ent",
+		"enten",
+		"enter",
+		"enters",
+		"enting",
+		"entree",
+		"entte",
+		"enzym",
+		"eo",
+		"Eoceen",
+		"eoliet",
+		"ep",
+		"epiek",
+		"epifyt",
+		"episch",
+		"epoche",
+		"epopee",
+		"epoque",
+		"epos",
+		"eq",
+		"equipe",
+		"er",
+		"era",
+		"eraan",
+		"eraf",
+		"erbij",
+		"erdoor",
+		"ere",
+		"erelid",
+		"eren",
+		"erf",
+		"erfde",
+		"erfoom",
+		"erfwet",
+		"erg",
+		"erge",
+		"ergens",
+		"erger",
+		"ergo",
+		"ergon",
+		"erheen",
+		"erica",
+		"erin",
+		"erkend",
+		"erker",
+		"erkers",
+		"ermede",
+		"ermee",
+		"erna",
+		"ernaar",
+		"ernst",
+		"erom",
+		"erop",
+		"eropaf",
+		"eropin",
+		"eropna",
+		"Eros",
+		"erosie",
+		"erover",
+		"errata",
+		"ersatz",
+		"ertoe",
+		"erts",
+		"ertsen",
+		"eruit",
+		"ervan",
+		"erve",
+		"erven",
+		"ervoer",
+		"ervoor",
+		"erwt",
+		"erwten",
+		"es",
+		"escape",
+		"escort",
+		"escudo",
+		"eskimo",
+		"esp",
+		"espada",
+		"espen",
+		"esprit",
+		"essay",
+		"essays",
+		"essen",
+		"ester",
+		"estrik",
+		"et",
+		"etage",
+		"etages",
+		"etappe",
+		"eten",
+		"eter",
+		"etheen",
+		"ether",
+		"ethica",
+		"ethiek",
+		"ethos",
+		"ethyl",
+		"etiket",
+		"etmaal",
+		"ets",
+		"etsen",
+		"etser",
+		"etsers",
+		"etste",
+		"etter",
+		"etude",
+		"etudes",
+		"etui",
+		"eu",
+		"eunuch",
+		"eureka",
+		"euvel",
+		"euvele",
+		"euvels",
+		"euzie",
+		"euzies",
+		"ev",
+		"eva",
+		"evacué",
+		"evasie",
+		"even",
+		"evenzo",
+		"ever",
+		"ew",
+		"ex",
+		"exact",
+		"exacte",
+		"examen",
+		"exces",
+		"excuus",
+		"exil",
+		"exit",
+		"ex-man",
+		"exodus",
+		"exoot",
+		"expert",
+		"export",
+		"exposé",
+		"expres",
+		"exquis",
+		"extase",
+		"extern",
+		"extra",
+		"ey",
+		"ez",
+		"ezel",
+		"ezelin",
+		"f",
+		"faal",
+		"faalde",
+		"faam",
+		"faas",
+		"fabel",
+		"fabels",
+		"façade",
+		"face",
+		"facet",
+		"facie",
+		"facies",
+		"facit",
+		"factie",
+		"facto",
+		"factor",
+		"fade",
+		"fading",
+		"fado",
+		"faëton",
+		"fagot",
+		"fair",
+		"faire",
+		"fake",
+		"faken",
+		"fakir",
+		"fakirs",
+		"fakkel",
+		"falanx",
+		"falen",
+		"falie",
+		"falies",
+		"fallus",
+		"falset",
+		"fameus",
+		"fan",
+		"fanaal",
+		"fanaat",
+		"farad",
+		"farao",
+		"farce",
+		"farcen",
+		"farces",
+		"farde",
+		"farden",
+		"fardes",
+		"farm",
+		"farmer",
+		"faro",
+		"fase",
+		"fasen",
+		"fases",
+		"fat",
+		"fata",
+		"fataal",
+		"fatale",
+		"fats",
+		"fatsen",
+		"fatten",
+		"fatum",
+		"fatwa",
+		"faun",
+		"fauna",
+		"faunen",
+		"faveur",
+		"fax",
+		"faxen",
+		"faxte",
+		"fazant",
+		"fazen",
+		"fb",
+		"fc",
+		"fd",
+		"fe",
+		"fecaal",
+		"feces",
+		"fee",
+		"feeën",
+		"feeks",
+		"feest",
+		"feetje",
+		"feil",
+		"feilde",
+		"feilen",
+		"feit",
+		"feiten",
+		"fel",
+		"fellah",
+		"felle",
+		"feller",
+		"fels",
+		"felsen",
+		"felste",
+		"femel",
+		"feniks",
+		"fenol",
+		"fep",
+		"ferm",
+		"ferme",
+		"fermer",
+		"ferry",
+		"fes",
+		"fessen",
+		"feston",
+		"feta",
+		"fetisj",
+		"feut",
+		"fez",
+		"fezzen",
+		"ff",
+		"fff",
+		"ffff",
+		"fg",
+		"fgh",
+		"fh",
+		"fi",
+		"fiasco",
+		"fiat",
+		"fiber",
+		"fibril",
+		"fibula",
+		"fiche",
+		"fiches",
+		"fichu",
+		"fictie",
+		"ficus",
+		"fideel",
+		"fidele",
+		"fiedel",
+		"fielt",
+		"fier",
+		"fiere",
+		"fiets",
+		"figaro",
+		"figuur",
+		"fijfel",
+		"fijn",
+		"fijne",
+		"fijnen",
+		"fijner",
+		"fijnte",
+		"fijt",
+		"fik",
+		"fikken",
+		"fikkie",
+		"fiks",
+		"fikse",
+		"fiksen",
+		"file",
+		"files",
+		"filet",
+		"filets",
+		"film",
+		"filmde",
+		"filmen",
+		"filmer",
+		"filter",
+		"Fin",
+		"finaal",
+		"finale",
+		"fine",
+		"fineer",
+		"finish",
+		"Finnen",
+		"Fins",
+		"Finse",
+		"fint",
+		"finten",
+		"fiolen",
+		"fiool",
+		"firma",
+		"firn",
+		"fis",
+		"fiscus",
+		"fissen",
+		"fistel",
+		"fit",
+		"fitis",
+		"fits",
+		"fitte",
+		"fitten",
+		"fitter",
+		"fixeer",
+		"fixus",
+		"fj",
+		"fjord",
+		"fk",
+		"fl",
+		"flacon",
+		"flair",
+		"flanel",
+		"flank",
+		"flap",
+		"flapte",
+		"flard",
+		"flash",
+		"flat",
+		"flater",
+		"flatus",
+		"flauw",
+		"flauwe",
+		"fleer",
+		"flegma",
+		"flemen",
+		"flens",
+		"fleren",
+		"fles",
+		"flets",
+		"fletse",
+		"fleur",
+		"flexie",
+		"flik",
+		"flikje",
+		"flikte",
+		"flink",
+		"flinke",
+		"flip",
+		"flipte",
+		"flirt",
+		"flits",
+		"floep",
+		"floer",
+		"floers",
+		"floot",
+		"flop",
+		"floppy",
+		"flor",
+		"flora",
+		"floret",
+		"floste",
+		"flox",
+		"fluïde",
+		"fluim",
+		"fluit",
+		"fluks",
+		"fluor",
+		"flus",
+		"flut",
+		"flux",
+		"fm",
+		"fn",
+		"fo",
+		"fobie",
+		"focus",
+		"foefje",
+		"foei",
+		"foelie",
+		"foetus",
+		"foezel",
+		"föhn",
+		"föhnde",
+		"föhnen",
+		"fok",
+		"fokken",
+		"fokker",
+		"foksia",
+		"fokte",
+		"fokvee",
+		"folder",
+		"folie",
+		"folies",
+		"folio",
+		"fond",
+		"fonds",
+		"fondue",
+		"foneem",
+		"font",
+		"fooi",
+		"fooien",
+		"foor",
+		"fop",
+		"foppen",
+		"fopte",
+		"fora",
+		"ford",
+		"forel",
+		"foren",
+		"forens",
+		"forint",
+		"forma",
+		"formol",
+		"fors",
+		"forse",
+		"forser",
+		"forsig",
+		"fort",
+		"forten",
+		"forto",
+		"forum",
+		"forums",
+		"fosfor",
+		"foto",
+		"foton",
+		"foto's",
+		"fout",
+		"foute",
+		"fouten",
+		"fouter",
+		"foutje",
+		"fox",
+		"foyer",
+		"foyers",
+		"fp",
+		"fq",
+		"fr",
+		"fraai",
+		"frak",
+		"frame",
+		"frames",
+		"franc",
+		"franco",
+		"franje",
+		"frank",
+		"Frank",
+		"franke",
+		"Frans",
+		"Franse",
+		"frappe",
+		"frase",
+		"frasen",
+		"frases",
+		"frater",
+		"frats",
+		"fraude",
+		"freak",
+		"frees",
+		"fregat",
+		"frêle",
+		"freon",
+		"fresco",
+		"fresia",
+		"fret",
+		"frette",
+		"freule",
+		"frezen",
+		"Fries",
+		"Friese",
+		"friet",
+		"frik",
+		"fris",
+		"frisco",
+		"frisse",
+		"friste",
+		"frites",
+		"frons",
+		"front",
+		"fruit",
+		"fs",
+		"ft",
+		"ftisis",
+		"fu",
+		"fuga",
+		"fuga's",
+		"fuif",
+		"fuifde",
+		"fuik",
+		"fuiken",
+		"fuiven",
+		"fulp",
+		"fulpen",
+		"fundi",
+		"funest",
+		"fungus",
+		"funk",
+		"funky",
+		"furie",
+		"furiën",
+		"furies",
+		"furore",
+		"fusee",
+		"fusie",
+		"fusies",
+		"fust",
+		"fusten",
+		"fut",
+		"futen",
+		"futiel",
+		"fuut",
+		"fv",
+		"fw",
+		"fx",
+		"fy",
+		"fylum",
+		"fysica",
+		"fysici",
+		"fysiek",
+		"fz",
+		"g",
+		"gaaf",
+		"gaai",
+		"gaaien",
+		"gaal",
+		"gaan",
+		"gaande",
+		"gaap",
+		"gaapte",
+		"gaar",
+		"gaard",
+		"gaarde",
+		"gaarne",
+		"gaas",
+		"gaasje",
+		"gaatje",
+		"gabber",
+		"gade",
+		"gaden",
+		"gadget",
+		"gading",
+		"gaf",
+		"gaffe",
+		"gaffel",
+		"gag",
+		"gaga",
+		"gage",
+		"gagel",
+		"gagels",
+		"gages",
+		"gaine",
+		"gajes",
+		"gal",
+		"gala",
+		"galant",
+		"galde",
+		"galei",
+		"galen",
+		"galg",
+		"galgen",
+		"gallen",
+		"gallig",
+		"gallon",
+		"galm",
+		"galmde",
+		"galmei",
+		"galmen",
+		"galmug",
+		"galon",
+		"galons",
+		"galop",
+		"galops",
+		"gamba",
+		"gambir",
+		"game",
+		"gameet",
+		"gamel",
+		"games",
+		"gamma",
+		"gammel",
+		"gander",
+		"gang",
+		"gangen",
+		"gannef",
+		"gans",
+		"ganse",
+		"ganser",
+		"ganzen",
+		"gapen",
+		"gaper",
+		"gapers",
+		"gaping",
+		"gappen",
+		"gapper",
+		"gapte",
+		"garage",
+		"garant",
+		"gard",
+		"garde",
+		"garden",
+		"gardes",
+		"gare",
+		"gareel",
+		"garen",
+		"garens",
+		"garf",
+		"garfde",
+		"garoe",
+		"garve",
+		"garven",
+		"gas",
+		"gasbek",
+		"gasbel",
+		"gaslek",
+		"gasman",
+		"gasnet",
+		"gaspit",
+		"gassen",
+		"gast",
+		"gaste",
+		"gasten",
+		"gat",
+		"gaten",
+		"gatten",
+		"gaucho",
+		"gauw",
+		"gauwer",
+		"gave",
+		"gaven",
+		"gaver",
+		"gay",
+		"gazel",
+		"gazen",
+		"gazet",
+		"gazon",
+		"gazons",
+		"gb",
+		"gc",
+		"gd",
+		"ge",
+		"geaaid",
+		"geaard",
+		"geaasd",
+		"geacht",
+		"geard",
+		"gearmd",
+		"gebaad",
+		"gebaar",
+		"gebaat",
+		"gebak",
+		"gebakt",
+		"gebald",
+		"gebalk",
+		"gebast",
+		"gebed",
+		"gebeft",
+		"gebeid",
+		"gebekt",
+		"gebeld",
+		"gebet",
+		"gebied",
+		"gebigd",
+		"gebijt",
+		"gebikt",
+		"gebild",
+		"gebint",
+		"gebit",
+		"geblaf",
+		"geblèr",
+		"gebluf",
+		"gebobd",
+		"gebod",
+		"geboet",
+		"geboft",
+		"gebokt",
+		"gebold",
+		"gebomd",
+		"gebood",
+		"geboot",
+		"gebost",
+		"gebot",
+		"gebouw",
+		"gebral",
+		"gebrek",
+		"gebrom",
+		"gebrul",
+		"gebuid",
+		"gebukt",
+		"gebult",
+		"gecast",
+		"gedaan",
+		"gedaas",
+		"gedabd",
+		"gedag",
+		"gedamd",
+		"gedane",
+		"gedekt",
+		"gedept",
+		"gedijd",
+		"gedikt",
+		"gedimd",
+		"geding",
+		"gedoe",
+		"gedokt",
+		"gedold",
+		"gedood",
+		"gedopt",
+		"gedord",
+		"gedost",
+		"gedrag",
+		"gedubd",
+		"geduid",
+		"geduld",
+		"gedund",
+		"gedut",
+		"geduwd",
+		"gedwee",
+		"geëbd",
+		"geëcht",
+		"geëerd",
+		"geëest",
+		"geef",
+		"geëgd",
+		"geëind",
+		"geëist",
+		"geel",
+		"geelde",
+		"geen",
+		"geënt",
+		"geep",
+		"geer",
+		"geerde",
+		"geërfd",
+		"geest",
+		"geëtst",
+		"geeuw",
+		"gefaxt",
+		"gefokt",
+		"gefopt",
+		"gefret",
+		"gegaan",
+		"gegald",
+		"gegalm",
+		"gegapt",
+		"gegast",
+		"gegeid",
+		"gegekt",
+		"gegil",
+		"gegild",
+		"gegist",
+		"geglad",
+		"gegoed",
+		"gegokt",
+		"gegomd",
+		"gegons",
+		"gegord",
+		"gegrom",
+		"gegrut",
+		"gegund",
+		"gegymd",
+		"gehaat",
+		"gehad",
+		"gehakt",
+		"gehand",
+		"gehapt",
+		"gehard",
+		"geheel",
+		"geheet",
+		"geheid",
+		"geheim",
+		"geheld",
+		"gehele",
+		"gehemd",
+		"gehijg",
+		"gehikt",
+		"gehipt",
+		"gehoed",
+		"gehokt",
+		"gehold",
+		"gehoon",
+		"gehoor",
+		"gehopt",
+		"gehord",
+		"gehore",
+		"gehort",
+		"gehost",
+		"gehot",
+		"gehuil",
+		"gehukt",
+		"gehuld",
+		"gehumd",
+		"gehupt",
+		"gehuwd",
+		"gei",
+		"geïaad",
+		"geide",
+		"geien",
+		"geijkt",
+		"geijld",
+		"geijsd",
+		"geil",
+		"geile",
+		"geiler",
+		"gein",
+		"geïnd",
+		"geinig",
+		"geïnkt",
+		"geiser",
+		"geisha",
+		"geit",
+		"geiten",
+		"gejank",
+		"gejast",
+		"gejat",
+		"gejij",
+		"gejijd",
+		"gejoel",
+		"gejokt",
+		"gejold",
+		"gejond",
+		"gejou",
+		"gejukt",
+		"gejut",
+		"gek",
+		"gekaft",
+		"gekakt",
+		"gekald",
+		"gekamd",
+		"gekant",
+		"gekapt",
+		"gekard",
+		"gekast",
+		"gekat",
+		"gekeft",
+		"gekend",
+		"gekift",
+		"gekikt",
+		"gekild",
+		"gekimd",
+		"gekipt",
+		"gekird",
+		"gekist",
+		"gekit",
+		"gekke",
+		"gekken",
+		"gekker",
+		"gekkin",
+		"gekko",
+		"geklad",
+		"geklap",
+		"geklit",
+		"geklop",
+		"geknik",
+		"geknot",
+		"gekold",
+		"gekoot",
+		"gekopt",
+		"gekord",
+		"gekort",
+		"gekost",
+		"gekout",
+		"gekte",
+		"gekuch",
+		"gekuip",
+		"gekuld",
+		"gekund",
+		"gekust",
+		"gel",
+		"gelaat",
+		"gelach",
+		"gelag",
+		"gelakt",
+		"gelal",
+		"gelald",
+		"geland",
+		"gelang",
+		"gelapt",
+		"gelast",
+		"gelat",
+		"geld",
+		"gelden",
+		"geldig",
+		"geldla",
+		"gele",
+		"gelede",
+		"gelee",
+		"geleed",
+		"geleek",
+		"gelegd",
+		"gelei",
+		"geleid",
+		"gelekt",
+		"geleld",
+		"gelen",
+		"gelept",
+		"geler",
+		"gelet",
+		"gelid",
+		"gelift",
+		"gelig",
+		"gelige",
+		"gelijk",
+		"gelikt",
+		"gelild",
+		"gelipt",
+		"gelobd",
+		"geloei",
+		"gelogd",
+		"gelokt",
+		"gelold",
+		"gelood",
+		"geloof",
+		"geloop",
+		"geloot",
+		"gelord",
+		"gelost",
+		"gelubd",
+		"gelui",
+		"geluid",
+		"geluk",
+		"gelukt",
+		"gelul",
+		"geluld",
+		"gelust",
+		"geluwd",
+		"gemaal",
+		"gemaft",
+		"gemak",
+		"gemald",
+		"gemand",
+		"gemard",
+		"gemast",
+		"gemat",
+		"gember",
+		"gemeen",
+		"gemekt",
+		"gemeld",
+		"gemend",
+		"gemene",
+		"gemept",
+		"gemest",
+		"gemier",
+		"gemijt",
+		"gemikt",
+		"gemind",
+		"gemis",
+		"gemist",
+		"gemixt",
+		"gemoed",
+		"gemok",
+		"gemokt",
+		"gemold",
+		"gemond",
+		"gemor",
+		"gemord",
+		"gemors",
+		"gemot",
+		"gemout",
+		"gems",
+		"gemuit",
+		"gemunt",
+		"gemzen",
+		"gen",
+		"genade",
+		"gênant",
+		"genard",
+		"genas",
+		"genat",
+		"gene",
+		"gêne",
+		"genekt",
+		"genen",
+		"genept",
+		"genera",
+		"genese",
+		"genet",
+		"genie",
+		"geniën",
+		"geniep",
+		"geniet",
+		"genikt",
+		"genipt",
+		"genist",
+		"genius",
+		"genoeg",
+		"genokt",
+		"genood",
+		"genoom",
+		"genoot",
+		"genopt",
+		"genot",
+		"genre",
+		"genres",
+		"Gent",
+		"genten",
+		"genus",
+		"geoogd",
+		"gepaft",
+		"gepakt",
+		"gepand",
+		"gepapt",
+		"gepast",
+		"gepekt",
+		"gepeld",
+		"gepen",
+		"gepend",
+		"gepest",
+		"gepiep",
+		"gepikt",
+		"gepind",
+		"gepist",
+		"gepit",
+		"geplas",
+		"geplat",
+		"geplet",
+		"gepoft",
+		"gepokt",
+		"gepoot",
+		"gepord",
+		"gepost",
+		"gepot",
+		"gepote",
+		"gepuft",
+		"gepunt",
+		"gepust",
+		"geput",
+		"geraas",
+		"geragd",
+		"geramd",
+		"gerand",
+		"gerant",
+		"gerat",
+		"gered",
+		"gerede",
+		"gereed",
+		"gerei",
+		"gereid",
+		"gerekt",
+		"gereld",
+		"geremd",
+		"geren",
+		"gerend",
+		"gerent",
+		"gerept",
+		"gerest",
+		"geribd",
+		"gerief",
+		"gerij",
+		"gerijd",
+		"gerild",
+		"gering",
+		"gerist",
+		"gerit",
+		"geroep",
+		"gerokt",
+		"gerold",
+		"gerond",
+		"geronk",
+		"geroot",
+		"gerost",
+		"gerot",
+		"gerst",
+		"geruid",
+		"geruim",
+		"geruis",
+		"geruit",
+		"gerukt",
+		"gerund",
+		"gerust",
+		"geruwd",
+		"ges",
+		"gesard",
+		"gesast",
+		"gesel",
+		"gesels",
+		"gesimd",
+		"gesis",
+		"gesist",
+		"gesjot",
+		"gesmet",
+		"gesnap",
+		"gesnor",
+		"gesold",
+		"gesopt",
+		"gesp",
+		"gespan",
+		"gespat",
+		"gespen",
+		"gespet",
+		"gespit",
+		"gespot",
+		"gespte",
+		"gessen",
+		"geste",
+		"gestel",
+		"gestes",
+		"gestie",
+		"gestut",
+		"gesuft",
+		"gesust",
+		"getakt",
+		"getal",
+		"getale",
+		"getalm",
+		"getand",
+		"getapt",
+		"getart",
+		"getast",
+		"geteem",
+		"geteld",
+		"getemd",
+		"getest",
+		"geteut",
+		"getier",
+		"getij",
+		"getik",
+		"getikt",
+		"getild",
+		"getint",
+		"getipt",
+		"getob",
+		"getobd",
+		"getoet",
+		"getold",
+		"getond",
+		"getopt",
+		"getost",
+		"getouw",
+		"getto",
+		"getuft",
+		"getuid",
+		"getuig",
+		"getuit",
+		"getukt",
+		"getypt",
+		"geuit",
+		"geul",
+		"geulen",
+		"geur",
+		"geurde",
+		"geuren",
+		"geurig",
+		"geärmd",
+		"geus",
+		"geut",
+		"geuten",
+		"geuzen",
+		"gevaar",
+		"gevaat",
+		"geval",
+		"gevang",
+		"gevast",
+		"gevat",
+		"gevel",
+		"geveld",
+		"gevels",
+		"geven",
+		"gevent",
+		"gever",
+		"gevers",
+		"gevest",
+		"gevet",
+		"geviel",
+		"gevild",
+		"gevind",
+		"gevist",
+		"gevit",
+		"gevlei",
+		"gevlet",
+		"gevlij",
+		"gevlot",
+		"gevoed",
+		"gevoeg",
+		"gevoel",
+		"gevold",
+		"gevolg",
+		"gevost",
+		"gevrij",
+		"gevuld",
+		"gewaad",
+		"gewaar",
+		"gewag",
+		"gewald",
+		"gewamd",
+		"gewand",
+		"gewant",
+		"geward",
+		"gewas",
+		"gewast",
+		"gewed",
+		"geween",
+		"geweer",
+		"gewei",
+		"geweid",
+		"gewekt",
+		"geweld",
+		"gewelf",
+		"gewend",
+		"gewerd",
+		"gewest",
+		"gewet",
+		"gewied",
+		"gewijd",
+		"gewikt",
+		"gewild",
+		"gewin",
+		"gewipt",
+		"gewis",
+		"gewist",
+		"gewit",
+		"gewoed",
+		"gewoel",
+		"gewon",
+		"gewond",
+		"gewone",
+		"gewoon",
+		"gezaag",
+		"gezag",
+		"gezakt",
+		"gezand",
+		"gezang",
+		"gezant",
+		"gezapt",
+		"gezegd",
+		"gezeik",
+		"gezel",
+		"gezet",
+		"gezeul",
+		"gezeur",
+		"gezien",
+		"gezift",
+		"gezin",
+		"gezind",
+		"gezoem",
+		"gezoet",
+		"gezond",
+		"gezwam",
+		"gezwel",
+		"gf",
+		"gg",
+		"ggg",
+		"gggg",
+		"gh",
+		"ghi",
+		"gi",
+		"gibbon",
+		"gibus",
+		"gids",
+		"gidsen",
+		"giebel",
+		"giek",
+		"gieken",
+		"gier",
+		"gierde",
+		"gieren",
+		"gierig",
+		"gierst",
+		"gieten",
+		"gieter",
+		"gif",
+		"giffen",
+		"gifgas",
+		"gift",
+		"giften",
+		"giftig",
+		"gig",
+		"gigant",
+		"giggen",
+		"gigolo",
+		"gigue",
+		"gij",
+		"gijl",
+		"gijn",
+		"gijnen",
+		"gijpen",
+		"gijpte",
+		"gil",
+		"gild",
+		"gilde",
+		"gilden",
+		"gilet",
+		"gilets",
+		"gillen",
+		"gin",
+		"ginder",
+		"ginds",
+		"gindse",
+		"ging",
+		"ginkgo",
+		"gips",
+		"gipsen",
+		"gipste",
+		"gipsy",
+		"giraal",
+		"giraf",
+		"girale",
+		"girant",
+		"giro",
+		"giro's",
+		"gis",
+		"gispen",
+		"gispte",
+		"gissen",
+		"gist",
+		"giste",
+		"gisten",
+		"gistte",
+		"git",
+		"gitaar",
+		"gitten",
+		"gj",
+		"gk",
+		"gl",
+		"glacé",
+		"glacés",
+		"glacis",
+		"glad",
+		"gladaf",
+		"gladde",
+		"glans",
+		"glas",
+		"glazen",
+		"glazig",
+		"glee",
+		"gleed",
+		"gleeën",
+		"gleis",
+		"gleuf",
+		"glimp",
+		"glip",
+		"glipte",
+		"glit",
+		"globe",
+		"globes",
+		"gloed",
+		"gloor",
+		"gloren",
+		"gloria",
+		"glorie",
+		"glosse",
+		"glossy",
+		"glui",
+		"gluien",
+		"gluren",
+		"gluten",
+		"gluton",
+		"glycol",
+		"gm",
+		"gn",
+		"gneis",
+		"gnoe",
+		"gnomen",
+		"gnomon",
+		"gnoom",
+		"gnosis",
+		"go",
+		"goal",
+		"goalie",
+		"gocart",
+		"God",
+		"goden",
+		"godin",
+		"godlof",
+		"goed",
+		"goede",
+		"goeden",
+		"goedig",
+		"goedje",
+		"goeiig",
+		"goeman",
+		"goeroe",
+		"gojim",
+		"gojims",
+		"gojs",
+		"gok",
+		"gokhal",
+		"gokken",
+		"gokker",
+		"gokte",
+		"golem",
+		"golems",
+		"golf",
+		"golfde",
+		"golfen",
+		"golven",
+		"gom",
+		"gombal",
+		"gomde",
+		"gommen",
+		"gompie",
+		"gonade",
+		"gondel",
+		"gong",
+		"gons",
+		"gonsde",
+		"gonzen",
+		"goog",
+		"gooi",
+		"gooide",
+		"gooien",
+		"goor",
+		"goot",
+		"gordde",
+		"gordel",
+		"gorden",
+		"gore",
+		"gorgel",
+		"gorig",
+		"gorige",
+		"gors",
+		"gort",
+		"gorten",
+		"gorter",
+		"gortig",
+		"gorzen",
+		"gospel",
+		"gossip",
+		"goten",
+		"gotiek",
+		"gotspe",
+		"goud",
+		"gouden",
+		"gouw",
+		"gouwe",
+		"gouwen",
+		"gozer",
+		"gozers",
+		"gp",
+		"gq",
+		"gr",
+		"graad",
+		"graaf",
+		"graag",
+		"graai",
+		"graal",
+		"graan",
+		"graat",
+		"gracht",
+		"graden",
+		"graeci",
+		"graf",
+		"grafie",
+		"grage",
+		"grager",
+		"gram",
+		"gramme",
+		"grand",
+		"grande",
+		"grands",
+		"granen",
+		"grap",
+		"gras",
+		"graten",
+		"gratie",
+		"gratig",
+		"gratis",
+		"grauw",
+		"grauwe",
+		"gravel",
+		"graven",
+		"graver",
+		"gravin",
+		"grazen",
+		"grazig",
+		"grebbe",
+		"green",
+		"greep",
+		"grein",
+		"grenen",
+		"grens",
+		"grepen",
+		"gres",
+		"gretig",
+		"gribus",
+		"grief",
+		"Griek",
+		"Grieks",
+		"griel",
+		"griend",
+		"griep",
+		"gries",
+		"griet",
+		"grieve",
+		"grif",
+		"griffe",
+		"grift",
+		"grifte",
+		"grijns",
+		"grijp",
+		"grijs",
+		"grijze",
+		"gril",
+		"grilde",
+		"grill",
+		"grille",
+		"grim",
+		"grimas",
+		"grimde",
+		"grime",
+		"grimes",
+		"grind",
+		"grip",
+		"grise",
+		"grises",
+		"griste",
+		"grit",
+		"groef",
+		"groei",
+		"groen",
+		"groene",
+		"groep",
+		"groet",
+		"groeve",
+		"grof",
+		"grofte",
+		"grog",
+		"groggy",
+		"grol",
+		"grolde",
+		"grom",
+		"gromde",
+		"grond",
+		"gronde",
+		"groot",
+		"groots",
+		"gros",
+		"grosse",
+		"grosso",
+		"grot",
+		"grote",
+		"groten",
+		"groter",
+		"grove",
+		"grover",
+		"gruis",
+		"grunge",
+		"grut",
+		"grutte",
+		"grutto",
+		"gruwde",
+		"gruwel",
+		"gruwen",
+		"gs",
+		"gt",
+		"gu",
+		"guano",
+		"guit",
+		"guiten",
+		"guitig",
+		"gul",
+		"gulden",
+		"gulle",
+		"gullen",
+		"guller",
+		"gulp",
+		"gulpen",
+		"gulpte",
+		"gulzig",
+		"gum",
+		"gumde",
+		"gummen",
+		"gummi",
+		"gunde",
+		"gunnen",
+		"gunst",
+		"gup",
+		"guppy",
+		"gure",
+		"gust",
+		"guts",
+		"gutsen",
+		"gutste",
+		"guur",
+		"gv",
+		"gw",
+		"gx",
+		"gy",
+		"gym",
+		"gymde",
+		"gymmen",
+		"gymp",
+		"gympie",
+		"gz",
+		"h",
+		"haaf",
+		"haagde",
+		"haai",
+		"haaide",
+		"haaien",
+		"haaiig",
+		"haak",
+		"haaks",
+		"haakse",
+		"haakte",
+		"haal",
+		"haalde",
+		"haam",
+		"haan",
+		"haar",
+		"haard",
+		"haarde",
+		"haas",
+		"haast",
+		"haat",
+		"haatte",
+		"habijt",
+		"hachee",
+		"hachje",
+		"hacken",
+		"hadith",
+		"hadji",
+		"hadzji",
+		"haf",
+		"haffen",
+		"haft",
+		"haften",
+		"hagel",
+		"hagen",
+		"haiku",
+		"hak",
+		"haken",
+		"hakken",
+		"hakker",
+		"hakmes",
+		"haksel",
+		"hakte",
+		"hal",
+		"halen",
+		"half",
+		"halfje",
+		"hall",
+		"hallen",
+		"hallo",
+		"halm",
+		"halma",
+		"halmen",
+		"halo",
+		"hals",
+		"halsde",
+		"halt",
+		"halte",
+		"halten",
+		"halter",
+		"haltes",
+		"halve",
+		"halzen",
+		"ham",
+		"hamei",
+		"hamel",
+		"hamels",
+		"hamen",
+		"hamer",
+		"hamers",
+		"hamlap",
+		"hammen",
+		"hand",
+		"handde",
+		"handel",
+		"handen",
+		"handig",
+		"handje",
+		"hanen",
+		"hang",
+		"hangar",
+		"hangel",
+		"hangen",
+		"hanger",
+		"hangop",
+		"hanig",
+		"hanige",
+		"hannes",
+		"hans",
+		"hansop",
+		"Hanze",
+		"hanzen",
+		"hap",
+		"hapax",
+		"hapje",
+		"hapjes",
+		"happen",
+		"happig",
+		"happy",
+		"hapte",
+		"har",
+		"hard",
+		"hardde",
+		"harde",
+		"harden",
+		"harder",
+		"hardop",
+		"harem",
+		"harems",
+		"haren",
+		"harent",
+		"harig",
+		"harige",
+		"haring",
+		"hark",
+		"harken",
+		"harkte",
+		"harnas",
+		"harp",
+		"harpen",
+		"harpij",
+		"harpte",
+		"harre",
+		"harrel",
+		"harren",
+		"hars",
+		"harsen",
+		"harsig",
+		"harst",
+		"hart",
+		"harte",
+		"harten",
+		"hartig",
+		"hartje",
+		"hasj",
+		"haspel",
+		"haten",
+		"hater",
+		"haters",
+		"hausse",
+		"haute",
+		"hauw",
+		"hauwen",
+		"have",
+		"haven",
+		"havens",
+		"haver",
+		"havik",
+		"havo",
+		"hazard",
+		"hazen",
+		"hb",
+		"hc",
+		"hd",
+		"he",
+		"heat",
+		"heavy",
+		"heb",
+		"hebben",
+		"hebbes",
+		"hecht",
+		"hechte",
+		"heden",
+		"heef",
+		"heeft",
+		"heel",
+		"heelal",
+		"heelde",
+		"heem",
+		"heemst",
+		"heen",
+		"heep",
+		"heer",
+		"hees",
+		"heet",
+		"heette",
+		"hef",
+		"heffe",
+		"heffen",
+		"heft",
+		"heften",
+		"heftig",
+		"heg",
+		"hegge",
+		"heggen",
+		"hegje",
+		"hei",
+		"heibel",
+		"heide",
+		"heiden",
+		"heien",
+		"heiig",
+		"heiige",
+		"heikel",
+		"heil",
+		"heilig",
+		"Hein",
+		"heinde",
+		"heisa",
+		"heitje",
+		"hek",
+		"hekel",
+		"hekels",
+		"hekken",
+		"heks",
+		"heksen",
+		"hekste",
+		"hel",
+		"hela",
+		"helaas",
+		"held",
+		"helde",
+		"helden",
+		"helder",
+		"heldin",
+		"hele",
+		"helen",
+		"heler",
+		"helers",
+		"helft",
+		"heli",
+		"heling",
+		"helium",
+		"helix",
+		"helle",
+		"hellen",
+		"heller",
+		"helm",
+		"helmen",
+		"heloot",
+		"helpen",
+		"helper",
+		"helpt",
+		"hels",
+		"helse",
+		"hem",
+		"he-man",
+		"hemd",
+		"hemde",
+		"hemden",
+		"hemel",
+		"hemels",
+		"hemen",
+		"hemmen",
+		"hen",
+		"hendel",
+		"henen",
+		"heng",
+		"hengel",
+		"hengen",
+		"hengst",
+		"henna",
+		"hennen",
+		"hennep",
+		"hens",
+		"hepen",
+		"her",
+		"heraut",
+		"herder",
+		"heren",
+		"herfst",
+		"hergaf",
+		"herig",
+		"herik",
+		"herlas",
+		"hernam",
+		"hernia",
+		"heroën",
+		"heros",
+		"herpes",
+		"herren",
+		"herrie",
+		"hert",
+		"herten",
+		"hertog",
+		"hertz",
+		"hervat",
+		"herwon",
+		"herzag",
+		"hes",
+		"hese",
+		"heser",
+		"hesp",
+		"hespen",
+		"hessen",
+		"het",
+		"hete",
+		"heten",
+		"heter",
+		"hetero",
+		"hetze",
+		"hetzij",
+		"heug",
+		"heugde",
+		"heugel",
+		"heugen",
+		"heul",
+		"heulde",
+		"heulen",
+		"heup",
+		"heupen",
+		"heus",
+		"heuse",
+		"heuser",
+		"heuvel",
+		"hevea",
+		"hevel",
+		"hevels",
+		"hevig",
+		"hevige",
+		"hf",
+		"hg",
+		"hh",
+		"hhh",
+		"hhhh",
+		"hi",
+		"hiaat",
+		"hiaten",
+		"hiel",
+		"hield",
+		"hielde",
+		"hielen",
+		"hielp",
+		"hier",
+		"hieraf",
+		"hierin",
+		"hierna",
+		"hierom",
+		"hierop",
+		"hifi",
+		"high",
+		"hij",
+		"hij",
+		"hijgde",
+		"hijgen",
+		"hijger",
+		"hijs",
+		"hijsen",
+		"hik",
+		"hikken",
+		"hikte",
+		"hinde",
+		"hinden",
+		"hinder",
+		"Hindoe",
+		"hing",
+		"hinken",
+		"hinkte",
+		"hint",
+		"hinten",
+		"hip",
+		"hiphop",
+		"hippe",
+		"hippen",
+		"hippie",
+		"hipte",
+		"hit",
+		"hitsig",
+		"hitte",
+		"hitten",
+		"hj",
+		"hk",
+		"hl",
+		"hm",
+		"hn",
+		"ho",
+		"hobbel",
+		"hobby",
+		"hobo",
+		"hoc",
+		"hockey",
+		"hoe",
+		"hoed",
+		"hoedde",
+		"hoede",
+		"hoeden",
+		"hoeder",
+		"hoef",
+		"hoefde",
+		"hoek",
+		"hoeken",
+		"hoeker",
+		"hoekig",
+		"hoeks",
+		"hoekse",
+		"hoekte",
+		"hoempa",
+		"hoen",
+		"hoep",
+		"hoepel",
+		"hoepen",
+		"hoepla",
+		"hoer",
+		"hoera",
+		"hoerde",
+		"hoeren",
+		"hoerig",
+		"hoes",
+		"hoest",
+		"hoeve",
+		"hoeven",
+		"hoever",
+		"hoewel",
+		"hoezee",
+		"hoezen",
+		"hoezo",
+		"hof",
+		"hofje",
+		"hofjes",
+		"hofnar",
+		"hoge",
+		"hogen",
+		"hoger",
+		"hoging",
+		"hoi",
+		"hok",
+		"hokken",
+		"hokte",
+		"hol",
+		"hola",
+		"holde",
+		"hole",
+		"holen",
+		"holist",
+		"holle",
+		"hollen",
+		"holler",
+		"holte",
+		"holten",
+		"holtes",
+		"hom",
+		"home",
+		"hommel",
+		"hommen",
+		"hommer",
+		"homo",
+		"homo's",
+		"homp",
+		"hompen",
+		"hond",
+		"honden",
+		"honds",
+		"hondse",
+		"honen",
+		"honend",
+		"honger",
+		"honig",
+		"honing",
+		"honk",
+		"honken",
+		"honkte",
+		"hoofd",
+		"hoofde",
+		"hoofs",
+		"hoofse",
+		"hoog",
+		"hoogde",
+		"hoogst",
+		"hoogte",
+		"hooi",
+		"hooide",
+		"hooien",
+		"hooier",
+		"hooked",
+		"hoon",
+		"hoonde",
+		"hoop",
+		"hoopte",
+		"hoor",
+		"hoorde",
+		"hoorn",
+		"hoos",
+		"hoosde",
+		"hop",
+		"hope",
+		"hopen",
+		"hopla",
+		"hopman",
+		"hoppe",
+		"hoppen",
+		"hopper",
+		"hopsa",
+		"hopte",
+		"hor",
+		"hordde",
+		"horde",
+		"horden",
+		"hordes",
+		"horeca",
+		"horen",
+		"horens",
+		"horig",
+		"horige",
+		"hork",
+		"horken",
+		"hormon",
+		"horren",
+		"horror",
+		"hors",
+		"horsen",
+		"horst",
+		"hort",
+		"horten",
+		"hortte",
+		"hortus",
+		"horzel",
+		"horzen",
+		"hospes",
+		"hospik",
+		"hossen",
+		"hoste",
+		"hostel",
+		"hostie",
+		"hot",
+		"hotdog",
+		"hotel",
+		"hotels",
+		"hotsen",
+		"hotste",
+		"hotte",
+		"hotten",
+		"hou",
+		"houden",
+		"houder",
+		"house",
+		"housen",
+		"hout",
+		"houten",
+		"houtig",
+		"houtje",
+		"houw",
+		"houwen",
+		"houwer",
+		"hoven",
+		"hoving",
+		"hozen",
+		"hp",
+		"hq",
+		"hr",
+		"hs",
+		"ht",
+		"hu",
+		"hui",
+		"huid",
+		"huiden",
+		"huidig",
+		"huif",
+		"huifde",
+		"huig",
+		"huigen",
+		"huik",
+		"huiken",
+		"huilde",
+		"huilen",
+		"huiler",
+		"huis",
+		"huisde",
+		"huisje",
+		"huiven",
+		"huize",
+		"huizen",
+		"hukken",
+		"hukte",
+		"hul",
+		"hulde",
+		"hulk",
+		"hulken",
+		"hullen",
+		"hulp",
+		"hulpen",
+		"huls",
+		"hulsel",
+		"hulst",
+		"hulzen",
+		"hum",
+		"humaan",
+		"humane",
+		"humbug",
+		"humde",
+		"humeur",
+		"hummel",
+		"hummen",
+		"humor",
+		"humus",
+		"hun",
+		"hunne",
+		"hunnen",
+		"hup",
+		"huppen",
+		"hups",
+		"hupse",
+		"hupte",
+		"huren",
+		"hurken",
+		"hurkte",
+		"husky",
+		"hut",
+		"hutje",
+		"hutten",
+		"huur",
+		"huurde",
+		"huwde",
+		"huwen",
+		"huzaar",
+		"hv",
+		"hw",
+		"hx",
+		"hy",
+		"hybris",
+		"hydra",
+		"hyena",
+		"hymen",
+		"hymens",
+		"hymne",
+		"hymnen",
+		"hype",
+		"hypo",
+		"hysop",
+		"hz",
+		"i",
+		"iade",
+		"iaën",
+		"ib",
+		"ibidem",
+		"ibis",
+		"ic",
+		"icing",
+		"iconen",
+		"icoon",
+		"id",
+		"ideaal",
+		"ideale",
+		"idee",
+		"ideëel",
+		"ideeën",
+		"ideële",
+		"idem",
+		"idioom",
+		"idioot",
+		"idiote",
+		"idolen",
+		"idool",
+		"idylle",
+		"ie",
+		"iebel",
+		"ieder",
+		"iedere",
+		"iel",
+		"iele",
+		"iemand",
+		"iemker",
+		"iep",
+		"iepen",
+		"Ier",
+		"Ieren",
+		"Iers",
+		"Ierse",
+		"iet",
+		"iets",
+		"ietsje",
+		"ietwat",
+		"if",
+		"ig",
+		"iglo",
+		"i-grec",
+		"ih",
+		"ii",
+		"iii",
+		"iiii",
+		"ij",
+		"ijdel",
+		"ijdele",
+		"ijk",
+		"ijk",
+		"ijken",
+		"ijker",
+		"ijkers",
+		"ijking",
+		"ijkte",
+		"ijl",
+		"ijlde",
+		"ijle",
+		"ijlen",
+		"ijler",
+		"ijs",
+		"ijsco",
+		"ijsde",
+		"ijsje",
+		"ijsjes",
+		"ijskap",
+		"ijszak",
+		"ijszee",
+		"ijver",
+		"ijzel",
+		"ijzen",
+		"ijzer",
+		"ijzers",
+		"ijzig",
+		"ijzige",
+		"ik",
+		"ikzelf",
+		"il",
+		"Ilias",
+		"im",
+		"image",
+		"imago",
+		"imam",
+		"imker",
+		"imkers",
+		"immens",
+		"immer",
+		"immers",
+		"immune",
+		"immuun",
+		"impact",
+		"impala",
+		"import",
+		"impost",
+		"impuls",
+		"in",
+		"inbaar",
+		"inbare",
+		"inca",
+		"incest",
+		"inch",
+		"inches",
+		"inde",
+		"index",
+		"indien",
+		"Indiër",
+		"indigo",
+		"Indo",
+		"indoen",
+		"Indo's",
+		"indruk",
+		"indult",
+		"ineen",
+		"ineens",
+		"inert",
+		"inerte",
+		"infaam",
+		"infame",
+		"infant",
+		"info",
+		"infuus",
+		"ingaan",
+		"ingang",
+		"ingoed",
+		"ingooi",
+		"inham",
+		"inhoud",
+		"inkeep",
+		"inkeer",
+		"inkijk",
+		"inkom",
+		"inkoop",
+		"inkoud",
+		"inkt",
+		"inkten",
+		"inktte",
+		"inlaag",
+		"inlaat",
+		"inlage",
+		"inlas",
+		"inlaut",
+		"inleg",
+		"inloop",
+		"inmaak",
+		"inname",
+		"innen",
+		"innig",
+		"innige",
+		"inning",
+		"input",
+		"inrit",
+		"inruil",
+		"insect",
+		"inslag",
+		"insult",
+		"intact",
+		"intake",
+		"intens",
+		"intern",
+		"intiem",
+		"intimi",
+		"intree",
+		"intrek",
+		"intro",
+		"intron",
+		"inval",
+		"invers",
+		"invert",
+		"invite",
+		"invité",
+		"invoer",
+		"inworp",
+		"inzage",
+		"inzake",
+		"inzet",
+		"inzien",
+		"io",
+		"ion",
+		"ionen",
+		"ip",
+		"iq",
+		"ir",
+		"iris",
+		"ironie",
+		"is",
+		"islam",
+		"isme",
+		"ismen",
+		"ismes",
+		"issue",
+		"issues",
+		"it",
+		"item",
+		"iu",
+		"iv",
+		"ivoor",
+		"ivoren",
+		"Ivriet",
+		"iw",
+		"ix",
+		"iy",
+		"iz",
+		"j",
+		"jaagde",
+		"jaap",
+		"jaapte",
+		"jaar",
+		"jabot",
+		"jabots",
+		"jacht",
+		"jack",
+		"jacket",
+		"jade",
+		"jaeger",
+		"jagen",
+		"jager",
+		"jagers",
+		"jaguar",
+		"Jahwe",
+		"Jahweh",
+		"jajem",
+		"jak",
+		"jakken",
+		"jakkes",
+		"jam",
+		"jambe",
+		"jamben",
+		"jammen",
+		"jammer",
+		"jampot",
+		"jan",
+		"janhen",
+		"janken",
+		"jankte",
+		"jannen",
+		"jantje",
+		"janus",
+		"Jap",
+		"Japans",
+		"japen",
+		"japon",
+		"Jappen",
+		"jaren",
+		"jargon",
+		"jarig",
+		"jarige",
+		"jas",
+		"jaspis",
+		"jassen",
+		"jaste",
+		"jaszak",
+		"jat",
+		"jatte",
+		"jatten",
+		"Javaan",
+		"jawel",
+		"jazz",
+		"jazzy",
+		"jb",
+		"jc",
+		"jd",
+		"je",
+		"jeans",
+		"jeep",
+		"jegens",
+		"Jehova",
+		"jein",
+		"jekker",
+		"jelui",
+		"jengel",
+		"jennen",
+		"jersey",
+		"jet",
+		"jetlag",
+		"jetset",
+		"jetski",
+		"jeu",
+		"jeugd",
+		"jeuïg",
+		"jeuk",
+		"jeuken",
+		"jeukte",
+		"jezelf",
+		"jf",
+		"jg",
+		"jh",
+		"ji",
+		"jicht",
+		"jij",
+		"jijde",
+		"jijen",
+		"jingle",
+		"jive",
+		"jj",
+		"jjj",
+		"jjjj",
+		"jk",
+		"jkl",
+		"jl",
+		"jm",
+		"jn",
+		"jo",
+		"Job",
+		"jochie",
+		"jockey",
+		"joden",
+		"jodide",
+		"jodin",
+		"jodium",
+		"joeg",
+		"joekel",
+		"joelde",
+		"joelen",
+		"joep",
+		"joetje",
+		"jofel",
+		"joggen",
+		"jogger",
+		"joh",
+		"joint",
+		"jojo",
+		"jojoën",
+		"jok",
+		"joke",
+		"joker",
+		"jokers",
+		"jokken",
+		"jokte",
+		"jol",
+		"jolde",
+		"jolen",
+		"jolig",
+		"jolige",
+		"jolijt",
+		"jollen",
+		"Jonas",
+		"jonde",
+		"jonen",
+		"jong",
+		"jongde",
+		"jonge",
+		"jongen",
+		"jonger",
+		"jongs",
+		"jonk",
+		"jonken",
+		"jonker",
+		"jonnen",
+		"jood",
+		"joods",
+		"joodse",
+		"jool",
+		"joolde",
+		"joon",
+		"joop",
+		"Joost",
+		"jopen",
+		"jota",
+		"jou",
+		"joule",
+		"jour",
+		"jouw",
+		"jouwde",
+		"jouwen",
+		"joyeus",
+		"jozef",
+		"jp",
+		"jq",
+		"jr",
+		"js",
+		"jt",
+		"ju",
+		"jubel",
+		"judas",
+		"judo",
+		"judoën",
+		"judoka",
+		"juf",
+		"juffen",
+		"juffer",
+		"juffie",
+		"juist",
+		"juiste",
+		"jujube",
+		"juk",
+		"jukken",
+		"jukte",
+		"juli",
+		"jullie",
+		"jumbo",
+		"jumper",
+		"jungle",
+		"juni",
+		"junior",
+		"junk",
+		"junkie",
+		"junta",
+		"Jura",
+		"jurist",
+		"jurk",
+		"jurken",
+		"jury",
+		"jury's",
+		"jus",
+		"juskom",
+		"jut",
+		"jute",
+		"juten",
+		"jutte",
+		"jutten",
+		"jutter",
+		"juweel",
+		"jv",
+		"jw",
+		"jx",
+		"jy",
+		"jz",
+		"k",
+		"kaag",
+		"kaai",
+		"kaaide",
+		"kaaien",
+		"kaak",
+		"kaakje",
+		"kaakte",
+		"kaal",
+		"kaalte",
+		"kaam",
+		"kaamde",
+		"kaan",
+		"kaap",
+		"kaapte",
+		"kaar",
+		"kaard",
+		"kaarde",
+		"kaars",
+		"kaart",
+		"kaas",
+		"kaasde",
+		"kaats",
+		"kabaai",
+		"kabaal",
+		"kabaja",
+		"kabas",
+		"kabel",
+		"kabels",
+		"kachel",
+		"kade",
+		"kadee",
+		"kadees",
+		"kaden",
+		"kader",
+		"kaders",
+		"kadi",
+		"kaduke",
+		"kaduuk",
+		"kaf",
+		"kaffa",
+		"kaffer",
+		"kaft",
+		"kaftan",
+		"kaften",
+		"kaftte",
+		"kafzak",
+		"kagen",
+		"kaön",
+		"kaöns",
+		"kajak",
+		"kajaks",
+		"kajuit",
+		"kak",
+		"kakel",
+		"kakels",
+		"kaken",
+		"kaki",
+		"kakken",
+		"kakte",
+		"kalbas",
+		"kalde",
+		"kale",
+		"kalen",
+		"kaler",
+		"kalf",
+		"kalfde",
+		"kalfje",
+		"kali",
+		"kalief",
+		"kali's",
+		"kalium",
+		"kalk",
+		"kalkei",
+		"kalken",
+		"kalkte",
+		"kalle",
+		"kallen",
+		"kalm",
+		"kalme",
+		"kalmer",
+		"kalmte",
+		"kalot",
+		"kalven",
+		"kam",
+		"kamde",
+		"kameel",
+		"kamen",
+		"kamer",
+		"kamers",
+		"kamfer",
+		"kamig",
+		"kammen",
+		"kamp",
+		"kampen",
+		"kamper",
+		"kampte",
+		"kamrad",
+		"kan",
+		"kanaal",
+		"kanaat",
+		"kandij",
+		"kaneel",
+		"kanen",
+		"kanis",
+		"kanjer",
+		"kanji",
+		"kanker",
+		"kannen",
+		"kano",
+		"kanode",
+		"kanoën",
+		"kanoër",
+		"kanoet",
+		"kanon",
+		"kans",
+		"kansel",
+		"kansen",
+		"kant",
+		"kanten",
+		"kantig",
+		"kantje",
+		"kanton",
+		"kantte",
+		"kap",
+		"kapel",
+		"kapen",
+		"kaper",
+		"kapers",
+		"kapje",
+		"kapjes",
+		"kapmes",
+		"kapoen",
+		"kapok",
+		"kapot",
+		"kappa",
+		"kappen",
+		"kapper",
+		"kapsel",
+		"kapte",
+		"kar",
+		"karaat",
+		"karaf",
+		"karate",
+		"karde",
+		"karen",
+		"karet",
+		"karig",
+		"karige",
+		"karkas",
+		"karma",
+		"karn",
+		"karnde",
+		"karnen",
+		"karos",
+		"karot",
+		"karper",
+		"karpet",
+		"karren",
+		"kartel",
+		"karton",
+		"karwei",
+		"karwij",
+		"kas",
+		"kasba",
+		"kashba",
+		"kassa",
+		"kassei",
+		"kassen",
+		"kast",
+		"kaste",
+		"kasten",
+		"kastie",
+		"kat",
+		"kater",
+		"katern",
+		"katers",
+		"kation",
+		"katje",
+		"katjes",
+		"katoen",
+		"katoog",
+		"katrol",
+		"katte",
+		"katten",
+		"kattig",
+		"kattin",
+		"katuil",
+		"katvis",
+		"kauri",
+		"kauw",
+		"kauwde",
+		"kauwen",
+		"kavel",
+		"kavels",
+		"kazak",
+		"kazen",
+		"kb",
+		"kc",
+		"kd",
+		"ke",
+		"kebab",
+		"kebon",
+		"kebons",
+		"keek",
+		"keel",
+		"keelde",
+		"keen",
+		"keende",
+		"keep",
+		"keepen",
+		"keeper",
+		"keepte",
+		"keer",
+		"keerde",
+		"kees",
+		"keet",
+		"keffen",
+		"keffer",
+		"kefir",
+		"kefte",
+		"keg",
+		"kegel",
+		"kegels",
+		"kegge",
+		"keggen",
+		"kegje",
+		"kei",
+		"keien",
+		"keikop",
+		"keilde",
+		"keilen",
+		"keitje",
+		"keizer",
+		"kek",
+		"keker",
+		"kekers",
+		"kelder",
+		"kelen",
+		"kelim",
+		"kelk",
+		"kelken",
+		"kelner",
+		"kelp",
+		"kelt",
+		"kelten",
+		"kemel",
+		"kemels",
+		"kemp",
+		"kempen",
+		"kenau",
+		"kende",
+		"kenen",
+		"kennel",
+		"kennen",
+		"kenner",
+		"kennis",
+		"kepen",
+		"keper",
+		"kepers",
+		"kepie",
+		"kepies",
+		"kerel",
+		"kerels",
+		"keren",
+		"kerf",
+		"kerfde",
+		"kering",
+		"kerk",
+		"kerken",
+		"kerker",
+		"kerks",
+		"kerkse",
+		"kerkte",
+		"kermde",
+		"kermen",
+		"kermes",
+		"Kermis",
+		"kern",
+		"kernen",
+		"kerrie",
+		"kers",
+		"kersen",
+		"kerst",
+		"kervel",
+		"kerven",
+		"kesp",
+		"kespen",
+		"ketel",
+		"ketels",
+		"keten",
+		"ketens",
+		"ketjap",
+		"ketje",
+		"ketjes",
+		"kets",
+		"ketsen",
+		"ketste",
+		"ketter",
+		"keu",
+		"keuken",
+		"Keuls",
+		"Keulse",
+		"keur",
+		"keurde",
+		"keuren",
+		"keurig",
+		"keurs",
+		"keus",
+		"keutel",
+		"keuter",
+		"keuvel",
+		"keuze",
+		"keuzen",
+		"keuzes",
+		"kevel",
+		"kevels",
+		"kever",
+		"kevers",
+		"kevie",
+		"kevies",
+		"kezen",
+		"kf",
+		"kg",
+		"kh",
+		"khmer",
+		"ki",
+		"kick",
+		"kicken",
+		"kief",
+		"kiek",
+		"kieken",
+		"kiekje",
+		"kiekte",
+		"kiel",
+		"kielde",
+		"kielen",
+		"kiem",
+		"kiemde",
+		"kiemen",
+		"kien",
+		"kiende",
+		"kiene",
+		"kienen",
+		"kiep",
+		"kiepen",
+		"kier",
+		"kierde",
+		"kieren",
+		"kies",
+		"kiese",
+		"kieuw",
+		"kievit",
+		"kiezel",
+		"kiezen",
+		"kiezer",
+		"kift",
+		"kiften",
+		"kiftte",
+		"kijf",
+		"kijk",
+		"kijken",
+		"kijker",
+		"kijven",
+		"kik",
+		"kikken",
+		"kikker",
+		"kikte",
+		"kil",
+		"kilde",
+		"kille",
+		"killen",
+		"killer",
+		"kilo",
+		"kilo's",
+		"kilt",
+		"kilte",
+		"kim",
+		"kimde",
+		"kimme",
+		"kimmen",
+		"kimono",
+		"kin",
+		"kina",
+		"kinase",
+		"kind",
+		"kindje",
+		"kinds",
+		"kindse",
+		"kinema",
+		"kinine",
+		"kink",
+		"kinkel",
+		"kinken",
+		"kinnen",
+		"kiosk",
+		"kip",
+		"kipbak",
+		"kipkap",
+		"kipkar",
+		"kippen",
+		"kippig",
+		"kipte",
+		"kirde",
+		"kirren",
+		"kirsch",
+		"kissen",
+		"kist",
+		"kiste",
+		"kisten",
+		"kistje",
+		"kistte",
+		"kit",
+		"kits",
+		"kitsch",
+		"kitsen",
+		"kitste",
+		"kitte",
+		"kitten",
+		"kittig",
+		"kiwi",
+		"kiwi's",
+		"kj",
+		"kk",
+		"kkk",
+		"kkkk",
+		"kl",
+		"klaar",
+		"klaas",
+		"klabak",
+		"klacht",
+		"klad",
+		"kladde",
+		"kladje",
+		"klagen",
+		"klager",
+		"klak",
+		"klakte",
+		"klam",
+		"klamme",
+		"klamp",
+		"klank",
+		"klant",
+		"klap",
+		"klapte",
+		"klare",
+		"klaren",
+		"klas",
+		"klasse",
+		"klauw",
+		"klaver",
+		"klazen",
+		"kleden",
+		"kledij",
+		"kleed",
+		"kleef",
+		"klef",
+		"kleffe",
+		"klei",
+		"kleide",
+		"kleien",
+		"kleiig",
+		"klein",
+		"kleine",
+		"klem",
+		"klemde",
+		"klep",
+		"klepel",
+		"klepte",
+		"kleren",
+		"klerk",
+		"klets",
+		"kleun",
+		"kleur",
+		"kleven",
+		"klever",
+		"kliek",
+		"klier",
+		"klif",
+		"klik",
+		"klikte",
+		"klim",
+		"klimop",
+		"kling",
+		"klink",
+		"klip",
+		"klis",
+		"kliste",
+		"klit",
+		"klitte",
+		"klm",
+		"klodde",
+		"kloef",
+		"kloek",
+		"kloeke",
+		"kloet",
+		"klok",
+		"klokje",
+		"klokke",
+		"klokte",
+		"klom",
+		"klomp",
+		"klonen",
+		"klonk",
+		"klont",
+		"kloof",
+		"kloon",
+		"kloot",
+		"klop",
+		"klopje",
+		"klopte",
+		"klos",
+		"kloste",
+		"kloten",
+		"klove",
+		"kloven",
+		"klucht",
+		"kluft",
+		"kluif",
+		"kluis",
+		"kluit",
+		"klunen",
+		"kluns",
+		"klus",
+		"kluts",
+		"kluwen",
+		"klysma",
+		"km",
+		"kn",
+		"knaak",
+		"knaap",
+		"knagen",
+		"knak",
+		"knaken",
+		"knakte",
+		"knal",
+		"knalde",
+		"knap",
+		"knapen",
+		"knappe",
+		"knapte",
+		"knar",
+		"knauw",
+		"knecht",
+		"kneden",
+		"kneep",
+		"knekel",
+		"knel",
+		"knelde",
+		"knepen",
+		"kneu",
+		"kneuen",
+		"kneus",
+		"knevel",
+		"knie",
+		"knieën",
+		"knier",
+		"knijp",
+		"knik",
+		"knikte",
+		"knip",
+		"knipte",
+		"knoei",
+		"knoest",
+		"knoet",
+		"knok",
+		"knoken",
+		"knokig",
+		"knokte",
+		"knol",
+		"knook",
+		"knoop",
+		"knop",
+		"knopen",
+		"knopig",
+		"knopte",
+		"knor",
+		"knorde",
+		"knorf",
+		"knot",
+		"knotje",
+		"knots",
+		"knotte",
+		"knudde",
+		"knuist",
+		"knul",
+		"knus",
+		"knusse",
+		"ko",
+		"koala",
+		"kobalt",
+		"kobbe",
+		"kobben",
+		"kobold",
+		"kocht",
+		"kodak",
+		"kodaks",
+		"kodde",
+		"kodden",
+		"koddig",
+		"koe",
+		"koedoe",
+		"koeien",
+		"koek",
+		"koeken",
+		"koekje",
+		"koekte",
+		"koel",
+		"koelak",
+		"koelde",
+		"koele",
+		"koelen",
+		"koeler",
+		"koelie",
+		"koelte",
+		"koen",
+		"koene",
+		"koepel",
+		"koepok",
+		"koer",
+		"koerde",
+		"koeren",
+		"koers",
+		"koest",
+		"koet",
+		"koeten",
+		"koetje",
+		"koets",
+		"kof",
+		"koffen",
+		"koffer",
+		"koffie",
+		"kogel",
+		"kogels",
+		"kogen",
+		"kogge",
+		"koggen",
+		"kohier",
+		"koine",
+		"kok",
+		"koken",
+		"kokend",
+		"koker",
+		"kokers",
+		"koket",
+		"kokkel",
+		"kokker",
+		"kokkie",
+		"kokkin",
+		"kokos",
+		"kol",
+		"kola",
+		"kolbak",
+		"kolde",
+		"kolder",
+		"kolen",
+		"kolf",
+		"kolfde",
+		"kolfje",
+		"koliek",
+		"kolk",
+		"kolken",
+		"kolkte",
+		"kollen",
+		"kolom",
+		"kolos",
+		"kolven",
+		"kom",
+		"komaan",
+		"komaf",
+		"komeet",
+		"komen",
+		"komend",
+		"komiek",
+		"komijn",
+		"komma",
+		"kommen",
+		"kommer",
+		"kompas",
+		"kompel",
+		"komst",
+		"komt",
+		"kond",
+		"konen",
+		"kongsi",
+		"konijn",
+		"koning",
+		"konkel",
+		"kont",
+		"konten",
+		"kontje",
+		"koof",
+		"koog",
+		"kooi",
+		"kooide",
+		"kooien",
+		"kook",
+		"kookte",
+		"kool",
+		"koon",
+		"koop",
+		"koopje",
+		"koor",
+		"koord",
+		"koorde",
+		"koorts",
+		"koos",
+		"koosde",
+		"koot",
+		"kootje",
+		"kootte",
+		"kop",
+		"kopal",
+		"kopbal",
+		"kopeke",
+		"kopen",
+		"koper",
+		"kopers",
+		"kopie",
+		"kopij",
+		"kopje",
+		"kopjes",
+		"kopman",
+		"koppel",
+		"koppen",
+		"koppig",
+		"kopra",
+		"kops",
+		"kopse",
+		"kopte",
+		"kor",
+		"koraal",
+		"koran",
+		"korde",
+		"kordon",
+		"koren",
+		"korf",
+		"korfde",
+		"korist",
+		"kornak",
+		"kornet",
+		"kornis",
+		"korps",
+		"korre",
+		"korrel",
+		"korren",
+		"korset",
+		"korst",
+		"kort",
+		"kortaf",
+		"korte",
+		"korten",
+		"korter",
+		"kortom",
+		"kortte",
+		"korund",
+		"korven",
+		"korvet",
+		"kosjer",
+		"kosmos",
+		"kossem",
+		"kost",
+		"kosten",
+		"koster",
+		"kostte",
+		"kot",
+		"koten",
+		"koter",
+		"koters",
+		"kots",
+		"kotsen",
+		"kotste",
+		"kotten",
+		"kotter",
+		"kou",
+		"koud",
+		"koude",
+		"kouder",
+		"kous",
+		"kousen",
+		"kousje",
+		"kout",
+		"kouten",
+		"kouter",
+		"koutte",
+		"kovel",
+		"kovels",
+		"koven",
+		"kozak",
+		"kozen",
+		"kozijn",
+		"kp",
+		"kq",
+		"kr",
+		"kraag",
+		"kraai",
+		"kraak",
+		"kraal",
+		"kraam",
+		"kraan",
+		"krab",
+		"krabbe",
+		"krabde",
+		"krach",
+		"kracht",
+		"kragen",
+		"krak",
+		"kraken",
+		"kraker",
+		"krakte",
+		"kralen",
+		"kram",
+		"kramde",
+		"kramen",
+		"kramer",
+		"kramp",
+		"kranen",
+		"kranig",
+		"krank",
+		"kranke",
+		"krans",
+		"krant",
+		"krap",
+		"krappe",
+		"krapte",
+		"kras",
+		"krasse",
+		"kraste",
+		"krat",
+		"krater",
+		"kraton",
+		"krats",
+		"krauw",
+		"kreeft",
+		"kreeg",
+		"kreek",
+		"kreet",
+		"kregel",
+		"krek",
+		"krekel",
+		"kreken",
+		"kreng",
+		"krent",
+		"krepte",
+		"kresen",
+		"kreten",
+		"kreuk",
+		"krevel",
+		"kribbe",
+		"kribde",
+		"kribje",
+		"kriek",
+		"kriel",
+		"krijg",
+		"krijn",
+		"krijs",
+		"krijt",
+		"krik",
+		"krikte",
+		"krill",
+		"krimi",
+		"krimp",
+		"kring",
+		"krip",
+		"kris",
+		"kriste",
+		"krocht",
+		"kroeg",
+		"kroep",
+		"kroes",
+		"kroeze",
+		"kroket",
+		"krokus",
+		"krol",
+		"krols",
+		"krolse",
+		"krom",
+		"kromde",
+		"kromme",
+		"kromp",
+		"kromte",
+		"kronen",
+		"kroon",
+		"kroop",
+		"kroos",
+		"kroost",
+		"kroot",
+		"krop",
+		"kropte",
+		"krot",
+		"kroten",
+		"krozen",
+		"kruid",
+		"kruide",
+		"kruien",
+		"kruier",
+		"kruik",
+		"kruim",
+		"kruin",
+		"kruis",
+		"kruit",
+		"kruk",
+		"krukas",
+		"krukte",
+		"krul",
+		"krulde",
+		"ks",
+		"kt",
+		"ku",
+		"kubiek",
+		"kubist",
+		"kubus",
+		"kuch",
+		"kuchen",
+		"kuchte",
+		"kudde",
+		"kudden",
+		"kuddes",
+		"kuier",
+		"kuif",
+		"kuifde",
+		"kuiken",
+		"kuil",
+		"kuilde",
+		"kuilen",
+		"kuiler",
+		"kuip",
+		"kuipen",
+		"kuiper",
+		"kuipte",
+		"kuis",
+		"kuise",
+		"kuisen",
+		"kuiser",
+		"kuiste",
+		"kuit",
+		"kuiten",
+		"kuiter",
+		"kuiven",
+		"kuizen",
+		"kul",
+		"kulas",
+		"kulde",
+		"kullen",
+		"kummel",
+		"kunde",
+		"kundig",
+		"kungfu",
+		"kunne",
+		"kunnen",
+		"kunst",
+		"kär",
+		"kuras",
+		"kuren",
+		"kurk",
+		"kurken",
+		"kurkte",
+		"kus",
+		"kussen",
+		"kust",
+		"kuste",
+		"kusten",
+		"kut",
+		"kutten",
+		"kuub",
+		"kuur",
+		"kuurde",
+		"kv",
+		"kw",
+		"kwaad",
+		"kwaaie",
+		"kwaal",
+		"kwab",
+		"kwade",
+		"kwaden",
+		"kwader",
+		"kwak",
+		"kwaken",
+		"kwakte",
+		"kwal",
+		"kwalen",
+		"kwam",
+		"kwant",
+		"kwanta",
+		"kwark",
+		"kwart",
+		"kwarto",
+		"kwarts",
+		"kwast",
+		"kwee",
+		"kweeën",
+		"kweek",
+		"kween",
+		"kwek",
+		"kweken",
+		"kweker",
+		"kwekte",
+		"kwel",
+		"kwelde",
+		"kwelen",
+		"kwenen",
+		"kwets",
+		"kwezel",
+		"kwibus",
+		"kwiek",
+		"kwieke",
+		"kwijl",
+		"kwijt",
+		"kwik",
+		"kwint",
+		"kx",
+		"ky",
+		"kz",
+		"l",
+		"laadde",
+		"laaf",
+		"laafde",
+		"laag",
+		"laagje",
+		"laagte",
+		"laaide",
+		"laaie",
+		"laaien",
+		"laakte",
+		"laan",
+		"laar",
+		"laars",
+		"laat",
+		"laatje",
+		"laatst",
+		"lab",
+		"label",
+		"labels",
+		"labeur",
+		"labiel",
+		"labo",
+		"lach",
+		"lachen",
+		"lacher",
+		"lachte",
+		"lacune",
+		"ladder",
+		"lade",
+		"laden",
+		"lader",
+		"laders",
+		"lades",
+		"lading",
+		"lady",
+		"laesie",
+		"laf",
+		"lafbek",
+		"laffe",
+		"laffer",
+		"lag",
+		"lage",
+		"lagen",
+		"lager",
+		"lagune",
+		"lak",
+		"lakei",
+		"laken",
+		"lakens",
+		"lakken",
+		"lakooi",
+		"laks",
+		"lakse",
+		"lakser",
+		"lakte",
+		"lala",
+		"lalde",
+		"lallen",
+		"lam",
+		"lama",
+		"lama's",
+		"lamŽ",
+		"lamel",
+		"lamfer",
+		"lamme",
+		"lammen",
+		"lammer",
+		"lammig",
+		"lamoen",
+		"lamp",
+		"lampen",
+		"lamzak",
+		"lancet",
+		"land",
+		"landde",
+		"lande",
+		"landen",
+		"landje",
+		"lanen",
+		"lang",
+		"langde",
+		"lange",
+		"langen",
+		"langer",
+		"langs",
+		"lans",
+		"lansen",
+		"Lap",
+		"Lappen",
+		"Laps",
+		"lapsus",
+		"lapte",
+		"laptop",
+		"laqué",
+		"laren",
+		"larf",
+		"largo",
+		"larie",
+		"lariks",
+		"larve",
+		"larven",
+		"larynx",
+		"las",
+		"laser",
+		"lasers",
+		"lassen",
+		"lasser",
+		"lasso",
+		"last",
+		"laste",
+		"lasten",
+		"laster",
+		"lastig",
+		"lat",
+		"late",
+		"latei",
+		"laten",
+		"latent",
+		"later",
+		"latere",
+		"latex",
+		"Latijn",
+		"latte",
+		"latten",
+		"latuw",
+		"lauden",
+		"lauw",
+		"lauwe",
+		"lauwer",
+		"lava",
+		"lavabo",
+		"lavas",
+		"laven",
+		"lavet",
+		"laving",
+		"lawaai",
+		"lawine",
+		"laxans",
+		"lazer",
+		"lazuur",
+		"lb",
+		"lc",
+		"ld",
+		"le",
+		"league",
+		"lease",
+		"leasen",
+		"leb",
+		"lebaal",
+		"lebbe",
+		"lebben",
+		"lebbig",
+		"lector",
+		"led",
+		"lede",
+		"leden",
+		"leder",
+		"ledig",
+		"ledige",
+		"leed",
+		"leefde",
+		"leeg",
+		"leegde",
+		"leegte",
+		"leek",
+		"leekte",
+		"leem",
+		"leeman",
+		"leemde",
+		"leemte",
+		"leen",
+		"leende",
+		"leep",
+		"leer",
+		"leerde",
+		"leest",
+		"leeuw",
+		"lef",
+		"leg",
+		"legaal",
+		"legaat",
+		"legale",
+		"legato",
+		"legde",
+		"lege",
+		"legen",
+		"leger",
+		"legers",
+		"leges",
+		"leggen",
+		"legger",
+		"leghen",
+		"legio",
+		"lego",
+		"legsel",
+		"lei",
+		"leidde",
+		"leiden",
+		"leider",
+		"leien",
+		"leis",
+		"leisel",
+		"leitje",
+		"leizen",
+		"lek",
+		"lekbak",
+		"leken",
+		"lekgat",
+		"lekke",
+		"lekken",
+		"lekker",
+		"lekte",
+		"lel",
+		"lelde",
+		"lelie",
+		"leliën",
+		"lelies",
+		"lelijk",
+		"lellen",
+		"lemen",
+		"lemma",
+		"lemmer",
+		"lemmet",
+		"lende",
+		"lenden",
+		"lenen",
+		"lener",
+		"leners",
+		"leng",
+		"lengde",
+		"lengen",
+		"lengte",
+		"lenig",
+		"lenige",
+		"lening",
+		"lens",
+		"lensde",
+		"lente",
+		"lentes",
+		"lento",
+		"lenze",
+		"lenzen",
+		"lepe",
+		"lepel",
+		"lepels",
+		"leper",
+		"leperd",
+		"leppen",
+		"lepra",
+		"lepte",
+		"lepton",
+		"leraar",
+		"leren",
+		"lering",
+		"les",
+		"lesbo",
+		"lessen",
+		"lest",
+		"leste",
+		"lesuur",
+		"Let",
+		"letaal",
+		"letale",
+		"letsel",
+		"lette",
+		"Letten",
+		"letter",
+		"leugen",
+		"leuk",
+		"leuke",
+		"leuker",
+		"leunde",
+		"leunen",
+		"leur",
+		"leurde",
+		"leuren",
+		"leus",
+		"leute",
+		"leuter",
+		"leutig",
+		"leuze",
+		"leuzen",
+		"Levant",
+		"leven",
+		"levend",
+		"levens",
+		"lever",
+		"levers",
+		"leviet",
+		"lexica",
+		"lezen",
+		"lezer",
+		"lezers",
+		"lezing",
+		"lf",
+		"lg",
+		"lh",
+		"li",
+		"liaan",
+		"liane",
+		"lianen",
+		"Lias",
+		"libel",
+		"libero",
+		"libido",
+		"libris",
+		"licht",
+		"lichte",
+		"lictor",
+		"lid",
+		"lidje",
+		"lidjes",
+		"lied",
+		"lieden",
+		"liedje",
+		"lief",
+		"liefde",
+		"liefje",
+		"liefst",
+		"liegen",
+		"liep",
+		"lier",
+		"lieren",
+		"liëren",
+		"lies",
+		"liet",
+		"lieve",
+		"lieven",
+		"liever",
+		"lievig",
+		"liezen",
+		"lift",
+		"liften",
+		"lifter",
+		"liftte",
+		"liga",
+		"ligbad",
+		"ligdag",
+		"liggen",
+		"ligger",
+		"lij",
+		"lijden",
+		"lijder",
+		"lijf",
+		"lijfde",
+		"lijfje",
+		"lijk",
+		"lijken",
+		"lijkte",
+		"lijkwa",
+		"lijm",
+		"lijmde",
+		"lijmen",
+		"lijmer",
+		"lijmig",
+		"lijn",
+		"lijnde",
+		"lijnen",
+		"lijs",
+		"lijst",
+		"lijve",
+		"lijven",
+		"lijvig",
+		"lijzen",
+		"lijzig",
+		"lijzij",
+		"lik",
+		"likeur",
+		"likken",
+		"likker",
+		"likte",
+		"lil",
+		"lila",
+		"lilde",
+		"lillen",
+		"liman",
+		"limans",
+		"limbo",
+		"limbus",
+		"limiet",
+		"limit",
+		"limoen",
+		"linde",
+		"linden",
+		"linea",
+		"linie",
+		"linies",
+		"link",
+		"linke",
+		"linken",
+		"linker",
+		"links",
+		"linkse",
+		"linnen",
+		"lino",
+		"lint",
+		"linten",
+		"lintje",
+		"linze",
+		"linzen",
+		"lip",
+		"lipje",
+		"lipjes",
+		"liplap",
+		"lippen",
+		"lipte",
+		"lipvis",
+		"lira",
+		"lire",
+		"lires",
+		"lis",
+		"lissen",
+		"list",
+		"listen",
+		"listig",
+		"liter",
+		"liters",
+		"litho",
+		"liturg",
+		"live",
+		"living",
+		"livrei",
+		"lj",
+		"lk",
+		"ll",
+		"lll",
+		"llll",
+		"lm",
+		"lmn",
+		"ln",
+		"lo",
+		"lob",
+		"lobben",
+		"lobbes",
+		"lobbig",
+		"lobby",
+		"loboor",
+		"loc",
+		"locale",
+		"locker",
+		"loco",
+		"lodder",
+		"loden",
+		"lodens",
+		"loding",
+		"loeder",
+		"loef",
+		"loefde",
+		"loeide",
+		"loeien",
+		"loens",
+		"loense",
+		"loep",
+		"loepen",
+		"loer",
+		"loerde",
+		"loeren",
+		"loeres",
+		"loeris",
+		"loet",
+		"loeten",
+		"loeven",
+		"lof",
+		"log",
+		"logde",
+		"loge",
+		"logé",
+		"logee",
+		"logees",
+		"logen",
+		"loges",
+		"logés",
+		"logge",
+		"loggen",
+		"logger",
+		"loggia",
+		"logica",
+		"logies",
+		"logo",
+		"logo's",
+		"loipe",
+		"lok",
+		"lokaal",
+		"lokaas",
+		"lokale",
+		"loket",
+		"lokken",
+		"lokkig",
+		"lokte",
+		"lol",
+		"lolde",
+		"lolita",
+		"lollen",
+		"lollig",
+		"lolly",
+		"lom",
+		"lombok",
+		"lome",
+		"lomer",
+		"lomig",
+		"lommen",
+		"lommer",
+		"lomp",
+		"lompe",
+		"lompen",
+		"lonen",
+		"long",
+		"longen",
+		"lonk",
+		"lonken",
+		"lonkte",
+		"lont",
+		"lonten",
+		"lood",
+		"loodde",
+		"loodje",
+		"loods",
+		"loof",
+		"loofde",
+		"loog",
+		"loogde",
+		"looi",
+		"looide",
+		"looien",
+		"looier",
+		"look",
+		"loom",
+		"loon",
+		"loonde",
+		"loop",
+		"loopje",
+		"loops",
+		"loopse",
+		"loos",
+		"loosde",
+		"loot",
+		"lootje",
+		"lootte",
+		"lopen",
+		"lopend",
+		"loper",
+		"lopers",
+		"lor",
+		"lord",
+		"lorde",
+		"lork",
+		"lorken",
+		"lorre",
+		"lorren",
+		"lorres",
+		"lorrie",
+		"lorrig",
+		"lorum",
+		"los",
+		"losbol",
+		"losdag",
+		"losjes",
+		"loss",
+		"löss",
+		"losse",
+		"lossen",
+		"losser",
+		"loste",
+		"losweg",
+		"lot",
+		"loten",
+		"loting",
+		"lotion",
+		"lotje",
+		"lotto",
+		"lotus",
+		"louche",
+		"lounge",
+		"louter",
+		"louw",
+		"louwen",
+		"loven",
+		"lover",
+		"loyaal",
+		"loyale",
+		"loze",
+		"lozen",
+		"lozer",
+		"lozing",
+		"lp",
+		"lq",
+		"lr",
+		"ls",
+		"lt",
+		"lu",
+		"lubben",
+		"lubde",
+		"lucht",
+		"lucide",
+		"ludiek",
+		"lues",
+		"lui",
+		"luid",
+		"luidde",
+		"luide",
+		"luiden",
+		"luider",
+		"luidop",
+		"luien",
+		"luier",
+		"luiers",
+		"luifel",
+		"Luik",
+		"luiken",
+		"luilak",
+		"luim",
+		"luimde",
+		"luimen",
+		"luimig",
+		"luis",
+		"luisde",
+		"luit",
+		"luiten",
+		"luizen",
+		"luizig",
+		"luk",
+		"lukken",
+		"lukte",
+		"lul",
+		"lulde",
+		"lullen",
+		"lullig",
+		"lummel",
+		"lunair",
+		"lunch",
+		"lunet",
+		"luns",
+		"lunsde",
+		"lunzen",
+		"lupine",
+		"lupus",
+		"luren",
+		"lurken",
+		"lurkte",
+		"lurven",
+		"lus",
+		"lussen",
+		"lust",
+		"lusten",
+		"luster",
+		"lustig",
+		"lustra",
+		"lustre",
+		"lustte",
+		"lutje",
+		"lutjes",
+		"luttel",
+		"luw",
+		"luwde",
+		"luwe",
+		"luwen",
+		"luwte",
+		"lux",
+		"luxe",
+		"lv",
+		"lw",
+		"lx",
+		"ly",
+		"lycea",
+		"lyceum",
+		"lychee",
+		"lycra",
+		"lymfe",
+		"lynx",
+		"lynxen",
+		"lyriek",
+		"lysine",
+		"lysol",
+		"lz",
+		"m",
+		"maag",
+		"maagd",
+		"maaide",
+		"maaien",
+		"maaier",
+		"maak",
+		"maakte",
+		"maal",
+		"maalde",
+		"maan",
+		"maand",
+		"maande",
+		"maar",
+		"maart",
+		"maarte",
+		"maarts",
+		"maas",
+		"maasde",
+		"maat",
+		"maatje",
+		"mach",
+		"macho",
+		"macht",
+		"macro",
+		"madam",
+		"madame",
+		"madams",
+		"made",
+		"maden",
+		"madera",
+		"madras",
+		"maf",
+		"maffe",
+		"maffen",
+		"maffer",
+		"maffia",
+		"mafte",
+		"magen",
+		"mager",
+		"magere",
+		"maggi",
+		"magie",
+		"magiër",
+		"magma",
+		"magnum",
+		"Mahdi",
+		"mail",
+		"mailen",
+		"maïs",
+		"maître",
+		"majeur",
+		"majoor",
+		"major",
+		"majors",
+		"mak",
+		"maken",
+		"maker",
+		"makers",
+		"makke",
+		"makker",
+		"makron",
+		"mal",
+		"malaga",
+		"malde",
+		"Maleis",
+		"malen",
+		"maler",
+		"malers",
+		"malie",
+		"maliën",
+		"malies",
+		"maling",
+		"malle",
+		"mallen",
+		"maller",
+		"mals",
+		"malse",
+		"malser",
+		"malta",
+		"malus",
+		"maluwe",
+		"malve",
+		"malven",
+		"mam",
+		"mama",
+		"mama's",
+		"mamma",
+		"mammen",
+		"mammon",
+		"mams",
+		"man",
+		"manche",
+		"manco",
+		"mand",
+		"mande",
+		"manden",
+		"manege",
+		"manen",
+		"maner",
+		"maners",
+		"manga",
+		"mangat",
+		"mangel",
+		"mango",
+		"maniak",
+		"manie",
+		"manier",
+		"manies",
+		"maniok",
+		"mank",
+		"manke",
+		"manken",
+		"mankte",
+		"manna",
+		"mannen",
+		"mannin",
+		"manou",
+		"mans",
+		"mantel",
+		"mantra",
+		"manuur",
+		"maoïst",
+		"map",
+		"mappen",
+		"marde",
+		"mare",
+		"maren",
+		"marge",
+		"marges",
+		"Maria",
+		"marine",
+		"mark",
+		"marken",
+		"marker",
+		"markt",
+		"marlde",
+		"marlen",
+		"marmer",
+		"marmot",
+		"marot",
+		"marqué",
+		"marren",
+		"marron",
+		"mars",
+		"marsen",
+		"marter",
+		"maseur",
+		"masker",
+		"massa",
+		"mast",
+		"mastel",
+		"masten",
+		"mastte",
+		"mat",
+		"match",
+		"mate",
+		"maté",
+		"maten",
+		"mater",
+		"maters",
+		"matig",
+		"matige",
+		"matje",
+		"matjes",
+		"matrak",
+		"matras",
+		"matrix",
+		"matse",
+		"matsen",
+		"matses",
+		"matste",
+		"matte",
+		"matten",
+		"matter",
+		"mauser",
+		"mauve",
+		"mauwde",
+		"mauwen",
+		"maxi",
+		"maxima",
+		"maxime",
+		"maya",
+		"mazen",
+		"mazzel",
+		"mb",
+		"mc",
+		"md",
+		"me",
+		"mede",
+		"media",
+		"medici",
+		"medina",
+		"medio",
+		"medium",
+		"medley",
+		"medoc",
+		"medusa",
+		"mee",
+		"meel",
+		"meelde",
+		"meelij",
+		"meende",
+		"meent",
+		"meer",
+		"ME'er",
+		"meerde",
+		"meers",
+		"mees",
+		"meest",
+		"meeste",
+		"meet",
+		"meeuw",
+		"mf",
+		"mg",
+		"mh",
+		"mi",
+		"mj",
+		"mk",
+		"ml",
+		"mm",
+		"mmm",
+		"mmmm",
+		"mn",
+		"mno",
+		"mo",
+		"mp",
+		"mq",
+		"mr",
+		"ms",
+		"mt",
+		"mu",
+		"mv",
+		"mw",
+		"mx",
+		"my",
+		"mz",
+		"n",
+		"nb",
+		"nc",
+		"nd",
+		"ne",
+		"nf",
+		"ng",
+		"nh",
+		"ni",
+		"nj",
+		"nk",
+		"nl",
+		"nm",
+		"nn",
+		"nnn",
+		"nnnn",
+		"no",
+		"nop",
+		"np",
+		"nq",
+		"nr",
+		"ns",
+		"nt",
+		"nu",
+		"nv",
+		"nw",
+		"nx",
+		"ny",
+		"nz",
+		"o",
+		"ob",
+		"oc",
+		"od",
+		"oe",
+		"of",
+		"og",
+		"oh",
+		"oi",
+		"oj",
+		"ok",
+		"ol",
+		"om",
+		"on",
+		"oo",
+		"ooo",
+		"oooo",
+		"op",
+		"opq",
+		"oq",
+		"or",
+		"os",
+		"ot",
+		"ou",
+		"ov",
+		"ow",
+		"ox",
+		"oy",
+		"oz",
+		"p",
+		"pb",
+		"pc",
+		"pd",
+		"pe",
+		"pf",
+		"pg",
+		"ph",
+		"pi",
+		"pj",
+		"pk",
+		"pl",
+		"pm",
+		"pn",
+		"po",
+		"pp",
+		"ppp",
+		"pppp",
+		"pq",
+		"pqr",
+		"pr",
+		"ps",
+		"pt",
+		"pu",
+		"pv",
+		"pw",
+		"px",
+		"py",
+		"pz",
+		"q",
+		"qb",
+		"qc",
+		"qd",
+		"qe",
+		"qf",
+		"qg",
+		"qh",
+		"qi",
+		"qj",
+		"qk",
+		"ql",
+		"qm",
+		"qn",
+		"qo",
+		"qp",
+		"qq",
+		"qqq",
+		"qqqq",
+		"qr",
+		"qrs",
+		"qs",
+		"qt",
+		"qu",
+		"qv",
+		"qw",
+		"qx",
+		"qy",
+		"qz",
+		"r",
+		"rb",
+		"rc",
+		"rd",
+		"re",
+		"rf",
+		"rg",
+		"rh",
+		"ri",
+		"rj",
+		"rk",
+		"rl",
+		"rm",
+		"rn",
+		"ro",
+		"rp",
+		"rq",
+		"rr",
+		"rrr",
+		"rrrr",
+		"rs",
+		"rst",
+		"rt",
+		"ru",
+		"rv",
+		"rw",
+		"rx",
+		"ry",
+		"rz",
+		"s",
+		"sb",
+		"sc",
+		"sd",
+		"se",
+		"sf",
+		"sg",
+		"sh",
+		"si",
+		"sj",
+		"sk",
+		"sl",
+		"sm",
+		"sn",
+		"so",
+		"sp",
+		"sq",
+		"sr",
+		"ss",
+		"sss",
+		"ssss",
+		"st",
+		"stu",
+		"su",
+		"sv",
+		"sw",
+		"sx",
+		"sy",
+		"sz",
+		"t",
+		"tb",
+		"tc",
+		"td",
+		"te",
+		"tf",
+		"tg",
+		"th",
+		"ti",
+		"tj",
+		"tk",
+		"tl",
+		"tm",
+		"tn",
+		"to",
+		"tp",
+		"tq",
+		"tr",
+		"ts",
+		"tt",
+		"ttt",
+		"tttt",
+		"tu",
+		"tuv",
+		"tv",
+		"tw",
+		"tx",
+		"ty",
+		"tz",
+		"u",
+		"ub",
+		"uc",
+		"ud",
+		"ue",
+		"uf",
+		"ug",
+		"uh",
+		"ui",
+		"uj",
+		"uk",
+		"ul",
+		"um",
+		"un",
+		"uo",
+		"up",
+		"uq",
+		"ur",
+		"us",
+		"ut",
+		"uu",
+		"uuu",
+		"uuuu",
+		"uv",
+		"uvw",
+		"uw",
+		"ux",
+		"uy",
+		"uz",
+		"v",
+		"vb",
+		"vc",
+		"vd",
+		"ve",
+		"vf",
+		"vg",
+		"vh",
+		"vi",
+		"vj",
+		"vk",
+		"vl",
+		"vm",
+		"vn",
+		"vo",
+		"vp",
+		"vq",
+		"vr",
+		"vs",
+		"vt",
+		"vu",
+		"vv",
+		"vvv",
+		"vvvv",
+		"vw",
+		"vwx",
+		"vx",
+		"vy",
+		"vz",
+		"w",
+		"wb",
+		"wc",
+		"wd",
+		"we",
+		"wf",
+		"wg",
+		"wh",
+		"wi",
+		"wj",
+		"wk",
+		"wl",
+		"wm",
+		"wn",
+		"wo",
+		"wp",
+		"wq",
+		"wr",
+		"ws",
+		"wt",
+		"wu",
+		"wv",
+		"ww",
+		"www",
+		"wwww",
+		"wx",
+		"wxy",
+	}
+};
+
+wordlist_t wordlist_base16 = {
+	.elt.key = "",
+	.family = "base16",
+	.max_word_length = 1,
+	.min_word_length = 1,
+	.words = (char *[]){
+		"0",
+		"1",
+		"2",
+		"3",
+		"4",
+		"5",
+		"6",
+		"7",
+		"8",
+		"9",
+		"a",
+		"b",
+		"c",
+		"d",
+		"e",
+		"f",
+	}
+};
+
+wordlist_t wordlist_base58 = {
+	.elt.key = "",
+	.family = "base58",
+	.max_word_length = 1,
+	.min_word_length = 1,
+	.words = (char *[]){
+		"1",
+		"2",
+		"3",
+		"4",
+		"5",
+		"6",
+		"7",
+		"8",
+		"9",
+		"A",
+		"B",
+		"C",
+		"D",
+		"E",
+		"F",
+		"G",
+		"H",
+		"J",
+		"K",
+		"L",
+		"M",
+		"N",
+		"P",
+		"Q",
+		"R",
+		"S",
+		"T",
+		"U",
+		"V",
+		"W",
+		"X",
+		"Y",
+		"Z",
+		"a",
+		"b",
+		"c",
+		"d",
+		"e",
+		"f",
+		"g",
+		"h",
+		"i",
+		"j",
+		"k",
+		"m",
+		"n",
+		"o",
+		"p",
+		"q",
+		"r",
+		"s",
+		"t",
+		"u",
+		"v",
+		"w",
+		"x",
+		"y",
+		"z",
+	}
+};
+void wordlists_init() {
+	codec_t *c;
+	fixnum_multiplier16_init(&wordlist_slip0039.m, 1024);
+	if ((c = codec_find("slip0039"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_slip0039); else FATAL("codec slip0039 not found");
+	fixnum_multiplier16_init(&wordlist_bip39_english.m, 2048);
+	if ((c = codec_find("bip39"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_bip39_english); else FATAL("codec bip39 not found");
+	fixnum_multiplier16_init(&wordlist_bip39_spanish.m, 2048);
+	if ((c = codec_find("bip39"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_bip39_spanish); else FATAL("codec bip39 not found");
+	fixnum_multiplier16_init(&wordlist_diceware_english.m, 7776);
+	if ((c = codec_find("diceware"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_diceware_english); else FATAL("codec diceware not found");
+	fixnum_multiplier16_init(&wordlist_diceware_german.m, 7776);
+	if ((c = codec_find("diceware"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_diceware_german); else FATAL("codec diceware not found");
+	fixnum_multiplier16_init(&wordlist_diceware_dutch.m, 7776);
+	if ((c = codec_find("diceware"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_diceware_dutch); else FATAL("codec diceware not found");
+	fixnum_multiplier16_init(&wordlist_base16.m, 16);
+	if ((c = codec_find("base16"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_base16); else FATAL("codec base16 not found");
+	fixnum_multiplier16_init(&wordlist_base58.m, 58);
+	if ((c = codec_find("base58"))) shashtbl_add_elt(&c->wordlists,
+			&wordlist_base58); else FATAL("codec base58 not found");
+}
+